@@ -126,6 +126,10 @@ private:
   GravityForce,             /*!< \brief Flag to know if the gravity force is incuded in the formulation. */
   SmoothNumGrid,            /*!< \brief Smooth the numerical grid. */
   AdaptBoundary,            /*!< \brief Adapt the elements on the boundary. */
+  AdaptDistributed,         /*!< \brief Adapt the partitioned grid in parallel. */
+  Geometry_Cache,           /*!< \brief Store and reuse the points and elements of each rank (partition cache). */
+  Fluid_Table,              /*!< \brief Tabulate the thermodynamic state of the fluid model. */
+  Fluid_Table_Read,         /*!< \brief Read the fluid table from a file instead of generating it. */
   SubsonicEngine,           /*!< \brief Engine intake subsonic region. */
   Frozen_Visc_Cont,         /*!< \brief Flag for cont. adjoint problem with/without frozen viscosity. */
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
@@ -160,6 +164,8 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  unsigned long Fluid_Table_nDensity, /*!< \brief Number of density nodes of the fluid table. */
+  Fluid_Table_nEnergy;               /*!< \brief Number of energy nodes of the fluid table. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   unsigned short Kind_Regime;        /*!< \brief Kind of adjoint function. */
@@ -442,6 +448,8 @@ private:
   string *TagFFDBox;                  /*!< \brief Tag of the FFD box. */
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
+  bool MG_LineAgglomeration;          /*!< \brief Agglomerate the stretched cells along lines normal to the walls. */
+  unsigned short MG_LineCoarsening;   /*!< \brief Number of line points merged into each coarse control volume. */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
@@ -524,6 +532,7 @@ private:
   Kind_CHT_Coupling;            /*!< \brief Kind of coupling method used at CHT interfaces. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
+  bool FusedGradientLimiter;    /*!< \brief Compute the flow gradients and limiters in one pass over the grid. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
   bool MUSCL,              /*!< \brief MUSCL scheme .*/
@@ -567,6 +576,9 @@ private:
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Coupled_Turb_Solve;                       /*!< \brief Solve the mean flow and turbulence equations as one linear system. */
+  su2double *Linear_Solver_Prec_Reuse_Flow;      /*!< \brief Reuse of the preconditioner across iterations of the flow solver. */
+  su2double *Linear_Solver_Prec_Reuse_Turb;      /*!< \brief Reuse of the preconditioner across iterations of the turbulence solver. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -597,6 +609,11 @@ private:
   Max_Beta_RoeTurkel;               /*!< \brief Maximum value of Beta for the Roe-Turkel low Mach preconditioner. */
   unsigned long GridDef_Nonlinear_Iter;  /*!< \brief Number of nonlinear increments for grid deformation. */
   unsigned short Deform_StiffnessType;   /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  unsigned short Deform_Method;          /*!< \brief Method used to deform the volume mesh (elasticity or RBF). */
+  unsigned short Deform_RBF_Kind;        /*!< \brief Type of radial basis function for the RBF mesh deformation. */
+  su2double Deform_RBF_Radius;           /*!< \brief Radius of the basis functions for the RBF mesh deformation. */
+  su2double Deform_RBF_Tol;              /*!< \brief Relative tolerance of the greedy selection of RBF centers. */
+  unsigned long Deform_RBF_MaxCenters;   /*!< \brief Maximum number of RBF centers. */
   bool Deform_Mesh;                      /*!< \brief Determines whether the mesh will be deformed. */
   bool Deform_Output;                    /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor;       /*!< \brief Factor to multiply smallest volume for deform tolerance (0.001 default) */
@@ -746,6 +763,8 @@ private:
   su2double* Mesh_Box_Offset;    /*!< \brief Array containing the offset from 0.0 in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
+  Geometry_Cache_FileName,       /*!< \brief Prefix of the files of the partition cache. */
+  Fluid_Table_FileName,          /*!< \brief Name of the file of the fluid table. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
   Solution_LinFileName,          /*!< \brief Linearized flow solution input file. */
   Solution_AdjFileName,          /*!< \brief Adjoint solution input file for drag functional. */
@@ -809,6 +828,8 @@ private:
   Pressure_Critical,     /*!< \brief Critical Pressure for real fluid model.  */
   Density_Critical,      /*!< \brief Critical Density for real fluid model.  */
   Acentric_Factor,       /*!< \brief Acentric Factor for real fluid model.  */
+  *Fluid_Table_Density,  /*!< \brief Density range of the fluid table.  */
+  *Fluid_Table_Temperature, /*!< \brief Temperature range of the fluid table.  */
   Mu_Constant,           /*!< \brief Constant viscosity for ConstantViscosity model.  */
   Mu_ConstantND,         /*!< \brief Non-dimensional constant viscosity for ConstantViscosity model.  */
   Kt_Constant,           /*!< \brief Constant thermal conductivity for ConstantConductivity model.  */
@@ -1059,6 +1080,7 @@ private:
   default_eng_cyl[7],            /*!< \brief Default engine box array for the COption class. */
   default_eng_val[5],            /*!< \brief Default engine box array values for the COption class. */
   default_cfl_adapt[4],          /*!< \brief Default CFL adapt param array for the COption class. */
+  default_prec_reuse[3],         /*!< \brief Default preconditioner reuse param array for the COption class. */
   default_jst_coeff[2],          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   default_ffd_coeff[3],          /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   default_mixedout_coeff[3],     /*!< \brief Default default mixedout algorithm coefficients for the COption class. */
@@ -1079,7 +1101,9 @@ private:
   default_body_force[3],         /*!< \brief Default body force vector for the COption class. */
   default_nacelle_location[5],   /*!< \brief Location of the nacelle. */
   default_hs_axes[3],            /*!< \brief Default principal axes (x, y, z) of the ellipsoid containing the heat source. */
-  default_hs_center[3];          /*!< \brief Default position of the center of the heat source. */
+  default_hs_center[3],          /*!< \brief Default position of the center of the heat source. */
+  default_fluid_table_density[2],     /*!< \brief Default density range of the fluid table (derived from the free-stream). */
+  default_fluid_table_temperature[2]; /*!< \brief Default temperature range of the fluid table (derived from the free-stream). */
 
   unsigned short Riemann_Solver_FEM;         /*!< \brief Riemann solver chosen for the DG method. */
   su2double Quadrature_Factor_Straight;      /*!< \brief Factor applied during quadrature of elements with a constant Jacobian. */
@@ -1110,6 +1134,18 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  unsigned short Kind_Output_Compression; /*!< \brief Compression of the binary restart and Paraview XML data. */
+  string *Output_Lossy_Fields;            /*!< \brief Visualization-only fields that may be quantized. */
+  unsigned short nOutput_Lossy_Fields;    /*!< \brief Number of fields that may be quantized. */
+  su2double Output_Lossy_Tolerance;       /*!< \brief Absolute error bound of the quantized fields. */
+  string *InSitu_Fields;                  /*!< \brief Volume output fields reduced during the run. */
+  unsigned short nInSitu_Fields;          /*!< \brief Number of fields reduced during the run. */
+  bool InSitu_Statistics;                 /*!< \brief Running mean and variance of the reduced fields. */
+  su2double *InSitu_Probes;               /*!< \brief Coordinates of the probes. */
+  unsigned short nInSitu_Probes;          /*!< \brief Number of probe coordinates. */
+  su2double *InSitu_Slices;               /*!< \brief Origin and normal of the slice planes. */
+  unsigned short nInSitu_Slices;          /*!< \brief Number of slice plane values. */
+  unsigned long InSitu_Slice_Freq;        /*!< \brief Writing frequency of the slices (time iterations). */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -2633,6 +2669,18 @@ public:
    */
   unsigned short GetMGCycle(void) const { return MGCycle; }
 
+  /*!
+   * \brief Check if the multigrid agglomeration follows the lines normal to the walls.
+   * \return <code>TRUE</code> if the stretched cells are semi-coarsened along lines.
+   */
+  bool GetMG_LineAgglomeration(void) const { return MG_LineAgglomeration; }
+
+  /*!
+   * \brief Get the semi-coarsening ratio of the line agglomeration.
+   * \return Number of line points merged into each coarse control volume.
+   */
+  unsigned short GetMG_LineCoarsening(void) const { return MG_LineCoarsening; }
+
   /*!
    * \brief Get the king of evaluation in the geometrical module.
    * \return 0 or 1 depending of we are dealing with a V or W cycle.
@@ -3736,6 +3784,46 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Check if the thermodynamic state of the fluid model is tabulated.
+   * \return <code>TRUE</code> if the fluid model is replaced by a look-up table of it.
+   */
+  bool GetFluid_Table(void) const { return Fluid_Table; }
+
+  /*!
+   * \brief Check if the fluid table is read from a file.
+   * \return <code>TRUE</code> if the table is read, otherwise it is generated and written.
+   */
+  bool GetFluid_Table_Read(void) const { return Fluid_Table_Read; }
+
+  /*!
+   * \brief Get the name of the file of the fluid table.
+   * \return Name of the file.
+   */
+  string GetFluid_Table_FileName(void) const { return Fluid_Table_FileName; }
+
+  /*!
+   * \brief Get the density range of the fluid table (0 if derived from the free-stream).
+   * \return Minimum and maximum density.
+   */
+  const su2double* GetFluid_Table_Density(void) const { return Fluid_Table_Density; }
+
+  /*!
+   * \brief Get the temperature range of the fluid table (0 if derived from the free-stream).
+   * \return Minimum and maximum temperature.
+   */
+  const su2double* GetFluid_Table_Temperature(void) const { return Fluid_Table_Temperature; }
+
+  /*!
+   * \brief Get the number of density nodes of the fluid table.
+   */
+  unsigned long GetFluid_Table_nDensity(void) const { return Fluid_Table_nDensity; }
+
+  /*!
+   * \brief Get the number of energy nodes of the fluid table.
+   */
+  unsigned long GetFluid_Table_nEnergy(void) const { return Fluid_Table_nEnergy; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3944,6 +4032,12 @@ public:
    */
   bool GetLeastSquaresRequired(void) const { return LeastSquaresRequired; }
 
+  /*!
+   * \brief Get flag for whether the flow gradients and limiters are computed in one pass over the grid.
+   * \return <code>TRUE</code> means that the fused gradient and limiter computation is used (where supported).
+   */
+  bool GetFusedGradientLimiter(void) const { return FusedGradientLimiter; }
+
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -4011,6 +4105,26 @@ public:
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void) const { return Linear_Solver_Restart_Frequency; }
 
+  /*!
+   * \brief Get whether the mean flow and turbulence increments are obtained from one coupled linear system.
+   * \return <code>TRUE</code> if the block-coupled Jacobian of both solvers is assembled and solved.
+   */
+  bool GetCoupled_Turb_Solve(void) const { return Coupled_Turb_Solve; }
+
+  /*!
+   * \brief Get the parameters of the preconditioner reuse for the flow solver.
+   * \return Maximum number of linear solves with the same preconditioner, and the growth factors of the
+   *         linear iterations and final residual that force a rebuild.
+   */
+  const su2double* GetLinear_Solver_Prec_Reuse_Flow(void) const { return Linear_Solver_Prec_Reuse_Flow; }
+
+  /*!
+   * \brief Get the parameters of the preconditioner reuse for the turbulence solver.
+   * \return Maximum number of linear solves with the same preconditioner, and the growth factors of the
+   *         linear iterations and final residual that force a rebuild.
+   */
+  const su2double* GetLinear_Solver_Prec_Reuse_Turb(void) const { return Linear_Solver_Prec_Reuse_Turb; }
+
   /*!
    * \brief Get the relaxation factor for iterative linear smoothers.
    * \return Relaxation factor.
@@ -4152,6 +4266,31 @@ public:
    */
   su2double GetDeform_StiffLayerSize(void) const { return Deform_StiffLayerSize; }
 
+  /*!
+   * \brief Get the method used to deform the volume mesh.
+   */
+  unsigned short GetDeform_Method(void) const { return Deform_Method; }
+
+  /*!
+   * \brief Get the type of radial basis function for the RBF mesh deformation.
+   */
+  unsigned short GetDeform_RBF_Kind(void) const { return Deform_RBF_Kind; }
+
+  /*!
+   * \brief Get the radius of the basis functions for the RBF mesh deformation (0 for automatic).
+   */
+  su2double GetDeform_RBF_Radius(void) const { return Deform_RBF_Radius; }
+
+  /*!
+   * \brief Get the tolerance of the greedy selection of RBF centers, relative to the maximum boundary displacement.
+   */
+  su2double GetDeform_RBF_Tol(void) const { return Deform_RBF_Tol; }
+
+  /*!
+   * \brief Get the maximum number of RBF centers.
+   */
+  unsigned long GetDeform_RBF_MaxCenters(void) const { return Deform_RBF_MaxCenters; }
+
   /*!
    * \brief Creates a tecplot file to visualize the volume deformation deformation made by the DEF software.
    * \return <code>TRUE</code> if the deformation is going to be plotted; otherwise <code>FALSE</code>.
@@ -5314,6 +5453,18 @@ public:
    */
   string GetMesh_Out_FileName(void) const { return Mesh_Out_FileName; }
 
+  /*!
+   * \brief Get whether the points and elements of each rank are stored on disk and reused by later runs.
+   * \return <code>TRUE</code> if the partition cache is used.
+   */
+  bool GetGeometry_Cache(void) const { return Geometry_Cache; }
+
+  /*!
+   * \brief Get the prefix of the files of the partition cache (the zone and rank are appended).
+   * \return Prefix of the cache files.
+   */
+  string GetGeometry_Cache_FileName(void) const { return Geometry_Cache_FileName; }
+
   /*!
    * \brief Get the name of the file with the solution of the flow problem.
    * \return Name of the file with the solution of the flow problem.
@@ -5484,6 +5635,15 @@ public:
    */
   string GetUnsteady_FileName(string val_filename, int val_iter, string ext) const;
 
+  /*!
+   * \brief Inverse of GetUnsteady_FileName, split a file name (without extension) into the base name and the iteration number.
+   * \param[in] val_filename - Name of the unsteady file.
+   * \param[out] base_filename - Name without the iteration number.
+   * \param[out] val_iter - Iteration number.
+   * \return <TRUE> if the file name ends with an iteration number.
+   */
+  bool SplitUnsteady_FileName(const string& val_filename, string& base_filename, unsigned long& val_iter) const;
+
   /*!
    * \brief Append the input filename string with the appropriate objective function extension.
    * \param[in] val_filename - String value of the base filename.
@@ -5981,6 +6141,12 @@ public:
    */
   bool GetAdaptBoundary(void) const { return AdaptBoundary; }
 
+  /*!
+   * \brief Get information about the parallel adaptation of the partitioned grid.
+   * \return <code>TRUE</code> if each rank adapts its partition of the grid; otherwise <code>FALSE</code>.
+   */
+  bool GetAdapt_Distributed(void) const { return AdaptDistributed; }
+
   /*!
    * \brief Get information about there is a smoothing of the grid coordinates.
    * \return <code>TRUE</code> if there is smoothing of the grid coordinates; otherwise <code>FALSE</code>.
@@ -9326,6 +9492,55 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Get the kind of compression applied to the binary output files.
+   * \return ENUM_OUTPUT_COMPRESSION value.
+   */
+  unsigned short GetKind_Output_Compression() const { return Kind_Output_Compression; }
+
+  /*!
+   * \brief Get the names of the fields that are quantized before compression.
+   */
+  vector<string> GetOutput_Lossy_Fields() const {
+    return vector<string>(Output_Lossy_Fields, Output_Lossy_Fields+nOutput_Lossy_Fields);
+  }
+
+  /*!
+   * \brief Get the absolute error bound of the quantized fields.
+   */
+  su2double GetOutput_Lossy_Tolerance() const { return Output_Lossy_Tolerance; }
+
+  /*!
+   * \brief Get the names of the volume output fields that are reduced in-situ (statistics, probes, slices).
+   */
+  vector<string> GetInSitu_Fields() const {
+    return vector<string>(InSitu_Fields, InSitu_Fields+nInSitu_Fields);
+  }
+
+  /*!
+   * \brief Check if the running mean and variance of the in-situ fields are computed.
+   */
+  bool GetInSitu_Statistics() const { return InSitu_Statistics; }
+
+  /*!
+   * \brief Get the coordinates of the probes (nDim values per probe).
+   */
+  vector<su2double> GetInSitu_Probes() const {
+    return vector<su2double>(InSitu_Probes, InSitu_Probes+nInSitu_Probes);
+  }
+
+  /*!
+   * \brief Get the slice planes (origin followed by normal, 2*nDim values per plane).
+   */
+  vector<su2double> GetInSitu_Slices() const {
+    return vector<su2double>(InSitu_Slices, InSitu_Slices+nInSitu_Slices);
+  }
+
+  /*!
+   * \brief Get the writing frequency of the slices.
+   */
+  unsigned long GetInSitu_Slice_Freq() const { return InSitu_Slice_Freq; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
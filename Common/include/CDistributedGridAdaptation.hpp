@@ -0,0 +1,212 @@
+/*!
+ * \file CDistributedGridAdaptation.hpp
+ * \brief Headers of the grid adaptation of partitioned (distributed) grids.
+ *        The implementations are in the <i>CDistributedGridAdaptation.cpp</i> file.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "grid_adaptation_structure.hpp"
+#include "toolboxes/C2DContainer.hpp"
+
+/*!
+ * \class CDistributedGridAdaptation
+ * \brief Refinement of the partitioned grid, each rank divides the elements it owns.
+ * \details The elements are selected with the indicators of CGridAdaptation, the selection
+ *          is made global (same threshold on all ranks). The edges to split are then agreed
+ *          between the ranks that share them, and closed such that every element can be divided
+ *          with a conforming pattern (triangles: any, quadrilaterals: 1 edge, 2 opposite edges
+ *          or all, tetrahedra: 1 edge, the 3 edges of a face or all). Edges of other elements
+ *          are never split. The new points are placed at the mid point of the edges (and at the
+ *          center of fully divided quadrilaterals), where the solution is interpolated linearly.
+ *          The points, volume and surface elements of the adapted grid are routed to linear
+ *          partitions, from which each rank writes its part of the grid and of the restart file.
+ * \note Elements are owned by the rank that owns their node with lowest global index, edges by
+ *       the rank that owns their node with lowest global index. Periodic grids are not supported.
+ * \note Only refinement is implemented, elements are never merged (no coarsening), and the adapted
+ *       grid is not passed to the solver in memory, SU2_CFD restarts from the files.
+ */
+class CDistributedGridAdaptation : public CGridAdaptation {
+private:
+  /*!
+   * \brief Status of the edges during the selection.
+   */
+  enum : unsigned long {
+    EDGE_KEEP = 0,    /*!< \brief Edge is not split (yet). */
+    EDGE_SPLIT = 1,   /*!< \brief Edge is split. */
+    EDGE_LOCKED = 2   /*!< \brief Edge cannot be split. */
+  };
+
+  unsigned long Global_nPointOld;   /*!< \brief Number of points of the original grid. */
+  unsigned long Global_nPointNew;   /*!< \brief Number of points of the adapted grid. */
+  unsigned long Global_nElemNew;    /*!< \brief Number of elements of the adapted grid. */
+
+  bool Restart_Flow;      /*!< \brief The flow solution is interpolated. */
+  bool Restart_Adjoint;   /*!< \brief The adjoint solution is interpolated. */
+  unsigned short nVarTurb;  /*!< \brief Number of turbulence variables in the flow restart file. */
+
+  su2activematrix TurbVar_Sol;  /*!< \brief Turbulence variables of the original grid. */
+
+  vector<bool> OwnedElem;             /*!< \brief Whether each local element is owned by this rank. */
+  vector<unsigned long> EdgeStatus;   /*!< \brief Status of each local edge. */
+  vector<unsigned long> EdgeNode;     /*!< \brief Global index of the point inserted on each split edge. */
+
+  vector<vector<unsigned long> > HaloRecv;  /*!< \brief Local halo points whose values come from each rank. */
+  vector<vector<unsigned long> > HaloSend;  /*!< \brief Local owned points whose values go to each rank. */
+  vector<vector<unsigned long> > EdgeRecv;  /*!< \brief Local edges owned by each rank, whose status comes from it. */
+  vector<vector<unsigned long> > EdgeSend;  /*!< \brief Local owned edges shared with each rank. */
+
+  vector<vector<passivedouble> > Coord_Linear;  /*!< \brief Coordinates of the adapted grid (linear partition). */
+  su2activematrix Solution_Linear;              /*!< \brief Interpolated solution of the adapted grid (linear partition). */
+  vector<unsigned long> Elem_Owned;             /*!< \brief Elements generated by this rank (SU2 connectivity). */
+  vector<string> Marker_Tags;                   /*!< \brief Tags of the physical markers. */
+  vector<vector<unsigned long> > Bound_Linear;  /*!< \brief Surface elements whose first node is in the linear partition, per marker. */
+
+public:
+  /*!
+   * \brief Constructor of the class, builds the communication patterns of the partitioned grid.
+   * \param[in] geometry - Partitioned geometry, with edges and dual grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CDistributedGridAdaptation(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Read the flow solution, and the turbulence variables (RANS), from the restart file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GetFlowSolution(CGeometry *geometry, CConfig *config) override;
+
+  /*!
+   * \brief Read the residual of the flow equations from the restart file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GetFlowResidual(CGeometry *geometry, CConfig *config) override;
+
+  /*!
+   * \brief Read the adjoint solution from the restart file.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GetAdjSolution(CGeometry *geometry, CConfig *config) override;
+
+  /*!
+   * \brief Select the elements to adapt from the adaptation index, with the same threshold on all ranks.
+   * \note The local maximum is replaced by the global one (a percentage of the global number of elements).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] max_elem - Maximum number of cells being adapted on this rank (not used).
+   */
+  void SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem) override;
+
+  /*!
+   * \brief Divide the selected elements, interpolate the solution, and gather the adapted grid in linear partitions.
+   * \param[in] geometry - Geometrical definition of the problem, with the selected elements.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDistributed_Adaptation(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Write the adapted grid in SU2 format, each rank writes its part in turn.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the grid file.
+   */
+  void WriteAdaptedGrid(CConfig *config, string val_filename) const;
+
+  /*!
+   * \brief Write the ASCII (CSV) restart file of the adapted grid, which SU2_CFD and CGridAdaptation can read.
+   * \note The flow restart includes the turbulence variables of RANS problems.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file (the extension is replaced by ".csv").
+   * \param[in] adjoint - Write the adjoint variables instead of the flow variables.
+   */
+  void WriteAdaptedSolution(CConfig *config, string val_filename, bool adjoint) const;
+
+  /*!
+   * \brief Number of points of the adapted grid.
+   */
+  inline unsigned long GetGlobal_nPointNew() const { return Global_nPointNew; }
+
+  /*!
+   * \brief Number of elements of the adapted grid.
+   */
+  inline unsigned long GetGlobal_nElemNew() const { return Global_nElemNew; }
+
+private:
+  /*!
+   * \brief Sparse all-to-all exchange of per rank buffers.
+   * \param[in] sendBuf - Data sent to each rank.
+   * \param[out] recvBuf - Data received from each rank.
+   * \param[in] type - MPI type of the data.
+   */
+  template<class T>
+  void Exchange(const vector<vector<T> >& sendBuf, vector<vector<T> >& recvBuf, SU2_MPI::Datatype type) const;
+
+  /*!
+   * \brief Read columns of a restart file, each rank parses the rows of its linear partition of the
+   *        original grid and sends them to the ranks that have the points.
+   * \note The rows must be sorted by global index, as in the restart files written by SU2.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_filename - Name of the restart file (ASCII or CSV).
+   * \param[in] firstCol - First column read, counted from the first variable after the coordinates.
+   * \param[in] nCol - Number of columns read.
+   * \return Values of the columns at each local point.
+   */
+  su2activematrix ReadRestartColumns(CGeometry *geometry, const string& val_filename,
+                                     unsigned short firstCol, unsigned short nCol) const;
+
+  /*!
+   * \brief Copy the values of the owned points to the halo points of the other ranks.
+   * \param[in,out] values - Values (one per local point).
+   */
+  void CommunicateHalos(su2double *values) const;
+
+  /*!
+   * \brief Merge the status of the edges shared by several ranks (the highest status wins).
+   * \return True if the status of any edge changed.
+   */
+  bool SynchronizeEdges();
+
+  /*!
+   * \brief One sweep promoting the split edges of the local elements to a supported division pattern,
+   *        or locking the edges of the elements that cannot be divided (the status only increases).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return True if the status of any edge changed.
+   */
+  bool SetEdgeClosure(CGeometry *geometry);
+
+  /*!
+   * \brief Divide an element according to the status of its edges.
+   * \param[in] vtk - Type of element.
+   * \param[in] node - Global index of the nodes of the element.
+   * \param[in] mid - Global index of the points on the edges (-1 if the edge is not split).
+   * \param[in] coord - Coordinates of the nodes followed by those of the new points of the edges.
+   * \param[in] center - Global index of the center point (fully divided quadrilaterals).
+   * \param[out] conn - Connectivity of the children, SU2_CONN_SIZE entries each without the global index.
+   */
+  void DivideElement(unsigned short vtk, const unsigned long *node, const long *mid,
+                     const su2double *coord, unsigned long center, vector<unsigned long>& conn) const;
+
+};
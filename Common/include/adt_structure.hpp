@@ -36,6 +36,7 @@
 #include <vector>
 #include <algorithm>
 #include <array>
+#include <limits>
 
 #include "./mpi_structure.hpp"
 #include "./omp_structure.hpp"
@@ -358,10 +359,65 @@ public:
                                       unsigned long   &elemID,
                                       int             &rankID) {
     const auto iThread = omp_get_thread_num();
-    DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread],
-              FrontLeavesNew[iThread], coor, dist, markerID, elemID, rankID);
+    unsigned long nearestElem;
+    DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                 coor, numeric_limits<su2double>::max(), dist, markerID, elemID, rankID, nearestElem);
   }
 
+  /*!
+   * \brief Function, which determines the nearest element in the ADT that is closer than a given distance.
+   *        A guess of the nearest element (e.g. the result of a previous search, in an ADT built
+   *        from the same elements) tightens the bound and speeds up the search.
+   * \param[in]     coor    Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in]     maxDist Elements farther than this distance are not considered.
+   * \param[in,out] elem    On input the guessed element (index in the ADT, ignored if it does not exist),
+   *                        on output the index of the nearest element if one was found.
+   * \param[out]    dist    Distance to the nearest element.
+   * \return True if an element closer than maxDist (or than the guessed element) was found.
+   */
+  inline bool DetermineNearestElementBounded(const su2double *coor,
+                                             su2double       maxDist,
+                                             unsigned long   &elem,
+                                             su2double       &dist) {
+    if (isEmpty) return false;
+
+    /*--- Avoid overflow when no maximum distance is given. ---*/
+    const su2double maxDistLimit = sqrt(numeric_limits<su2double>::max());
+    su2double maxDist2 = (maxDist < maxDistLimit)? maxDist*maxDist : numeric_limits<su2double>::max();
+
+    const bool validGuess = (elem < elemVTK_Type.size());
+    su2double dist2Guess = 0.0;
+    if (validGuess) {
+      Dist2ToElement(elem, coor, dist2Guess);
+      maxDist2 = min(maxDist2, dist2Guess);
+    }
+
+    const auto iThread = omp_get_thread_num();
+    unsigned short markerID;
+    unsigned long  elemID;
+    int            rankID;
+    unsigned long  nearestElem;
+    if (DetermineNearestElement_impl(BBoxTargets[iThread], FrontLeaves[iThread], FrontLeavesNew[iThread],
+                                     coor, maxDist2, dist, markerID, elemID, rankID, nearestElem)) {
+      elem = nearestElem;
+      return true;
+    }
+
+    /*--- The search may discard the guess itself (ties), it is then the nearest. ---*/
+    if (validGuess && (dist2Guess <= maxDist2)) {
+      dist = sqrt(dist2Guess);
+      return true;
+    }
+    return false;
+  }
+
+  /*!
+   * \brief Function, which computes the bounding box of the points stored in the ADT.
+   * \param[out] bbMin Minimum coordinates of the bounding box, +max if the ADT is empty.
+   * \param[out] bbMax Maximum coordinates of the bounding box, -max if the ADT is empty.
+   */
+  void GetBoundingBox(su2double *bbMin, su2double *bbMax) const;
+
 private:
   /*!
    * \brief Implementation of DetermineContainingElement.
@@ -379,15 +435,20 @@ private:
   /*!
    * \brief Implementation of DetermineNearestElement.
    * \note Working variables (first three) passed explicitly for thread safety.
+   * \param[in]  maxDist2    Square of the distance beyond which elements are not considered.
+   * \param[out] nearestElem Index of the nearest element in the ADT.
+   * \return True if an element closer than the square root of maxDist2 was found.
    */
-  void DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
+  bool DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
                                     vector<unsigned long>& frontLeaves,
                                     vector<unsigned long>& frontLeavesNew,
                                     const su2double *coor,
+                                    su2double       maxDist2,
                                     su2double       &dist,
                                     unsigned short  &markerID,
                                     unsigned long   &elemID,
-                                    int             &rankID) const;
+                                    int             &rankID,
+                                    unsigned long   &nearestElem) const;
 
   /*!
    * \brief Function, which checks whether or not the given coordinate is
@@ -56,7 +56,9 @@ extern "C" {
 #include "dual_grid/CPoint.hpp"
 #include "dual_grid/CEdge.hpp"
 #include "dual_grid/CVertex.hpp"
+#include "dual_grid/CVertexData.hpp"
 #include "dual_grid/CTurboVertex.hpp"
+#include "dual_grid/CVertexPack.hpp"
 
 #include "../CConfig.hpp"
 #include "../fem/geometry_structure_fem_part.hpp"
@@ -194,6 +196,7 @@ public:
   CPoint* nodes;                         /*!< \brief Node vector (dual grid information). */
   CEdge* edges;                          /*!< \brief Edge vector (dual grid information). */
   CVertex*** vertex;                     /*!< \brief Boundary Vertex vector (dual grid information). */
+  vector<CVertexData> vertexData;        /*!< \brief Node, normal, and normal neighbor of the vertices of each marker. */
   CTurboVertex**** turbovertex;          /*!< \brief Boundary Vertex vector ordered for turbomachinery calculation(dual grid information). */
   unsigned long *nVertex;                /*!< \brief Number of vertex for each marker. */
   unsigned long *nElem_Bound;            /*!< \brief Number of elements of the boundary. */
@@ -257,6 +260,14 @@ public:
   vector<su2double> Aspect_Ratio;        /*!< \brief Measure of dual CV aspect ratio (max face area / min face area).  */
   vector<su2double> Volume_Ratio;        /*!< \brief Measure of dual CV volume ratio (max sub-element volume / min sub-element volume). */
 
+  /*--- Cached least-squares matrices (static grids). ---*/
+
+  su2activematrix LeastSquaresMatrix[2]; /*!< \brief Inverse least-squares matrix of each domain point, unweighted and weighted (empty until used). */
+
+  /*--- Boundary vertices packed by kind of boundary condition. ---*/
+
+  unordered_map<unsigned short, CVertexPack> VertexPack; /*!< \brief Packed domain vertices of the markers of each kind of boundary condition. */
+
   /*!
    * \brief Constructor of the class.
    */
@@ -610,6 +621,34 @@ public:
    */
   void SetFaces(void);
 
+  /*!
+   * \brief Set the geometric quantities of the edges used by the edge loops (edge vector, squared length, area).
+   * \note Called when the dual grid is computed, after the coordinates and normals are set.
+   */
+  void SetEdgeGeometry(void);
+
+  /*!
+   * \brief Pack the domain vertices of the markers of each kind of boundary condition (see CVertexPack).
+   * \note Called once the normal neighbors are found, send-receive and periodic markers are not packed.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetVertexPacks(const CConfig *config);
+
+  /*!
+   * \brief Copy the normals, coordinates, and normal neighbors to the packed vertices (after the grid changes).
+   */
+  void UpdateVertexPacks(void);
+
+  /*!
+   * \brief Get the packed vertices of a kind of boundary condition.
+   * \param[in] kindBC - Kind of boundary condition.
+   * \return Pointer to the pack, nullptr if the vertices of that kind are not packed.
+   */
+  inline const CVertexPack* GetVertexPack(unsigned short kindBC) const {
+    const auto it = VertexPack.find(kindBC);
+    return (it != VertexPack.end())? &it->second : nullptr;
+  }
+
   /*!
    * \brief Sets the boundary volume.
    */
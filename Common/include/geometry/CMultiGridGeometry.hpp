@@ -87,6 +87,30 @@ public:
   void SetSuitableNeighbors(vector<unsigned long> *Suitable_Indirect_Neighbors, unsigned long iPoint,
                             unsigned long Index_CoarseCV, CGeometry *fine_grid);
 
+  /*!
+   * \brief Agglomerate the stretched cells along the lines normal to the walls (semi-coarsening).
+   * \note The lines are built with the same criterion used for the linelet preconditioner, they
+   *       grow from the walls while a single neighbor is strongly coupled to the last point. The
+   *       points of each line are merged in groups of MG_LINE_COARSENING, the remainder of the line
+   *       is left for the isotropic agglomeration.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] Index_CoarseCV - Number of coarse control volumes, increased by the number of line agglomerates.
+   */
+  void AgglomerateImplicitLines(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV);
+
+  /*!
+   * \brief Merge the small agglomerates cut by the partition interface into a neighbor owned by the same rank.
+   * \note The children of a coarse control volume must be owned by its rank, as the fine halo layer does not
+   *       hold the complete stencil of the halo points. The agglomerates that the interface leaves with fewer
+   *       children than nDim+1 are therefore merged on the local side, which keeps the coarse levels close
+   *       to the ones obtained in serial.
+   * \param[in] fine_grid - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] Index_CoarseCV - Number of coarse control volumes, reduced by the number of merged agglomerates.
+   */
+  void MergeInterfaceFragments(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV);
+
   /*!
    * \brief Set boundary vertex.
    * \param[in] geometry - Geometrical definition of the problem.
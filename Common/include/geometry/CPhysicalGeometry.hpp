@@ -105,6 +105,9 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  vector<int> nearestWallRank;              /*!< \brief Rank of the nearest wall element of each point, for incremental wall distance updates. */
+  vector<unsigned long> nearestWallElem;    /*!< \brief Index of the nearest wall element in the wall ADT of that rank. */
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -137,8 +140,9 @@ public:
    *        the points and cells to all partitions based on the coloring.
    * \param[in] geometry - Definition of the geometry container holding the initial linear partitions of the grid + coloring.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_cache_key - Key of the partition cache (see GetPartitionCacheKey), used if it is written.
    */
-  CPhysicalGeometry(CGeometry *geometry, CConfig *config);
+  CPhysicalGeometry(CGeometry *geometry, CConfig *config, unsigned long val_cache_key = 0);
 
   /*!
    * \overload
@@ -150,6 +154,16 @@ public:
    */
   CPhysicalGeometry(CGeometry *geometry, CConfig *config, bool val_flag);
 
+  /*!
+   * \overload
+   * \brief Loads the partitioned grid of this rank from the partition cache written by a previous run.
+   * \note The cache must have been validated with CheckPartitionCache.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_cache_filename - Name of the cache file of this rank.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  CPhysicalGeometry(CConfig *config, const string& val_cache_filename, unsigned short val_nZone);
+
   /*!
    * \brief Destructor of the class.
    */
@@ -221,6 +235,53 @@ public:
    */
   void LoadSurfaceElements(CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Load the distributed points and elements into the geometry class objects, and free the partitioning data.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem (linear partitions).
+   */
+  void LoadPartition(CConfig *config, CGeometry *geometry);
+
+  /*!
+   * \brief Name of the partition cache file of this rank.
+   * \param[in] config - Definition of the particular problem.
+   * \return Cache prefix followed by the zone and rank numbers.
+   */
+  static string GetPartitionCacheFileName(const CConfig *config);
+
+  /*!
+   * \brief Key that identifies the partitioned grid, a hash of the grid file (or of the analytic grid
+   *        definition), of the zone, of the number of ranks, and of the options that modify the grid.
+   * \note This is a collective operation, the master rank hashes the file.
+   * \param[in] config - Definition of the particular problem.
+   * \return The key, equal on all ranks.
+   */
+  static unsigned long GetPartitionCacheKey(const CConfig *config);
+
+  /*!
+   * \brief Check that the cache files of all ranks exist, match the current grid and options, and are complete.
+   * \note This is a collective operation, the result is the same on all ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] key - Key of the partitioned grid, see GetPartitionCacheKey.
+   * \return True if all ranks can load their partition from the cache.
+   */
+  static bool CheckPartitionCache(const CConfig *config, unsigned long key);
+
+  /*!
+   * \brief Write the distributed points and elements of this rank to its partition cache file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem (linear partitions).
+   * \param[in] key - Key of the partitioned grid, see GetPartitionCacheKey.
+   */
+  void WritePartitionCache(const CConfig *config, const CGeometry *geometry, unsigned long key) const;
+
+  /*!
+   * \brief Read the distributed points and elements of this rank from its partition cache file.
+   * \param[in] config - Definition of the particular problem, the global marker tags are set.
+   * \param[in] val_cache_filename - Name of the cache file of this rank.
+   */
+  void ReadPartitionCache(CConfig *config, const string& val_cache_filename);
+
   /*!
    * \brief Routine to launch non-blocking sends and recvs amongst all processors.
    * \param[in] bufSend - Buffer of data to be sent.
@@ -783,7 +844,7 @@ public:
   void Check_Periodicity(CConfig *config) override;
 
   /*!
-   * \brief Compute an ADT including the coordinates of all viscous markers
+   * \brief Compute an ADT including the coordinates of the viscous markers of this rank
    * \param[in] config - Definition of the particular problem.
    * \return pointer to the ADT
    */
@@ -791,7 +852,11 @@ public:
 
   /*!
    * \brief Set the wall distance based on an previously constructed ADT
-   * \param[in] WallADT - The ADT to compute the wall distance
+   * \note Collective, the nodes are sent to the ranks whose walls may be the closest. In single zone
+   *       problems the nearest wall element of each node is kept, subsequent calls (e.g. for dynamic grids)
+   *       start the search from the distance to that element, which in most cases limits the search to
+   *       a few elements of a single rank.
+   * \param[in] WallADT - The ADT (of the local walls) to compute the wall distance
    */
   void SetWallDistance(const CConfig *config, CADTElemClass* WallADT) override;
 
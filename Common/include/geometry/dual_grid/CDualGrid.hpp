@@ -68,54 +68,4 @@ public:
    * \param[in] val_coord - Coordinate of the point.
    */
   virtual void SetCoord(const su2double *val_coord) = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   * \param[in] val_coord_Edge_CG - Coordinates of the centre of gravity of the edge.
-   * \param[in] val_coord_FaceElem_CG - Coordinates of the centre of gravity of the face of an element.
-   * \param[in] val_coord_Elem_CG - Coordinates of the centre of gravity of the element.
-   * \param[in] config - Definition of the particular problem.
-   */
-  virtual void SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_FaceElem_CG, su2double *val_coord_Elem_CG) = 0;
-
-  /*!
-   * \overload
-   * \param[in] val_coord_Edge_CG - Coordinates of the centre of gravity of the edge.
-   * \param[in] val_coord_Elem_CG - Coordinates of the centre of gravity of the element.
-   * \param[in] config - Definition of the particular problem.
-   */
-  virtual void SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_Elem_CG) = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   * \param[out] val_normal - Coordinates of the normal.
-   */
-  virtual void GetNormal(su2double *val_normal) const = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   */
-  virtual su2double *GetNormal(void) = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   * \param[in] val_face_normal - Coordinates of the normal.
-   */
-  virtual void SetNormal(const su2double *val_face_normal) = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   */
-  virtual unsigned short GetnNodes(void) const = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   */
-  virtual void SetZeroValues(void) = 0;
-
-  /*!
-   * \brief A pure virtual member.
-   * \param[in] val_face_normal - Normal vector to be added.
-   */
-  virtual void AddNormal(const su2double *val_face_normal) = 0;
 };
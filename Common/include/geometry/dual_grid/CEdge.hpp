@@ -41,6 +41,9 @@ private:
   su2matrix<unsigned long> Nodes; /*!< \brief Vector to store the node indices of the edge. */
   su2activematrix Normal;         /*!< \brief Normal (area) of the edge. */
   su2activematrix Coord_CG;       /*!< \brief Center-of-gravity (mid point) of the edge. */
+  su2activematrix EdgeVector;     /*!< \brief Vector from the left to the right node of the edge. */
+  su2activevector Dist2;          /*!< \brief Squared length of the edge. */
+  su2activevector Area;           /*!< \brief Area of the face of the edge (norm of the normal). */
 
 public:
   enum NodePosition : unsigned long {LEFT = 0, RIGHT = 1};
@@ -168,6 +171,35 @@ public:
    */
   inline const su2double* GetNormal(unsigned long iEdge) const { return Normal[iEdge]; }
 
+  /*!
+   * \brief Set the edge vector, squared length, and area of an edge (the normal must be set).
+   * \param[in] iEdge - Edge index.
+   * \param[in] coord_i - Coordinates of the left node.
+   * \param[in] coord_j - Coordinates of the right node.
+   */
+  void SetEdgeGeometry(unsigned long iEdge, const su2double* coord_i, const su2double* coord_j);
+
+  /*!
+   * \brief Get the vector from the left to the right node of an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Edge vector, set by SetEdgeGeometry.
+   */
+  inline const su2double* GetEdgeVector(unsigned long iEdge) const { return EdgeVector[iEdge]; }
+
+  /*!
+   * \brief Get the squared length of an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Squared length, set by SetEdgeGeometry.
+   */
+  inline su2double GetDist2(unsigned long iEdge) const { return Dist2(iEdge); }
+
+  /*!
+   * \brief Get the area of the face of the control volume associated with an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Norm of the normal, set by SetEdgeGeometry.
+   */
+  inline su2double GetArea(unsigned long iEdge) const { return Area(iEdge); }
+
   /*!
    * \brief Initialize normal vector to 0.
    */
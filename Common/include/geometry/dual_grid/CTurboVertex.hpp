@@ -37,6 +37,8 @@
  */
 class CTurboVertex final : public CVertex {
 private:
+  unsigned long Node;         /*!< \brief Node of the vertex. */
+  su2double Normal[3];        /*!< \brief Unit normal of the vertex. */
   su2double *TurboNormal;     /*!< \brief Normal for computing correct turbomachinery quantities. */
   su2double Area;             /*!< \brief Value of the face area associated to the vertex */
   //  su2double PitchCoord;       /*!< \brief Value of the abscissa pitch wise */
@@ -61,6 +63,30 @@ public:
    */
   ~CTurboVertex(void) override;
 
+  /*!
+   * \brief Get the node of the vertex.
+   * \return Index of the node that compose the vertex.
+   */
+  inline unsigned long GetNode() const { return Node; }
+
+  /*!
+   * \brief Set the normal vector.
+   * \param[in] val_normal - Vector to initialize the normal vector.
+   */
+  inline void SetNormal(const su2double *val_normal) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Normal[iDim] = val_normal[iDim];
+  }
+
+  /*!
+   * \brief Copy the normal vector.
+   * \param[out] val_normal - Vector where the normal is copied.
+   */
+  inline void GetNormal(su2double *val_normal) const {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      val_normal[iDim] = Normal[iDim];
+  }
+
   /*!
    * \brief set Normal in the turbomachinery frame of reference.
    * \param[in] val_normal - normal vector.
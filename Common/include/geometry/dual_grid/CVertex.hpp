@@ -33,12 +33,11 @@
 /*!
  * \class CVertex
  * \brief Class for vertex definition (equivalent to edges, but for the boundaries).
+ * \note The node, normal, and normal neighbor of the vertices are stored per marker in CVertexData.
  * \author F. Palacios
  */
 class CVertex : public CDualGrid {
 protected:
-  unsigned long Nodes[1];        /*!< \brief Vector to store the global nodes of an element. */
-  su2double Normal[3];           /*!< \brief Normal coordinates of the element and its center of gravity. */
   su2double Aux_Var;             /*!< \brief Auxiliar variable defined only on the surface. */
   su2double CartCoord[3];        /*!< \brief Vertex cartesians coordinates. */
   su2double VarCoord[3];         /*!< \brief Used for storing the coordinate variation due to a surface modification. */
@@ -46,7 +45,6 @@ protected:
   long PeriodicPoint[5];         /*!< \brief Store the periodic point of a boundary (iProcessor, iPoint) */
   bool ActDisk_Perimeter;        /*!< \brief Identify nodes at the perimeter of the actuator disk */
   short Rotation_Type;           /*!< \brief Type of rotation associated with the vertex (MPI and periodic) */
-  unsigned long Normal_Neighbor; /*!< \brief Index of the closest neighbor. */
   unsigned long *Donor_Points;   /*!< \brief indices of donor points for interpolation across zones */
   unsigned long *Donor_Proc;     /*!< \brief indices of donor processor for interpolation across zones in parallel */
   su2double Basis_Function[3];   /*!< \brief Basis function values for interpolation across zones. */
@@ -56,73 +54,15 @@ protected:
 public:
   /*!
    * \brief Constructor of the class.
-   * \param[in] val_point - Node of the vertex.
    * \param[in] val_nDim - Number of dimensions of the problem.
    */
-  CVertex(unsigned long val_point, unsigned short val_nDim);
+  CVertex(unsigned short val_nDim);
 
   /*!
    * \brief Destructor of the class.
    */
   ~CVertex(void) override;
 
-  /*!
-   * \brief Get the number of nodes of a vertex.
-   * \return Number of nodes that set a vertex (1).
-   */
-  inline unsigned short GetnNodes() const override { return 1; }
-
-  /*!
-   * \brief Get the node of the vertex.
-   * \return Index of the node that compose the vertex.
-   */
-  inline unsigned long GetNode() const { return Nodes[0]; }
-
-  /*!
-   * \brief Set the face that correspond to a vertex.
-   * \param[in] val_coord_Edge_CG - Coordinates of the centre of gravity of the edge.
-   * \param[in] val_coord_FaceElem_CG - Coordinates of the centre of gravity of the face of an element.
-   * \param[in] val_coord_Elem_CG - Coordinates of the centre of gravity of the element.
-   * \return Compute the normal (dimensional) to the face that makes the vertex.
-   */
-  void SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_FaceElem_CG, su2double *val_coord_Elem_CG) override;
-
-  /*!
-   * \overload
-   * \param[in] val_coord_Edge_CG - Coordinates of the centre of gravity of the edge.
-   * \param[in] val_coord_Elem_CG - Coordinates of the centre of gravity of the element.
-   * \return Compute the normal (dimensional) to the face that makes the vertex.
-   */
-  void SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_Elem_CG) override;
-
-  /*!
-   * \brief Copy the the normal vector of a face.
-   * \param[in] val_normal - Vector where the subroutine is goint to copy the normal (dimensional).
-   */
-  inline void GetNormal(su2double *val_normal) const override {
-    for (unsigned short iDim = 0; iDim < nDim; iDim++)
-      val_normal[iDim] = Normal[iDim];
-  }
-
-  /*!
-   * \brief Get the normal to a face of the control volume asociated with a vertex.
-   * \return Dimensional normal vector, the modulus is the area of the face.
-   */
-  inline su2double *GetNormal(void) override { return Normal; }
-
-  /*!
-   * \brief Get the ith component of the normal.
-   */
-  inline su2double GetNormal(unsigned short iDim) const { return Normal[iDim]; }
-
-  /*!
-   * \brief Initialize normal vector.
-   */
-  inline void SetZeroValues(void) override {
-    for (unsigned short iDim = 0; iDim < nDim; iDim ++)
-      Normal[iDim] = 0.0;
-  }
-
   /*!
    * \brief Set the value of an auxiliary variable for gradient computation.
    * \param[in] val_auxvar - Value of the auxiliar variable.
@@ -141,25 +81,6 @@ public:
    */
   inline void AddAuxVar(su2double val_auxvar) { Aux_Var += val_auxvar; }
 
-  /*!
-   * \brief Set the normal vector.
-   * \param[in] val_face_normal - Vector to initialize the normal vector.
-   * \return Value of the normal vector.
-   */
-  inline void SetNormal(const su2double *val_face_normal) override {
-    for (unsigned short iDim = 0; iDim < nDim; iDim++)
-      Normal[iDim]=val_face_normal[iDim];
-  }
-
-  /*!
-   * \brief Add a vector to the normal vector.
-   * \param[in] val_face_normal - Vector to add to the normal vector.
-   */
-  inline void AddNormal(const su2double *val_face_normal) override {
-    for(unsigned short iDim = 0; iDim < nDim; iDim++)
-      Normal[iDim] += val_face_normal[iDim];
-  }
-
   /*!
    * \brief Set the value of the coordinate variation due to a surface modification.
    * \param[in] val_varcoord - Variation of the coordinate.
@@ -324,18 +245,6 @@ public:
    */
   inline su2double GetBasisFunction(unsigned short val_node) { return Basis_Function[val_node]; }
 
-  /*!
-   * \brief Set the index of the closest neighbor to a point on the boundaries.
-   * \param[in] val_Normal_Neighbor - Index of the closest neighbor.
-   */
-  inline void SetNormal_Neighbor(unsigned long val_Normal_Neighbor) { Normal_Neighbor = val_Normal_Neighbor; }
-
-  /*!
-   * \brief Get the value of the closest neighbor.
-   * \return Index of the closest neighbor.
-   */
-  inline unsigned long GetNormal_Neighbor(void) const { return Normal_Neighbor; }
-
   /*!
    * \brief Return the value of nDonor_Points
    * \return nDonor - the number of donor points
@@ -0,0 +1,159 @@
+/*!
+ * \file CVertexData.hpp
+ * \brief Declaration of the boundary vertex data of a marker.
+ *        The implementation is in the <i>CVertexData.cpp</i> file.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../toolboxes/C2DContainer.hpp"
+
+/*!
+ * \class CVertexData
+ * \brief The node, normal, and normal neighbor of the vertices of a marker, stored contiguously
+ *        as structure of arrays. The remaining (less used) vertex information is kept in CVertex.
+ */
+class CVertexData {
+  static_assert(su2activematrix::Storage == StorageType::RowMajor, "Needed to return normal as pointer.");
+
+private:
+  su2vector<unsigned long> Node;            /*!< \brief Point of each vertex. */
+  su2vector<unsigned long> Normal_Neighbor; /*!< \brief Closest interior neighbor of each vertex. */
+  su2activematrix Normal;                   /*!< \brief Normal (area) of each vertex, pointing into the domain. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nVertex - Number of vertices of the marker.
+   * \param[in] nDim - Number of spatial dimensions of the problem.
+   */
+  CVertexData(unsigned long nVertex, unsigned long nDim);
+
+  /*!
+   * \brief No default construction.
+   */
+  CVertexData() = delete;
+
+  /*!
+   * \brief Get the number of vertices.
+   */
+  inline unsigned long GetnVertex() const { return Node.size(); }
+
+  /*!
+   * \brief Get the node of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \return Index of the point of the vertex.
+   */
+  inline unsigned long GetNode(unsigned long iVertex) const { return Node(iVertex); }
+
+  /*!
+   * \brief Set the node of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \param[in] iPoint - Index of the point of the vertex.
+   */
+  inline void SetNode(unsigned long iVertex, unsigned long iPoint) { Node(iVertex) = iPoint; }
+
+  /*!
+   * \brief Get the closest interior neighbor of a vertex.
+   * \param[in] iVertex - Vertex index.
+   */
+  inline unsigned long GetNormal_Neighbor(unsigned long iVertex) const { return Normal_Neighbor(iVertex); }
+
+  /*!
+   * \brief Set the closest interior neighbor of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \param[in] iPoint - Index of the neighbor.
+   */
+  inline void SetNormal_Neighbor(unsigned long iVertex, unsigned long iPoint) { Normal_Neighbor(iVertex) = iPoint; }
+
+  /*!
+   * \brief Copy the normal of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \param[out] normal - Object into which the normal (dimensional) will be copied.
+   */
+  template<class T>
+  inline void GetNormal(unsigned long iVertex, T& normal) const {
+    for (auto iDim = 0ul; iDim < Normal.cols(); iDim++)
+      normal[iDim] = Normal(iVertex,iDim);
+  }
+
+  /*!
+   * \brief Get the normal of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \return Dimensional normal vector, the modulus is the area of the face.
+   */
+  inline su2double* GetNormal(unsigned long iVertex) { return Normal[iVertex]; }
+  inline const su2double* GetNormal(unsigned long iVertex) const { return Normal[iVertex]; }
+
+  /*!
+   * \brief Set the normal of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \param[in] normal - Normal vector.
+   */
+  template<class T>
+  void SetNormal(unsigned long iVertex, const T& normal) {
+    for (auto iDim = 0ul; iDim < Normal.cols(); ++iDim)
+      Normal(iVertex,iDim) = normal[iDim];
+  }
+
+  /*!
+   * \brief Add a vector to the normal of a vertex.
+   * \param[in] iVertex - Vertex index.
+   * \param[in] normal - Vector to add to the normal.
+   */
+  template<class T>
+  void AddNormal(unsigned long iVertex, const T& normal) {
+    for (auto iDim = 0ul; iDim < Normal.cols(); ++iDim)
+      Normal(iVertex,iDim) += normal[iDim];
+  }
+
+  /*!
+   * \brief Set the normals of all vertices to zero.
+   */
+  void SetZeroValues(void);
+
+  /*!
+   * \brief Add the contribution of a face of the dual control volume to the normal of a vertex (3D).
+   * \param[in] iVertex - Vertex index.
+   * \param[in] coord_Edge_CG - Coordinates of the centre of gravity of the edge.
+   * \param[in] coord_FaceElem_CG - Coordinates of the centre of gravity of the face of an element.
+   * \param[in] coord_Elem_CG - Coordinates of the centre of gravity of the element.
+   */
+  void SetNodes_Coord(unsigned long iVertex,
+                      const su2double* coord_Edge_CG,
+                      const su2double* coord_FaceElem_CG,
+                      const su2double* coord_Elem_CG);
+
+  /*!
+   * \overload
+   * \brief Add the contribution of an edge of the dual control volume to the normal of a vertex (2D).
+   * \param[in] iVertex - Vertex index.
+   * \param[in] coord_Edge_CG - Coordinates of the centre of gravity of the edge.
+   * \param[in] coord_Elem_CG - Coordinates of the centre of gravity of the element.
+   */
+  void SetNodes_Coord(unsigned long iVertex,
+                      const su2double* coord_Edge_CG,
+                      const su2double* coord_Elem_CG);
+
+};
@@ -0,0 +1,133 @@
+/*!
+ * \file CVertexPack.hpp
+ * \brief Declaration of the packed boundary vertices of a kind of boundary condition.
+ *        The implementation is in the <i>CVertexPack.cpp</i> file.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../toolboxes/C2DContainer.hpp"
+#include <vector>
+
+class CGeometry;
+
+/*!
+ * \class CVertexPack
+ * \brief The domain vertices of a set of markers (usually all the markers of a kind of boundary
+ *        condition), stored contiguously as structure of arrays.
+ * \details The vertices are ordered by marker and by vertex, and split in groups such that a
+ *          point appears at most once in each group (points shared by several markers of the set
+ *          go in the later groups). The vertices of a group can therefore be processed concurrently,
+ *          one group after the other, and a point still receives the contributions of the markers
+ *          in marker order.
+ */
+class CVertexPack {
+  static_assert(su2activematrix::Storage == StorageType::RowMajor, "Needed to return normal as pointer.");
+
+private:
+  std::vector<unsigned short> Markers;  /*!< \brief Markers of the set. */
+  std::vector<unsigned long> GroupPtr;  /*!< \brief Start of each group, and end of the last. */
+
+  su2vector<unsigned short> Marker;       /*!< \brief Marker of each vertex. */
+  su2vector<unsigned long> Vertex;        /*!< \brief Index of each vertex in its marker. */
+  su2vector<unsigned long> Node;          /*!< \brief Point of each vertex. */
+  su2vector<unsigned long> Normal_Neighbor; /*!< \brief Closest interior neighbor of each vertex. */
+  su2activematrix Normal;                 /*!< \brief Normal (area) of each vertex, pointing into the domain. */
+  su2activematrix Coord;                  /*!< \brief Coordinates of the point of each vertex. */
+
+public:
+  /*!
+   * \brief Constructor of the class, packs the domain vertices of the markers.
+   * \param[in] geometry - Geometrical definition of the problem (vertices and normal neighbors set).
+   * \param[in] markers - Markers of the set.
+   */
+  CVertexPack(const CGeometry& geometry, std::vector<unsigned short> markers);
+
+  /*!
+   * \brief No default construction.
+   */
+  CVertexPack() = delete;
+
+  /*!
+   * \brief Copy the normals, coordinates, and normal neighbors of the vertices (after the grid changes).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetGeometry(const CGeometry& geometry);
+
+  /*!
+   * \brief Get the markers of the set.
+   */
+  inline const std::vector<unsigned short>& GetMarkers() const { return Markers; }
+
+  /*!
+   * \brief Get the number of packed vertices.
+   */
+  inline unsigned long GetnVertex() const { return Node.size(); }
+
+  /*!
+   * \brief Get the number of groups of vertices without repeated points.
+   */
+  inline unsigned long GetnGroup() const { return GroupPtr.size()-1; }
+
+  /*!
+   * \brief Get the first vertex of a group.
+   */
+  inline unsigned long GetGroupBegin(unsigned long iGroup) const { return GroupPtr[iGroup]; }
+
+  /*!
+   * \brief Get the end (one past the last vertex) of a group.
+   */
+  inline unsigned long GetGroupEnd(unsigned long iGroup) const { return GroupPtr[iGroup+1]; }
+
+  /*!
+   * \brief Get the marker of a packed vertex.
+   */
+  inline unsigned short GetMarker(unsigned long iPack) const { return Marker(iPack); }
+
+  /*!
+   * \brief Get the index of a packed vertex in its marker.
+   */
+  inline unsigned long GetVertex(unsigned long iPack) const { return Vertex(iPack); }
+
+  /*!
+   * \brief Get the point of a packed vertex.
+   */
+  inline unsigned long GetNode(unsigned long iPack) const { return Node(iPack); }
+
+  /*!
+   * \brief Get the closest interior neighbor of a packed vertex.
+   */
+  inline unsigned long GetNormal_Neighbor(unsigned long iPack) const { return Normal_Neighbor(iPack); }
+
+  /*!
+   * \brief Get the normal of a packed vertex (same as CVertex::GetNormal).
+   */
+  inline const su2double* GetNormal(unsigned long iPack) const { return Normal[iPack]; }
+
+  /*!
+   * \brief Get the coordinates of the point of a packed vertex.
+   */
+  inline const su2double* GetCoord(unsigned long iPack) const { return Coord[iPack]; }
+
+};
@@ -80,28 +80,28 @@ public:
   /*!
    * \brief Destructor of the class.
    */
-  ~CGridAdaptation(void);
+  virtual ~CGridAdaptation(void);
 
   /*!
    * \brief Read the flow solution from the restart file.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void GetFlowSolution(CGeometry *geometry, CConfig *config);
+  virtual void GetFlowSolution(CGeometry *geometry, CConfig *config);
 
   /*!
    * \brief Read the flow solution from the restart file.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void GetFlowResidual(CGeometry *geometry, CConfig *config);
+  virtual void GetFlowResidual(CGeometry *geometry, CConfig *config);
 
   /*!
    * \brief Read the flow solution from the restart file.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void GetAdjSolution(CGeometry *geometry, CConfig *config);
+  virtual void GetAdjSolution(CGeometry *geometry, CConfig *config);
 
   /*!
    * \brief Read the flow solution from the restart file.
@@ -334,7 +334,7 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] max_elem - Maximum number of cells being adapted.
    */
-  void SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem);
+  virtual void SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem);
 
 };
 
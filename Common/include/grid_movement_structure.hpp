@@ -292,6 +292,8 @@ public:
 
   vector<su2double> CartesianCoord[3];	/*!< \brief Vector with all the cartesian coordinates in the FFD FFDBox. */
   vector<su2double> ParametricCoord[3];	/*!< \brief Vector with all the parametrics coordinates in the FFD FFDBox. */
+  vector<su2double> ParametricBasis[3];	/*!< \brief Basis functions of each direction evaluated at the parametric coordinates (point-major). */
+  unsigned short ParametricBasisOrder[3] = {0, 0, 0}; /*!< \brief Orders of the cached basis functions, 0 if the cache is invalid. */
   vector<unsigned short> MarkerIndex;	/*!< \brief Vector with all markers in the FFD FFDBox. */
   vector<unsigned long> VertexIndex;	/*!< \brief Vector with all vertex index in the FFD FFDBox. */
   vector<unsigned long> PointIndex;		/*!< \brief Vector with all points index in the FFD FFDBox. */
@@ -745,6 +747,20 @@ public:
    */
   su2double *EvalCartesianCoord(su2double *ParamCoord) const;
 
+  /*!
+   * \brief Evaluate the basis functions of each direction at the parametric coordinates of all the surface points.
+   * \note The cache is invalidated when the parametric coordinates or the orders of the box change.
+   */
+  void SetParametricBasis(void);
+
+  /*!
+   * \brief Cartesian coordinates of a surface point of the box, computed from the cached basis functions,
+   *        which are (re)built if needed. The result is the same as for EvalCartesianCoord(Get_ParametricCoord(...)).
+   * \param[in] iSurfacePoint - Index of the surface point.
+   * \return Pointer to the cartesian coordinates of the point.
+   */
+  su2double *EvalCartesianCoord(unsigned long iSurfacePoint);
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
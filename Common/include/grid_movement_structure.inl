@@ -73,11 +73,13 @@ inline void CFreeFormDefBox::Set_CartesianCoord(const su2double *val_coord, unsi
 
 inline void CFreeFormDefBox::Set_ParametricCoord(su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
 																																		 ParametricCoord[1].push_back(val_coord[1]); 
-																																		 ParametricCoord[2].push_back(val_coord[2]); }
+																																		 ParametricCoord[2].push_back(val_coord[2]);
+																																		 ParametricBasisOrder[0] = 0; }
 																																		 
 inline void CFreeFormDefBox::Set_ParametricCoord(const su2double *val_coord, unsigned long val_iSurfacePoints) { ParametricCoord[0][val_iSurfacePoints] = val_coord[0];
 																																																			 ParametricCoord[1][val_iSurfacePoints] = val_coord[1]; 
-																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2]; }
+																																																			 ParametricCoord[2][val_iSurfacePoints] = val_coord[2];
+																																																			 ParametricBasisOrder[0] = 0; }
 
 inline unsigned short CFreeFormDefBox::Get_MarkerIndex(unsigned long val_iSurfacePoints) { return MarkerIndex[val_iSurfacePoints]; }
 
@@ -86,6 +86,7 @@ private:
   unsigned long nPointDomain;       /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;               /*!< \brief Number of variables (and rows of the blocks). */
   unsigned long nEqn;               /*!< \brief Number of equations (and columns of the blocks). */
+  unsigned long fixedBlockSize;     /*!< \brief Block size with specialized kernels, 0 if the generic ones are used. */
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -165,10 +166,13 @@ private:
 
   /*!
    * \brief Calculates the matrix-vector product: product = matrix*vector
+   * \note The block kernels below are specialized for square blocks of size BS when BS > 0,
+   *       with BS = 0 they use the run-time sizes (and the MKL JIT kernels if available).
    * \param[in] matrix
    * \param[in] vector
    * \param[out] product
    */
+  template<unsigned long BS = 0>
   inline void MatrixVectorProduct(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
   /*!
@@ -177,6 +181,7 @@ private:
    * \param[in] vector
    * \param[in,out] product
    */
+  template<unsigned long BS = 0>
   inline void MatrixVectorProductAdd(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
   /*!
@@ -185,6 +190,7 @@ private:
    * \param[in] vector
    * \param[in,out] product
    */
+  template<unsigned long BS = 0>
   inline void MatrixVectorProductSub(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
   /*!
@@ -198,36 +204,44 @@ private:
   /*!
    * \brief Calculates the matrix-matrix product
    */
+  template<unsigned long BS = 0>
   inline void MatrixMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b, ScalarType *product) const;
 
   /*!
    * \brief Subtract b from a and store the result in c.
    */
+  template<unsigned long BS = 0>
   inline void VectorSubtraction(const ScalarType *a, const ScalarType *b, ScalarType *c) const {
-    for(unsigned long iVar = 0; iVar < nVar; iVar++)
+    const auto n = BS? BS : nVar;
+    for(unsigned long iVar = 0; iVar < n; iVar++)
       c[iVar] = a[iVar] - b[iVar];
   }
 
   /*!
    * \brief Subtract b from a and store the result in c.
    */
+  template<unsigned long BS = 0>
   inline void MatrixSubtraction(const ScalarType *a, const ScalarType *b, ScalarType *c) const {
-    for(unsigned long iVar = 0; iVar < nVar*nEqn; iVar++)
+    const auto n = BS? BS*BS : nVar*nEqn;
+    for(unsigned long iVar = 0; iVar < n; iVar++)
       c[iVar] = a[iVar] - b[iVar];
   }
 
   /*!
    * \brief Copy matrix src into dst, transpose if required.
    */
+  template<unsigned long BS = 0>
   inline void MatrixCopy(const ScalarType *src, ScalarType *dst, bool transposed = false) const {
+    const auto n = BS? BS : nVar;
     if (!transposed) {
-      for(auto iVar = 0ul; iVar < nVar*nEqn; ++iVar)
+      const auto nn = BS? BS*BS : nVar*nEqn;
+      for(auto iVar = 0ul; iVar < nn; ++iVar)
         dst[iVar] = src[iVar];
     }
     else {
-      for (auto iVar = 0ul; iVar < nVar; ++iVar)
-        for (auto jVar = 0ul; jVar < nVar; ++jVar)
-          dst[iVar*nVar+jVar] = src[jVar*nVar+iVar];
+      for (auto iVar = 0ul; iVar < n; ++iVar)
+        for (auto jVar = 0ul; jVar < n; ++jVar)
+          dst[iVar*n+jVar] = src[jVar*n+iVar];
     }
   }
 
@@ -236,6 +250,7 @@ private:
    * \param[in,out] matrix - On entry the system matrix, on exit the factorized matrix.
    * \param[in,out] vec - On entry the rhs, on exit the solution.
    */
+  template<unsigned long BS = 0>
   void Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const;
 
   /*!
@@ -243,6 +258,7 @@ private:
    * \param[in,out] matrix - On entry the system matrix, on exit the factorized matrix.
    * \param[out] inverse - the matrix inverse.
    */
+  template<unsigned long BS = 0>
   void MatrixInverse(ScalarType *matrix, ScalarType *inverse) const;
 
   /*!
@@ -252,6 +268,7 @@ private:
    * \param[in] transposed - If true the transposed of the block is used (default = false).
    * \return Solution of the linear system (overwritten on rhs).
    */
+  template<unsigned long BS = 0>
   inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed = false) const;
 
   /*!
@@ -259,6 +276,7 @@ private:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
+  template<unsigned long BS = 0>
   inline void InverseDiagonalBlock(unsigned long block_i, ScalarType *invBlock, bool transposed = false) const;
 
   /*!
@@ -266,6 +284,7 @@ private:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
+  template<unsigned long BS = 0>
   inline void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType *invBlock) const;
 
   /*!
@@ -298,6 +317,7 @@ private:
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
+  template<unsigned long BS = 0>
   inline void UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_ub, ScalarType *prod) const;
 
@@ -308,6 +328,7 @@ private:
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
+  template<unsigned long BS = 0>
   inline void LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_lb, ScalarType *prod) const;
 
@@ -317,6 +338,7 @@ private:
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
+  template<unsigned long BS = 0>
   inline void DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
   /*!
@@ -325,7 +347,34 @@ private:
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return Result of the product (stored at *prod_row_vector).
    */
-  void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+  template<unsigned long BS = 0>
+  inline void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
+
+  /*--- Implementations of the public methods with the block kernels specialized for size BS, the public
+   *    methods call the specialization for the block size selected at Initialize (see fixedBlockSize). ---*/
+
+  template<unsigned long BS>
+  void MatrixVectorProductImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  template<unsigned long BS>
+  void BuildJacobiPreconditionerImpl(bool transpose);
+
+  template<unsigned long BS>
+  void ComputeJacobiPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  template<unsigned long BS>
+  void BuildILUPreconditionerImpl();
+
+  template<unsigned long BS>
+  void ComputeILUPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+
+  template<unsigned long BS>
+  void ComputeLU_SGSPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                       CGeometry *geometry, CConfig *config) const;
+
+  template<unsigned long BS>
+  void ComputeResidualImpl(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
+                           CSysVector<ScalarType> & res) const;
 
 public:
 
@@ -355,6 +404,12 @@ public:
                   bool EdgeConnect, CGeometry *geometry,
                   const CConfig *config, bool needTranspPtr = false);
 
+  /*!
+   * \brief Use the generic block kernels instead of the ones specialized for the block size.
+   * \note The results are the same, this allows testing the specialized kernels.
+   */
+  inline void SetGenericBlockKernels() { fixedBlockSize = 0; }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -500,6 +555,28 @@ public:
     SetBlock<OtherType,false>(block_i, block_j, val_block, alpha);
   }
 
+  /*!
+   * \brief Set a sub-block (nRow x nCol in flat format) of block "ij", the rest of the block is not modified.
+   * \param[in] block_i - Row index.
+   * \param[in] block_j - Column index.
+   * \param[in] iVarOffset - First row of the sub-block.
+   * \param[in] jVarOffset - First column of the sub-block.
+   * \param[in] nRow - Number of rows of the sub-block.
+   * \param[in] nCol - Number of columns of the sub-block.
+   * \param[in] val_block - Sub-block to set.
+   */
+  template<class OtherType>
+  inline void SetSubBlock(unsigned long block_i, unsigned long block_j,
+                          unsigned long iVarOffset, unsigned long jVarOffset,
+                          unsigned long nRow, unsigned long nCol, const OtherType *val_block) {
+
+    auto mat_ij = GetBlock(block_i, block_j);
+    if (!mat_ij) return;
+    for (auto iVar = 0ul; iVar < nRow; ++iVar)
+      for (auto jVar = 0ul; jVar < nCol; ++jVar)
+        mat_ij[(iVarOffset+iVar)*nEqn + jVarOffset+jVar] = PassiveAssign(val_block[iVar*nCol+jVar]);
+  }
+
   /*!
    * \brief Subtracts the specified block to the sparse matrix (see AddBlock).
    * \param[in] block_i - Row index.
@@ -698,6 +775,16 @@ public:
    */
   void MatrixMatrixAddition(ScalarType alpha, const CSysMatrix& B);
 
+  /*!
+   * \brief Copy the blocks of a matrix with smaller blocks into sub-blocks of "this",
+   *        A(i,j)[iVarOffset+k, jVarOffset+l] = B(i,j)[k,l].
+   * \note Matrices must have the same sparse pattern, the other entries of the blocks are not modified.
+   * \param[in] B - Matrix being copied.
+   * \param[in] iVarOffset - First row of the sub-blocks.
+   * \param[in] jVarOffset - First column of the sub-blocks.
+   */
+  void SetSubMatrix(const CSysMatrix& B, unsigned long iVarOffset, unsigned long jVarOffset);
+
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
@@ -765,6 +852,11 @@ public:
    */
   unsigned long BuildLineletPreconditioner(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Check if the linelet structure was built (required by the linelet preconditioner).
+   */
+  inline bool HasLinelets() const { return !LineletBool.empty(); }
+
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
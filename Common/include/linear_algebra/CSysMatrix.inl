@@ -61,13 +61,17 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlockTransposed_ILUMatrix(unsigned l
       ilu_ij[iVar*nVar+jVar] = val_block[jVar*nVar+iVar];
 }
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T *b, T *c) {
+template<class T, bool alpha, bool beta, bool transp, unsigned long N = 0>
+FORCEINLINE void gemv_impl(unsigned long n_, unsigned long m_, const T *a, const T *b, T *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
    This is still the traditional "row dot vector" method.
+   A non-zero N fixes the (square) size at compilation, which allows the
+   loops to be fully unrolled.
   ---*/
+  const auto n = N? N : n_;
+  const auto m = N? N : m_;
   if (!transp) {
     for (auto i = 0ul; i < n; i++) {
       if (!beta) c[i] = 0.0;
@@ -82,9 +86,10 @@ FORCEINLINE void gemv_impl(unsigned long n, unsigned long m, const T *a, const T
   }
 }
 
-template<class T>
-FORCEINLINE void gemm_impl(unsigned long n, const T *a, const T *b, T *c) {
-  /*--- Same deal as for GEMV but here only the type is templated. ---*/
+template<class T, unsigned long N = 0>
+FORCEINLINE void gemm_impl(unsigned long n_, const T *a, const T *b, T *c) {
+  /*--- Same deal as for GEMV but here only the type and size are templated. ---*/
+  const auto n = N? N : n_;
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
@@ -98,7 +103,8 @@ FORCEINLINE void gemm_impl(unsigned long n, const T *a, const T *b, T *c) {
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
-#define MATVECPROD_SIGNATURE(NAME) template<class ScalarType> __MATVECPROD_SIGNATURE__(ScalarType,NAME)
+#define MATVECPROD_SIGNATURE(NAME) \
+template<class ScalarType> template<unsigned long BS> __MATVECPROD_SIGNATURE__(ScalarType,NAME)
 
 #if !defined(USE_MKL)
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
@@ -106,29 +112,32 @@ MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
    Without MKL (default) picture copying the body of gemv_impl
    here and resolving the conditionals at compilation.
   ---*/
-  gemv_impl<ScalarType,true,false,false>(nVar, nEqn, matrix, vector, product);
+  gemv_impl<ScalarType,true,false,false,BS>(nVar, nEqn, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductAdd ) {
-  gemv_impl<ScalarType,true,true,false>(nVar, nEqn, matrix, vector, product);
+  gemv_impl<ScalarType,true,true,false,BS>(nVar, nEqn, matrix, vector, product);
 }
 
 MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
-  gemv_impl<ScalarType,false,true,false>(nVar, nEqn, matrix, vector, product);
+  gemv_impl<ScalarType,false,true,false,BS>(nVar, nEqn, matrix, vector, product);
 }
 
-MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
+template<class ScalarType>
+__MATVECPROD_SIGNATURE__(ScalarType, MatrixVectorProductTransp) {
   gemv_impl<ScalarType,true,true,true>(nVar, nEqn, matrix, vector, product);
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix_a,
                                                              const ScalarType *matrix_b, ScalarType *product) const {
-  gemm_impl<ScalarType>(nVar, matrix_a, matrix_b, product);
+  gemm_impl<ScalarType,BS>(nVar, matrix_a, matrix_b, product);
 }
 #else
+/*--- With MKL we use the just-in-time kernels instead of the naive implementation,
+ *    the specialized sizes are never selected in this case (see Initialize), BS is 0. ---*/
 MATVECPROD_SIGNATURE( MatrixVectorProduct ) {
-  /*--- With MKL we use the just-in-time kernels instead of the naive implementation. ---*/
   MatrixVectorProductKernelBetaZero(MatrixVectorProductJitterBetaZero, const_cast<ScalarType*>(vector),
                                     const_cast<ScalarType*>(matrix), product );
 }
@@ -143,12 +152,14 @@ MATVECPROD_SIGNATURE( MatrixVectorProductSub ) {
                                          const_cast<ScalarType*>(matrix), product );
 }
 
-MATVECPROD_SIGNATURE( MatrixVectorProductTransp ) {
+template<class ScalarType>
+__MATVECPROD_SIGNATURE__(ScalarType, MatrixVectorProductTransp) {
   MatrixVectorProductTranspKernelBetaOne(MatrixVectorProductTranspJitterBetaOne, const_cast<ScalarType*>(matrix),
                                          const_cast<ScalarType*>(vector), product );
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *matrix_a,
                                                              const ScalarType *matrix_b, ScalarType *product) const {
   MatrixMatrixProductKernel(MatrixMatrixProductJitter, const_cast<ScalarType*>(matrix_a),
@@ -160,66 +171,86 @@ FORCEINLINE void CSysMatrix<ScalarType>::MatrixMatrixProduct(const ScalarType *m
 #undef __MATVECPROD_SIGNATURE__
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
-  MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
+  MatrixCopy<BS>(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
 
-  Gauss_Elimination(block, rhs);
+  Gauss_Elimination<BS>(block, rhs);
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock(unsigned long block_i, ScalarType *invBlock, bool transposed) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
-  MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
+  MatrixCopy<BS>(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
 
-  MatrixInverse(block, invBlock);
+  MatrixInverse<BS>(block, invBlock);
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType *invBlock) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
-  MatrixCopy(&ILU_matrix[dia_ptr_ilu[block_i]*nVar*nVar], block, false);
+  MatrixCopy<BS>(&ILU_matrix[dia_ptr_ilu[block_i]*nVar*nVar], block, false);
 
-  MatrixInverse(block, invBlock);
+  MatrixInverse<BS>(block, invBlock);
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_ub, ScalarType *prod) const {
   unsigned long iVar, index, col_j;
 
-  for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
+  for (iVar = 0; iVar < (BS? BS : nVar); iVar++) prod[iVar] = 0.0;
 
   for (index = dia_ptr[row_i]+1; index < row_ptr[row_i+1]; index++) {
     col_j = col_ind[index];
     if (col_j < col_ub)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
+      MatrixVectorProductAdd<BS>(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
   }
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_lb, ScalarType *prod) const {
   unsigned long iVar, index, col_j;
 
-  for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
+  for (iVar = 0; iVar < (BS? BS : nVar); iVar++) prod[iVar] = 0.0;
 
   for (index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
     col_j = col_ind[index];
     if (col_j >= col_lb)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
+      MatrixVectorProductAdd<BS>(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
   }
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec,
                                                          unsigned long row_i, ScalarType *prod) const {
 
-  MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
+  MatrixVectorProduct<BS>(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
+                                                    unsigned long row_i, ScalarType *prod) const {
+  unsigned long iVar, index, col_j;
+
+  for (iVar = 0; iVar < (BS? BS : nVar); iVar++) prod[iVar] = 0.0;
+
+  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+    col_j = col_ind[index];
+    MatrixVectorProductAdd<BS>(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
+  }
 }
@@ -105,6 +105,14 @@ private:
 
   LinearToleranceType tol_type = LinearToleranceType::RELATIVE; /*!< \brief How the linear solvers interpret the tolerance. */
 
+  unsigned long prec_max_reuse = 1;   /*!< \brief Maximum number of calls to Solve with the same preconditioner. */
+  ScalarType prec_iter_ratio = 1.5;   /*!< \brief Iteration growth (w.r.t. the reference solve) that forces a rebuild. */
+  ScalarType prec_res_ratio = 10.0;   /*!< \brief Final residual growth (w.r.t. the reference solve) that forces a rebuild. */
+  bool prec_rebuild = true;           /*!< \brief The preconditioner needs to be built in the next call to Solve. */
+  unsigned long prec_age = 0;         /*!< \brief Number of calls to Solve since the preconditioner was built. */
+  unsigned long prec_ref_iter = 0;    /*!< \brief Iterations of the reference solve (the first after the build). */
+  ScalarType prec_ref_res = 0.0;      /*!< \brief Final residual of the reference solve. */
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -331,4 +339,19 @@ public:
    */
   inline void SetToleranceType(LinearToleranceType type) {tol_type = type;}
 
+  /*!
+   * \brief Allow consecutive calls to Solve to reuse the ILU or JACOBI preconditioner, i.e. to lag its
+   *        factorization. It is rebuilt after a maximum number of calls, or when the iterations or the final
+   *        residual of a solve grow by some factor w.r.t. the first solve after the last build.
+   * \note Not used in mesh deformation mode nor for the discrete adjoint (whose recording modifies the preconditioner).
+   * \param[in] param - Maximum number of calls (1 means the preconditioner is always rebuilt), iteration factor,
+   *                    residual factor (see e.g. LINEAR_SOLVER_PREC_REUSE_FLOW).
+   */
+  inline void SetPreconditionerReuse(const su2double* param) {
+    prec_max_reuse = SU2_TYPE::Int(param[0]);
+    prec_iter_ratio = SU2_TYPE::GetValue(param[1]);
+    prec_res_ratio = SU2_TYPE::GetValue(param[2]);
+    prec_rebuild = true;
+  }
+
 };
@@ -129,6 +129,22 @@ inline constexpr size_t nextMultiple(size_t argument, size_t multiple)
   return roundUpDiv(argument, multiple) * multiple;
 }
 
+/*!
+ * \brief Greatest common divisor (Euclid's algorithm).
+ */
+inline constexpr size_t greatestCommonDivisor(size_t a, size_t b)
+{
+  return b? greatestCommonDivisor(b, a%b) : a;
+}
+
+/*!
+ * \brief Least common multiple, i.e. the smallest number that is a multiple of both arguments.
+ */
+inline constexpr size_t leastCommonMultiple(size_t a, size_t b)
+{
+  return (a/greatestCommonDivisor(a, b)) * b;
+}
+
 /*!
  * \brief Compute a chunk size based on totalWork and number of threads such that
  *        all threads get the same number of chunks (with limited size).
@@ -1616,7 +1616,8 @@ enum ENUM_OUTPUT {
   STL_BINARY              = 16, /*!< \brief STL binary format for surface solution output. Not implemented yet. */
   PARAVIEW_XML            = 17, /*!< \brief Paraview XML with binary data format */
   SURFACE_PARAVIEW_XML    = 18, /*!< \brief Surface Paraview XML with binary data format */
-  PARAVIEW_MULTIBLOCK     = 19  /*!< \brief Paraview XML Multiblock */
+  PARAVIEW_MULTIBLOCK     = 19, /*!< \brief Paraview XML Multiblock */
+  TIME_SERIES             = 20  /*!< \brief SU2 binary time series (one file for all snapshots) with an XDMF index. */
 };
 static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("TECPLOT_ASCII", TECPLOT)
@@ -1637,6 +1638,19 @@ static const MapType<string, ENUM_OUTPUT> Output_Map = {
   MakePair("CGNS", CGNS)
   MakePair("STL", STL)
   MakePair("STL_BINARY", STL_BINARY)
+  MakePair("TIME_SERIES", TIME_SERIES)
+};
+
+/*!
+ * \brief Compression of the data arrays of binary output files
+ */
+enum ENUM_OUTPUT_COMPRESSION {
+  NO_COMPRESSION = 0,   /*!< \brief Raw binary data. */
+  LZ4_COMPRESSION = 1   /*!< \brief Byte-shuffle (restart files only) and LZ4 coding of each rank's data. */
+};
+static const MapType<string, ENUM_OUTPUT_COMPRESSION> Output_Compression_Map = {
+  MakePair("NONE", NO_COMPRESSION)
+  MakePair("LZ4", LZ4_COMPRESSION)
 };
 
 /*!
@@ -1979,6 +1993,18 @@ static const MapType<string, ENUM_DEFORM_STIFFNESS> Deform_Stiffness_Map = {
   MakePair("WALL_DISTANCE", SOLID_WALL_DISTANCE)
 };
 
+/*!
+ * \brief Method used to deform the volume mesh from the boundary displacements.
+ */
+enum ENUM_DEFORM_METHOD {
+  ELASTICITY_DEFORMATION = 0, /*!< \brief Solve a linear elasticity problem for the displacements. */
+  RBF_DEFORMATION = 1         /*!< \brief Interpolate the displacements with radial basis functions. */
+};
+static const MapType<string, ENUM_DEFORM_METHOD> Deform_Method_Map = {
+  MakePair("ELASTICITY", ELASTICITY_DEFORMATION)
+  MakePair("RBF", RBF_DEFORMATION)
+};
+
 /*!
  * \brief The direct differentation variables.
  */
@@ -0,0 +1,131 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Byte shuffling, LZ4 block coding and error-bounded quantization
+ *        used to compress output and restart data.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+namespace CompressionToolbox {
+
+/*!
+ * \brief Tag stored in the fourth header int of SU2 binary restart files whose data section is
+ *        made of compressed per-rank blocks (hex representation of "LZ4"), see CSU2BinaryFileWriter.
+ */
+constexpr int COMPRESSED_FORMAT_TAG = 0x4C5A34;
+
+/*!
+ * \brief Per-field codecs of the compressed SU2 binary format.
+ */
+enum FIELD_CODEC : int {
+  CODEC_SHUFFLE_LZ4 = 1,  /*!< \brief Lossless, byte-shuffle followed by LZ4 coding. */
+  CODEC_QUANTIZED_LZ4 = 2 /*!< \brief Error-bounded quantization, byte-shuffle and LZ4 coding. */
+};
+
+/*!
+ * \brief Transpose the bytes of n elements of size elemSize, i.e. all first bytes, then all second bytes, etc.
+ *        Smooth fields then have long runs of similar (exponent) bytes that the LZ coder can exploit.
+ * \param[in] in - Input elements.
+ * \param[in] n - Number of elements.
+ * \param[in] elemSize - Size of each element in bytes.
+ * \param[out] out - Shuffled bytes (n*elemSize), must not alias the input.
+ */
+void ByteShuffle(const void* in, size_t n, size_t elemSize, void* out);
+
+/*!
+ * \brief Inverse of ByteShuffle.
+ */
+void ByteUnshuffle(const void* in, size_t n, size_t elemSize, void* out);
+
+/*!
+ * \brief Upper bound for the size of the LZ4 encoding of n bytes.
+ */
+inline size_t LZ4CompressBound(size_t n) { return n + n/255 + 16; }
+
+/*!
+ * \brief Encode a buffer in the LZ4 block format (readable by any LZ4 decoder, e.g. vtkLZ4DataCompressor).
+ * \param[in] src - Input bytes.
+ * \param[in] n - Number of input bytes.
+ * \param[out] dst - Output buffer of at least LZ4CompressBound(n) bytes.
+ * \return Size of the compressed data in bytes.
+ */
+size_t LZ4Compress(const uint8_t* src, size_t n, uint8_t* dst);
+
+/*!
+ * \brief Decode a LZ4 block.
+ * \param[in] src - Compressed bytes.
+ * \param[in] compSize - Number of compressed bytes.
+ * \param[out] dst - Output buffer.
+ * \param[in] rawSize - Expected size of the decoded data.
+ * \return True if the block was well formed and decoded to exactly rawSize bytes.
+ */
+bool LZ4Decompress(const uint8_t* src, size_t compSize, uint8_t* dst, size_t rawSize);
+
+/*!
+ * \brief Round values to multiples of the largest power of two not exceeding 2*tol.
+ * \note The absolute error is at most tol and the trailing mantissa bits become zero,
+ *       which makes the shuffled bytes highly compressible.
+ * \param[in,out] data - Values to quantize.
+ * \param[in] n - Number of values.
+ * \param[in] tol - Absolute error bound, nothing is done if tol <= 0.
+ */
+template<class T>
+void Quantize(T* data, size_t n, double tol) {
+  if (!(tol > 0.0)) return;
+  const T step = T(std::ldexp(1.0, std::ilogb(2.0*tol)));
+  for (size_t i = 0; i < n; ++i) {
+    if (std::isfinite(data[i])) data[i] = std::nearbyint(data[i]/step)*step;
+  }
+}
+
+/*!
+ * \brief Compress the field-major block of nPoint x nField doubles of one rank.
+ * \note Layout of the block: for each field a uint64 with the compressed size followed by the LZ4 stream
+ *       of the byte-shuffled values.
+ * \param[in] data - Field-major values, data[iField*nPoint + iPoint], quantized fields are modified.
+ * \param[in] nPoint - Number of points of the block.
+ * \param[in] codec - Codec of each field.
+ * \param[in] tol - Error bound of each field (only used by CODEC_QUANTIZED_LZ4).
+ * \param[out] block - The compressed block.
+ */
+void CompressBlock(double* data, size_t nPoint, const std::vector<int>& codec,
+                   const std::vector<double>& tol, std::vector<uint8_t>& block);
+
+/*!
+ * \brief Decompress a block written by CompressBlock.
+ * \param[in] block - Pointer to the compressed block.
+ * \param[in] blockSize - Size of the compressed block in bytes.
+ * \param[in] nPoint - Number of points in the block.
+ * \param[in] nField - Number of fields in the block.
+ * \param[out] data - Point-major values, data[iPoint*nField + iField], of size nPoint*nField.
+ * \return True if the block was successfully decoded.
+ */
+bool DecompressBlock(const uint8_t* block, size_t blockSize, size_t nPoint, size_t nField, double* data);
+
+}
@@ -913,6 +913,8 @@ void CConfig::SetPointersNull(void) {
 
   RefOriginMoment     = nullptr;
   CFL_AdaptParam      = nullptr;
+  Linear_Solver_Prec_Reuse_Flow = nullptr;
+  Linear_Solver_Prec_Reuse_Turb = nullptr;
   CFL                 = nullptr;
   HTP_Axis = nullptr;
   PlaneTag            = nullptr;
@@ -1027,6 +1029,10 @@ void CConfig::SetPointersNull(void) {
   ScreenOutput = nullptr;
   HistoryOutput = nullptr;
   VolumeOutput = nullptr;
+  Output_Lossy_Fields = nullptr;
+  InSitu_Fields = nullptr;
+  InSitu_Probes = nullptr;
+  InSitu_Slices = nullptr;
   VolumeOutputFiles = nullptr;
   ConvField = nullptr;
 
@@ -1186,6 +1192,25 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulated (look-up table) fluid model ---*/
+
+  /* DESCRIPTION: Replace the compressible fluid model by a look-up table of it in (rho, e) */
+  addBoolOption("FLUID_TABLE", Fluid_Table, false);
+  /* DESCRIPTION: Read the fluid table from FLUID_TABLE_FILENAME, otherwise it is generated and written to it */
+  addBoolOption("FLUID_TABLE_READ", Fluid_Table_Read, false);
+  /* DESCRIPTION: File of the fluid table (SI units) */
+  addStringOption("FLUID_TABLE_FILENAME", Fluid_Table_FileName, string("fluid_table.dat"));
+  /* DESCRIPTION: Density range of the generated table (kg/m^3), (0, 0) is 0.2 to 5 times the free-stream density */
+  default_fluid_table_density[0] = 0.0; default_fluid_table_density[1] = 0.0;
+  addDoubleArrayOption("FLUID_TABLE_DENSITY_RANGE", 2, Fluid_Table_Density, default_fluid_table_density);
+  /* DESCRIPTION: Temperature range of the generated table (K), (0, 0) is 0.5 to 2 times the free-stream temperature */
+  default_fluid_table_temperature[0] = 0.0; default_fluid_table_temperature[1] = 0.0;
+  addDoubleArrayOption("FLUID_TABLE_TEMPERATURE_RANGE", 2, Fluid_Table_Temperature, default_fluid_table_temperature);
+  /* DESCRIPTION: Number of density nodes of the generated table */
+  addUnsignedLongOption("FLUID_TABLE_DENSITY_NODES", Fluid_Table_nDensity, 200);
+  /* DESCRIPTION: Number of energy nodes of the generated table */
+  addUnsignedLongOption("FLUID_TABLE_ENERGY_NODES", Fluid_Table_nEnergy, 200);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1686,6 +1711,14 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Solve the mean flow and turbulence equations as one block-coupled linear system (compressible RANS). */
+  addBoolOption("COUPLED_TURB_SOLVE", Coupled_Turb_Solve, false);
+  /* DESCRIPTION: Reuse of the ILU, JACOBI, or LINELET preconditioner across iterations (max. number of solves with the same
+   preconditioner, factor on the linear iterations and factor on the final residual that force a rebuild). */
+  default_prec_reuse[0] = 1.0; default_prec_reuse[1] = 1.5; default_prec_reuse[2] = 10.0;
+  addDoubleArrayOption("LINEAR_SOLVER_PREC_REUSE_FLOW", 3, Linear_Solver_Prec_Reuse_Flow, default_prec_reuse);
+  /* DESCRIPTION: Same for the turbulence solver. */
+  addDoubleArrayOption("LINEAR_SOLVER_PREC_REUSE_TURB", 3, Linear_Solver_Prec_Reuse_Turb, default_prec_reuse);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1763,6 +1796,10 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_LINE_AGGLOMERATION\n DESCRIPTION: Agglomerate the stretched cells along lines normal to the walls, the coarse levels then use the linelet preconditioner. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_LINE_AGGLOMERATION", MG_LineAgglomeration, false);
+  /*!\brief MG_LINE_COARSENING\n DESCRIPTION: Number of line points merged into each coarse control volume. DEFAULT: 2 \ingroup Config*/
+  addUnsignedShortOption("MG_LINE_COARSENING", MG_LineCoarsening, 2);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1773,6 +1810,10 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute the gradients and limiters of the flow primitive variables in one pass over the grid,
+   *  caching the least-squares matrices of static grids. DEFAULT: NO. \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", FusedGradientLimiter, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1935,6 +1976,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /* DESCRIPTION: Partition cache, store the points and elements of each rank on disk, and load them in later runs with the same grid and number of ranks */
+  addBoolOption("GEOMETRY_CACHE", Geometry_Cache, false);
+  /* DESCRIPTION: Prefix of the partition cache files, the zone and rank numbers are appended (default: geometry_cache) */
+  addStringOption("GEOMETRY_CACHE_FILENAME", Geometry_Cache_FileName, string("geometry_cache"));
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2107,6 +2152,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("SMOOTH_GEOMETRY", SmoothNumGrid, false);
   /* DESCRIPTION: Adapt the boundary elements */
   addBoolOption("ADAPT_BOUNDARY", AdaptBoundary, true);
+  /* DESCRIPTION: Adapt the partitioned grid in parallel (SU2_MSH), instead of the serial adaptation */
+  addBoolOption("ADAPT_DISTRIBUTED", AdaptDistributed, false);
 
   /*!\par CONFIG_CATEGORY: Aeroelastic Simulation (Typical Section Model) \ingroup Config*/
   /*--- Options related to aeroelastic simulations using the Typical Section Model) ---*/
@@ -2239,6 +2286,16 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_POISSONS_RATIO", Deform_PoissonRatio, 0.3);
   /* DESCRIPTION: Size of the layer of highest stiffness for wall distance-based mesh stiffness */
   addDoubleOption("DEFORM_STIFF_LAYER_SIZE", Deform_StiffLayerSize, 0.0);
+  /* DESCRIPTION: Method used to deform the volume mesh (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Deform_Method, Deform_Method_Map, ELASTICITY_DEFORMATION);
+  /* DESCRIPTION: Type of radial basis function for the RBF mesh deformation */
+  addEnumOption("DEFORM_RBF_KIND", Deform_RBF_Kind, RadialBasisFunction_Map, WENDLAND_C2);
+  /* DESCRIPTION: Radius of the radial basis functions, 0 uses the size of the bounding box of the boundaries */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 0.0);
+  /* DESCRIPTION: Tolerance of the greedy selection of RBF centers, relative to the maximum boundary displacement */
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tol, 1e-3);
+  /* DESCRIPTION: Maximum number of RBF centers */
+  addUnsignedLongOption("DEFORM_RBF_MAX_CENTERS", Deform_RBF_MaxCenters, 2000);
   /*  DESCRIPTION: Linear solver for the mesh deformation\n OPTIONS: see \link Linear_Solver_Map \endlink \n DEFAULT: FGMRES \ingroup Config*/
   addEnumOption("DEFORM_LINEAR_SOLVER", Kind_Deform_Linear_Solver, Linear_Solver_Map, FGMRES);
   /*  \n DESCRIPTION: Preconditioner for the Krylov linear solvers \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: LU_SGS \ingroup Config*/
@@ -2775,6 +2832,23 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Compression of the restart (RESTART) and Paraview XML (PARAVIEW, SURFACE_PARAVIEW) files */
+  addEnumOption("OUTPUT_COMPRESSION", Kind_Output_Compression, Output_Compression_Map, NO_COMPRESSION);
+  /* DESCRIPTION: Visualization-only fields that are quantized (lossy) before compression */
+  addStringListOption("OUTPUT_LOSSY_FIELDS", nOutput_Lossy_Fields, Output_Lossy_Fields);
+  /* DESCRIPTION: Absolute error bound of the quantized fields */
+  addDoubleOption("OUTPUT_LOSSY_TOLERANCE", Output_Lossy_Tolerance, 1e-6);
+
+  /* DESCRIPTION: Volume output fields reduced during unsteady runs (statistics, probes, slices) */
+  addStringListOption("INSITU_FIELDS", nInSitu_Fields, InSitu_Fields);
+  /* DESCRIPTION: Running mean and variance of the in-situ fields as additional volume output */
+  addBoolOption("INSITU_STATISTICS", InSitu_Statistics, false);
+  /* DESCRIPTION: Coordinates of the probes sampled every time step */
+  addDoubleListOption("INSITU_PROBES", nInSitu_Probes, InSitu_Probes);
+  /* DESCRIPTION: Slice planes given by an origin and a normal */
+  addDoubleListOption("INSITU_SLICES", nInSitu_Slices, InSitu_Slices);
+  /* DESCRIPTION: Writing frequency of the slices */
+  addUnsignedLongOption("INSITU_SLICE_FREQ", InSitu_Slice_Freq, 1);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -3203,6 +3277,30 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     }
   }
 
+  /*--- In-situ reductions, probes are given by their coordinates and slices by origin and normal. ---*/
+  if ((InSitu_Statistics || nInSitu_Probes > 0 || nInSitu_Slices > 0) && nInSitu_Fields == 0) {
+    SU2_MPI::Error("In-situ statistics, probes and slices require INSITU_FIELDS.", CURRENT_FUNCTION);
+  }
+  if (val_nDim > 0 && nInSitu_Probes % val_nDim != 0) {
+    SU2_MPI::Error("INSITU_PROBES must contain nDim coordinates per probe.", CURRENT_FUNCTION);
+  }
+  if (val_nDim > 0 && nInSitu_Slices % (2*val_nDim) != 0) {
+    SU2_MPI::Error("INSITU_SLICES must contain an origin and a normal (2*nDim values) per slice.", CURRENT_FUNCTION);
+  }
+  if (InSitu_Slice_Freq == 0) {
+    SU2_MPI::Error("INSITU_SLICE_FREQ must be positive.", CURRENT_FUNCTION);
+  }
+
+  /*--- Quantization is part of the compressed formats. ---*/
+  if (nOutput_Lossy_Fields > 0) {
+    if (Kind_Output_Compression == NO_COMPRESSION) {
+      SU2_MPI::Error("OUTPUT_LOSSY_FIELDS requires OUTPUT_COMPRESSION= LZ4.", CURRENT_FUNCTION);
+    }
+    if (Output_Lossy_Tolerance <= 0.0) {
+      SU2_MPI::Error("OUTPUT_LOSSY_TOLERANCE must be positive.", CURRENT_FUNCTION);
+    }
+  }
+
 
   if (Kind_Solver == NAVIER_STOKES && Kind_Turb_Model != NONE){
     SU2_MPI::Error("KIND_TURB_MODEL must be NONE if SOLVER= NAVIER_STOKES", CURRENT_FUNCTION);
@@ -3996,6 +4094,9 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   FinestMesh = MESH_0;
   if (MGCycle == FULLMG_CYCLE) FinestMesh = nMGLevels;
 
+  if (MG_LineAgglomeration && (MG_LineCoarsening < 2))
+    SU2_MPI::Error("MG_LINE_COARSENING must be at least 2.", CURRENT_FUNCTION);
+
   if ((Kind_Solver == NAVIER_STOKES) &&
       (Kind_Turb_Model != NONE))
     Kind_Solver = RANS;
@@ -4004,6 +4105,22 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
       (Kind_Turb_Model != NONE))
     Kind_Solver = INC_RANS;
 
+  if (Coupled_Turb_Solve) {
+    if ((Kind_Solver != RANS) || DiscreteAdjoint || ContinuousAdjoint)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE is only available for the direct compressible RANS solver.", CURRENT_FUNCTION);
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (Kind_TimeIntScheme_Turb != EULER_IMPLICIT))
+      SU2_MPI::Error("COUPLED_TURB_SOLVE requires TIME_DISCRE_FLOW= EULER_IMPLICIT and TIME_DISCRE_TURB= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE requires MGLEVEL= 0 (no multigrid).", CURRENT_FUNCTION);
+    if (nMarker_PerBound != 0)
+      SU2_MPI::Error("COUPLED_TURB_SOLVE cannot be used with periodic boundaries.", CURRENT_FUNCTION);
+  }
+
+  for (const auto reuse : {Linear_Solver_Prec_Reuse_Flow, Linear_Solver_Prec_Reuse_Turb}) {
+    if ((reuse[0] < 1.0) || (reuse[1] < 1.0) || (reuse[2] < 1.0))
+      SU2_MPI::Error("The values of LINEAR_SOLVER_PREC_REUSE_FLOW/TURB must be at least 1.", CURRENT_FUNCTION);
+  }
+
   if (Kind_Solver == EULER ||
       Kind_Solver == INC_EULER ||
       Kind_Solver == FEM_EULER)
@@ -7668,6 +7785,10 @@ CConfig::~CConfig(void) {
   delete [] ScreenOutput;
   delete [] HistoryOutput;
   delete [] VolumeOutput;
+  delete [] Output_Lossy_Fields;
+  delete [] InSitu_Fields;
+  delete [] InSitu_Probes;
+  delete [] InSitu_Slices;
   delete [] Mesh_Box_Size;
   delete [] VolumeOutputFiles;
 
@@ -7732,6 +7853,22 @@ string CConfig::GetUnsteady_FileName(string val_filename, int val_iter, string e
   return UnstFilename;
 }
 
+bool CConfig::SplitUnsteady_FileName(const string& val_filename, string& base_filename, unsigned long& val_iter) const {
+
+  /*--- The iteration is appended as "_" followed by at least 5 digits. ---*/
+
+  const auto pos = val_filename.find_last_of('_');
+  if (pos == string::npos) return false;
+
+  const string digits = val_filename.substr(pos+1);
+  if (digits.size() < 5 || digits.find_first_not_of("0123456789") != string::npos) return false;
+
+  base_filename = val_filename.substr(0, pos);
+  val_iter = stoul(digits);
+
+  return true;
+}
+
 string CConfig::GetMultizone_FileName(string val_filename, int val_iZone, string ext) const {
 
     string multizone_filename = val_filename;
@@ -0,0 +1,1221 @@
+/*!
+ * \file CDistributedGridAdaptation.cpp
+ * \brief Grid adaptation of partitioned (distributed) grids.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/CDistributedGridAdaptation.hpp"
+#include "../include/toolboxes/CLinearPartitioner.hpp"
+
+namespace {
+
+/*--- Local edges of the elements that can be divided. ---*/
+
+const unsigned short LineEdges[1][2] = {{0,1}};
+const unsigned short TriangleEdges[3][2] = {{0,1}, {1,2}, {2,0}};
+const unsigned short QuadEdges[4][2] = {{0,1}, {1,2}, {2,3}, {3,0}};
+const unsigned short TetraEdges[6][2] = {{0,1}, {0,2}, {0,3}, {1,2}, {1,3}, {2,3}};
+
+/*--- Edges of the face opposite to each node of a tetrahedron, and edge between two nodes. ---*/
+
+const unsigned short TetraFaceEdges[4][3] = {{3,4,5}, {1,2,5}, {0,2,4}, {0,1,3}};
+const unsigned short TetraEdgeIndex[4][4] = {{0,0,1,2}, {0,0,3,4}, {1,3,0,5}, {2,4,5,0}};
+
+/*!
+ * \brief Local edges of the elements that can be divided.
+ * \param[in] vtk - Type of element.
+ * \param[out] nEdge - Number of edges, 0 if the element cannot be divided.
+ * \return Pairs of local nodes of each edge.
+ */
+const unsigned short (*DivisibleEdges(unsigned short vtk, unsigned short &nEdge))[2] {
+  switch (vtk) {
+    case LINE:          nEdge = 1; return LineEdges;
+    case TRIANGLE:      nEdge = 3; return TriangleEdges;
+    case QUADRILATERAL: nEdge = 4; return QuadEdges;
+    case TETRAHEDRON:   nEdge = 6; return TetraEdges;
+    default:            nEdge = 0; return nullptr;
+  }
+}
+
+/*!
+ * \brief Number of nodes of an element type.
+ */
+unsigned short NodesPerElem(unsigned long vtk) {
+  switch (vtk) {
+    case LINE:          return N_POINTS_LINE;
+    case TRIANGLE:      return N_POINTS_TRIANGLE;
+    case QUADRILATERAL: return N_POINTS_QUADRILATERAL;
+    case TETRAHEDRON:   return N_POINTS_TETRAHEDRON;
+    case HEXAHEDRON:    return N_POINTS_HEXAHEDRON;
+    case PRISM:         return N_POINTS_PRISM;
+    case PYRAMID:       return N_POINTS_PYRAMID;
+    default:            return 0;
+  }
+}
+
+/*!
+ * \brief Signed volume (times 6) of a tetrahedron.
+ */
+su2double TetraVolume(const su2double *a, const su2double *b, const su2double *c, const su2double *d) {
+  su2double u[3], v[3], w[3];
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    u[iDim] = b[iDim]-a[iDim]; v[iDim] = c[iDim]-a[iDim]; w[iDim] = d[iDim]-a[iDim];
+  }
+  return u[0]*(v[1]*w[2]-v[2]*w[1]) - u[1]*(v[0]*w[2]-v[2]*w[0]) + u[2]*(v[0]*w[1]-v[1]*w[0]);
+}
+
+/*!
+ * \brief Number of bits set in a mask of edges.
+ */
+unsigned short CountEdges(unsigned short mask) {
+  unsigned short n = 0;
+  for (; mask; mask >>= 1) n += mask & 1;
+  return n;
+}
+
+}
+
+CDistributedGridAdaptation::CDistributedGridAdaptation(CGeometry *geometry, CConfig *config) :
+  CGridAdaptation(geometry, config) {
+
+  unsigned long iPoint, jPoint, iElem, iEdge;
+  unsigned short iNode;
+  int iRank;
+
+  if (config->GetnMarker_Periodic() > 0)
+    SU2_MPI::Error("The distributed grid adaptation does not support periodic boundaries.", CURRENT_FUNCTION);
+
+  Global_nPointOld = geometry->GetGlobal_nPointDomain();
+  Global_nPointNew = Global_nPointOld;
+  Global_nElemNew = 0;
+
+  const unsigned short kind = config->GetKind_Adaptation();
+
+  Restart_Flow = ((kind == FULL_FLOW) || (kind == GRAD_FLOW) || (kind == FULL_ADJOINT) ||
+                  (kind == GRAD_ADJOINT) || (kind == GRAD_FLOW_ADJ) || (kind == REMAINING) ||
+                  (kind == COMPUTABLE));
+
+  Restart_Adjoint = ((kind == FULL_ADJOINT) || (kind == GRAD_ADJOINT) || (kind == GRAD_FLOW_ADJ) ||
+                     (kind == REMAINING) || (kind == COMPUTABLE));
+
+  /*--- The flow restart files of RANS problems also have the turbulence variables. ---*/
+
+  switch (config->GetKind_Turb_Model()) {
+    case NONE:              nVarTurb = 0; break;
+    case SST: case SST_SUST: nVarTurb = 2; break;
+    default:                nVarTurb = 1; break;
+  }
+  TurbVar_Sol.resize(geometry->GetnPoint(), nVarTurb) = su2double(0.0);
+
+  const auto nodes = geometry->nodes;
+
+  /*--- An element is owned by the rank owning its node with lowest global index,
+   that rank has all the elements around the node. ---*/
+
+  OwnedElem.resize(geometry->GetnElem());
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    auto elem = geometry->elem[iElem];
+    iPoint = elem->GetNode(0);
+    for (iNode = 1; iNode < elem->GetnNodes(); iNode++) {
+      jPoint = elem->GetNode(iNode);
+      if (nodes->GetGlobalIndex(jPoint) < nodes->GetGlobalIndex(iPoint)) iPoint = jPoint;
+    }
+    OwnedElem[iElem] = nodes->GetDomain(iPoint);
+  }
+
+  /*--- Communication pattern of the halo points, ask their owners. ---*/
+
+  vector<vector<unsigned long> > sendBuf(size), recvBuf;
+
+  HaloRecv.resize(size);
+  HaloSend.resize(size);
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    if (nodes->GetDomain(iPoint)) continue;
+    iRank = nodes->GetColor(iPoint);
+    HaloRecv[iRank].push_back(iPoint);
+    sendBuf[iRank].push_back(nodes->GetGlobalIndex(iPoint));
+  }
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  for (iRank = 0; iRank < size; iRank++) {
+    for (auto iGlobal : recvBuf[iRank]) {
+      const long iLocal = geometry->GetGlobal_to_Local_Point(iGlobal);
+      if (iLocal < 0 || !nodes->GetDomain(iLocal))
+        SU2_MPI::Error("Halo point not owned by the expected rank.", CURRENT_FUNCTION);
+      HaloSend[iRank].push_back(iLocal);
+    }
+  }
+
+  /*--- Communication pattern of the edges, an edge is owned by the rank owning its
+   node with lowest global index (which has all the elements around the edge). ---*/
+
+  for (iRank = 0; iRank < size; iRank++) sendBuf[iRank].clear();
+
+  EdgeRecv.resize(size);
+  EdgeSend.resize(size);
+
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    iPoint = geometry->edges->GetNode(iEdge,0);
+    jPoint = geometry->edges->GetNode(iEdge,1);
+    if (nodes->GetGlobalIndex(jPoint) < nodes->GetGlobalIndex(iPoint)) swap(iPoint, jPoint);
+    if (nodes->GetDomain(iPoint)) continue;
+    iRank = nodes->GetColor(iPoint);
+    EdgeRecv[iRank].push_back(iEdge);
+    sendBuf[iRank].push_back(nodes->GetGlobalIndex(iPoint));
+    sendBuf[iRank].push_back(nodes->GetGlobalIndex(jPoint));
+  }
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  for (iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iPair = 0; iPair < recvBuf[iRank].size(); iPair += 2) {
+      const long iLocal = geometry->GetGlobal_to_Local_Point(recvBuf[iRank][iPair]);
+      const long jLocal = geometry->GetGlobal_to_Local_Point(recvBuf[iRank][iPair+1]);
+      if (iLocal < 0 || jLocal < 0 || !geometry->CheckEdge(iLocal, jLocal))
+        SU2_MPI::Error("Edge not found on the rank owning it.", CURRENT_FUNCTION);
+      EdgeSend[iRank].push_back(geometry->FindEdge(iLocal, jLocal));
+    }
+  }
+
+  EdgeStatus.assign(geometry->GetnEdge(), EDGE_KEEP);
+  EdgeNode.assign(geometry->GetnEdge(), 0);
+
+}
+
+template<class T>
+void CDistributedGridAdaptation::Exchange(const vector<vector<T> >& sendBuf, vector<vector<T> >& recvBuf,
+                                          SU2_MPI::Datatype type) const {
+
+  vector<int> nSend(size), nRecv(size), sendDisp(size+1, 0), recvDisp(size+1, 0);
+
+  for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendBuf[iRank].size();
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+    recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+  }
+
+  vector<T> sendFlat(max(sendDisp[size],1)), recvFlat(max(recvDisp[size],1));
+
+  for (int iRank = 0; iRank < size; iRank++)
+    copy(sendBuf[iRank].begin(), sendBuf[iRank].end(), sendFlat.begin()+sendDisp[iRank]);
+
+  SU2_MPI::Alltoallv(sendFlat.data(), nSend.data(), sendDisp.data(), type,
+                     recvFlat.data(), nRecv.data(), recvDisp.data(), type, MPI_COMM_WORLD);
+
+  recvBuf.resize(size);
+  for (int iRank = 0; iRank < size; iRank++)
+    recvBuf[iRank].assign(recvFlat.begin()+recvDisp[iRank], recvFlat.begin()+recvDisp[iRank+1]);
+
+}
+
+void CDistributedGridAdaptation::CommunicateHalos(su2double *values) const {
+
+  vector<vector<su2double> > sendBuf(size), recvBuf;
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (auto iPoint : HaloSend[iRank]) sendBuf[iRank].push_back(values[iPoint]);
+
+  Exchange(sendBuf, recvBuf, MPI_DOUBLE);
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (unsigned long iRecv = 0; iRecv < recvBuf[iRank].size(); iRecv++)
+      values[HaloRecv[iRank][iRecv]] = recvBuf[iRank][iRecv];
+
+}
+
+bool CDistributedGridAdaptation::SynchronizeEdges() {
+
+  bool changed = false;
+  vector<vector<unsigned long> > sendBuf(size), recvBuf;
+
+  /*--- Send the status to the owners, which keep the highest. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++)
+    for (auto iEdge : EdgeRecv[iRank]) sendBuf[iRank].push_back(EdgeStatus[iEdge]);
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iRecv = 0; iRecv < recvBuf[iRank].size(); iRecv++) {
+      const auto iEdge = EdgeSend[iRank][iRecv];
+      if (recvBuf[iRank][iRecv] > EdgeStatus[iEdge]) {
+        EdgeStatus[iEdge] = recvBuf[iRank][iRecv];
+        changed = true;
+      }
+    }
+  }
+
+  /*--- Send the merged status back to all the ranks sharing the edges. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendBuf[iRank].clear();
+    for (auto iEdge : EdgeSend[iRank]) sendBuf[iRank].push_back(EdgeStatus[iEdge]);
+  }
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iRecv = 0; iRecv < recvBuf[iRank].size(); iRecv++) {
+      const auto iEdge = EdgeRecv[iRank][iRecv];
+      if (recvBuf[iRank][iRecv] != EdgeStatus[iEdge]) {
+        EdgeStatus[iEdge] = recvBuf[iRank][iRecv];
+        changed = true;
+      }
+    }
+  }
+
+  return changed;
+
+}
+
+bool CDistributedGridAdaptation::SetEdgeClosure(CGeometry *geometry) {
+
+  bool changed = false;
+  unsigned short iNode, jNode, iEdge, nEdge;
+  unsigned long edge[6];
+
+  /*--- The rules are evaluated with the status before the sweep (Jacobi), the result is then
+   independent of the order of the elements, and thus of the partitioning. ---*/
+
+  const vector<unsigned long> OldStatus(EdgeStatus);
+
+  auto Raise = [&](unsigned long iEdge, unsigned long status) {
+    if (EdgeStatus[iEdge] < status) { EdgeStatus[iEdge] = status; changed = true; }
+  };
+
+  for (unsigned long iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    auto elem = geometry->elem[iElem];
+    const unsigned short vtk = elem->GetVTK_Type();
+    const auto ElemEdges = DivisibleEdges(vtk, nEdge);
+
+    /*--- The edges of the elements that cannot be divided are never split. ---*/
+
+    if ((ElemEdges == nullptr) || (vtk == LINE)) {
+      for (iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+        for (jNode = iNode+1; jNode < elem->GetnNodes(); jNode++) {
+          const auto iPoint = elem->GetNode(iNode), jPoint = elem->GetNode(jNode);
+          if (geometry->CheckEdge(iPoint, jPoint)) Raise(geometry->FindEdge(iPoint, jPoint), EDGE_LOCKED);
+        }
+      }
+      continue;
+    }
+
+    unsigned short split = 0, locked = 0;
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      edge[iEdge] = geometry->FindEdge(elem->GetNode(ElemEdges[iEdge][0]), elem->GetNode(ElemEdges[iEdge][1]));
+      if (OldStatus[edge[iEdge]] == EDGE_SPLIT) split |= 1 << iEdge;
+      if (OldStatus[edge[iEdge]] == EDGE_LOCKED) locked |= 1 << iEdge;
+    }
+
+    /*--- Smallest supported pattern containing the split edges. ---*/
+
+    const unsigned short all = (1 << nEdge) - 1;
+    const unsigned short nSplit = CountEdges(split);
+    unsigned short pattern = split;
+
+    switch (vtk) {
+      case QUADRILATERAL:
+        if ((nSplit > 1) && (split != 5) && (split != 10)) pattern = all;
+        break;
+      case TETRAHEDRON:
+        if (nSplit > 1) {
+          pattern = all;
+          for (iNode = 0; iNode < 4; iNode++) {
+            unsigned short face = 0;
+            for (auto jEdge : TetraFaceEdges[iNode]) face |= 1 << jEdge;
+            if ((split & ~face) == 0) pattern = face;
+          }
+        }
+        break;
+      default:
+        break;
+    }
+
+    if (pattern == split) continue;
+
+    /*--- If a missing edge is locked the element is not divided, its edges are locked. ---*/
+
+    const unsigned short status = (pattern & locked)? EDGE_LOCKED : EDGE_SPLIT;
+    const unsigned short update = (status == EDGE_LOCKED)? all : (pattern & ~split);
+
+    for (iEdge = 0; iEdge < nEdge; iEdge++)
+      if (update & (1 << iEdge)) Raise(edge[iEdge], status);
+  }
+
+  return changed;
+
+}
+
+void CDistributedGridAdaptation::SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem) {
+
+  unsigned long iElem, nElem_Owned = 0, Global_nElem_Owned = 0;
+  unsigned short iNode, nEdge;
+  const unsigned long nElem = geometry->GetnElem();
+
+  /*--- The index of the halo points is only complete on the ranks owning them. ---*/
+
+  CommunicateHalos(Index);
+
+  for (iElem = 0; iElem < nElem; iElem++) nElem_Owned += OwnedElem[iElem];
+
+  SU2_MPI::Allreduce(&nElem_Owned, &Global_nElem_Owned, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  const unsigned long Global_max_elem = SU2_TYPE::Int(0.01*config->GetNew_Elem_Adapt()*su2double(Global_nElem_Owned));
+
+  /*--- Compute the adaptation index at each element, all the copies of an element get the same value. ---*/
+
+  vector<su2double> Sensor(nElem, 0.0);
+  su2double Max_Sensor = 0.0, Global_Max_Sensor = 0.0;
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+    auto elem = geometry->elem[iElem];
+    for (iNode = 0; iNode < elem->GetnNodes(); iNode++)
+      Sensor[iElem] += Index[elem->GetNode(iNode)];
+    Sensor[iElem] /= elem->GetnNodes();
+    Max_Sensor = max(Max_Sensor, Sensor[iElem]);
+  }
+
+  SU2_MPI::Allreduce(&Max_Sensor, &Global_Max_Sensor, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  if (Global_Max_Sensor <= 0.0) {
+    if (rank == MASTER_NODE) cout << "WARNING: The adaptation index is zero everywhere." << endl;
+    return;
+  }
+
+  for (iElem = 0; iElem < nElem; iElem++) Sensor[iElem] /= Global_Max_Sensor;
+
+  /*--- Selection of the elements to be adapted, lowering the same threshold on all ranks. ---*/
+
+  su2double threshold = 0.999;
+  unsigned long nElem_real = 0;
+
+  while ((nElem_real <= Global_max_elem) && (threshold >= 0)) {
+
+    unsigned long nElem_new = 0, Global_nElem_new = 0;
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+      auto elem = geometry->elem[iElem];
+      if ((Sensor[iElem] < threshold) || elem->GetDivide()) continue;
+      if ((DivisibleEdges(elem->GetVTK_Type(), nEdge) == nullptr) || (nEdge < 3)) continue;
+
+      elem->SetDivide(true);
+      if (OwnedElem[iElem]) nElem_new += (nEdge == 6)? 7 : 3;
+    }
+
+    SU2_MPI::Allreduce(&nElem_new, &Global_nElem_new, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    nElem_real += Global_nElem_new;
+    threshold -= 0.001;
+  }
+
+  if (rank == MASTER_NODE) cout << "Number of elements to adapt: " << nElem_real << endl;
+
+}
+
+su2activematrix CDistributedGridAdaptation::ReadRestartColumns(CGeometry *geometry, const string& val_filename,
+                                                               unsigned short firstCol, unsigned short nCol) const {
+
+  unsigned long iPoint, iLinear, index;
+  unsigned short iVar;
+  su2double dummy;
+  string text_line;
+  int iRank;
+
+  CLinearPartitioner pointPartitioner(Global_nPointOld, 0);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointLinear = pointPartitioner.GetSizeOnRank(rank);
+
+  ifstream restart_file(val_filename);
+  if (restart_file.fail())
+    SU2_MPI::Error(string("There is no restart file ") + val_filename, CURRENT_FUNCTION);
+
+  /*--- Skip the header and the rows of the previous linear partitions without parsing them. ---*/
+
+  for (index = 0; index <= firstPoint; index++)
+    restart_file.ignore(numeric_limits<streamsize>::max(), '\n');
+
+  su2activematrix Values_Linear(nPointLinear, nCol);
+
+  for (iLinear = 0; iLinear < nPointLinear; iLinear++) {
+    if (!getline(restart_file, text_line))
+      SU2_MPI::Error(string("The restart file ") + val_filename + " has fewer points than the grid.", CURRENT_FUNCTION);
+
+    replace(text_line.begin(), text_line.end(), ',', ' ');
+    istringstream point_line(text_line);
+
+    if (!(point_line >> index) || (index != firstPoint+iLinear))
+      SU2_MPI::Error(string("The points of the restart file ") + val_filename + " are not sorted by global index.",
+                     CURRENT_FUNCTION);
+
+    for (iVar = 0; iVar < nDim+firstCol; iVar++) point_line >> dummy;
+
+    for (iVar = 0; iVar < nCol; iVar++) point_line >> Values_Linear(iLinear, iVar);
+  }
+
+  restart_file.close();
+
+  /*--- Each rank asks the linear partitions for the points it has (owned and halo). ---*/
+
+  vector<vector<unsigned long> > sendIndex(size), recvIndex, localPoint(size);
+
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    const auto iGlobal = geometry->nodes->GetGlobalIndex(iPoint);
+    iRank = pointPartitioner.GetRankContainingIndex(iGlobal);
+    sendIndex[iRank].push_back(iGlobal);
+    localPoint[iRank].push_back(iPoint);
+  }
+
+  Exchange(sendIndex, recvIndex, MPI_UNSIGNED_LONG);
+
+  vector<vector<su2double> > sendData(size), recvData;
+
+  for (iRank = 0; iRank < size; iRank++) {
+    for (auto iGlobal : recvIndex[iRank]) {
+      const su2double *row = Values_Linear[iGlobal-firstPoint];
+      sendData[iRank].insert(sendData[iRank].end(), row, row+nCol);
+    }
+  }
+
+  Exchange(sendData, recvData, MPI_DOUBLE);
+
+  su2activematrix Values(geometry->GetnPoint(), nCol);
+
+  for (iRank = 0; iRank < size; iRank++)
+    for (unsigned long iRecv = 0; iRecv < localPoint[iRank].size(); iRecv++)
+      for (iVar = 0; iVar < nCol; iVar++)
+        Values(localPoint[iRank][iRecv], iVar) = recvData[iRank][iRecv*nCol+iVar];
+
+  return Values;
+
+}
+
+void CDistributedGridAdaptation::GetFlowSolution(CGeometry *geometry, CConfig *config) {
+
+  const auto Values = ReadRestartColumns(geometry, config->GetSolution_FileName(), 0, nVar+nVarTurb);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      ConsVar_Sol[iPoint][iVar] = Values(iPoint, iVar);
+    for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+      TurbVar_Sol(iPoint, iVar) = Values(iPoint, nVar+iVar);
+  }
+
+}
+
+void CDistributedGridAdaptation::GetFlowResidual(CGeometry *geometry, CConfig *config) {
+
+  /*--- The residuals follow the conservative (and turbulence) variables. ---*/
+
+  const auto Values = ReadRestartColumns(geometry, config->GetSolution_FileName(), nVar+nVarTurb, nVar);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      ConsVar_Res[iPoint][iVar] = Values(iPoint, iVar);
+
+}
+
+void CDistributedGridAdaptation::GetAdjSolution(CGeometry *geometry, CConfig *config) {
+
+  const string val_filename = config->GetObjFunc_Extension(config->GetSolution_AdjFileName());
+
+  const auto Values = ReadRestartColumns(geometry, val_filename, 0, nVar);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      AdjVar_Sol[iPoint][iVar] = Values(iPoint, iVar);
+
+}
+
+void CDistributedGridAdaptation::SetDistributed_Adaptation(CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint, jPoint, iElem, iEdge, iMarker, iVertex;
+  unsigned short iNode, iDim, jEdge, nEdge;
+  int iRank;
+
+  const auto nodes = geometry->nodes;
+  const unsigned long nEdgeLocal = geometry->GetnEdge();
+  const unsigned short nField = (nVar+nVarTurb)*Restart_Flow + nVar*Restart_Adjoint;
+
+  /*--- Split all the edges of the selected elements. ---*/
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    auto elem = geometry->elem[iElem];
+    const auto ElemEdges = DivisibleEdges(elem->GetVTK_Type(), nEdge);
+    if (!elem->GetDivide() || (ElemEdges == nullptr)) continue;
+    for (jEdge = 0; jEdge < nEdge; jEdge++) {
+      iEdge = geometry->FindEdge(elem->GetNode(ElemEdges[jEdge][0]), elem->GetNode(ElemEdges[jEdge][1]));
+      EdgeStatus[iEdge] = EDGE_SPLIT;
+    }
+  }
+
+  /*--- Optionally, keep the boundary unchanged. ---*/
+
+  if (!config->GetAdaptBoundary()) {
+    for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+      for (iElem = 0; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+        auto bound = geometry->bound[iMarker][iElem];
+        for (iNode = 0; iNode < bound->GetnNodes(); iNode++) {
+          iPoint = bound->GetNode(iNode);
+          jPoint = bound->GetNode((iNode+1) % bound->GetnNodes());
+          if (geometry->CheckEdge(iPoint, jPoint))
+            EdgeStatus[geometry->FindEdge(iPoint, jPoint)] = EDGE_LOCKED;
+        }
+      }
+    }
+  }
+
+  /*--- Close the selection until all ranks agree on a conforming set of split edges. ---*/
+
+  unsigned short changed = 0, Global_changed = 0;
+  unsigned long nIter = 0;
+
+  SynchronizeEdges();
+
+  do {
+    changed = SetEdgeClosure(geometry);
+    if (SynchronizeEdges()) changed = 1;
+    SU2_MPI::Allreduce(&changed, &Global_changed, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+    nIter++;
+  } while (Global_changed);
+
+  if (rank == MASTER_NODE)
+    cout << "Conforming selection of the edges found in " << nIter << " iterations." << endl;
+
+  /*--- Number the new points, first the mid points of the edges then the centers of the quadrilaterals. ---*/
+
+  auto EdgeOwnedNode = [&](unsigned long iEdge) {
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
+    return (nodes->GetGlobalIndex(jPoint) < nodes->GetGlobalIndex(iPoint))? jPoint : iPoint;
+  };
+
+  auto FullQuad = [&](unsigned long iElem) {
+    auto elem = geometry->elem[iElem];
+    if (elem->GetVTK_Type() != QUADRILATERAL) return false;
+    for (jEdge = 0; jEdge < 4; jEdge++) {
+      iEdge = geometry->FindEdge(elem->GetNode(QuadEdges[jEdge][0]), elem->GetNode(QuadEdges[jEdge][1]));
+      if (EdgeStatus[iEdge] != EDGE_SPLIT) return false;
+    }
+    return true;
+  };
+
+  unsigned long nCount[2] = {0,0};
+
+  for (iEdge = 0; iEdge < nEdgeLocal; iEdge++)
+    if ((EdgeStatus[iEdge] == EDGE_SPLIT) && nodes->GetDomain(EdgeOwnedNode(iEdge))) nCount[0]++;
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++)
+    if (OwnedElem[iElem] && FullQuad(iElem)) nCount[1]++;
+
+  vector<unsigned long> nCountRank(2*size);
+  SU2_MPI::Allgather(nCount, 2, MPI_UNSIGNED_LONG, nCountRank.data(), 2, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  unsigned long nMidGlobal = 0, nCenterGlobal = 0, midOffset = 0, centerOffset = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) { midOffset += nCountRank[2*iRank]; centerOffset += nCountRank[2*iRank+1]; }
+    nMidGlobal += nCountRank[2*iRank];
+    nCenterGlobal += nCountRank[2*iRank+1];
+  }
+
+  Global_nPointNew = Global_nPointOld + nMidGlobal + nCenterGlobal;
+
+  unsigned long iMid = Global_nPointOld + midOffset;
+  for (iEdge = 0; iEdge < nEdgeLocal; iEdge++)
+    if ((EdgeStatus[iEdge] == EDGE_SPLIT) && nodes->GetDomain(EdgeOwnedNode(iEdge))) EdgeNode[iEdge] = iMid++;
+
+  /*--- The other ranks sharing the edges get the index of the new points from the owners. ---*/
+
+  vector<vector<unsigned long> > sendBuf(size), recvBuf;
+
+  for (iRank = 0; iRank < size; iRank++)
+    for (auto iEdge : EdgeSend[iRank]) sendBuf[iRank].push_back(EdgeNode[iEdge]);
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  for (iRank = 0; iRank < size; iRank++)
+    for (unsigned long iRecv = 0; iRecv < recvBuf[iRank].size(); iRecv++)
+      EdgeNode[EdgeRecv[iRank][iRecv]] = recvBuf[iRank][iRecv];
+
+  /*--- Points owned by this rank (original, mid points of owned edges, centers of owned quadrilaterals),
+   with the coordinates and the interpolated solution, are sent to the linear partitions. ---*/
+
+  CLinearPartitioner pointPartitioner(Global_nPointNew, 0);
+
+  vector<vector<unsigned long> > sendIndex(size), recvIndex;
+  vector<vector<su2double> > sendData(size), recvData;
+
+  vector<su2double> data(nDim+nField);
+
+  auto LoadPointData = [&](unsigned long iPoint) {
+    for (iDim = 0; iDim < nDim; iDim++) data[iDim] = nodes->GetCoord(iPoint, iDim);
+    auto field = data.begin()+nDim;
+    if (Restart_Flow) {
+      field = copy(ConsVar_Sol[iPoint], ConsVar_Sol[iPoint]+nVar, field);
+      field = copy(TurbVar_Sol[iPoint], TurbVar_Sol[iPoint]+nVarTurb, field);
+    }
+    if (Restart_Adjoint) copy(AdjVar_Sol[iPoint], AdjVar_Sol[iPoint]+nVar, field);
+  };
+
+  auto SendPoint = [&](unsigned long iGlobal, const vector<su2double>& values) {
+    iRank = pointPartitioner.GetRankContainingIndex(iGlobal);
+    sendIndex[iRank].push_back(iGlobal);
+    sendData[iRank].insert(sendData[iRank].end(), values.begin(), values.end());
+  };
+
+  vector<su2double> average(nDim+nField);
+
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    LoadPointData(iPoint);
+    SendPoint(nodes->GetGlobalIndex(iPoint), data);
+  }
+
+  for (iEdge = 0; iEdge < nEdgeLocal; iEdge++) {
+    if ((EdgeStatus[iEdge] != EDGE_SPLIT) || !nodes->GetDomain(EdgeOwnedNode(iEdge))) continue;
+    LoadPointData(geometry->edges->GetNode(iEdge,0));
+    average = data;
+    LoadPointData(geometry->edges->GetNode(iEdge,1));
+    for (unsigned short iData = 0; iData < data.size(); iData++)
+      average[iData] = 0.5*(average[iData]+data[iData]);
+    SendPoint(EdgeNode[iEdge], average);
+  }
+
+  /*--- Generate the children of the owned elements. ---*/
+
+  unsigned long iCenter = Global_nPointOld + nMidGlobal + centerOffset;
+  vector<unsigned long> children;
+  vector<su2double> coord;
+  unsigned long node[8];
+  long mid[6];
+
+  Elem_Owned.clear();
+
+  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+
+    if (!OwnedElem[iElem]) continue;
+
+    auto elem = geometry->elem[iElem];
+    const unsigned short vtk = elem->GetVTK_Type();
+    const unsigned short nNode = elem->GetnNodes();
+    const auto ElemEdges = DivisibleEdges(vtk, nEdge);
+
+    coord.assign((nNode+nEdge)*nDim, 0.0);
+
+    for (iNode = 0; iNode < nNode; iNode++) {
+      iPoint = elem->GetNode(iNode);
+      node[iNode] = nodes->GetGlobalIndex(iPoint);
+      for (iDim = 0; iDim < nDim; iDim++) coord[iNode*nDim+iDim] = nodes->GetCoord(iPoint, iDim);
+    }
+
+    for (jEdge = 0; jEdge < nEdge; jEdge++) {
+      iEdge = geometry->FindEdge(elem->GetNode(ElemEdges[jEdge][0]), elem->GetNode(ElemEdges[jEdge][1]));
+      mid[jEdge] = (EdgeStatus[iEdge] == EDGE_SPLIT)? long(EdgeNode[iEdge]) : -1;
+      for (iDim = 0; iDim < nDim; iDim++)
+        coord[(nNode+jEdge)*nDim+iDim] = 0.5*(coord[ElemEdges[jEdge][0]*nDim+iDim] +
+                                              coord[ElemEdges[jEdge][1]*nDim+iDim]);
+    }
+
+    unsigned long center = 0;
+    if (FullQuad(iElem)) {
+      center = iCenter++;
+      fill(average.begin(), average.end(), 0.0);
+      for (iNode = 0; iNode < nNode; iNode++) {
+        LoadPointData(elem->GetNode(iNode));
+        for (unsigned short iData = 0; iData < data.size(); iData++) average[iData] += 0.25*data[iData];
+      }
+      SendPoint(center, average);
+    }
+
+    DivideElement(vtk, node, mid, coord.data(), center, children);
+    Elem_Owned.insert(Elem_Owned.end(), children.begin(), children.end());
+  }
+
+  Exchange(sendIndex, recvIndex, MPI_UNSIGNED_LONG);
+  Exchange(sendData, recvData, MPI_DOUBLE);
+
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointLinear = pointPartitioner.GetSizeOnRank(rank);
+
+  Coord_Linear.assign(nDim, vector<passivedouble>(nPointLinear, 0.0));
+  Solution_Linear.resize(nPointLinear, nField);
+
+  for (iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iRecv = 0; iRecv < recvIndex[iRank].size(); iRecv++) {
+      const auto iLinear = recvIndex[iRank][iRecv] - firstPoint;
+      const su2double *values = &recvData[iRank][iRecv*(nDim+nField)];
+      for (iDim = 0; iDim < nDim; iDim++) Coord_Linear[iDim][iLinear] = SU2_TYPE::GetValue(values[iDim]);
+      for (unsigned short iField = 0; iField < nField; iField++) Solution_Linear(iLinear, iField) = values[nDim+iField];
+    }
+  }
+
+  /*--- Global index of the new elements. ---*/
+
+  unsigned long nElemLocal = Elem_Owned.size()/SU2_CONN_SIZE, elemOffset = 0;
+  vector<unsigned long> nElemRank(size);
+  SU2_MPI::Allgather(&nElemLocal, 1, MPI_UNSIGNED_LONG, nElemRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  Global_nElemNew = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) elemOffset += nElemRank[iRank];
+    Global_nElemNew += nElemRank[iRank];
+  }
+
+  for (iElem = 0; iElem < nElemLocal; iElem++) Elem_Owned[iElem*SU2_CONN_SIZE] = elemOffset + iElem;
+
+  /*--- Global list of the physical markers. ---*/
+
+  vector<char> localTags;
+  unsigned long nLocalTags = 0;
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+    string tag = config->GetMarker_All_TagBound(iMarker);
+    tag.resize(MAX_STRING_SIZE-1, '\0');
+    localTags.insert(localTags.end(), tag.begin(), tag.end());
+    localTags.push_back('\0');
+    nLocalTags++;
+  }
+
+  vector<unsigned long> nTagsRank(size);
+  SU2_MPI::Allgather(&nLocalTags, 1, MPI_UNSIGNED_LONG, nTagsRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  vector<int> nChars(size), charDisp(size+1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    nChars[iRank] = nTagsRank[iRank]*MAX_STRING_SIZE;
+    charDisp[iRank+1] = charDisp[iRank] + nChars[iRank];
+  }
+
+  vector<char> allTags(max(charDisp[size],1));
+#ifdef HAVE_MPI
+  localTags.resize(max<size_t>(localTags.size(),1));
+  SU2_MPI::Allgatherv(localTags.data(), nChars[rank], MPI_CHAR, allTags.data(), nChars.data(),
+                      charDisp.data(), MPI_CHAR, MPI_COMM_WORLD);
+#else
+  copy(localTags.begin(), localTags.end(), allTags.begin());
+#endif
+
+  Marker_Tags.clear();
+  for (int iChar = 0; iChar < charDisp[size]; iChar += MAX_STRING_SIZE) {
+    string tag(&allTags[iChar]);
+    if (find(Marker_Tags.begin(), Marker_Tags.end(), tag) == Marker_Tags.end()) Marker_Tags.push_back(tag);
+  }
+
+  /*--- Divide the owned surface elements and send them to the linear partition of their first node. ---*/
+
+  for (iRank = 0; iRank < size; iRank++) sendBuf[iRank].clear();
+
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) continue;
+
+    const unsigned long iMarkerGlobal = find(Marker_Tags.begin(), Marker_Tags.end(),
+                                             config->GetMarker_All_TagBound(iMarker)) - Marker_Tags.begin();
+
+    for (iVertex = 0; iVertex < geometry->GetnElem_Bound(iMarker); iVertex++) {
+
+      auto bound = geometry->bound[iMarker][iVertex];
+      const unsigned short vtk = bound->GetVTK_Type();
+      const unsigned short nNode = bound->GetnNodes();
+
+      iPoint = bound->GetNode(0);
+      for (iNode = 1; iNode < nNode; iNode++)
+        if (nodes->GetGlobalIndex(bound->GetNode(iNode)) < nodes->GetGlobalIndex(iPoint)) iPoint = bound->GetNode(iNode);
+      if (!nodes->GetDomain(iPoint)) continue;
+
+      auto ElemEdges = DivisibleEdges(vtk, nEdge);
+      if (vtk == QUADRILATERAL) nEdge = 0;
+
+      for (iNode = 0; iNode < nNode; iNode++)
+        node[iNode] = nodes->GetGlobalIndex(bound->GetNode(iNode));
+
+      for (jEdge = 0; jEdge < nEdge; jEdge++) {
+        iPoint = bound->GetNode(ElemEdges[jEdge][0]);
+        jPoint = bound->GetNode(ElemEdges[jEdge][1]);
+        iEdge = geometry->FindEdge(iPoint, jPoint);
+        mid[jEdge] = (EdgeStatus[iEdge] == EDGE_SPLIT)? long(EdgeNode[iEdge]) : -1;
+      }
+
+      children.clear();
+      if (nEdge == 0) {
+        children.assign(SU2_CONN_SIZE, 0);
+        children[1] = vtk;
+        copy(node, node+nNode, children.begin()+SU2_CONN_SKIP);
+      }
+      else {
+        DivideElement(vtk, node, mid, nullptr, 0, children);
+      }
+
+      for (unsigned long iChild = 0; iChild < children.size(); iChild += SU2_CONN_SIZE) {
+        iRank = pointPartitioner.GetRankContainingIndex(children[iChild+SU2_CONN_SKIP]);
+        sendBuf[iRank].push_back(iMarkerGlobal);
+        sendBuf[iRank].insert(sendBuf[iRank].end(), children.begin()+iChild, children.begin()+iChild+SU2_CONN_SIZE);
+      }
+    }
+  }
+
+  Exchange(sendBuf, recvBuf, MPI_UNSIGNED_LONG);
+
+  Bound_Linear.assign(Marker_Tags.size(), vector<unsigned long>());
+  for (iRank = 0; iRank < size; iRank++) {
+    for (unsigned long iRecv = 0; iRecv < recvBuf[iRank].size(); iRecv += SU2_CONN_SIZE+1) {
+      auto& conn = Bound_Linear[recvBuf[iRank][iRecv]];
+      conn.insert(conn.end(), recvBuf[iRank].begin()+iRecv+1, recvBuf[iRank].begin()+iRecv+1+SU2_CONN_SIZE);
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Adapted grid: " << Global_nPointNew << " points (" << Global_nPointNew-Global_nPointOld;
+    cout << " new), " << Global_nElemNew << " elements." << endl;
+  }
+
+}
+
+void CDistributedGridAdaptation::DivideElement(unsigned short vtk, const unsigned long *node, const long *mid,
+                                               const su2double *coord, unsigned long center,
+                                               vector<unsigned long>& conn) const {
+
+  /*--- The vertices of the children are given by local indices, first the nodes, then the
+   points on the edges, and last the center. ---*/
+
+  unsigned short nNode = 0, nEdge = 0;
+  switch (vtk) {
+    case LINE:          nNode = 2; nEdge = 1; break;
+    case TRIANGLE:      nNode = 3; nEdge = 3; break;
+    case QUADRILATERAL: nNode = 4; nEdge = 4; break;
+    case TETRAHEDRON:   nNode = 4; nEdge = 6; break;
+    default:            nNode = NodesPerElem(vtk); nEdge = 0; break;
+  }
+
+  auto Global = [&](unsigned short iLocal) {
+    if (iLocal < nNode) return node[iLocal];
+    if (iLocal < nNode+nEdge) return static_cast<unsigned long>(mid[iLocal-nNode]);
+    return center;
+  };
+
+  auto Coord = [&](unsigned short iLocal) { return &coord[iLocal*nDim]; };
+
+  conn.clear();
+
+  auto AddChild = [&](unsigned short childType, initializer_list<unsigned short> vertices) {
+    const auto iStart = conn.size();
+    conn.resize(iStart+SU2_CONN_SIZE, 0);
+    conn[iStart+1] = childType;
+    unsigned short iVertex = 0;
+    for (auto iLocal : vertices) conn[iStart+SU2_CONN_SKIP+iVertex++] = Global(iLocal);
+  };
+
+  /*--- Tetrahedra are built with the orientation of the parent. ---*/
+
+  su2double parentVolume = 0.0;
+  if (vtk == TETRAHEDRON) parentVolume = TetraVolume(Coord(0), Coord(1), Coord(2), Coord(3));
+
+  auto AddTetra = [&](unsigned short a, unsigned short b, unsigned short c, unsigned short d) {
+    if (TetraVolume(Coord(a), Coord(b), Coord(c), Coord(d))*parentVolume < 0.0) swap(a, b);
+    AddChild(TETRAHEDRON, {a, b, c, d});
+  };
+
+  unsigned short split = 0;
+  for (unsigned short iEdge = 0; iEdge < nEdge; iEdge++)
+    if (mid[iEdge] >= 0) split |= 1 << iEdge;
+
+  const unsigned short nSplit = CountEdges(split);
+
+  if (nSplit == 0) {
+    const auto iStart = conn.size();
+    conn.resize(iStart+SU2_CONN_SIZE, 0);
+    conn[iStart+1] = vtk;
+    copy(node, node+nNode, conn.begin()+iStart+SU2_CONN_SKIP);
+    return;
+  }
+
+  switch (vtk) {
+
+    case LINE:
+      AddChild(LINE, {0, 2});
+      AddChild(LINE, {2, 1});
+      break;
+
+    case TRIANGLE: {
+      /*--- Edge k joins nodes k and k+1, its point has local index 3+k. ---*/
+      if (nSplit == 3) {
+        AddChild(TRIANGLE, {0, 3, 5});
+        AddChild(TRIANGLE, {3, 1, 4});
+        AddChild(TRIANGLE, {5, 4, 2});
+        AddChild(TRIANGLE, {3, 4, 5});
+      }
+      else if (nSplit == 1) {
+        unsigned short k = 0;
+        while (!(split & (1 << k))) k++;
+        const unsigned short b0 = k, b1 = (k+1)%3, b2 = (k+2)%3;
+        AddChild(TRIANGLE, {b0, static_cast<unsigned short>(3+k), b2});
+        AddChild(TRIANGLE, {static_cast<unsigned short>(3+k), b1, b2});
+      }
+      else {
+        /*--- Corner at the node common to the split edges, the remaining quadrilateral
+         is divided by its shortest diagonal (needs the coordinates). ---*/
+        unsigned short k = 0;
+        while (split & (1 << k)) k++;
+        const unsigned short b0 = (k+2)%3, b1 = k, b2 = (k+1)%3;
+        const unsigned short p = 3+(k+2)%3, q = 3+(k+1)%3;
+        AddChild(TRIANGLE, {b0, p, q});
+        bool diagonal_p = true;
+        if (coord != nullptr) {
+          su2double d_p = 0.0, d_q = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            d_p += pow(Coord(p)[iDim]-Coord(b2)[iDim], 2);
+            d_q += pow(Coord(q)[iDim]-Coord(b1)[iDim], 2);
+          }
+          diagonal_p = (d_p <= d_q);
+        }
+        if (diagonal_p) {
+          AddChild(TRIANGLE, {p, b1, b2});
+          AddChild(TRIANGLE, {p, b2, q});
+        }
+        else {
+          AddChild(TRIANGLE, {p, b1, q});
+          AddChild(TRIANGLE, {b1, b2, q});
+        }
+      }
+      break;
+    }
+
+    case QUADRILATERAL: {
+      /*--- Edge k joins nodes k and k+1, its point has local index 4+k, the center is 8. ---*/
+      if (nSplit == 4) {
+        AddChild(QUADRILATERAL, {0, 4, 8, 7});
+        AddChild(QUADRILATERAL, {4, 1, 5, 8});
+        AddChild(QUADRILATERAL, {8, 5, 2, 6});
+        AddChild(QUADRILATERAL, {7, 8, 6, 3});
+      }
+      else {
+        unsigned short k = 0;
+        while (!(split & (1 << k))) k++;
+        const unsigned short b0 = k, b1 = (k+1)%4, b2 = (k+2)%4, b3 = (k+3)%4;
+        const unsigned short m = 4+k, n = 4+(k+2)%4;
+        if (nSplit == 1) {
+          AddChild(TRIANGLE, {b0, m, b3});
+          AddChild(TRIANGLE, {m, b1, b2});
+          AddChild(TRIANGLE, {m, b2, b3});
+        }
+        else {
+          AddChild(QUADRILATERAL, {b0, m, n, b3});
+          AddChild(QUADRILATERAL, {m, b1, b2, n});
+        }
+      }
+      break;
+    }
+
+    case TETRAHEDRON: {
+      /*--- Edges as in TetraEdges, the point of edge k has local index 4+k. ---*/
+      auto M = [&](unsigned short i, unsigned short j) {
+        return static_cast<unsigned short>(4+TetraEdgeIndex[i][j]);
+      };
+
+      if (nSplit == 1) {
+        unsigned short k = 0;
+        while (!(split & (1 << k))) k++;
+        const unsigned short i = TetraEdges[k][0], j = TetraEdges[k][1];
+        unsigned short v[4] = {0,1,2,3};
+        v[j] = 4+k; AddTetra(v[0], v[1], v[2], v[3]);
+        v[j] = j; v[i] = 4+k; AddTetra(v[0], v[1], v[2], v[3]);
+      }
+      else if (nSplit == 3) {
+        /*--- Face opposite to node k divided in 4, each part joined to node k. ---*/
+        unsigned short k = 0;
+        for (; k < 4; k++) {
+          unsigned short face = 0;
+          for (auto iEdge : TetraFaceEdges[k]) face |= 1 << iEdge;
+          if (face == split) break;
+        }
+        unsigned short f[3], nFace = 0;
+        for (unsigned short iNode = 0; iNode < 4; iNode++) if (iNode != k) f[nFace++] = iNode;
+        AddTetra(k, f[0], M(f[0],f[1]), M(f[0],f[2]));
+        AddTetra(k, f[1], M(f[1],f[2]), M(f[1],f[0]));
+        AddTetra(k, f[2], M(f[2],f[0]), M(f[2],f[1]));
+        AddTetra(k, M(f[0],f[1]), M(f[1],f[2]), M(f[2],f[0]));
+      }
+      else {
+        /*--- Corners, plus the inner octahedron divided along its shortest diagonal. ---*/
+        AddTetra(0, M(0,1), M(0,2), M(0,3));
+        AddTetra(M(0,1), 1, M(1,2), M(1,3));
+        AddTetra(M(0,2), M(1,2), 2, M(2,3));
+        AddTetra(M(0,3), M(1,3), M(2,3), 3);
+
+        const unsigned short diag[3][2] = {{4,9}, {5,8}, {6,7}};
+        unsigned short iDiag = 0;
+        su2double minLength = 0.0;
+        for (unsigned short jDiag = 0; jDiag < 3; jDiag++) {
+          su2double length = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            length += pow(Coord(diag[jDiag][0])[iDim]-Coord(diag[jDiag][1])[iDim], 2);
+          if ((jDiag == 0) || (length < minLength)) { minLength = length; iDiag = jDiag; }
+        }
+        const unsigned short p = diag[iDiag][0], q = diag[iDiag][1];
+        const unsigned short x1 = diag[(iDiag+1)%3][0], x2 = diag[(iDiag+1)%3][1];
+        const unsigned short y1 = diag[(iDiag+2)%3][0], y2 = diag[(iDiag+2)%3][1];
+        AddTetra(p, q, x1, y1);
+        AddTetra(p, q, y1, x2);
+        AddTetra(p, q, x2, y2);
+        AddTetra(p, q, y2, x1);
+      }
+      break;
+    }
+
+    default:
+      SU2_MPI::Error("Element type cannot be divided.", CURRENT_FUNCTION);
+      break;
+  }
+
+}
+
+void CDistributedGridAdaptation::WriteAdaptedGrid(CConfig *config, string val_filename) const {
+
+  CLinearPartitioner pointPartitioner(Global_nPointNew, 0);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointLinear = pointPartitioner.GetSizeOnRank(rank);
+
+  ofstream mesh_file;
+
+  /*--- The ranks append their elements and points in turn, which are in global order. ---*/
+
+  for (unsigned short iSection = 0; iSection < 2; iSection++) {
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (rank == iRank) {
+        mesh_file.open(val_filename.c_str(), ((iSection == 0) && (rank == MASTER_NODE))? ios::out : ios::app);
+        mesh_file.precision(15);
+
+        if (iSection == 0) {
+          if (rank == MASTER_NODE) {
+            mesh_file << "NDIME= " << nDim << endl;
+            mesh_file << "NELEM= " << Global_nElemNew << endl;
+          }
+          for (unsigned long iElem = 0; iElem < Elem_Owned.size()/SU2_CONN_SIZE; iElem++) {
+            const unsigned long *conn = &Elem_Owned[iElem*SU2_CONN_SIZE];
+            mesh_file << conn[1];
+            for (unsigned short iNode = 0; iNode < NodesPerElem(conn[1]); iNode++)
+              mesh_file << "\t" << conn[SU2_CONN_SKIP+iNode];
+            mesh_file << "\t" << conn[0] << endl;
+          }
+        }
+        else {
+          if (rank == MASTER_NODE) mesh_file << "NPOIN= " << Global_nPointNew << endl;
+          for (unsigned long iPoint = 0; iPoint < nPointLinear; iPoint++) {
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+              mesh_file << scientific << "\t" << Coord_Linear[iDim][iPoint];
+            mesh_file << "\t" << firstPoint+iPoint << endl;
+          }
+        }
+        mesh_file.close();
+      }
+      SU2_MPI::Barrier(MPI_COMM_WORLD);
+    }
+  }
+
+  /*--- The surface elements are also in linear partitions, the ranks append them marker by marker. ---*/
+
+  const unsigned long nMarker = Marker_Tags.size();
+  vector<unsigned long> nElemBound(nMarker), Global_nElemBound(nMarker);
+
+  for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++)
+    nElemBound[iMarker] = Bound_Linear[iMarker].size()/SU2_CONN_SIZE;
+
+  SU2_MPI::Allreduce(nElemBound.data(), Global_nElemBound.data(), nMarker, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (int iRank = 0; iRank < size; iRank++) {
+      if (rank == iRank) {
+        mesh_file.open(val_filename.c_str(), ios::app);
+
+        if (rank == MASTER_NODE) {
+          if (iMarker == 0) mesh_file << "NMARK= " << nMarker << endl;
+          mesh_file << "MARKER_TAG= " << Marker_Tags[iMarker] << endl;
+          mesh_file << "MARKER_ELEMS= " << Global_nElemBound[iMarker] << endl;
+        }
+        for (unsigned long iElem = 0; iElem < nElemBound[iMarker]; iElem++) {
+          const unsigned long *conn = &Bound_Linear[iMarker][iElem*SU2_CONN_SIZE];
+          mesh_file << conn[1];
+          for (unsigned short iNode = 0; iNode < NodesPerElem(conn[1]); iNode++)
+            mesh_file << "\t" << conn[SU2_CONN_SKIP+iNode];
+          mesh_file << endl;
+        }
+        mesh_file.close();
+      }
+      SU2_MPI::Barrier(MPI_COMM_WORLD);
+    }
+  }
+
+}
+
+void CDistributedGridAdaptation::WriteAdaptedSolution(CConfig *config, string val_filename, bool adjoint) const {
+
+  if ((adjoint && !Restart_Adjoint) || (!adjoint && !Restart_Flow)) return;
+
+  /*--- Same name and format (CSV) as the ASCII restart files of SU2_CFD. ---*/
+
+  if (adjoint) val_filename = config->GetObjFunc_Extension(val_filename);
+  val_filename = config->GetFilename(val_filename, ".csv", 0);
+
+  CLinearPartitioner pointPartitioner(Global_nPointNew, 0);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long nPointLinear = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned short offset = (adjoint && Restart_Flow)? nVar+nVarTurb : 0;
+  const unsigned short nVarWrite = adjoint? nVar : nVar+nVarTurb;
+
+  ofstream restart_file;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (rank == iRank) {
+      restart_file.open(val_filename.c_str(), (rank == MASTER_NODE)? ios::out : ios::app);
+      restart_file.precision(15);
+
+      if (rank == MASTER_NODE) {
+        const string prefix = adjoint? "Adjoint_" : "";
+        restart_file << "\"PointID\",\"x\",\"y\"";
+        if (nDim == 3) restart_file << ",\"z\"";
+        restart_file << ",\"" << prefix << "Density\",\"" << prefix << "Momentum_x\",\"" << prefix << "Momentum_y\"";
+        if (nDim == 3) restart_file << ",\"" << prefix << "Momentum_z\"";
+        restart_file << ",\"" << prefix << "Energy\"";
+        if (!adjoint && (nVarTurb == 1)) restart_file << ",\"Nu_Tilde\"";
+        if (!adjoint && (nVarTurb == 2)) restart_file << ",\"Turb_Kin_Energy\",\"Omega\"";
+        restart_file << endl;
+      }
+
+      for (unsigned long iPoint = 0; iPoint < nPointLinear; iPoint++) {
+        restart_file << firstPoint+iPoint;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          restart_file << ", " << scientific << Coord_Linear[iDim][iPoint];
+        for (unsigned short iVar = 0; iVar < nVarWrite; iVar++)
+          restart_file << ", " << scientific << Solution_Linear(iPoint, offset+iVar);
+        restart_file << endl;
+      }
+      restart_file.close();
+    }
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+  }
+
+}
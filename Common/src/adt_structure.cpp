@@ -781,26 +781,45 @@ bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& front
   return false;
 }
 
-void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
+void CADTElemClass::GetBoundingBox(su2double *bbMin, su2double *bbMax) const {
+
+  for(unsigned short k=0; k<nDim; ++k) {
+    bbMin[k] =  numeric_limits<su2double>::max();
+    bbMax[k] = -numeric_limits<su2double>::max();
+  }
+
+  for(unsigned long i=0; i<coorPoints.size(); i+=nDim) {
+    for(unsigned short k=0; k<nDim; ++k) {
+      bbMin[k] = min(bbMin[k], coorPoints[i+k]);
+      bbMax[k] = max(bbMax[k], coorPoints[i+k]);
+    }
+  }
+}
+
+bool CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxTargets,
                                                  vector<unsigned long>& frontLeaves,
                                                  vector<unsigned long>& frontLeavesNew,
                                                  const su2double *coor,
+                                                 su2double       maxDist2,
                                                  su2double       &dist,
                                                  unsigned short  &markerID,
                                                  unsigned long   &elemID,
-                                                 int             &rankID) const {
+                                                 int             &rankID,
+                                                 unsigned long   &nearestElem) const {
 
   AD_BEGIN_PASSIVE
 
   /*----------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the distance (squared) to the quaranteed distance ---*/
-  /*---         of the central bounding box of the root element.             ---*/
+  /*---         of the central bounding box of the root element, or to the   ---*/
+  /*---         given maximum distance if that is smaller.                   ---*/
   /*----------------------------------------------------------------------------*/
 
   unsigned long kk = leaves[0].centralNodeID;
   const su2double *coorBBMin = BBoxCoor.data() + nDimADT*kk;
   const su2double *coorBBMax = coorBBMin + nDim;
   unsigned long jj = 0;
+  bool found = false;
 
   dist = 0.0;
   su2double ds;
@@ -809,6 +828,8 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
   if(nDim==3) {
   ds = max(fabs(coor[2]-coorBBMin[2]), fabs(coor[2]-coorBBMax[2])); dist += ds*ds;}
 
+  dist = min(dist, maxDist2);
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -945,6 +966,7 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
     su2double dist2Elem;
     Dist2ToElement(ii, coor, dist2Elem);
     if(dist2Elem <= dist) {
+      found    = true;
       jj       = ii;
       dist     = dist2Elem;
       markerID = localMarkers[ii];
@@ -955,10 +977,16 @@ void CADTElemClass::DetermineNearestElement_impl(vector<CBBoxTargetClass>& BBoxT
 
   AD_END_PASSIVE
 
+  /* No element is closer than the given maximum distance. Without a maximum
+     distance an element is always found, the first one is taken as a safeguard. */
+  if(!found && (maxDist2 < numeric_limits<su2double>::max())) return false;
+
   /* At the moment the square of the distance is stored in dist. Compute
      the correct value. */
+  nearestElem = jj;
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+  return true;
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
@@ -429,7 +429,7 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
 
         if (iRank == Neighbors_P2PSend[iSend]) {
           for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-            Local_Point_P2PSend[count] = geometry->vertex[MarkerS][iVertex]->GetNode();
+            Local_Point_P2PSend[count] = geometry->vertexData[MarkerS].GetNode(iVertex);
             count++;
           }
         }
@@ -452,7 +452,7 @@ void CGeometry::PreprocessP2PComms(CGeometry *geometry,
 
         if (iRank == Neighbors_P2PRecv[iRecv]) {
           for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-            Local_Point_P2PRecv[count] = geometry->vertex[MarkerR][iVertex]->GetNode();
+            Local_Point_P2PRecv[count] = geometry->vertexData[MarkerR].GetNode(iVertex);
             count++;
           }
         }
@@ -1000,7 +1000,7 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
          the owned nodes on a rank, as the MPI comms will take care of
          the halos after completing the periodic comms. ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -1149,7 +1149,7 @@ void CGeometry::PreprocessPeriodicComms(CGeometry *geometry,
            the owned nodes on a rank, as the MPI comms will take care of
            the halos after completing the periodic comms. ---*/
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -1537,35 +1537,89 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 
 void CGeometry::SetEdges(void) {
 
-  nEdge = 0;
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
-        if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
-          }
-          break;
-        }
+  /*--- The edges of each point are those to the neighbors with higher index, they are numbered
+   by point and then in the order of the neighbors, which the offsets allow doing in parallel. ---*/
+
+  vector<unsigned long> edgeOffset(nPoint+1, 0);
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint,omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        if (nodes->GetPoint(iPoint, iNode) > iPoint) edgeOffset[iPoint+1]++;
       }
     }
-  }
 
-  edges = new CEdge(nEdge,nDim);
+    SU2_OMP_MASTER
+    {
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+        edgeOffset[iPoint+1] += edgeOffset[iPoint];
+
+      nEdge = edgeOffset[nPoint];
+      edges = new CEdge(nEdge,nDim);
+    }
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      auto iEdge = edgeOffset[iPoint];
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        auto jPoint = nodes->GetPoint(iPoint, iNode);
+        if (jPoint < iPoint) continue;
 
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      if (iPoint < jPoint) {
-        auto iEdge = FindEdge(iPoint, jPoint);
+        /*--- Each edge is set on both of its points by the thread of the lowest one. ---*/
+
+        for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
+          if (nodes->GetPoint(jPoint, jNode) == iPoint) {
+            nodes->SetEdge(jPoint, iEdge, jNode);
+            break;
+          }
+        }
+        nodes->SetEdge(iPoint, iEdge, iNode);
         edges->SetNodes(iEdge, iPoint, jPoint);
+        iEdge++;
       }
     }
+  } // end SU2_OMP_PARALLEL
+}
+
+void CGeometry::SetEdgeGeometry(void) {
+
+  if (edges == nullptr) return;
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(roundUpDiv(nEdge,omp_get_num_threads()))
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+      const auto iPoint = edges->GetNode(iEdge,0);
+      const auto jPoint = edges->GetNode(iEdge,1);
+      edges->SetEdgeGeometry(iEdge, nodes->GetCoord(iPoint), nodes->GetCoord(jPoint));
+    }
+  } // end SU2_OMP_PARALLEL
+}
+
+void CGeometry::SetVertexPacks(const CConfig *config) {
+
+  VertexPack.clear();
+
+  /*--- Markers of each kind, in marker order. ---*/
+
+  map<unsigned short, vector<unsigned short> > markersOfKind;
+
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    const auto kindBC = config->GetMarker_All_KindBC(iMarker);
+    if ((kindBC == SEND_RECEIVE) || (kindBC == PERIODIC_BOUNDARY)) continue;
+    markersOfKind[kindBC].push_back(iMarker);
   }
+
+  for (auto& kind : markersOfKind)
+    VertexPack.emplace(kind.first, CVertexPack(*this, move(kind.second)));
+}
+
+void CGeometry::UpdateVertexPacks(void) {
+
+  for (auto& pack : VertexPack) pack.second.SetGeometry(*this);
 }
 
 void CGeometry::SetFaces(void) {
@@ -1626,12 +1680,12 @@ void CGeometry::TestGeometry(void) const {
     para_file << "Marker index: " << iMarker << endl;
     for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
       para_file << "   Vertex index: " << iVertex << endl;
-      para_file << "      Point index: " << vertex[iMarker][iVertex]->GetNode() << endl;
+      para_file << "      Point index: " << vertexData[iMarker].GetNode(iVertex) << endl;
       para_file << "      Point coordinates : ";
       for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-        para_file << nodes->GetCoord(vertex[iMarker][iVertex]->GetNode(), iDim) << "\t";}
+        para_file << nodes->GetCoord(vertexData[iMarker].GetNode(iVertex), iDim) << "\t";}
       para_file << endl;
-      vertex[iMarker][iVertex]->GetNormal(Normal);
+      vertexData[iMarker].GetNormal(iVertex, Normal);
       para_file << "         Face normal : ";
       for (unsigned short iDim = 0; iDim < nDim; iDim++)
         para_file << Normal[iDim] << "\t";
@@ -1962,7 +2016,7 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
       if (config->GetMarker_All_GeoEval(iMarker) == YES) {
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
           VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           for (iDim = 0; iDim < nDim; iDim++)
             Coord_Variation[iPoint][iDim] = VarCoord[iDim];
         }
@@ -2811,7 +2865,7 @@ void CGeometry::ComputeSurf_Straightness(CConfig *config,
           while(bound_is_straight[iMarker] == true &&
                 iVertex < nVertex[iMarker]) {
 
-            vertex[iMarker][iVertex]->GetNormal(Normal.data());
+            vertexData[iMarker].GetNormal(iVertex, Normal);
             UnitNormal = Normal;
 
             /*--- Compute unit normal. ---*/
@@ -2922,7 +2976,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
         /*--- Loop through all marker vertices again, this time also
          finding the neighbors of each node.---*/
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          iPoint  = vertex[iMarker][iVertex]->GetNode();
+          iPoint  = vertexData[iMarker].GetNode(iVertex);
 
           if (nodes->GetDomain(iPoint)) {
             /*--- Loop through neighbors. In 2-D, there should be 2 nodes on either
@@ -3088,7 +3142,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
       if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          iPoint  = vertex[iMarker][iVertex]->GetNode();
+          iPoint  = vertexData[iMarker].GetNode(iVertex);
 
           if (nodes->GetDomain(iPoint)) {
 
@@ -3132,7 +3186,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint  = vertex[iMarker][iVertex]->GetNode();
+        iPoint  = vertexData[iMarker].GetNode(iVertex);
         if (nodes->GetDomain(iPoint)) {
           MaxK = max(MaxK, fabs(K[iPoint]));
           MinK = min(MinK, fabs(K[iPoint]));
@@ -3158,7 +3212,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint  = vertex[iMarker][iVertex]->GetNode();
+        iPoint  = vertexData[iMarker].GetNode(iVertex);
         if (nodes->GetDomain(iPoint)) {
           SigmaK += (fabs(K[iPoint]) - MeanK) * (fabs(K[iPoint]) - MeanK);
         }
@@ -3179,7 +3233,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint  = vertex[iMarker][iVertex]->GetNode();
+        iPoint  = vertexData[iMarker].GetNode(iVertex);
         if (nodes->GetDomain(iPoint)) {
           if (fabs(K[iPoint]) > MeanK + config->GetRefSharpEdges()*SigmaK) {
             Point_Critical.push_back(iPoint);
@@ -3714,11 +3768,11 @@ void CGeometry::SetGeometryPlanes(CConfig *config) {
         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL)              ||
         (config->GetMarker_All_KindBC(iMarker) == EULER_WALL)                )
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
         Xcoord[iVertex_Wall] = nodes->GetCoord(iPoint, 0);
         Ycoord[iVertex_Wall] = nodes->GetCoord(iPoint, 1);
         if (nDim==3) Zcoord[iVertex_Wall] = nodes->GetCoord(iPoint, 2);
-        Face_Normal = vertex[iMarker][iVertex]->GetNormal();
+        Face_Normal = vertexData[iMarker].GetNormal(iVertex);
         FaceArea[iVertex_Wall] = fabs(Face_Normal[nDim-1]);
         iVertex_Wall ++;
       }
@@ -3848,7 +3902,7 @@ void CGeometry::SetShroudVelocity(CConfig *config) {
     for(iMarkerShroud=0; iMarkerShroud < config->GetnMarker_Shroud(); iMarkerShroud++){
       if(config->GetMarker_Shroud(iMarkerShroud) == config->GetMarker_All_TagBound(iMarker)){
         for (iVertex = 0; iVertex  < nVertex[iMarker]; iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           nodes->SetGridVel(iPoint, RotVel);
         }
       }
@@ -3982,9 +4036,22 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
 
     CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
 
-    /*--- Color the edges. ---*/
+    /*--- Color the edges. Small grids (e.g. coarse MG levels) have too few groups per color
+     *    to keep the threads busy, and their more connected edges may need too many colors,
+     *    in both cases retry with smaller groups. Unless the reducer strategy was requested
+     *    (EDGE_COLORING_GROUP_SIZE = 0), then the natural coloring is kept. ---*/
     constexpr bool balanceColors = true;
-    edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
+    const bool adaptGroupSize = (edgeColorGroupSize != 1ul<<30);
+
+    while (true) {
+      edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
+
+      if (!adaptGroupSize || (edgeColorGroupSize == 1)) break;
+      if (!edgeColoring.empty() &&
+          (coloringEfficiency(edgeColoring, omp_get_max_threads(), edgeColorGroupSize) >= COLORING_EFF_THRESH)) break;
+
+      edgeColorGroupSize /= 2;
+    }
 
     /*--- If the coloring fails use the natural coloring. This is a
      *    "soft" failure as this "bad" coloring should be detected
@@ -4091,7 +4158,12 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
     for (int iZone = 0; iZone < nZone; iZone++){
       CGeometry *geometry = geometry_container[iZone][iInst][MESH_0];
       unique_ptr<CADTElemClass> WallADT = geometry->ComputeViscousWallADT(config_container[iZone]);
-      if (WallADT && !WallADT->IsEmpty()){
+
+      /*--- The ADT may only contain the walls of this rank, check whether there are walls on any rank. ---*/
+      int localWalls = (WallADT && !WallADT->IsEmpty()), globalWalls = 0;
+      SU2_MPI::Allreduce(&localWalls, &globalWalls, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+
+      if (WallADT && globalWalls){
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
        * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
@@ -28,6 +28,7 @@
 #include "../../include/geometry/CMultiGridGeometry.hpp"
 #include "../../include/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/toolboxes/geometry_toolbox.hpp"
 
 
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
@@ -96,12 +97,17 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   Index_CoarseCV = 0;
 
+  /*--- The stretched cells next to the walls are agglomerated first, along lines. ---*/
+
+  if (config->GetMG_LineAgglomeration())
+    AgglomerateImplicitLines(fine_grid, config, Index_CoarseCV);
+
   /*--- The first step is the boundary agglomeration. ---*/
 
   for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
 
     for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
-      iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
+      iPoint = fine_grid->vertexData[iMarker].GetNode(iVertex);
 
       /*--- If the element has not being previously agglomerated and it belongs
        to the physical domain, then the agglomeration is studied ---*/
@@ -223,7 +229,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++)
     for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
-      iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
+      iPoint = fine_grid->vertexData[iMarker].GetNode(iVertex);
       if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) &&
           (fine_grid->nodes->GetDomain(iPoint))) {
         fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
@@ -449,6 +455,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
     }
   }
 
+  /*--- Merge the fragments left at the partition interface with their local neighbors ---*/
+
+  if (size > SINGLE_NODE) {
+    MergeInterfaceFragments(fine_grid, config, Index_CoarseCV);
+    nPointDomain = Index_CoarseCV;
+  }
+
   //  unsigned long iPointFree = nPointDomain-1;
   //  iCoarsePoint = 0;
   //
@@ -515,7 +528,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       /*--- Copy the information that should be sended ---*/
 
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = fine_grid->vertex[MarkerS][iVertex]->GetNode();
+        iPoint = fine_grid->vertexData[MarkerS].GetNode(iVertex);
         Buffer_Send_Children[iVertex] = iPoint;
         Buffer_Send_Parent[iVertex] = fine_grid->nodes->GetParent_CV(iPoint);
       }
@@ -572,7 +585,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
         }
 
         Children_Remote[iVertex] = Buffer_Receive_Children[iVertex];
-        Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
+        Children_Local[iVertex] = fine_grid->vertexData[MarkerR].GetNode(iVertex);
 
       }
 
@@ -619,8 +632,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Console output with the summary of the agglomeration ---*/
 
-  Local_nPointCoarse = nPoint;
-  Local_nPointFine = fine_grid->GetnPoint();
+  /*--- The agglomeration rate is based on the owned points, the halos would make it depend on the partitioning ---*/
+
+  Local_nPointCoarse = nPointDomain;
+  Local_nPointFine = fine_grid->GetnPointDomain();
 
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
@@ -636,8 +651,14 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   su2double ratio = su2double(Global_nPointFine)/su2double(Global_nPointCoarse);
 
-  if (((nDim == 2) && (ratio < 2.5)) ||
-      ((nDim == 3) && (ratio < 2.5))) {
+  /*--- The semi-coarsening of the lines gives lower rates, the level is still useful. ---*/
+
+  su2double min_ratio = 2.5;
+  if (config->GetMG_LineAgglomeration())
+    min_ratio = min(min_ratio, 0.75*config->GetMG_LineCoarsening());
+
+  if (((nDim == 2) && (ratio < min_ratio)) ||
+      ((nDim == 3) && (ratio < min_ratio))) {
     config->SetMGLevels(iMesh-1);
   }
   else {
@@ -754,6 +775,208 @@ bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short mark
 }
 
 
+void CMultiGridGeometry::AgglomerateImplicitLines(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV) {
+
+  const su2double alpha = 0.9;
+  const unsigned short nLinePoints = config->GetMG_LineCoarsening();
+
+  unsigned long iPoint, jPoint, iVertex, iLine, next_Point, Local_nLines = 0, Global_nLines = 0;
+  unsigned short iMarker, iNode, iChildren, counter;
+  su2double weight, max_weight;
+  bool add_point;
+
+  auto Weight = [&](unsigned long iPoint, unsigned short iNode) {
+    const auto iEdge = fine_grid->nodes->GetEdge(iPoint, iNode);
+    const auto jPoint = fine_grid->nodes->GetPoint(iPoint, iNode);
+    const su2double area = GeometryToolbox::Norm(nDim, fine_grid->edges->GetNormal(iEdge));
+    return 0.5*area*(1.0/fine_grid->nodes->GetVolume(iPoint) + 1.0/fine_grid->nodes->GetVolume(jPoint));
+  };
+
+  /*--- Number of physical (not send-receive) markers of a point. ---*/
+
+  auto PhysicalMarkers = [&](unsigned long iPoint) {
+    unsigned short nMarker = 0;
+    for (unsigned short jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker++)
+      if ((fine_grid->nodes->GetVertex(iPoint, jMarker) != -1) &&
+          (config->GetMarker_All_KindBC(jMarker) != SEND_RECEIVE)) nMarker++;
+    return nMarker;
+  };
+
+  vector<bool> check_Point(fine_grid->GetnPoint(), true);
+  vector<unsigned long> Line;
+
+  for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
+
+    if ((config->GetMarker_All_KindBC(iMarker) != HEAT_FLUX) &&
+        (config->GetMarker_All_KindBC(iMarker) != ISOTHERMAL) &&
+        (config->GetMarker_All_KindBC(iMarker) != EULER_WALL)) continue;
+
+    for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
+
+      iPoint = fine_grid->vertexData[iMarker].GetNode(iVertex);
+
+      if (!check_Point[iPoint] || fine_grid->nodes->GetAgglomerate(iPoint) ||
+          !fine_grid->nodes->GetDomain(iPoint)) continue;
+
+      /*--- Grow the line from the wall, as for the linelets. ---*/
+
+      Line.clear();
+      Line.push_back(iPoint);
+      check_Point[iPoint] = false;
+
+      do {
+        iPoint = Line.back();
+
+        max_weight = 0.0;
+        for (iNode = 0; iNode < fine_grid->nodes->GetnPoint(iPoint); iNode++) {
+          jPoint = fine_grid->nodes->GetPoint(iPoint, iNode);
+          if (check_Point[jPoint] && fine_grid->nodes->GetDomain(jPoint))
+            max_weight = max(max_weight, Weight(iPoint, iNode));
+        }
+
+        add_point = false;
+        counter = 0;
+        next_Point = iPoint;
+        for (iNode = 0; iNode < fine_grid->nodes->GetnPoint(iPoint); iNode++) {
+          jPoint = fine_grid->nodes->GetPoint(iPoint, iNode);
+          weight = Weight(iPoint, iNode);
+          if (check_Point[jPoint] && fine_grid->nodes->GetDomain(jPoint) && (weight/max_weight > alpha)) {
+            add_point = true;
+            next_Point = jPoint;
+            counter++;
+          }
+        }
+
+        /*--- The line ends in isotropic zones, at boundaries, and at points that
+         were already agglomerated or that fail the geometrical check. ---*/
+
+        if ((counter != 1) || fine_grid->nodes->GetAgglomerate(next_Point) ||
+            (PhysicalMarkers(next_Point) != 0) || !GeometricalCheck(next_Point, fine_grid, config)) add_point = false;
+
+        if (add_point) {
+          Line.push_back(next_Point);
+          check_Point[next_Point] = false;
+        }
+
+      } while (add_point);
+
+      /*--- The wall point is part of the first group if it is only on this wall, the
+       others (corners) are left for the boundary agglomeration. ---*/
+
+      auto iFirst = ((PhysicalMarkers(Line[0]) == 1) && GeometricalCheck(Line[0], fine_grid, config))? 0ul : 1ul;
+
+      if (Line.size() >= iFirst + nLinePoints) Local_nLines++;
+
+      for (; iFirst + nLinePoints <= Line.size(); iFirst += nLinePoints) {
+        for (iChildren = 0; iChildren < nLinePoints; iChildren++) {
+          iPoint = Line[iFirst + iChildren];
+          fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+          nodes->SetChildren_CV(Index_CoarseCV, iChildren, iPoint);
+          if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+            nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+        }
+        nodes->SetnChildren_CV(Index_CoarseCV, nLinePoints);
+        Index_CoarseCV++;
+      }
+
+      /*--- The points left in the line can be agglomerated isotropically. ---*/
+
+      for (iLine = iFirst; iLine < Line.size(); iLine++) check_Point[Line[iLine]] = true;
+    }
+  }
+
+  SU2_MPI::Allreduce(&Local_nLines, &Global_nLines, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE)
+    cout << "Agglomerated " << Global_nLines << " lines normal to the walls." << endl;
+
+}
+
+void CMultiGridGeometry::MergeInterfaceFragments(CGeometry *fine_grid, CConfig *config, unsigned long &Index_CoarseCV) {
+
+  unsigned long iCoarsePoint, jCoarsePoint, iFinePoint, jFinePoint, iLastPoint, Target;
+  unsigned short iChildren, nChildren, nChildren_Target, iNode, iMarker;
+  bool Interface, Mergeable;
+
+  iCoarsePoint = 0;
+
+  while (iCoarsePoint < Index_CoarseCV) {
+
+    nChildren = nodes->GetnChildren_CV(iCoarsePoint);
+
+    /*--- Only the small agglomerates are candidates, the empty ones were already merged ---*/
+
+    if ((nChildren == 0) || (nChildren > nDim)) { iCoarsePoint++; continue; }
+
+    /*--- The children must not be on a physical boundary (the boundary agglomeration rules
+     apply to those) and at least one of them must be next to a halo point. The target is the
+     smallest neighbor agglomerate, the lowest index breaks the ties. ---*/
+
+    Interface = false; Mergeable = true;
+    Target = iCoarsePoint; nChildren_Target = 0;
+
+    for (iChildren = 0; (iChildren < nChildren) && Mergeable; iChildren++) {
+      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+
+      Mergeable = GeometricalCheck(iFinePoint, fine_grid, config);
+
+      for (iMarker = 0; (iMarker < fine_grid->GetnMarker()) && Mergeable; iMarker++)
+        if (fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1)
+          Mergeable = (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE);
+
+      for (iNode = 0; iNode < fine_grid->nodes->GetnPoint(iFinePoint); iNode++) {
+        jFinePoint = fine_grid->nodes->GetPoint(iFinePoint, iNode);
+
+        if (!fine_grid->nodes->GetDomain(jFinePoint)) { Interface = true; continue; }
+
+        jCoarsePoint = fine_grid->nodes->GetParent_CV(jFinePoint);
+        if (jCoarsePoint == iCoarsePoint) continue;
+
+        if ((Target == iCoarsePoint) || (nodes->GetnChildren_CV(jCoarsePoint) < nChildren_Target) ||
+            ((nodes->GetnChildren_CV(jCoarsePoint) == nChildren_Target) && (jCoarsePoint < Target))) {
+          Target = jCoarsePoint;
+          nChildren_Target = nodes->GetnChildren_CV(jCoarsePoint);
+        }
+      }
+    }
+
+    if (!Interface || !Mergeable || (Target == iCoarsePoint)) { iCoarsePoint++; continue; }
+
+    /*--- Move the children to the target ---*/
+
+    for (iChildren = 0; iChildren < nChildren; iChildren++) {
+      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+      nodes->SetChildren_CV(Target, nChildren_Target, iFinePoint);
+      nChildren_Target++;
+      fine_grid->nodes->SetParent_CV(iFinePoint, Target);
+    }
+    nodes->SetnChildren_CV(Target, nChildren_Target);
+
+    if (nodes->GetAgglomerate_Indirect(iCoarsePoint))
+      nodes->SetAgglomerate_Indirect(Target, true);
+
+    /*--- Fill the gap with the last agglomerate, which is examined in the next pass of the loop ---*/
+
+    iLastPoint = Index_CoarseCV-1;
+
+    if (iLastPoint != iCoarsePoint) {
+      nChildren = nodes->GetnChildren_CV(iLastPoint);
+      for (iChildren = 0; iChildren < nChildren; iChildren++) {
+        iFinePoint = nodes->GetChildren_CV(iLastPoint, iChildren);
+        nodes->SetChildren_CV(iCoarsePoint, iChildren, iFinePoint);
+        fine_grid->nodes->SetParent_CV(iFinePoint, iCoarsePoint);
+      }
+      nodes->SetnChildren_CV(iCoarsePoint, nChildren);
+      nodes->SetAgglomerate_Indirect(iCoarsePoint, nodes->GetAgglomerate_Indirect(iLastPoint));
+    }
+
+    nodes->SetnChildren_CV(iLastPoint, 0);
+    nodes->SetAgglomerate_Indirect(iLastPoint, false);
+    Index_CoarseCV--;
+  }
+
+}
+
 bool CMultiGridGeometry::GeometricalCheck(unsigned long iPoint, CGeometry *fine_grid, CConfig *config) {
 
   su2double max_dimension = 1.2;
@@ -1002,8 +1225,11 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
     }
   }
 
+  vertexData.clear();
+  vertexData.reserve(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [fine_grid->GetnVertex(iMarker)+1];
+    vertexData.emplace_back(nVertex[iMarker], nDim);
     nVertex[iMarker] = 0;
   }
 
@@ -1021,7 +1247,8 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
         for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker ++) {
           if ((fine_grid->nodes->GetVertex(iFinePoint, iMarker) != -1) && (nodes->GetVertex(iCoarsePoint, iMarker) == -1)) {
             iVertex = nVertex[iMarker];
-            vertex[iMarker][iVertex] = new CVertex(iCoarsePoint, nDim);
+            vertex[iMarker][iVertex] = new CVertex(nDim);
+            vertexData[iMarker].SetNode(iVertex, iCoarsePoint);
             nodes->SetVertex(iCoarsePoint, iVertex, iMarker);
 
             /*--- Set the transformation to apply ---*/
@@ -1045,7 +1272,7 @@ void CMultiGridGeometry::MatchNearField(CConfig *config) {
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
         if (nodes->GetDomain(iPoint)) {
           vertex[iMarker][iVertex]->SetDonorPoint(iPoint, nodes->GetGlobalIndex(iPoint), iVertex, iMarker, iProcessor);
         }
@@ -1065,7 +1292,7 @@ void CMultiGridGeometry::MatchActuator_Disk(CConfig *config) {
     if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
         (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
         if (nodes->GetDomain(iPoint)) {
           vertex[iMarker][iVertex]->SetDonorPoint(iPoint, nodes->GetGlobalIndex(iPoint), iVertex, iMarker, iProcessor);
         }
@@ -1091,7 +1318,7 @@ void CMultiGridGeometry::MatchPeriodic(CConfig *config, unsigned short val_perio
       if ((iPeriodic == val_periodic) ||
           (iPeriodic == val_periodic + nPeriodic/2)) {
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           if (nodes->GetDomain(iPoint)) {
             vertex[iMarker][iVertex]->SetDonorPoint(iPoint, nodes->GetGlobalIndex(iPoint), iVertex, iMarker, iProcessor);
           }
@@ -1177,19 +1404,18 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
 
   if (action != ALLOCATE) {
     for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-        vertex[iMarker][iVertex]->SetZeroValues();
+      vertexData[iMarker].SetZeroValues();
   }
 
   for (iMarker = 0; iMarker < nMarker; iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+      iCoarsePoint = vertexData[iMarker].GetNode(iVertex);
       for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
         iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
         if (fine_grid->nodes->GetVertex(iFinePoint, iMarker)!=-1) {
           FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
-          fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
-          vertex[iMarker][iVertex]->AddNormal(Normal);
+          fine_grid->vertexData[iMarker].GetNormal(FineVertex, Normal);
+          vertexData[iMarker].AddNormal(iVertex, Normal);
         }
       }
     }
@@ -1199,7 +1425,7 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
   /*--- Check if there is a normal with null area ---*/
   for (iMarker = 0; iMarker < nMarker; iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      NormalFace = vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
       Area = sqrt(Area);
       if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
@@ -1228,6 +1454,11 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
       nodes->SetCoord(Point_Coarse, iDim, Coordinates[iDim]);
   }
   delete[] Coordinates;
+
+  /*--- The control volume of the coarse grid is set before its coordinates. ---*/
+
+  SetEdgeGeometry();
+  UpdateVertexPacks();
 }
 
 void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned short val_marker){
@@ -1241,7 +1472,7 @@ void CMultiGridGeometry::SetMultiGridWallHeatFlux(CGeometry *geometry, unsigned
   int numberVertexChildren;
 
   for(iVertex=0; iVertex < nVertex[val_marker]; iVertex++){
-    Point_Coarse = vertex[val_marker][iVertex]->GetNode();
+    Point_Coarse = vertexData[val_marker].GetNode(iVertex);
     if (nodes->GetDomain(Point_Coarse)){
       Area_Parent = 0.0;
       WallHeatFlux_Coarse = 0.0;
@@ -1287,7 +1518,7 @@ void CMultiGridGeometry::SetMultiGridWallTemperature(CGeometry *geometry, unsign
   int numberVertexChildren;
 
   for(iVertex=0; iVertex < nVertex[val_marker]; iVertex++){
-    Point_Coarse = vertex[val_marker][iVertex]->GetNode();
+    Point_Coarse = vertexData[val_marker].GetNode(iVertex);
     if (nodes->GetDomain(Point_Coarse)){
       Area_Parent = 0.0;
       WallTemperature_Coarse = 0.0;
@@ -1361,7 +1592,7 @@ void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
 
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
 
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
 
         /*--- If the node belong to the domain ---*/
         if (nodes->GetDomain(iPoint)) {
@@ -1370,7 +1601,7 @@ void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
           su2double cos_max, scalar_prod, norm_vect, norm_Normal, cos_alpha, diff_coord;
           unsigned long Point_Normal = 0, jPoint;
           unsigned short iNeigh;
-          su2double *Normal = vertex[iMarker][iVertex]->GetNormal();
+          su2double *Normal = vertexData[iMarker].GetNormal(iVertex);
           cos_max = -1.0;
           for (iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); iNeigh++) {
             jPoint = nodes->GetPoint(iPoint, iNeigh);
@@ -1391,7 +1622,7 @@ void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
               cos_max = cos_alpha;
             }
           }
-          vertex[iMarker][iVertex]->SetNormal_Neighbor(Point_Normal);
+          vertexData[iMarker].SetNormal_Neighbor(iVertex, Point_Normal);
         }
       }
     }
@@ -54,6 +54,9 @@
 #include <direct.h>
 #endif
 
+/*--- Identification of the partition cache files, the version changes with their layout. ---*/
+static const char PARTITION_CACHE_MAGIC[] = "SU2_GEOMETRY_CACHE";
+static const unsigned long PARTITION_CACHE_VERSION = 2;
 
 CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {
 
@@ -276,7 +279,8 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
 }
 
 CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
-                                     CConfig *config) {
+                                     CConfig *config,
+                                     unsigned long val_cache_key) {
 
   /*--- Get rank and size. ---*/
 
@@ -450,75 +454,45 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   DistributeSurfaceConnectivity(config, geometry, TRIANGLE     );
   DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
 
-  /*--- Reduce the total number of elements that we have on each rank. ---*/
+  /*--- Store the partition of this rank such that later runs can skip the partitioning. ---*/
 
-  nLocal_Elem = (nLocal_Tria +
-                 nLocal_Quad +
-                 nLocal_Tetr +
-                 nLocal_Hexa +
-                 nLocal_Pris +
-                 nLocal_Pyra);
-  nLocal_Bound_Elem = nLocal_Line + nLocal_BoundTria + nLocal_BoundQuad;
-
-  SU2_MPI::Allreduce(&nLocal_Elem, &nGlobal_Elem, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&nLocal_Bound_Elem, &nGlobal_Bound_Elem, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  if (config->GetGeometry_Cache() && (config->GetKind_SU2() == SU2_CFD))
+    WritePartitionCache(config, geometry, val_cache_key);
 
   /*--- With the distribution of all points, elements, and markers based
    on the ParMETIS coloring complete, as a final step, load this data into
    our geometry class data structures. ---*/
 
-  LoadPoints(config, geometry);
-  LoadVolumeElements(config, geometry);
-  LoadSurfaceElements(config, geometry);
+  LoadPartition(config, geometry);
 
-  /*--- Free memory associated with the partitioning of points and elems. ---*/
+}
 
-  Neighbors.clear();
-  Color_List.clear();
+CPhysicalGeometry::CPhysicalGeometry(CConfig *config, const string& val_cache_filename,
+                                     unsigned short val_nZone) : CPhysicalGeometry() {
 
-  delete [] Local_Points;
-  delete [] Local_Colors;
-  delete [] Local_Coords;
+  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
 
-  if (nLinear_Line > 0      && Conn_Line_Linear      != nullptr)
-    delete [] Conn_Line_Linear;
-  if (nLinear_BoundTria > 0 && Conn_BoundTria_Linear != nullptr)
-    delete [] Conn_BoundTria_Linear;
-  if (nLinear_BoundQuad > 0 && Conn_BoundQuad_Linear != nullptr)
-    delete [] Conn_BoundQuad_Linear;
+  nZone = val_nZone;
 
-  if (nLocal_Line > 0      && Conn_Line      != nullptr) delete [] Conn_Line;
-  if (nLocal_BoundTria > 0 && Conn_BoundTria != nullptr) delete [] Conn_BoundTria;
-  if (nLocal_BoundQuad > 0 && Conn_BoundQuad != nullptr) delete [] Conn_BoundQuad;
-  if (nLocal_Tria > 0      && Conn_Tria      != nullptr) delete [] Conn_Tria;
-  if (nLocal_Quad > 0      && Conn_Quad      != nullptr) delete [] Conn_Quad;
-  if (nLocal_Tetr > 0      && Conn_Tetr      != nullptr) delete [] Conn_Tetr;
-  if (nLocal_Hexa > 0      && Conn_Hexa      != nullptr) delete [] Conn_Hexa;
-  if (nLocal_Pris > 0      && Conn_Pris      != nullptr) delete [] Conn_Pris;
-  if (nLocal_Pyra > 0      && Conn_Pyra      != nullptr) delete [] Conn_Pyra;
+  /*--- Initialize the partitioning data that is not stored in the cache. ---*/
 
-  delete [] ID_Line;
-  delete [] ID_BoundTria;
-  delete [] ID_BoundQuad;
-  delete [] ID_Line_Linear;
-  delete [] ID_BoundTria_Linear;
-  delete [] ID_BoundQuad_Linear;
+  nLinear_Line = nLinear_BoundTria = nLinear_BoundQuad = 0;
 
-  delete [] ID_Tria;
-  delete [] ID_Quad;
-  delete [] ID_Tetr;
-  delete [] ID_Hexa;
-  delete [] ID_Pris;
-  delete [] ID_Pyra;
+  Conn_Line_Linear = Conn_BoundTria_Linear = Conn_BoundQuad_Linear = nullptr;
+  ID_Line_Linear = ID_BoundTria_Linear = ID_BoundQuad_Linear = nullptr;
+  Elem_ID_Line_Linear = Elem_ID_BoundTria_Linear = Elem_ID_BoundQuad_Linear = nullptr;
 
-  delete [] Elem_ID_Line;
-  delete [] Elem_ID_BoundTria;
-  delete [] Elem_ID_BoundQuad;
-  delete [] Elem_ID_Line_Linear;
-  delete [] Elem_ID_BoundTria_Linear;
-  delete [] Elem_ID_BoundQuad_Linear;
+  if (rank == MASTER_NODE)
+    cout << "Loading the partitioned grid from the partition cache." << endl;
+
+  ReadPartitionCache(config, val_cache_filename);
+
+  /*--- The cache holds the same data as the distribution of the linear partitions,
+   this geometry takes their role (global sizes of the grid) when loading it. ---*/
+
+  LoadPartition(config, this);
+
+  assert((nDim == 2) || (nDim == 3));
 
 }
 
@@ -2331,6 +2305,79 @@ void CPhysicalGeometry::DistributeMarkerTags(CConfig *config, CGeometry *geometr
 
 }
 
+void CPhysicalGeometry::LoadPartition(CConfig *config, CGeometry *geometry) {
+
+  /*--- Reduce the total number of elements that we have on each rank. ---*/
+
+  nLocal_Elem = (nLocal_Tria +
+                 nLocal_Quad +
+                 nLocal_Tetr +
+                 nLocal_Hexa +
+                 nLocal_Pris +
+                 nLocal_Pyra);
+  nLocal_Bound_Elem = nLocal_Line + nLocal_BoundTria + nLocal_BoundQuad;
+
+  SU2_MPI::Allreduce(&nLocal_Elem, &nGlobal_Elem, 1,
+                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nLocal_Bound_Elem, &nGlobal_Bound_Elem, 1,
+                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- Load the points, volume elements and markers of this rank into
+   our geometry class data structures. ---*/
+
+  LoadPoints(config, geometry);
+  LoadVolumeElements(config, geometry);
+  LoadSurfaceElements(config, geometry);
+
+  /*--- Free memory associated with the partitioning of points and elems. ---*/
+
+  Neighbors.clear();
+  Color_List.clear();
+
+  delete [] Local_Points;
+  delete [] Local_Colors;
+  delete [] Local_Coords;
+
+  if (nLinear_Line > 0      && Conn_Line_Linear      != nullptr)
+    delete [] Conn_Line_Linear;
+  if (nLinear_BoundTria > 0 && Conn_BoundTria_Linear != nullptr)
+    delete [] Conn_BoundTria_Linear;
+  if (nLinear_BoundQuad > 0 && Conn_BoundQuad_Linear != nullptr)
+    delete [] Conn_BoundQuad_Linear;
+
+  if (nLocal_Line > 0      && Conn_Line      != nullptr) delete [] Conn_Line;
+  if (nLocal_BoundTria > 0 && Conn_BoundTria != nullptr) delete [] Conn_BoundTria;
+  if (nLocal_BoundQuad > 0 && Conn_BoundQuad != nullptr) delete [] Conn_BoundQuad;
+  if (nLocal_Tria > 0      && Conn_Tria      != nullptr) delete [] Conn_Tria;
+  if (nLocal_Quad > 0      && Conn_Quad      != nullptr) delete [] Conn_Quad;
+  if (nLocal_Tetr > 0      && Conn_Tetr      != nullptr) delete [] Conn_Tetr;
+  if (nLocal_Hexa > 0      && Conn_Hexa      != nullptr) delete [] Conn_Hexa;
+  if (nLocal_Pris > 0      && Conn_Pris      != nullptr) delete [] Conn_Pris;
+  if (nLocal_Pyra > 0      && Conn_Pyra      != nullptr) delete [] Conn_Pyra;
+
+  delete [] ID_Line;
+  delete [] ID_BoundTria;
+  delete [] ID_BoundQuad;
+  delete [] ID_Line_Linear;
+  delete [] ID_BoundTria_Linear;
+  delete [] ID_BoundQuad_Linear;
+
+  delete [] ID_Tria;
+  delete [] ID_Quad;
+  delete [] ID_Tetr;
+  delete [] ID_Hexa;
+  delete [] ID_Pris;
+  delete [] ID_Pyra;
+
+  delete [] Elem_ID_Line;
+  delete [] Elem_ID_BoundTria;
+  delete [] Elem_ID_BoundQuad;
+  delete [] Elem_ID_Line_Linear;
+  delete [] Elem_ID_BoundTria_Linear;
+  delete [] Elem_ID_BoundQuad_Linear;
+
+}
+
 void CPhysicalGeometry::LoadPoints(CConfig *config, CGeometry *geometry) {
 
   unsigned long iPoint, jPoint, iOwned, iPeriodic, iGhost;
@@ -3071,6 +3118,397 @@ void CPhysicalGeometry::LoadSurfaceElements(CConfig *config, CGeometry *geometry
 
 }
 
+string CPhysicalGeometry::GetPartitionCacheFileName(const CConfig *config) {
+
+  const string ext = "_" + to_string(SU2_MPI::GetRank()) + ".dat";
+  return config->GetMultizone_FileName(config->GetGeometry_Cache_FileName(), config->GetiZone(), ext);
+}
+
+unsigned long CPhysicalGeometry::GetPartitionCacheKey(const CConfig *config) {
+
+  /*--- 64-bit FNV-1a hash of the grid and of the options that define the partitions. ---*/
+
+  unsigned long key = 14695981039346656037ul;
+
+  auto Hash = [&key](const void *data, size_t bytes) {
+    const auto ptr = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < bytes; ++i) {
+      key ^= ptr[i];
+      key *= 1099511628211ul;
+    }
+  };
+
+  const unsigned long options[] = {PARTITION_CACHE_VERSION, static_cast<unsigned long>(SU2_MPI::GetSize()),
+                                   config->GetiZone(), config->GetnZone(), config->GetMesh_FileFormat(),
+                                   config->GetSystemMeasurements(), config->GetDiscard_InFiles()};
+  Hash(options, sizeof(options));
+
+  if ((config->GetMesh_FileFormat() == RECTANGLE) || (config->GetMesh_FileFormat() == BOX)) {
+
+    /*--- Analytic grids are defined by their sizes. ---*/
+
+    for (unsigned short iDim = 0; iDim < 3; iDim++) {
+      const short nNode = config->GetMeshBoxSize(iDim);
+      const passivedouble length = SU2_TYPE::GetValue(config->GetMeshBoxLength(iDim));
+      const passivedouble offset = SU2_TYPE::GetValue(config->GetMeshBoxOffset(iDim));
+      Hash(&nNode, sizeof(short));
+      Hash(&length, sizeof(passivedouble));
+      Hash(&offset, sizeof(passivedouble));
+    }
+  }
+  else if (SU2_MPI::GetRank() == MASTER_NODE) {
+
+    /*--- The master hashes the contents of the grid file. ---*/
+
+    ifstream mesh_file(config->GetMesh_FileName(), ios::in | ios::binary);
+    vector<char> buffer(1<<20);
+
+    while (mesh_file.good()) {
+      mesh_file.read(buffer.data(), buffer.size());
+      Hash(buffer.data(), mesh_file.gcount());
+    }
+  }
+
+  SU2_MPI::Bcast(&key, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  return key;
+}
+
+bool CPhysicalGeometry::CheckPartitionCache(const CConfig *config, unsigned long key) {
+
+  /*--- Compare the header of the cache file of this rank with the expected one. ---*/
+
+  const unsigned long expected[] = {PARTITION_CACHE_VERSION, static_cast<unsigned long>(SU2_MPI::GetSize()),
+                                    static_cast<unsigned long>(SU2_MPI::GetRank()), key};
+  char magic[sizeof(PARTITION_CACHE_MAGIC)] = {'\0'};
+  unsigned long header[4] = {0};
+
+  ifstream cache_file(GetPartitionCacheFileName(config), ios::in | ios::binary);
+  cache_file.read(magic, sizeof(magic));
+  cache_file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+  const bool match = cache_file.good() &&
+                     equal(magic, magic+sizeof(magic), PARTITION_CACHE_MAGIC) &&
+                     equal(header, header+4, expected);
+
+  /*--- Walk the sections of a matching file to detect truncated or damaged
+   caches, the arrays are skipped, only their sizes are read. ---*/
+
+  auto Read = [&cache_file](void *data, unsigned long count, size_t bytes) {
+    cache_file.read(static_cast<char*>(data), count*bytes);
+    return cache_file.good();
+  };
+
+  /*--- Seeking past the end does not fail, positions are compared with the file size. ---*/
+
+  cache_file.seekg(0, ios::end);
+  const auto fileSize = cache_file.tellg();
+  cache_file.seekg(sizeof(magic)+sizeof(header), ios::beg);
+
+  auto Skip = [&cache_file, fileSize](unsigned long count, size_t bytes) {
+    cache_file.seekg(count*bytes, ios::cur);
+    return cache_file.good() && (cache_file.tellg() < fileSize);
+  };
+
+  bool complete = match;
+
+  if (complete) {
+    passivedouble offsets[2];
+    unsigned long sizes[5];
+    complete = Read(offsets, 2, sizeof(passivedouble)) && Read(sizes, 5, sizeof(unsigned long));
+
+    for (auto iMarker = 0ul; complete && (iMarker < sizes[4]); iMarker++) {
+      unsigned long length = 0;
+      complete = Read(&length, 1, sizeof(unsigned long)) && Skip(length, sizeof(char));
+    }
+
+    unsigned long nPoints[4];
+    complete = complete && Read(nPoints, 4, sizeof(unsigned long)) &&
+               Skip(2*nPoints[0], sizeof(unsigned long)) && Skip(nPoints[0]*sizes[0], sizeof(passivedouble));
+
+    const unsigned short nodesVolume[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                          N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+    unsigned long nVolume[6];
+    complete = complete && Read(nVolume, 6, sizeof(unsigned long));
+    for (auto iType = 0u; complete && (iType < 6); iType++)
+      complete = Skip(nVolume[iType]*(1+nodesVolume[iType]), sizeof(unsigned long));
+
+    /*--- The last section must end exactly at the end of the file. ---*/
+
+    const unsigned short nodesSurface[] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL};
+    unsigned long nSurface[3], nEntries = 0;
+    complete = complete && Read(nSurface, 3, sizeof(unsigned long));
+    for (auto iType = 0u; iType < 3; iType++)
+      nEntries += nSurface[iType]*(2+nodesSurface[iType]);
+    if (complete) {
+      cache_file.seekg(nEntries*sizeof(unsigned long), ios::cur);
+      complete = cache_file.good() && (cache_file.tellg() == fileSize);
+    }
+  }
+
+  if (match && !complete) {
+    cout << "WARNING: The partition cache file " << GetPartitionCacheFileName(config)
+         << " is incomplete, the grid is partitioned again." << endl;
+  }
+
+  /*--- The cache is only used if it is valid for all ranks. ---*/
+
+  unsigned short valid = complete;
+  unsigned short all_valid = valid;
+  SU2_MPI::Allreduce(&valid, &all_valid, 1, MPI_UNSIGNED_SHORT, MPI_MIN, MPI_COMM_WORLD);
+
+  return all_valid;
+}
+
+void CPhysicalGeometry::WritePartitionCache(const CConfig *config, const CGeometry *geometry,
+                                            unsigned long key) const {
+
+  const auto filename = GetPartitionCacheFileName(config);
+
+  ofstream cache_file(filename, ios::out | ios::binary);
+
+  auto Write = [&cache_file](const void *data, unsigned long count, size_t bytes) {
+    if (count > 0) cache_file.write(static_cast<const char*>(data), count*bytes);
+  };
+
+  /*--- Header, which identifies the grid and the partitioning. ---*/
+
+  const unsigned long header[] = {PARTITION_CACHE_VERSION, static_cast<unsigned long>(size),
+                                  static_cast<unsigned long>(rank), key};
+  Write(PARTITION_CACHE_MAGIC, 1, sizeof(PARTITION_CACHE_MAGIC));
+  Write(header, 4, sizeof(unsigned long));
+
+  /*--- AoA and AoS offsets of the grid file, which the mesh reader adds to the config. ---*/
+
+  const passivedouble offsets[] = {SU2_TYPE::GetValue(config->GetAoA_Offset()),
+                                   SU2_TYPE::GetValue(config->GetAoS_Offset())};
+  Write(offsets, 2, sizeof(passivedouble));
+
+  /*--- Sizes of the grid before partitioning and marker tags. ---*/
+
+  const unsigned long sizes[] = {nDim, geometry->GetGlobal_nPoint(), geometry->GetGlobal_nPointDomain(),
+                                 geometry->GetGlobal_nElemDomain(), nMarker_Global};
+  Write(sizes, 5, sizeof(unsigned long));
+
+  for (const auto& tag : Marker_Tags) {
+    const unsigned long length = tag.size();
+    Write(&length, 1, sizeof(unsigned long));
+    Write(tag.data(), length, sizeof(char));
+  }
+
+  /*--- Points (owned, periodic and ghost) of this rank. ---*/
+
+  const unsigned long nPoints[] = {nLocal_Point, nLocal_PointDomain, nLocal_PointPeriodic, nLocal_PointGhost};
+  Write(nPoints, 4, sizeof(unsigned long));
+  Write(Local_Points, nLocal_Point, sizeof(unsigned long));
+  Write(Local_Colors, nLocal_Point, sizeof(unsigned long));
+
+  vector<passivedouble> coords(nLocal_Point*nDim);
+  for (auto iCoord = 0ul; iCoord < coords.size(); iCoord++)
+    coords[iCoord] = SU2_TYPE::GetValue(Local_Coords[iCoord]);
+  Write(coords.data(), coords.size(), sizeof(passivedouble));
+
+  /*--- Volume elements, global index and connectivity. ---*/
+
+  const unsigned long nVolume[] = {nLocal_Tria, nLocal_Quad, nLocal_Tetr, nLocal_Hexa, nLocal_Pris, nLocal_Pyra};
+  const unsigned long* const idVolume[] = {ID_Tria, ID_Quad, ID_Tetr, ID_Hexa, ID_Pris, ID_Pyra};
+  const unsigned long* const connVolume[] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  const unsigned short nodesVolume[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                        N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+
+  Write(nVolume, 6, sizeof(unsigned long));
+  for (auto iType = 0u; iType < 6; iType++) {
+    Write(idVolume[iType], nVolume[iType], sizeof(unsigned long));
+    Write(connVolume[iType], nVolume[iType]*nodesVolume[iType], sizeof(unsigned long));
+  }
+
+  /*--- Surface elements, global marker, global index and connectivity. ---*/
+
+  const unsigned long nSurface[] = {nLocal_Line, nLocal_BoundTria, nLocal_BoundQuad};
+  const unsigned long* const markerSurface[] = {ID_Line, ID_BoundTria, ID_BoundQuad};
+  const unsigned long* const idSurface[] = {Elem_ID_Line, Elem_ID_BoundTria, Elem_ID_BoundQuad};
+  const unsigned long* const connSurface[] = {Conn_Line, Conn_BoundTria, Conn_BoundQuad};
+  const unsigned short nodesSurface[] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL};
+
+  Write(nSurface, 3, sizeof(unsigned long));
+  for (auto iType = 0u; iType < 3; iType++) {
+    Write(markerSurface[iType], nSurface[iType], sizeof(unsigned long));
+    Write(idSurface[iType], nSurface[iType], sizeof(unsigned long));
+    Write(connSurface[iType], nSurface[iType]*nodesSurface[iType], sizeof(unsigned long));
+  }
+
+  /*--- Failing to write the cache is not fatal, the next run partitions the grid again. ---*/
+
+  cache_file.close();
+  if (cache_file.fail()) {
+    cout << "WARNING: Rank " << rank << " could not write the partition cache file " << filename << "." << endl;
+  }
+}
+
+void CPhysicalGeometry::ReadPartitionCache(CConfig *config, const string& val_cache_filename) {
+
+  ifstream cache_file(val_cache_filename, ios::in | ios::binary);
+
+  if (!cache_file.is_open()) {
+    SU2_MPI::Error("Unable to open the partition cache file " + val_cache_filename + ".", CURRENT_FUNCTION);
+  }
+
+  /*--- The layout was validated by CheckPartitionCache, a failure here means the
+   file was modified since, which cannot be recovered from as the config was changed. ---*/
+
+  auto CheckSection = [&cache_file, &val_cache_filename](const string& section) {
+    if (cache_file.fail() || cache_file.eof()) {
+      SU2_MPI::Error("Could not read the " + section + " from the partition cache file " +
+                     val_cache_filename + ".", CURRENT_FUNCTION);
+    }
+  };
+
+  auto Read = [&cache_file](void *data, unsigned long count, size_t bytes) {
+    if (count > 0) cache_file.read(static_cast<char*>(data), count*bytes);
+  };
+
+  auto ReadArray = [&Read](unsigned long count) {
+    unsigned long *array = nullptr;
+    if (count > 0) {
+      array = new unsigned long[count];
+      Read(array, count, sizeof(unsigned long));
+    }
+    return array;
+  };
+
+  char magic[sizeof(PARTITION_CACHE_MAGIC)];
+  unsigned long header[4];
+  Read(magic, 1, sizeof(magic));
+  Read(header, 4, sizeof(unsigned long));
+  CheckSection("header");
+
+  /*--- Apply the AoA and AoS offsets of the grid file as the mesh reader does, the
+   key of the cache includes DISCARD_INFILES, the offsets are 0 if they were discarded. ---*/
+
+  passivedouble offsets[2];
+  Read(offsets, 2, sizeof(passivedouble));
+  CheckSection("AoA and AoS offsets");
+
+  if (!config->GetDiscard_InFiles()) {
+    if (offsets[0] != 0.0) {
+      const su2double AoA_Current = config->GetAoA() + offsets[0];
+      if (rank == MASTER_NODE) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << offsets[0] << " deg.) = " << AoA_Current << " deg." << endl;
+      }
+      config->SetAoA_Offset(offsets[0]);
+      config->SetAoA(AoA_Current);
+    }
+    if (offsets[1] != 0.0) {
+      const su2double AoS_Current = config->GetAoS() + offsets[1];
+      if (rank == MASTER_NODE) {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << offsets[1] << " deg.) = " << AoS_Current << " deg." << endl;
+      }
+      config->SetAoS_Offset(offsets[1]);
+      config->SetAoS(AoS_Current);
+    }
+  }
+
+  /*--- Sizes of the grid before partitioning, the linear partitions are
+   needed to locate the points of the grid by global index. ---*/
+
+  unsigned long sizes[5];
+  Read(sizes, 5, sizeof(unsigned long));
+  CheckSection("grid sizes");
+
+  nDim = sizes[0];
+  Global_nPoint = sizes[1];
+  Global_nPointDomain = sizes[2];
+  Global_nElemDomain = sizes[3];
+  nMarker_Global = sizes[4];
+
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+
+  PrepareOffsets(Global_nPoint);
+
+  /*--- Marker tags, set in the config as done by DistributeMarkerTags. ---*/
+
+  for (auto iMarker = 0ul; iMarker < nMarker_Global; iMarker++) {
+    unsigned long length = 0;
+    Read(&length, 1, sizeof(unsigned long));
+    string tag(length, ' ');
+    Read(&tag[0], length, sizeof(char));
+    CheckSection("marker tags");
+
+    Marker_Tags.push_back(tag);
+    config->SetMarker_All_TagBound(iMarker, tag);
+    config->SetMarker_All_SendRecv(iMarker, NO);
+  }
+
+  /*--- Points of this rank. ---*/
+
+  unsigned long nPoints[4];
+  Read(nPoints, 4, sizeof(unsigned long));
+
+  nLocal_Point = nPoints[0];
+  nLocal_PointDomain = nPoints[1];
+  nLocal_PointPeriodic = nPoints[2];
+  nLocal_PointGhost = nPoints[3];
+
+  Local_Points = ReadArray(nLocal_Point);
+  Local_Colors = ReadArray(nLocal_Point);
+
+  vector<passivedouble> coords(nLocal_Point*nDim);
+  Read(coords.data(), coords.size(), sizeof(passivedouble));
+  CheckSection("points");
+
+  Local_Coords = new su2double[coords.size()];
+  for (auto iCoord = 0ul; iCoord < coords.size(); iCoord++)
+    Local_Coords[iCoord] = coords[iCoord];
+
+  /*--- Volume elements. ---*/
+
+  unsigned long* const nVolume[] = {&nLocal_Tria, &nLocal_Quad, &nLocal_Tetr, &nLocal_Hexa, &nLocal_Pris, &nLocal_Pyra};
+  unsigned long** const idVolume[] = {&ID_Tria, &ID_Quad, &ID_Tetr, &ID_Hexa, &ID_Pris, &ID_Pyra};
+  unsigned long** const connVolume[] = {&Conn_Tria, &Conn_Quad, &Conn_Tetr, &Conn_Hexa, &Conn_Pris, &Conn_Pyra};
+  const unsigned short nodesVolume[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                        N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+
+  for (auto iType = 0u; iType < 6; iType++)
+    Read(nVolume[iType], 1, sizeof(unsigned long));
+
+  for (auto iType = 0u; iType < 6; iType++) {
+    *idVolume[iType] = ReadArray(*nVolume[iType]);
+    *connVolume[iType] = ReadArray(*nVolume[iType]*nodesVolume[iType]);
+  }
+  CheckSection("volume elements");
+
+  /*--- Surface elements. ---*/
+
+  unsigned long* const nSurface[] = {&nLocal_Line, &nLocal_BoundTria, &nLocal_BoundQuad};
+  unsigned long** const markerSurface[] = {&ID_Line, &ID_BoundTria, &ID_BoundQuad};
+  unsigned long** const idSurface[] = {&Elem_ID_Line, &Elem_ID_BoundTria, &Elem_ID_BoundQuad};
+  unsigned long** const connSurface[] = {&Conn_Line, &Conn_BoundTria, &Conn_BoundQuad};
+  const unsigned short nodesSurface[] = {N_POINTS_LINE, N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL};
+
+  for (auto iType = 0u; iType < 3; iType++)
+    Read(nSurface[iType], 1, sizeof(unsigned long));
+
+  for (auto iType = 0u; iType < 3; iType++) {
+    *markerSurface[iType] = ReadArray(*nSurface[iType]);
+    *idSurface[iType] = ReadArray(*nSurface[iType]);
+    *connSurface[iType] = ReadArray(*nSurface[iType]*nodesSurface[iType]);
+  }
+
+  /*--- The eof flag is only set by reading past the end, the file must end here. ---*/
+
+  if (cache_file.fail() || (cache_file.peek() != EOF)) {
+    SU2_MPI::Error("Could not read the surface elements from the partition cache file " +
+                   val_cache_filename + ".", CURRENT_FUNCTION);
+  }
+}
+
 void CPhysicalGeometry::InitiateCommsAll(void *bufSend,
                                          const int *nElemSend,
                                          SU2_MPI::Request *sendReq,
@@ -5011,10 +5449,10 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
         || (fea))
 
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
 
         if (nodes->GetDomain(iPoint)) {
-          Normal = vertex[iMarker][iVertex]->GetNormal();
+          Normal = vertexData[iMarker].GetNormal(iVertex);
           CoordX = nodes->GetCoord(iPoint, 0);
           CoordY = nodes->GetCoord(iPoint, 1);
           if (nDim == 3) CoordZ = nodes->GetCoord(iPoint, 2);
@@ -5285,11 +5723,43 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  vector<unsigned long> InvResult(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    InvResult[Result[iPoint]] = iPoint;
+  }
+
+  /*--- Permute the point connectivity instead of building it again from the
+   renumbered elements, the element indices do not change and the neighbors
+   keep their order, thus the result is the same as that of SetPoint_Connectivity. ---*/
+
+  vector<vector<long> > elems(nPoint);
+  vector<vector<unsigned long> > points(nPoint);
+
+  SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPoint,omp_get_max_threads())))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    const auto oldPoint = Result[iPoint];
+
+    elems[iPoint].resize(nodes->GetnElem(oldPoint));
+    for (auto iElem = 0u; iElem < elems[iPoint].size(); iElem++)
+      elems[iPoint][iElem] = nodes->GetElem(oldPoint, iElem);
+
+    points[iPoint].resize(nodes->GetnPoint(oldPoint));
+    for (auto iNode = 0u; iNode < points[iPoint].size(); iNode++)
+      points[iPoint][iNode] = InvResult[nodes->GetPoint(oldPoint, iNode)];
+  }
+
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
   nodes->ResetPoints();
 
+  nodes->SetElems(elems);
+  nodes->SetPoints(points);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    nodes->SetnNeighbor(iPoint, points[iPoint].size());
+  }
+
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
     nodes->ResetBoundary(iPoint);
     nodes->SetPhysicalBoundary(iPoint, false);
@@ -5317,11 +5787,6 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
 
   /*--- Set the new conectivities ---*/
 
-  auto& InvResult = AuxGlobalIndex; // alias to re-use storage
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    InvResult[Result[iPoint]] = iPoint;
-  }
-
   for (auto iElem = 0ul; iElem < nElem; iElem++) {
     for (auto iNode = 0u; iNode < elem[iElem]->GetnNodes(); iNode++) {
       auto iPoint = elem[iElem]->GetNode(iNode);
@@ -5360,37 +5825,35 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
 }
 
 void CPhysicalGeometry::SetElement_Connectivity(void) {
-  unsigned short first_elem_face, second_elem_face, iFace, iNode, jElem;
-  unsigned long face_point, Test_Elem, iElem;
-
-  /*--- Loop over all the elements, faces and nodes ---*/
 
-  for (iElem = 0; iElem < nElem; iElem++)
-    for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++)
-      for (iNode = 0; iNode < elem[iElem]->GetnNodesFace(iFace); iNode++) {
-        face_point = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iNode));
+  /*--- Loop over all the elements, faces and nodes. Each element only sets its
+   own neighbors, which makes the loop independent of the order of the elements. ---*/
 
-        /*--- Loop over all elements sharing the face point ---*/
-
-        for (jElem = 0; jElem < nodes->GetnElem(face_point); jElem++) {
-          Test_Elem = nodes->GetElem(face_point, jElem);
+  SU2_OMP_PARALLEL_(for schedule(dynamic,roundUpDiv(nElem,2*omp_get_max_threads())))
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodesFace(iFace); iNode++) {
 
-          /*--- If it is a new element in this face ---*/
+        /*--- Skip the faces whose neighbor is already known ---*/
 
-          if ((elem[iElem]->GetNeighbor_Elements(iFace) == -1) && (iElem < Test_Elem) &&
-              FindFace(iElem, Test_Elem, first_elem_face, second_elem_face)) {
+        if (elem[iElem]->GetNeighbor_Elements(iFace) != -1) break;
 
-            /*--- Localice which faces are sharing both elements ---*/
+        const auto face_point = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iNode));
 
-            elem[iElem]->SetNeighbor_Elements(Test_Elem, first_elem_face);
+        /*--- Loop over all elements sharing the face point ---*/
 
-            /*--- Store the element for both elements ---*/
+        for (unsigned short jElem = 0; jElem < nodes->GetnElem(face_point); jElem++) {
+          const auto Test_Elem = nodes->GetElem(face_point, jElem);
+          unsigned short first_elem_face, second_elem_face;
 
-            elem[Test_Elem]->SetNeighbor_Elements(iElem, second_elem_face);
+          /*--- Localize which faces are shared by both elements ---*/
 
-          }
+          if (FindFace(iElem, Test_Elem, first_elem_face, second_elem_face))
+            elem[iElem]->SetNeighbor_Elements(Test_Elem, first_elem_face);
         }
       }
+    }
+  }
 }
 
 void CPhysicalGeometry::SetBoundVolume(void) {
@@ -5473,8 +5936,11 @@ void CPhysicalGeometry::SetVertex(CConfig *config) {
    is the same as in the input file, this is important for Send/Receive part ---*/
 
   vertex = new CVertex**[nMarker];
+  vertexData.clear();
+  vertexData.reserve(nMarker);
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [nVertex[iMarker]];
+    vertexData.emplace_back(nVertex[iMarker], nDim);
     nVertex[iMarker] = 0;
 
     /*--- Initialize the number of Bound Vertex for each Marker ---*/
@@ -5487,7 +5953,8 @@ void CPhysicalGeometry::SetVertex(CConfig *config) {
 
         if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
           iVertex = nVertex[iMarker];
-          vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
+          vertex[iMarker][iVertex] = new CVertex(nDim);
+          vertexData[iMarker].SetNode(iVertex, iPoint);
 
           if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
             vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
@@ -5536,7 +6003,7 @@ void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone,
           if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
             if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
               for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-                iPoint = vertex[iMarker][iVertex]->GetNode();
+                iPoint = vertexData[iMarker].GetNode(iVertex);
 
                 /*--- loop to find the vertex that ar both of inflow or outflow marker and on the periodic
                  * in order to caount the number of Span ---*/
@@ -5582,7 +6049,7 @@ void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone,
           if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
             if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
               for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-                iPoint = vertex[iMarker][iVertex]->GetNode();
+                iPoint = vertexData[iMarker].GetNode(iVertex);
                 for (jMarker = 0; jMarker < nMarker; jMarker++){
                   if (config->GetMarker_All_KindBC(jMarker) == PERIODIC_BOUNDARY) {
                     PeriodicBoundary = config->GetMarker_All_PerBound(jMarker);
@@ -5715,7 +6182,7 @@ void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone,
           if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
             if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
               for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-                iPoint = vertex[iMarker][iVertex]->GetNode();
+                iPoint = vertexData[iMarker].GetNode(iVertex);
                 for (jMarker = 0; jMarker < nMarker; jMarker++){
                   if (config->GetMarker_All_KindBC(jMarker) == PERIODIC_BOUNDARY) {
                     PeriodicBoundary = config->GetMarker_All_PerBound(jMarker);
@@ -5894,7 +6361,7 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
 
             /*--- compute the amount of vertexes for each span-wise section to initialize the CTurboVertex pointers and auxiliary pointers  ---*/
             for (iVertex = 0; (unsigned long)iVertex  < nVertex[iMarker]; iVertex++) {
-              iPoint = vertex[iMarker][iVertex]->GetNode();
+              iPoint = vertexData[iMarker].GetNode(iVertex);
               if (nDim == 3){
                 dist = 10E+06;
                 jSpan = -1;
@@ -5995,7 +6462,7 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
 
             /*--- store the vertexes in a ordered manner in span-wise directions but not yet ordered pitch-wise ---*/
             for (iVertex = 0; (unsigned long)iVertex < nVertex[iMarker]; iVertex++) {
-              iPoint = vertex[iMarker][iVertex]->GetNode();
+              iPoint = vertexData[iMarker].GetNode(iVertex);
               if(nDim == 3){
                 dist  = 10E+06;
                 jSpan = -1;
@@ -6063,7 +6530,7 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
                 jSpan = 0;
               }
               /*--- compute the face area associated with the vertex ---*/
-              vertex[iMarker][iVertex]->GetNormal(NormalArea);
+              vertexData[iMarker].GetNormal(iVertex, NormalArea);
               for (iDim = 0; iDim < nDim; iDim++) NormalArea[iDim] = -NormalArea[iDim];
               Area = 0.0;
               for (iDim = 0; iDim < nDim; iDim++)
@@ -7183,8 +7650,7 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
 
   if (action != ALLOCATE)
     for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-        vertex[iMarker][iVertex]->SetZeroValues();
+      vertexData[iMarker].SetZeroValues();
 
   su2double *Coord_Edge_CG = new su2double [nDim];
   su2double *Coord_Elem_CG = new su2double [nDim];
@@ -7223,15 +7689,15 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
 
               /*--- Store the 2D face ---*/
 
-              if (iNode == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
-              if (iNode == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
+              if (iNode == 0) vertexData[iMarker].SetNodes_Coord(iVertex, Coord_Elem_CG, Coord_Vertex);
+              if (iNode == 1) vertexData[iMarker].SetNodes_Coord(iVertex, Coord_Vertex, Coord_Elem_CG);
               break;
             case 3:
 
               /*--- Store the 3D face ---*/
 
-              if (iNeighbor_Nodes == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
-              if (iNeighbor_Nodes == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
+              if (iNeighbor_Nodes == 0) vertexData[iMarker].SetNodes_Coord(iVertex, Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
+              if (iNeighbor_Nodes == 1) vertexData[iMarker].SetNodes_Coord(iVertex, Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
               break;
           }
         }
@@ -7245,12 +7711,16 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
 
   for (iMarker = 0; iMarker < nMarker; iMarker ++)
     for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      NormalFace = vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
       Area = sqrt(Area);
       if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
     }
 
+  /*--- Refresh the packed vertices (empty until the normal neighbors are found). ---*/
+
+  UpdateVertexPacks();
+
 }
 
 void CPhysicalGeometry::SetMaxLength(CConfig* config) {
@@ -7335,7 +7805,7 @@ void CPhysicalGeometry::MatchNearField(CConfig *config) {
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
         for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           if (nodes->GetDomain(iPoint)) nLocalVertex_NearField ++;
         }
 
@@ -7379,7 +7849,7 @@ void CPhysicalGeometry::MatchNearField(CConfig *config) {
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
         for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           iPointGlobal = nodes->GetGlobalIndex(iPoint);
           if (nodes->GetDomain(iPoint)) {
             Buffer_Send_Point[nLocalVertex_NearField] = iPoint;
@@ -7406,7 +7876,7 @@ void CPhysicalGeometry::MatchNearField(CConfig *config) {
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
 
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           iPointGlobal = nodes->GetGlobalIndex(iPoint);
 
           if (nodes->GetDomain(iPoint)) {
@@ -7520,7 +7990,7 @@ void CPhysicalGeometry::MatchActuator_Disk(CConfig *config) {
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
         if (config->GetMarker_All_KindBC(iMarker) == Donor) {
           for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-            iPoint = vertex[iMarker][iVertex]->GetNode();
+            iPoint = vertexData[iMarker].GetNode(iVertex);
             if (nodes->GetDomain(iPoint)) nLocalVertex_ActDisk ++;
           }
         }
@@ -7568,7 +8038,7 @@ void CPhysicalGeometry::MatchActuator_Disk(CConfig *config) {
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
         if (config->GetMarker_All_KindBC(iMarker) == Donor) {
           for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-            iPoint = vertex[iMarker][iVertex]->GetNode();
+            iPoint = vertexData[iMarker].GetNode(iVertex);
             iPointGlobal = nodes->GetGlobalIndex(iPoint);
             if (nodes->GetDomain(iPoint)) {
               Buffer_Send_Point[nLocalVertex_ActDisk] = iPoint;
@@ -7597,7 +8067,7 @@ void CPhysicalGeometry::MatchActuator_Disk(CConfig *config) {
         if (config->GetMarker_All_KindBC(iMarker) == Beneficiary) {
 
           for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-            iPoint = vertex[iMarker][iVertex]->GetNode();
+            iPoint = vertexData[iMarker].GetNode(iVertex);
             iPointGlobal = nodes->GetGlobalIndex(iPoint);
 
 
@@ -7743,7 +8213,7 @@ void CPhysicalGeometry::MatchPeriodic(CConfig        *config,
       if ((iPeriodic == val_periodic) ||
           (iPeriodic == val_periodic + nPeriodic/2)) {
         for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           if (nodes->GetDomain(iPoint)) nLocalVertex_Periodic++;
         }
       }
@@ -7807,7 +8277,7 @@ void CPhysicalGeometry::MatchPeriodic(CConfig        *config,
       if ((iPeriodic == val_periodic) ||
           (iPeriodic == val_periodic + nPeriodic/2)) {
         for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
-          iPoint = vertex[iMarker][iVertex]->GetNode();
+          iPoint = vertexData[iMarker].GetNode(iVertex);
           iPointGlobal = nodes->GetGlobalIndex(iPoint);
           if (nodes->GetDomain(iPoint)) {
             Buffer_Send_Point[nLocalVertex_Periodic] = iPoint;
@@ -7893,7 +8363,7 @@ void CPhysicalGeometry::MatchPeriodic(CConfig        *config,
 
           /*--- Local and global index for the owned periodic point. ---*/
 
-          iPoint       = vertex[iMarker][iVertex]->GetNode();
+          iPoint       = vertexData[iMarker].GetNode(iVertex);
           iPointGlobal = nodes->GetGlobalIndex(iPoint);
 
           /*--- If this is not a ghost, find the periodic match. ---*/
@@ -8081,89 +8551,115 @@ void CPhysicalGeometry::MatchPeriodic(CConfig        *config,
 
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
 
-  unsigned long face_iPoint = 0, face_jPoint = 0, iPoint, iElem;
-  unsigned short nEdgesFace = 1, iFace, iEdgesFace, iDim;
-  su2double Coord_Edge_CG[3] = {0.0}, Coord_FaceElem_CG[3] = {0.0}, Coord_Elem_CG[3] = {0.0};
+  /*--- Elements of the same color do not share points (nor edges), therefore the
+   colors are processed one after the other and the elements of each color in parallel.
+   Without threads the natural coloring preserves the order of the serial algorithm. ---*/
+
+  const auto& coloring = GetElementColoring();
 
+  /*--- The chunks must be multiples of the group size (the elements of a group may share points). ---*/
+  const auto chunkSize = nextMultiple(32, GetElementColorGroupSize());
+
+  su2double my_DomainVolume = 0.0;
+
+  SU2_OMP_PARALLEL
+  {
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
+    SU2_OMP_MASTER
     edges->SetZeroValues();
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
+
+    SU2_OMP_FOR_STAT(roundUpDiv(nPoint,omp_get_num_threads()))
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
       nodes->SetVolume(iPoint, 0.0);
   }
 
-  su2double my_DomainVolume = 0.0;
-  for (iElem = 0; iElem < nElem; iElem++) {
-    for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+  su2double Coord_Edge_CG[3] = {0.0}, Coord_FaceElem_CG[3] = {0.0}, Coord_Elem_CG[3] = {0.0};
+  su2double my_Volume = 0.0;
 
-      /*--- In 2D all the faces have only one edge ---*/
-      if (nDim == 2) nEdgesFace = 1;
-      /*--- In 3D the number of edges per face is the same as the number of point per face ---*/
-      if (nDim == 3) nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); iColor++) {
 
-      /*-- Loop over the edges of a face ---*/
-      for (iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+    const auto nElemColor = coloring.getNumNonZeros(iColor);
+    const auto elemColor = coloring.innerIdx(iColor);
 
-        /*--- In 2D only one edge (two points) per edge ---*/
-        if (nDim == 2) {
-          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
-          face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,1));
-        }
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (auto k = 0ul; k < nElemColor; k++) {
+      const auto iElem = elemColor[k];
 
-        /*--- In 3D there are several edges in each face ---*/
-        if (nDim == 3) {
-          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace));
-          if (iEdgesFace != nEdgesFace-1)
-            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace+1));
-          else
-            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
-        }
+      for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
 
-        /*--- We define a direction (from the smalest index to the greatest) --*/
-        const bool change_face_orientation = (face_iPoint > face_jPoint);
-        const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+        /*--- In 2D all the faces have only one edge, in 3D the number
+         of edges per face is the same as the number of point per face ---*/
+        const unsigned short nEdgesFace = (nDim == 2)? 1 : elem[iElem]->GetnNodesFace(iFace);
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Coord_Edge_CG[iDim] = edges->GetCG(iEdge,iDim);
-          Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
-          Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
-        }
+        /*-- Loop over the edges of a face ---*/
+        for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
 
-        const su2double* Coord_FaceiPoint = nodes->GetCoord(face_iPoint);
-        const su2double* Coord_FacejPoint = nodes->GetCoord(face_jPoint);
+          unsigned long face_iPoint, face_jPoint;
 
-        su2double Volume_i, Volume_j;
+          /*--- In 2D only one edge (two points) per edge ---*/
+          if (nDim == 2) {
+            face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,1));
+          }
 
-        if (nDim == 2) {
-          /*--- Two dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+          /*--- In 3D there are several edges in each face ---*/
+          else {
+            face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace));
+            if (iEdgesFace != nEdgesFace-1)
+              face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace+1));
+            else
+              face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+          }
 
-          Volume_i = CEdge::GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_Elem_CG);
-          Volume_j = CEdge::GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_Elem_CG);
-        }
-        else {
-          /*--- Three dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          /*--- We define a direction (from the smalest index to the greatest) --*/
+          const bool change_face_orientation = (face_iPoint > face_jPoint);
+          const auto iEdge = FindEdge(face_iPoint, face_jPoint);
 
-          Volume_i = CEdge::GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-          Volume_j = CEdge::GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-        }
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            Coord_Edge_CG[iDim] = edges->GetCG(iEdge,iDim);
+            Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
+            Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
+          }
 
-        nodes->AddVolume(face_iPoint, Volume_i);
-        nodes->AddVolume(face_jPoint, Volume_j);
+          const su2double* Coord_FaceiPoint = nodes->GetCoord(face_iPoint);
+          const su2double* Coord_FacejPoint = nodes->GetCoord(face_jPoint);
 
-        my_DomainVolume += Volume_i+Volume_j;
+          su2double Volume_i, Volume_j;
+
+          if (nDim == 2) {
+            /*--- Two dimensional problem ---*/
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+
+            Volume_i = CEdge::GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_Elem_CG);
+            Volume_j = CEdge::GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_Elem_CG);
+          }
+          else {
+            /*--- Three dimensional problem ---*/
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+
+            Volume_i = CEdge::GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+            Volume_j = CEdge::GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          }
+
+          nodes->AddVolume(face_iPoint, Volume_i);
+          nodes->AddVolume(face_jPoint, Volume_j);
+
+          my_Volume += Volume_i+Volume_j;
+        }
       }
     }
   }
+  atomicAdd(my_Volume, my_DomainVolume);
 
   /*--- Check if there is a normal with null area ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(nEdge,omp_get_num_threads()))
   for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
     const auto Area2 = GeometryToolbox::SquaredNorm(nDim, edges->GetNormal(iEdge));
     if (Area2 == 0.0) {
@@ -8171,6 +8667,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
       edges->SetNormal(iEdge, DefaultArea);
     }
   }
+  } // end SU2_OMP_PARALLEL
+
+  SetEdgeGeometry();
 
   su2double DomainVolume;
   SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
@@ -8483,7 +8982,7 @@ void CPhysicalGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2doubl
     /*--- Copy boundary values ---*/
     for (iMarker = 0; iMarker < nMarker; iMarker++)
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint = vertex[iMarker][iVertex]->GetNode();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
         Coord_Old = nodes->GetCoord_Old(iPoint);
         nodes->SetCoord(iPoint, Coord_Old);
       }
@@ -8971,8 +9470,8 @@ void CPhysicalGeometry::ComputeMeshQualityStatistics(CConfig *config) {
         (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE)){
 
       for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        const unsigned long iPoint = vertex[iMarker][iVertex]->GetNode();
-        const su2double *Normal    = vertex[iMarker][iVertex]->GetNormal();
+        const unsigned long iPoint = vertexData[iMarker].GetNode(iVertex);
+        const su2double *Normal    = vertexData[iMarker].GetNormal(iVertex);
 
         if (nodes->GetDomain(iPoint)) {
 
@@ -9176,8 +9675,8 @@ void CPhysicalGeometry::FindNormal_Neighbor(CConfig *config) {
 
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
 
-        iPoint = vertex[iMarker][iVertex]->GetNode();
-        Normal = vertex[iMarker][iVertex]->GetNormal();
+        iPoint = vertexData[iMarker].GetNode(iVertex);
+        Normal = vertexData[iMarker].GetNormal(iVertex);
 
         /*--- Compute closest normal neighbor, note that the normal are oriented inwards ---*/
         Point_Normal = 0; cos_max = -1.0;
@@ -9200,7 +9699,7 @@ void CPhysicalGeometry::FindNormal_Neighbor(CConfig *config) {
             cos_max = cos_alpha;
           }
         }
-        vertex[iMarker][iVertex]->SetNormal_Neighbor(Point_Normal);
+        vertexData[iMarker].SetNormal_Neighbor(iVertex, Point_Normal);
       }
     }
   }
@@ -9226,9 +9725,9 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
 
         /*--- The sensitivity file uses the global numbering ---*/
-        iPoint = nodes->GetGlobalIndex(vertex[iMarker][iVertex]->GetNode());
+        iPoint = nodes->GetGlobalIndex(vertexData[iMarker].GetNode(iVertex));
 
-        if (vertex[iMarker][iVertex]->GetNode() < GetnPointDomain()) {
+        if (vertexData[iMarker].GetNode(iVertex) < GetnPointDomain()) {
           Point2Vertex[iPoint][0] = iMarker;
           Point2Vertex[iPoint][1] = iVertex;
           PointInDomain[iPoint] = true;
@@ -11564,10 +12063,12 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*---         surface elements. A nearest point search does not give     ---*/
   /*---         accurate results, especially not for the integration       ---*/
   /*---         points of the elements close to a wall boundary.           ---*/
+  /*---         The ADT only contains the local surface elements, the      ---*/
+  /*---         queries are routed to the other ranks in SetWallDistance.  ---*/
   /*--------------------------------------------------------------------------*/
 
   std::unique_ptr<CADTElemClass> WallADT(new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                                                           markerIDs, elemIDs, true));
+                                                           markerIDs, elemIDs, false));
 
   return WallADT;
 
@@ -11576,24 +12077,178 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
 void CPhysicalGeometry::SetWallDistance(const CConfig *config, CADTElemClass *WallADT) {
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 3: Loop over all interior mesh nodes and compute minimum      ---*/
-  /*---        distance to a solid wall element                           ---*/
+  /*--- Step 3: Loop over all mesh nodes and compute the minimum distance  ---*/
+  /*---         to a solid wall element. The ADT of each rank only holds   ---*/
+  /*---         its own walls, hence the distance is computed in two       ---*/
+  /*---         rounds. First by the rank whose walls are expected to be   ---*/
+  /*---         the closest to the node, which gives an upper bound, then  ---*/
+  /*---         by the ranks whose wall bounding box is closer than that   ---*/
+  /*---         bound. Only the node coordinates are exchanged. The rank   ---*/
+  /*---         and the element found for each node are kept, when the     ---*/
+  /*---         distance is updated (dynamic grids) the first round starts ---*/
+  /*---         from the distance to that element, which makes the search  ---*/
+  /*---         of the ADT and the second round much cheaper.              ---*/
   /*--------------------------------------------------------------------------*/
 
-  SU2_OMP_PARALLEL
-  if (!WallADT->IsEmpty()) {
-    /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+  /*--- Gather the bounding boxes of the walls of all ranks, empty boxes have min > max. ---*/
+
+  vector<su2double> wallBBox(2*nDim), allWallBBox(2*nDim*size);
+  WallADT->GetBoundingBox(wallBBox.data(), wallBBox.data()+nDim);
+
+  SU2_MPI::Allgather(wallBBox.data(), 2*nDim, MPI_DOUBLE, allWallBBox.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
 
-    SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      unsigned short markerID;
-      unsigned long  elemID;
-      int            rankID;
-      su2double      dist;
-      WallADT->DetermineNearestElement(nodes->GetCoord(iPoint), dist, markerID, elemID, rankID);
-      nodes->SetWall_Distance(iPoint, min(dist,nodes->GetWall_Distance(iPoint)));
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank)
+    if (allWallBBox[2*nDim*iRank] <= allWallBBox[2*nDim*iRank+nDim]) wallRanks.push_back(iRank);
+
+  const bool localWalls = !WallADT->IsEmpty();
+
+  /*--- Squared distance between a node and the wall bounding box of a rank,
+   *    a lower bound of the squared distance to the walls of that rank. ---*/
+
+  auto BBoxDistance2 = [&](unsigned long iPoint, int iRank) {
+    const su2double* bbMin = &allWallBBox[2*nDim*iRank];
+    const su2double* bbMax = bbMin+nDim;
+    passivedouble dist2 = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const passivedouble coor = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+      const passivedouble delta = max(0.0, max(SU2_TYPE::GetValue(bbMin[iDim])-coor, coor-SU2_TYPE::GetValue(bbMax[iDim])));
+      dist2 += delta*delta;
     }
+    return dist2;
+  };
+
+  /*--- The element indices are only meaningful if the ADT of each rank holds the same elements
+   *    as in the previous call, which is the case for the (single) geometry of each zone. ---*/
+
+  const unsigned long NO_ELEM = numeric_limits<unsigned long>::max();
+  const bool useCache = (config->GetnZone() == 1) && (nearestWallRank.size() == nPoint);
+
+  if (!useCache) {
+    nearestWallRank.assign(nPoint, -1);
+    nearestWallElem.assign(nPoint, NO_ELEM);
   }
-  // end SU2_OMP_PARALLEL
+
+  /*--- Send the coordinates of the nodes in pointsPerRank to the corresponding ranks, together with a
+   *    maximum distance and a guess of the nearest element. The nodes for which those ranks find a wall
+   *    element closer than the current distance are updated. ---*/
+
+  vector<su2double> wallDist(nPoint, numeric_limits<su2double>::max());
+
+  auto RemoteDistances = [&](const vector<vector<unsigned long> >& pointsPerRank, bool useGuess) {
+
+    vector<int> sendCounts(size), recvCounts(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+    for (int iRank = 0; iRank < size; ++iRank)
+      sendCounts[iRank] = pointsPerRank[iRank].size();
+
+    SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendDispl[iRank+1] = sendDispl[iRank] + sendCounts[iRank];
+      recvDispl[iRank+1] = recvDispl[iRank] + recvCounts[iRank];
+    }
+    const unsigned long nSend = sendDispl[size], nRecv = recvDispl[size];
+
+    /*--- Coordinates and maximum distance of each node, and the guessed element. ---*/
+
+    const unsigned short nVar = nDim+1;
+    vector<su2double> sendBuf(nVar*nSend), recvBuf(nVar*nRecv);
+    vector<unsigned long> sendElem(nSend), recvElem(nRecv);
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (unsigned long i = 0; i < pointsPerRank[iRank].size(); ++i) {
+        const unsigned long iPoint = pointsPerRank[iRank][i], iSend = sendDispl[iRank]+i;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          sendBuf[nVar*iSend+iDim] = nodes->GetCoord(iPoint, iDim);
+        sendBuf[nVar*iSend+nDim] = wallDist[iPoint];
+        sendElem[iSend] = useGuess? nearestWallElem[iPoint] : NO_ELEM;
+      }
+    }
+
+    vector<int> sendCountsVar(size), recvCountsVar(size), sendDisplVar(size), recvDisplVar(size);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendCountsVar[iRank] = nVar*sendCounts[iRank];  sendDisplVar[iRank] = nVar*sendDispl[iRank];
+      recvCountsVar[iRank] = nVar*recvCounts[iRank];  recvDisplVar[iRank] = nVar*recvDispl[iRank];
+    }
+
+    SU2_MPI::Alltoallv(sendBuf.data(), sendCountsVar.data(), sendDisplVar.data(), MPI_DOUBLE,
+                       recvBuf.data(), recvCountsVar.data(), recvDisplVar.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Alltoallv(sendElem.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                       recvElem.data(), recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    /*--- Nearest local wall element of the received nodes, if it is closer than the maximum distance. ---*/
+
+    vector<su2double> recvDist(nRecv), sendDist(nSend);
+
+    SU2_OMP_PARALLEL_(for schedule(dynamic,roundUpDiv(nRecv,2*omp_get_max_threads())+1))
+    for (unsigned long i = 0; i < nRecv; ++i) {
+      if (!WallADT->DetermineNearestElementBounded(&recvBuf[nVar*i], recvBuf[nVar*i+nDim], recvElem[i], recvDist[i])) {
+        recvDist[i] = numeric_limits<su2double>::max();
+        recvElem[i] = NO_ELEM;
+      }
+    }
+
+    /*--- Return the distances and elements, the counts are swapped. ---*/
+
+    SU2_MPI::Alltoallv(recvDist.data(), recvCounts.data(), recvDispl.data(), MPI_DOUBLE,
+                       sendDist.data(), sendCounts.data(), sendDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Alltoallv(recvElem.data(), recvCounts.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                       sendElem.data(), sendCounts.data(), sendDispl.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (unsigned long i = 0; i < pointsPerRank[iRank].size(); ++i) {
+        const unsigned long iPoint = pointsPerRank[iRank][i], iSend = sendDispl[iRank]+i;
+        if (sendElem[iSend] != NO_ELEM && sendDist[iSend] < wallDist[iPoint]) {
+          wallDist[iPoint] = sendDist[iSend];
+          nearestWallRank[iPoint] = iRank;
+          nearestWallElem[iPoint] = sendElem[iSend];
+        }
+      }
+    }
+  };
+
+  /*--- First round, distance to the walls of the rank of the previous nearest element or, if
+   *    there is none, to the local walls or the walls of the closest rank. ---*/
+
+  vector<int> firstRank(nPoint, -1);
+  vector<vector<unsigned long> > pointsPerRank(size);
+
+  if (!wallRanks.empty()) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      if (nearestWallRank[iPoint] >= 0) {
+        firstRank[iPoint] = nearestWallRank[iPoint];
+      }
+      else if (localWalls) {
+        firstRank[iPoint] = rank;
+      }
+      else {
+        passivedouble minDist2 = numeric_limits<passivedouble>::max();
+        for (const auto iRank : wallRanks) {
+          const passivedouble dist2 = BBoxDistance2(iPoint, iRank);
+          if (dist2 < minDist2) { minDist2 = dist2; firstRank[iPoint] = iRank; }
+        }
+      }
+      pointsPerRank[firstRank[iPoint]].push_back(iPoint);
+    }
+  }
+
+  RemoteDistances(pointsPerRank, true);
+
+  /*--- Second round, the other ranks with walls that may be closer than the first estimate. ---*/
+
+  for (auto& points : pointsPerRank) points.clear();
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const passivedouble bound = SU2_TYPE::GetValue(wallDist[iPoint]);
+    for (const auto iRank : wallRanks) {
+      if (iRank == firstRank[iPoint]) continue;
+      if (BBoxDistance2(iPoint, iRank) <= bound*bound) pointsPerRank[iRank].push_back(iPoint);
+    }
+  }
+
+  RemoteDistances(pointsPerRank, false);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    nodes->SetWall_Distance(iPoint, min(wallDist[iPoint], nodes->GetWall_Distance(iPoint)));
+
 }
@@ -32,9 +32,26 @@ using namespace GeometryToolbox;
 
 
 CEdge::CEdge(unsigned long nEdge, unsigned long nDim) :
-  Nodes(nEdge,2), Normal(nEdge,nDim), Coord_CG(nEdge,nDim) {
+  Nodes(nEdge,2), Normal(nEdge,nDim), Coord_CG(nEdge,nDim), EdgeVector(nEdge,nDim), Dist2(nEdge), Area(nEdge) {
   Normal = su2double(0.0);
   Coord_CG = su2double(0.0);
+  EdgeVector = su2double(0.0);
+  Dist2 = su2double(0.0);
+  Area = su2double(0.0);
+}
+
+void CEdge::SetEdgeGeometry(unsigned long iEdge, const su2double* coord_i, const su2double* coord_j) {
+
+  /*--- Same operations as the edge loops of the numerics, for consistent results. ---*/
+
+  su2double dist2 = 0.0, area = 0.0;
+  for (auto iDim = 0ul; iDim < Normal.cols(); ++iDim) {
+    EdgeVector(iEdge,iDim) = coord_j[iDim] - coord_i[iDim];
+    dist2 += EdgeVector(iEdge,iDim)*EdgeVector(iEdge,iDim);
+    area += Normal(iEdge,iDim)*Normal(iEdge,iDim);
+  }
+  Dist2(iEdge) = dist2;
+  Area(iEdge) = sqrt(area);
 }
 
 void CEdge::SetZeroValues(void) {
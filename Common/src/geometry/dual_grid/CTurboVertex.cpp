@@ -27,7 +27,7 @@
 
 #include "../../../include/geometry/dual_grid/CTurboVertex.hpp"
 
-CTurboVertex::CTurboVertex(unsigned long val_point, unsigned short val_nDim) : CVertex(val_point, val_nDim){
+CTurboVertex::CTurboVertex(unsigned long val_point, unsigned short val_nDim) : CVertex(val_nDim), Node(val_point) {
   unsigned short iDim;
  /*--- Pointers initialization ---*/
   TurboNormal = nullptr;
@@ -36,6 +36,7 @@ CTurboVertex::CTurboVertex(unsigned long val_point, unsigned short val_nDim) : C
 
   /*--- Initializate the structure ---*/
   for (iDim = 0; iDim < nDim; iDim ++) TurboNormal[iDim] = 0.0;
+  for (iDim = 0; iDim < 3; iDim ++) Normal[iDim] = 0.0;
 
 }
 
@@ -27,7 +27,7 @@
 
 #include "../../../include/geometry/dual_grid/CVertex.hpp"
 
-CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) : CDualGrid(val_nDim) {
+CVertex::CVertex(unsigned short val_nDim) : CDualGrid(val_nDim) {
 
   unsigned short iDim;
 
@@ -40,12 +40,6 @@ CVertex::CVertex(unsigned long val_point, unsigned short val_nDim) : CDualGrid(v
 
   ActDisk_Perimeter = false;
 
-  /*--- Initializate the structure ---*/
-
-  Nodes[0] = val_point;
-
-  for (iDim = 0; iDim < 3; iDim ++) Normal[iDim] = 0.0;
-
   /*--- Set to zero the variation of the coordinates ---*/
 
   for (iDim = 0; iDim < 3; iDim ++) VarCoord[iDim] = 0.0;
@@ -72,48 +66,6 @@ CVertex::~CVertex() {
 
 }
 
-void CVertex::SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_FaceElem_CG, su2double *val_coord_Elem_CG) {
-
-  su2double vec_a[3] = {0.0,0.0,0.0}, vec_b[3] = {0.0,0.0,0.0};
-  unsigned short iDim;
-
-  assert(nDim == 3);
-
-  AD::StartPreacc();
-  AD::SetPreaccIn(val_coord_Edge_CG, nDim);
-  AD::SetPreaccIn(val_coord_Elem_CG, nDim);
-  AD::SetPreaccIn(val_coord_FaceElem_CG, nDim);
-  AD::SetPreaccIn(Normal, nDim);
-
-  for (iDim = 0; iDim < nDim; iDim++) {
-    vec_a[iDim] = val_coord_Elem_CG[iDim]-val_coord_Edge_CG[iDim];
-    vec_b[iDim] = val_coord_FaceElem_CG[iDim]-val_coord_Edge_CG[iDim];
-  }
-
-  Normal[0] += 0.5 * ( vec_a[1] * vec_b[2] - vec_a[2] * vec_b[1]);
-  Normal[1] -= 0.5 * ( vec_a[0] * vec_b[2] - vec_a[2] * vec_b[0]);
-  Normal[2] += 0.5 * ( vec_a[0] * vec_b[1] - vec_a[1] * vec_b[0]);
-
-  AD::SetPreaccOut(Normal, nDim);
-  AD::EndPreacc();
-
-}
-
-void CVertex::SetNodes_Coord(su2double *val_coord_Edge_CG, su2double *val_coord_Elem_CG) {
-
-  AD::StartPreacc();
-  AD::SetPreaccIn(val_coord_Elem_CG, nDim);
-  AD::SetPreaccIn(val_coord_Edge_CG, nDim);
-  AD::SetPreaccIn(Normal, nDim);
-
-  Normal[0] += val_coord_Elem_CG[1]-val_coord_Edge_CG[1];
-  Normal[1] -= (val_coord_Elem_CG[0]-val_coord_Edge_CG[0]);
-
-  AD::SetPreaccOut(Normal, nDim);
-  AD::EndPreacc();
-
-}
-
 void CVertex::Allocate_DonorInfo(unsigned short nDonor) {
 
   nDonor_Points = nDonor;
@@ -0,0 +1,85 @@
+/*!
+ * \file CVertexData.cpp
+ * \brief Implementation of the boundary vertex data of a marker.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/geometry/dual_grid/CVertexData.hpp"
+
+
+CVertexData::CVertexData(unsigned long nVertex, unsigned long nDim) :
+  Node(nVertex), Normal_Neighbor(nVertex), Normal(nVertex,nDim) {
+  Node = 0ul;
+  Normal_Neighbor = 0ul;
+  Normal = su2double(0.0);
+}
+
+void CVertexData::SetZeroValues(void) {
+  Normal = su2double(0.0);
+}
+
+void CVertexData::SetNodes_Coord(unsigned long iVertex,
+                                 const su2double *coord_Edge_CG,
+                                 const su2double *coord_FaceElem_CG,
+                                 const su2double *coord_Elem_CG) {
+
+  constexpr unsigned long nDim = 3;
+
+  su2double vec_a[nDim] = {0.0}, vec_b[nDim] = {0.0};
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(coord_Edge_CG, nDim);
+  AD::SetPreaccIn(coord_Elem_CG, nDim);
+  AD::SetPreaccIn(coord_FaceElem_CG, nDim);
+  AD::SetPreaccIn(Normal[iVertex], nDim);
+
+  for (auto iDim = 0ul; iDim < nDim; iDim++) {
+    vec_a[iDim] = coord_Elem_CG[iDim]-coord_Edge_CG[iDim];
+    vec_b[iDim] = coord_FaceElem_CG[iDim]-coord_Edge_CG[iDim];
+  }
+
+  Normal(iVertex,0) += 0.5 * ( vec_a[1] * vec_b[2] - vec_a[2] * vec_b[1]);
+  Normal(iVertex,1) -= 0.5 * ( vec_a[0] * vec_b[2] - vec_a[2] * vec_b[0]);
+  Normal(iVertex,2) += 0.5 * ( vec_a[0] * vec_b[1] - vec_a[1] * vec_b[0]);
+
+  AD::SetPreaccOut(Normal[iVertex], nDim);
+  AD::EndPreacc();
+}
+
+void CVertexData::SetNodes_Coord(unsigned long iVertex,
+                                 const su2double *coord_Edge_CG,
+                                 const su2double *coord_Elem_CG) {
+
+  constexpr unsigned long nDim = 2;
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(coord_Elem_CG, nDim);
+  AD::SetPreaccIn(coord_Edge_CG, nDim);
+  AD::SetPreaccIn(Normal[iVertex], nDim);
+
+  Normal(iVertex,0) += coord_Elem_CG[1]-coord_Edge_CG[1];
+  Normal(iVertex,1) -= (coord_Elem_CG[0]-coord_Edge_CG[0]);
+
+  AD::SetPreaccOut(Normal[iVertex], nDim);
+  AD::EndPreacc();
+}
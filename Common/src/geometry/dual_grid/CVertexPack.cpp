@@ -0,0 +1,97 @@
+/*!
+ * \file CVertexPack.cpp
+ * \brief Implementation of the packed boundary vertices of a kind of boundary condition.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/geometry/dual_grid/CVertexPack.hpp"
+#include "../../../include/geometry/CGeometry.hpp"
+
+
+CVertexPack::CVertexPack(const CGeometry& geometry, std::vector<unsigned short> markers) :
+  Markers(std::move(markers)) {
+
+  /*--- The group of a vertex is the number of times its point was found in previous vertices. ---*/
+
+  std::vector<unsigned short> count(geometry.GetnPoint(), 0);
+  std::vector<unsigned short> group;
+  std::vector<unsigned long> groupSize;
+
+  for (auto iMarker : Markers) {
+    for (auto iVertex = 0ul; iVertex < geometry.nVertex[iMarker]; ++iVertex) {
+      const auto iPoint = geometry.vertexData[iMarker].GetNode(iVertex);
+      if (!geometry.nodes->GetDomain(iPoint)) continue;
+
+      const auto iGroup = count[iPoint]++;
+      if (iGroup == groupSize.size()) groupSize.push_back(0);
+      ++groupSize[iGroup];
+      group.push_back(iGroup);
+    }
+  }
+
+  GroupPtr.resize(groupSize.size()+1, 0);
+  for (auto iGroup = 0ul; iGroup < groupSize.size(); ++iGroup)
+    GroupPtr[iGroup+1] = GroupPtr[iGroup] + groupSize[iGroup];
+
+  /*--- Place the vertices in their group, keeping the marker and vertex order. ---*/
+
+  const auto nPack = group.size();
+  Marker.resize(nPack);
+  Vertex.resize(nPack);
+  Node.resize(nPack);
+  Normal_Neighbor.resize(nPack);
+  Normal.resize(nPack, geometry.GetnDim());
+  Coord.resize(nPack, geometry.GetnDim());
+
+  auto next = GroupPtr;
+  auto iVisit = 0ul;
+
+  for (auto iMarker : Markers) {
+    for (auto iVertex = 0ul; iVertex < geometry.nVertex[iMarker]; ++iVertex) {
+      const auto iPoint = geometry.vertexData[iMarker].GetNode(iVertex);
+      if (!geometry.nodes->GetDomain(iPoint)) continue;
+
+      const auto iPack = next[group[iVisit++]]++;
+      Marker(iPack) = iMarker;
+      Vertex(iPack) = iVertex;
+      Node(iPack) = iPoint;
+    }
+  }
+
+  SetGeometry(geometry);
+}
+
+void CVertexPack::SetGeometry(const CGeometry& geometry) {
+
+  for (auto iPack = 0ul; iPack < GetnVertex(); ++iPack) {
+    const auto& data = geometry.vertexData[Marker(iPack)];
+    const auto normal = data.GetNormal(Vertex(iPack));
+    const auto coord = geometry.nodes->GetCoord(Node(iPack));
+
+    for (auto iDim = 0ul; iDim < Normal.cols(); ++iDim) {
+      Normal(iPack,iDim) = normal[iDim];
+      Coord(iPack,iDim) = coord[iDim];
+    }
+    Normal_Neighbor(iPack) = data.GetNormal_Neighbor(Vertex(iPack));
+  }
+}
@@ -40,6 +40,7 @@ CPrimalGrid::CPrimalGrid(void) {
   Coord_FaceElems_CG = nullptr;
   JacobianFaceIsConstant = nullptr;
   GlobalIndex = 0;
+  Divide = false;
 
 }
 
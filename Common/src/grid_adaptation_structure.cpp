@@ -36,6 +36,7 @@
 #include "../include/geometry/primal_grid/CPrism.hpp"
 #include "../include/geometry/primal_grid/CVertexMPI.hpp"
 #include <math.h>
+#include <algorithm>
 
 CGridAdaptation::CGridAdaptation(CGeometry *geometry, CConfig *config) {
 
@@ -136,11 +137,16 @@ void CGridAdaptation::GetFlowSolution(CGeometry *geometry, CConfig *config) {
   /*--- Read the header of the file ---*/
   getline(restart_file, text_line);
 
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    getline(restart_file, text_line);
+  /*--- The points are identified by their global index (ASCII or CSV restart files),
+   the points that are not in this partition are skipped. ---*/
+  while (getline(restart_file, text_line)) {
+    replace(text_line.begin(), text_line.end(), ',', ' ');
     istringstream point_line(text_line);
 
-    point_line >> index;
+    if (!(point_line >> index)) continue;
+    const long iLocal = geometry->GetGlobal_to_Local_Point(index);
+    if (iLocal < 0) continue;
+    iPoint = iLocal;
 
     if (nDim == 2) point_line >> dummy >> dummy;
     else point_line >> dummy >> dummy >> dummy;
@@ -173,11 +179,16 @@ void CGridAdaptation::GetFlowResidual(CGeometry *geometry, CConfig *config) {
   /*--- Read the header of the file ---*/
   getline(restart_file, text_line);
 
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    getline(restart_file, text_line);
+  /*--- The points are identified by their global index (ASCII or CSV restart files),
+   the points that are not in this partition are skipped. ---*/
+  while (getline(restart_file, text_line)) {
+    replace(text_line.begin(), text_line.end(), ',', ' ');
     istringstream point_line(text_line);
 
-    point_line >> index;
+    if (!(point_line >> index)) continue;
+    const long iLocal = geometry->GetGlobal_to_Local_Point(index);
+    if (iLocal < 0) continue;
+    iPoint = iLocal;
 
     if (nDim == 2) point_line >> dummy >> dummy;
     else point_line >> dummy >> dummy >> dummy;
@@ -212,11 +223,16 @@ void CGridAdaptation::GetAdjSolution(CGeometry *geometry, CConfig *config) {
   /*--- Read the header of the file ---*/
   getline(restart_file, text_line);
 
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    getline(restart_file, text_line);
+  /*--- The points are identified by their global index (ASCII or CSV restart files),
+   the points that are not in this partition are skipped. ---*/
+  while (getline(restart_file, text_line)) {
+    replace(text_line.begin(), text_line.end(), ',', ' ');
     istringstream point_line(text_line);
 
-    point_line >> index;
+    if (!(point_line >> index)) continue;
+    const long iLocal = geometry->GetGlobal_to_Local_Point(index);
+    if (iLocal < 0) continue;
+    iPoint = iLocal;
 
     if (nDim == 2) point_line >> dummy >> dummy;
     else point_line >> dummy >> dummy >> dummy;
@@ -2193,7 +2209,7 @@ void CGridAdaptation::SetHomothetic_Adaptation2D(CGeometry *geometry, CPhysicalG
 //                                    the NACA 4-digit denomination) ---*/
 //
 //          su2double *Coord = geo_adapt->nodes->GetCoord(ip_01);
-//          su2double *Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+//          su2double *Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 //
 //          su2double Ycurv = 0.0;
 //          if (Coord[0] < Xa) Ycurv = (2.0*Xa*Coord[0]-pow(Coord[0],2.0))*(Ya/pow(Xa,2.0));
@@ -3219,9 +3235,9 @@ void CGridAdaptation::SetIndicator_Flow(CGeometry *geometry, CConfig *config, un
     if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        Point = geometry->vertex[iMarker][iVertex]->GetNode();
+        Point = geometry->vertexData[iMarker].GetNode(iVertex);
         Solution_Vertex = ConsVar_Sol[Point][0];
-        const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        const auto Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         for (iDim = 0; iDim < nDim; iDim++) {
           Partial_Res = Solution_Vertex*Normal[iDim];
           Gradient[Point][iDim] = Gradient[Point][iDim] - Partial_Res;
@@ -3287,9 +3303,9 @@ void CGridAdaptation::SetIndicator_Adj(CGeometry *geometry, CConfig *config, uns
     if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        Point = geometry->vertex[iMarker][iVertex]->GetNode();
+        Point = geometry->vertexData[iMarker].GetNode(iVertex);
         Solution_Vertex = AdjVar_Sol[Point][0];
-        const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        const auto Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         for (iDim = 0; iDim < nDim; iDim++) {
           Partial_Res = Solution_Vertex*Normal[iDim];
           Gradient[Point][iDim] = Gradient[Point][iDim] - Partial_Res;
@@ -3359,8 +3375,8 @@ void CGridAdaptation::SetIndicator_FlowAdj(CGeometry *geometry, CConfig *config)
     if ((config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
         (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        Point = geometry->vertex[iMarker][iVertex]->GetNode();
-        const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Point = geometry->vertexData[iMarker].GetNode(iVertex);
+        const auto Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         for (iDim = 0; iDim < nDim; iDim++) {
           Gradient_Flow[Point][iDim] = Gradient_Flow[Point][iDim] - ConsVar_Sol[Point][0] * Normal[iDim];
           Gradient_Adj[Point][iDim] = Gradient_Adj[Point][iDim] - AdjVar_Sol[Point][0] * Normal[iDim];
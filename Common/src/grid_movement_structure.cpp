@@ -343,7 +343,7 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL)  ||
          (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
       for (iVertex=0; iVertex<geometry->GetnVertex(iMarker); ++iVertex) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         PointIDs[jj++] = iPoint;
         for (iDim=0; iDim<nDim; ++iDim)
           Coord_bound[ii++] = geometry->nodes->GetCoord(iPoint, iDim);
@@ -1527,7 +1527,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
          (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
          (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         for (iDim = 0; iDim < nDim; iDim++) {
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
@@ -1547,7 +1547,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
         ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_CFD) && (config->GetMarker_All_DV(iMarker) == YES)) ||
         ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DOT))) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
         for (iDim = 0; iDim < nDim; iDim++) {
           total_index = iPoint*nDim + iDim;
@@ -1570,11 +1570,11 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
 
       /*--- Store the coord of the first point to help identify the axis. ---*/
 
-      iPoint  = geometry->vertex[iMarker][0]->GetNode();
+      iPoint  = geometry->vertexData[iMarker].GetNode(0);
       Coord_0 = geometry->nodes->GetCoord(iPoint);
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         VarCoord = geometry->nodes->GetCoord(iPoint);
         for (iDim = 0; iDim < nDim; iDim++)
           MeanCoord[iDim] += (VarCoord[iDim]-Coord_0[iDim])*(VarCoord[iDim]-Coord_0[iDim]);
@@ -1591,7 +1591,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
       }
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         total_index = iPoint*nDim + axis;
         LinSysRes[total_index] = 0.0;
         LinSysSol[total_index] = 0.0;
@@ -1605,7 +1605,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         for (iDim = 0; iDim < nDim; iDim++) {
           total_index = iPoint*nDim + iDim;
           LinSysRes[total_index] = 0.0;
@@ -1621,7 +1621,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_ZoneInterface(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
         for (iDim = 0; iDim < nDim; iDim++) {
           total_index = iPoint*nDim + iDim;
@@ -1645,7 +1645,7 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if ((config->GetMarker_All_DV(iMarker) == YES)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
           for (iDim = 0; iDim < nDim; iDim++) {
             total_index = iPoint*nDim + iDim;
@@ -1695,7 +1695,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConf
          (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE) ||
          (config->GetMarker_All_DV(iMarker) == YES)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           if (geometry->nodes->GetDomain(iPoint)) {
             for (iDim = 0; iDim < nDim; iDim++) {
               total_index = iPoint*nDim + iDim;
@@ -2907,7 +2907,7 @@ void CSurfaceMovement::SetSurface_Deformation(CGeometry *geometry, CConfig *conf
         for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
           if (config->GetMarker_All_DV(iMarker) == YES) {
             for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-              jPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+              jPoint = geometry->vertexData[iMarker].GetNode(iVertex);
               GlobalIndex = geometry->nodes->GetGlobalIndex(jPoint);
               Coords = geometry->nodes->GetCoord(jPoint);
               Surface_File << GlobalIndex << "\t" << Coords[0] << "\t" << Coords[1];
@@ -3078,7 +3078,7 @@ void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
       Coord = geometry->nodes->GetCoord(iPoint);
       geometry->vertex[iMarker][iVertex]->SetCoord(Coord);
     }
@@ -3172,7 +3172,7 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
           CartCoord[2] = acos(Xbar/CartCoord[0]);
         }
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
 
@@ -3808,7 +3808,7 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox, bool ResetDef) {
 
   su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff,
-  *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
+  VarCoord[3] = {0.0, 0.0, 0.0}, CartCoordOld[3] = {0.0, 0.0, 0.0};
   unsigned short iMarker, iDim;
   unsigned long iVertex, iPoint, iSurfacePoints;
 
@@ -3847,14 +3847,10 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
 
       geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
 
-      /*--- Get the parametric coordinate of the surface point ---*/
+      /*--- Compute the new cartesian coordinate from the basis functions cached
+       at the parametric coordinates, and set the value in the FFDBox structure ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
-
-      /*--- Compute the new cartesian coordinate, and set the value in
-       the FFDBox structure ---*/
-
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      CartCoordNew = FFDBox->EvalCartesianCoord(iSurfacePoints);
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
@@ -5088,7 +5084,7 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
       if (config->GetMarker_All_DV(iMarker) == YES) {
 
         Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal_ = boundary->vertex[iMarker][iVertex]->GetNormal();
+        Normal_ = boundary->vertexData[iMarker].GetNormal(iVertex);
 
         /*--- The Hicks Henne bump functions should be applied to a basic airfoil without AoA,
          and unitary chord, a tranformation is required ---*/
@@ -5300,7 +5296,7 @@ void CSurfaceMovement::SetCST(CGeometry *boundary, CConfig *config, unsigned sho
       if (config->GetMarker_All_DV(iMarker) == YES) {
 
         Coord_ = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal_ = boundary->vertex[iMarker][iVertex]->GetNormal();
+        Normal_ = boundary->vertexData[iMarker].GetNormal(iVertex);
 
         /*--- The CST functions should be applied to a basic airfoil without AoA,
          and unitary chord, a tranformation is required ---*/
@@ -5546,7 +5542,7 @@ void CSurfaceMovement::Moving_Walls(CGeometry *geometry, CConfig *config,
 
         /*--- Get the index and coordinates of the current point ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Coord  = geometry->nodes->GetCoord(iPoint);
 
         /*--- Calculate non-dim. position from rotation center ---*/
@@ -5621,7 +5617,7 @@ void CSurfaceMovement::AeroelasticDeform(CGeometry *geometry, CConfig *config, u
   Center[1] = config->GetRefOriginMoment_Y(iMarker_Monitoring);
 
   for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
     /*--- Coordinates of the current point ---*/
     Coord = geometry->nodes->GetCoord(iPoint);
 
@@ -5814,7 +5810,7 @@ void CSurfaceMovement::SetExternal_Deformation(CGeometry *geometry, CConfig *con
       if ((config->GetMarker_All_DV(iMarker) == YES && config->GetKind_SU2() == SU2_DEF) ||
           (config->GetMarker_All_Moving(iMarker) == YES && config->GetKind_SU2() == SU2_CFD)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          jPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          jPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           GlobalIndex = geometry->nodes->GetGlobalIndex(jPoint);
           if (GlobalIndex == iPoint) {
             geometry->vertex[iMarker][iVertex]->SetVarCoord(NewCoord);
@@ -5899,7 +5895,7 @@ void CSurfaceMovement::SetExternal_Deformation(CGeometry *geometry, CConfig *con
       /*--- Loop over all surface points for this marker ---*/
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Get current and new coordinates from file ---*/
 
@@ -5970,7 +5966,7 @@ void CSurfaceMovement::SetNACA_4Digits(CGeometry *boundary, CConfig *config) {
       VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0;
       if (config->GetMarker_All_DV(iMarker) == YES) {
         Coord = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal = boundary->vertex[iMarker][iVertex]->GetNormal();
+        Normal = boundary->vertexData[iMarker].GetNormal(iVertex);
 
         if (Coord[0] < Xa) Ycurv = (2.0*Xa*Coord[0]-pow(Coord[0],2.0))*(Ya/pow(Xa,2.0));
         else Ycurv = ((1.0-2.0*Xa)+2.0*Xa*Coord[0]-pow(Coord[0],2.0))*(Ya/pow((1.0-Xa), 2.0));
@@ -6001,7 +5997,7 @@ void CSurfaceMovement::SetParabolic(CGeometry *boundary, CConfig *config) {
       VarCoord[0] = 0.0; VarCoord[1] = 0.0; VarCoord[2] = 0.0;
       if (config->GetMarker_All_DV(iMarker) == YES) {
         Coord = boundary->vertex[iMarker][iVertex]->GetCoord();
-        Normal = boundary->vertex[iMarker][iVertex]->GetNormal();
+        Normal = boundary->vertexData[iMarker].GetNormal(iVertex);
 
         if (Normal[1] > 0) {
           VarCoord[1] =  t*(Coord[0]*Coord[0]-Coord[0])/(2.0*(c*c-c)) - Coord[1];
@@ -6635,7 +6631,7 @@ void CSurfaceMovement::ReadFFDInfo(CGeometry *geometry, CConfig *config, CFreeFo
             FFDBox_line >> CPcoord[0]; FFDBox_line >> CPcoord[1]; FFDBox_line >> CPcoord[2];
 
             for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-              jPoint =  geometry->vertex[iMarker][iVertex]->GetNode();
+              jPoint =  geometry->vertexData[iMarker].GetNode(iVertex);
               if (iPoint == geometry->nodes->GetGlobalIndex(jPoint)) {
                 for (iDim = 0; iDim < nDim; iDim++) {
                   coord[iDim] = geometry->nodes->GetCoord(jPoint,iDim);
@@ -8004,6 +8000,52 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
   return cart_coord;
 }
 
+void CFreeFormDefBox::SetParametricBasis(void) {
+
+  const unsigned long nSurfacePoint = GetnSurfacePoint();
+  const unsigned short Order[3] = {lOrder, mOrder, nOrder};
+
+  /*--- The basis functions of each direction are stored contiguously for each point,
+   *    the cartesian coordinates are then a tensor contraction with the control points. ---*/
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+    ParametricBasis[iDir].resize(nSurfacePoint*Order[iDir]);
+    for (unsigned long iSurfacePoint = 0; iSurfacePoint < nSurfacePoint; iSurfacePoint++)
+      for (unsigned short iDegree = 0; iDegree < Order[iDir]; iDegree++)
+        ParametricBasis[iDir][iSurfacePoint*Order[iDir]+iDegree] =
+          BlendingFunction[iDir]->GetBasis(iDegree, ParametricCoord[iDir][iSurfacePoint]);
+    ParametricBasisOrder[iDir] = Order[iDir];
+  }
+}
+
+su2double *CFreeFormDefBox::EvalCartesianCoord(unsigned long iSurfacePoint) {
+
+  if ((ParametricBasisOrder[0] != lOrder) || (ParametricBasisOrder[1] != mOrder) ||
+      (ParametricBasisOrder[2] != nOrder) || (ParametricBasis[0].size() != GetnSurfacePoint()*lOrder))
+    SetParametricBasis();
+
+  const su2double *Basis_l = &ParametricBasis[0][iSurfacePoint*lOrder];
+  const su2double *Basis_m = &ParametricBasis[1][iSurfacePoint*mOrder];
+  const su2double *Basis_n = &ParametricBasis[2][iSurfacePoint*nOrder];
+
+  unsigned short iDim, iDegree, jDegree, kDegree;
+
+  for (iDim = 0; iDim < nDim; iDim++)
+    cart_coord[iDim] = 0.0;
+
+  /*--- Same order of operations as the evaluation from the parametric coordinates. ---*/
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    for (jDegree = 0; jDegree <= mDegree; jDegree++)
+      for (kDegree = 0; kDegree <= nDegree; kDegree++)
+        for (iDim = 0; iDim < nDim; iDim++) {
+          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
+          * Basis_l[iDegree] * Basis_m[jDegree] * Basis_n[kDegree];
+        }
+
+  return cart_coord;
+}
+
 
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
 
@@ -8287,7 +8329,7 @@ void CFreeFormDefBox::SetDeformationZone(CGeometry *geometry, CConfig *config, u
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         Coord = geometry->nodes->GetCoord(iPoint);
 
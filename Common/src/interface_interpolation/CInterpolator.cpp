@@ -67,7 +67,7 @@ void CInterpolator::Determine_ArraySize(int markDonor, int markTarget,
   /*--- Count donor vertices. ---*/
   auto nLocalVertex_Donor = 0ul;
   for (auto iVertex = 0ul; iVertex < nVertexDonor; iVertex++) {
-    auto iPointDonor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    auto iPointDonor = donor_geometry->vertexData[markDonor].GetNode(iVertex);
     nLocalVertex_Donor += donor_geometry->nodes->GetDomain(iPointDonor);
   }
 
@@ -93,7 +93,7 @@ void CInterpolator::Collect_VertexInfo(int markDonor, int markTarget,
   auto iLocalVertexDonor = 0ul;
 
   for (iVertex = 0; iVertex < nVertexDonor; iVertex++) {
-    auto iPointDonor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    auto iPointDonor = donor_geometry->vertexData[markDonor].GetNode(iVertex);
     if (donor_geometry->nodes->GetDomain(iPointDonor)) {
       Buffer_Send_GlobalPoint[iLocalVertexDonor] = donor_geometry->nodes->GetGlobalIndex(iPointDonor);
       for (iDim = 0; iDim < nDim; iDim++)
@@ -208,7 +208,7 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
     Buffer_Send_nLinkedNodes[iVertex] = 0;
     Aux_Send_Map[iVertex]             = nullptr;
 
-    iPoint = geom->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geom->vertexData[val_marker].GetNode(iVertex);
 
     if (geom->nodes->GetDomain(iPoint)) {
       Buffer_Send_GlobalPoint[nLocalVertex] = geom->nodes->GetGlobalIndex(iPoint);
@@ -174,7 +174,7 @@ void CIsoparametric::SetTransferCoeff(const CConfig* const* config) {
     for (auto iVertexTarget = 0u; iVertexTarget < nVertexTarget; ++iVertexTarget) {
 
       auto target_vertex = target_geometry->vertex[markTarget][iVertexTarget];
-      const auto iPoint = target_vertex->GetNode();
+      const auto iPoint = target_geometry->vertexData[markTarget].GetNode(iVertexTarget);
 
       if (!target_geometry->nodes->GetDomain(iPoint)) continue;
       totalCount += 1;
@@ -80,7 +80,7 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
 
       auto donor_vertex = donor_geometry->vertex[markDonor][iVertex];
 
-      if (donor_geometry->nodes->GetDomain(donor_vertex->GetNode())) {
+      if (donor_geometry->nodes->GetDomain(donor_geometry->vertexData[markDonor].GetNode(iVertex))) {
         nNodeDonorLocal += donor_vertex->GetnDonorPoints();
         nVertexDonorLocal++;
       }
@@ -102,7 +102,7 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
     for (auto iVertex = 0ul, iDonor = 0ul; iVertex < nVertexDonor; ++iVertex) {
 
       auto donor_vertex = donor_geometry->vertex[markDonor][iVertex];
-      const auto iPoint = donor_vertex->GetNode();
+      const auto iPoint = donor_geometry->vertexData[markDonor].GetNode(iVertex);
 
       if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
 
@@ -189,7 +189,7 @@ void CMirror::SetTransferCoeff(const CConfig* const* config) {
     for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
 
       auto target_vertex = target_geometry->vertex[markTarget][iVertex];
-      const auto iPoint = target_vertex->GetNode();
+      const auto iPoint = target_geometry->vertexData[markTarget].GetNode(iVertex);
 
       if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
@@ -114,7 +114,7 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget++) {
 
       auto target_vertex = target_geometry->vertex[markTarget][iVertexTarget];
-      const auto Point_Target = target_vertex->GetNode();
+      const auto Point_Target = target_geometry->vertexData[markTarget].GetNode(iVertexTarget);
 
       if (!target_geometry->nodes->GetDomain(Point_Target)) continue;
 
@@ -282,7 +282,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
 
       auto targetVertex = target_geometry->vertex[markTarget][iVertexTarget];
-      auto pointTarget = targetVertex->GetNode();
+      auto pointTarget = target_geometry->vertexData[markTarget].GetNode(iVertexTarget);
 
       if (target_geometry->nodes->GetDomain(pointTarget)) {
         targetVertices.push_back(targetVertex);
@@ -189,7 +189,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        target_iPoint = target_geometry->vertexData[markTarget].GetNode(iVertex);
 
         if (target_geometry->nodes->GetDomain(target_iPoint)){
 
@@ -440,13 +440,13 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        target_iPoint = target_geometry->vertexData[markTarget].GetNode(iVertex);
 
         if (!target_geometry->nodes->GetDomain(target_iPoint)) continue;
 
         Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-        target_geometry->vertex[markTarget][iVertex]->GetNormal(Normal);
+        target_geometry->vertexData[markTarget].GetNormal(iVertex, Normal);
 
         /*--- The value of Area computed here includes also portion of boundary belonging to different marker ---*/
         Area = 0.0;
@@ -143,7 +143,7 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry *geometry, CConfig *config
 
       /*--- Prepare data to send ---*/
       for (unsigned long iVertex = 0; iVertex < nVertexS; iVertex++)
-        Buffer_Send[iVertex] = geometry->vertex[MarkerS][iVertex]->GetNode()+offset;
+        Buffer_Send[iVertex] = geometry->vertexData[MarkerS].GetNode(iVertex)+offset;
 
       /*--- Send and Receive data ---*/
       MPI_Sendrecv(Buffer_Send.data(), nVertexS, MPI_UNSIGNED_LONG, sender, 0,
@@ -152,7 +152,7 @@ void CPastixWrapper<ScalarType>::Initialize(CGeometry *geometry, CConfig *config
 
       /*--- Store received data---*/
       for (unsigned long iVertex = 0; iVertex < nVertexR; iVertex++)
-        map[ geometry->vertex[MarkerR][iVertex]->GetNode()-nPointDomain ] = Buffer_Recv[iVertex];
+        map[ geometry->vertexData[MarkerR].GetNode(iVertex)-nPointDomain ] = Buffer_Recv[iVertex];
     }
   }
 #endif
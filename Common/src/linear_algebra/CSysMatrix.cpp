@@ -34,12 +34,24 @@
 
 #include <cmath>
 
+/*--- Call the specialization of a member kernel for the block size selected at Initialize. ---*/
+#define CALL_BLOCK_KERNEL(KERNEL, ...) \
+  switch (fixedBlockSize) { \
+    case 1: KERNEL<1>(__VA_ARGS__); break; \
+    case 2: KERNEL<2>(__VA_ARGS__); break; \
+    case 3: KERNEL<3>(__VA_ARGS__); break; \
+    case 4: KERNEL<4>(__VA_ARGS__); break; \
+    case 5: KERNEL<5>(__VA_ARGS__); break; \
+    default: KERNEL<0>(__VA_ARGS__); break; \
+  }
+
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() :
   rank(SU2_MPI::GetRank()),
   size(SU2_MPI::GetSize()) {
 
   nPoint = nPointDomain = nVar = nEqn = 0;
+  fixedBlockSize = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
@@ -129,6 +141,12 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Square blocks of the common sizes use the kernels specialized for that size,
+   *    except with MKL whose JIT kernels are already specific to the size. ---*/
+#ifndef USE_MKL
+  if ((nVar == nEqn) && (nVar <= 5)) fixedBlockSize = nVar;
+#endif
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -526,6 +544,7 @@ void CSysMatrix<ScalarType>::SetValDiagonalZero() {
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
 
 #ifdef USE_MKL_LAPACK
@@ -534,6 +553,7 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
 #else
+  const auto nVar = BS? BS : this->nVar;
 #define A(I,J) matrix[(I)*nVar+(J)]
 
   /*--- Transform system in Upper Matrix ---*/
@@ -558,6 +578,7 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
 }
 
 template<class ScalarType>
+template<unsigned long BS>
 void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
 
   /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
@@ -567,6 +588,8 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inver
 
   assert((matrix != inverse) && "Output cannot be the same as the input.");
 
+  const auto nVar = BS? BS : this->nVar;
+
 #define M(I,J) inverse[(I)*nVar+(J)]
 
   /*--- Initialize the inverse with the identity. ---*/
@@ -629,20 +652,6 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 
 }
 
-template<class ScalarType>
-void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
-                                        unsigned long row_i, ScalarType *prod) const {
-  unsigned long iVar, index, col_j;
-
-  for (iVar = 0; iVar < nVar; iVar++) prod[iVar] = 0.0;
-
-  for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-    col_j = col_ind[index];
-    MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
-  }
-
-}
-
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                  CGeometry *geometry, CConfig *config) const {
@@ -665,6 +674,22 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
+  CALL_BLOCK_KERNEL(MatrixVectorProductImpl, vec, prod)
+
+  /*--- MPI Parallelization by master thread. ---*/
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::MatrixVectorProductImpl(const CSysVector<ScalarType> & vec,
+                                                     CSysVector<ScalarType> & prod) const {
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
     auto prod_begin = row_i*nVar; // offset to beginning of block row_i
@@ -673,18 +698,9 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
     for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
       auto vec_begin = col_ind[index]*nEqn; // offset to beginning of block col_ind[index]
       auto mat_begin = index*nVar*nEqn; // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductAdd(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
+      MatrixVectorProductAdd<BS>(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
     }
   }
-
-  /*--- MPI Parallelization by master thread. ---*/
-
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
@@ -728,11 +744,17 @@ void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<Scal
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner(bool transpose) {
+  CALL_BLOCK_KERNEL(BuildJacobiPreconditionerImpl, transpose)
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::BuildJacobiPreconditionerImpl(bool transpose) {
 
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
   SU2_OMP(for schedule(dynamic,omp_heavy_size) nowait)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]), transpose);
+    InverseDiagonalBlock<BS>(iPoint, &(invM[iPoint*nVar*nVar]), transpose);
 
 }
 
@@ -742,9 +764,7 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  CALL_BLOCK_KERNEL(ComputeJacobiPreconditionerImpl, vec, prod)
 
   /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
@@ -755,6 +775,15 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   SU2_OMP_BARRIER
 }
 
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::ComputeJacobiPreconditionerImpl(const CSysVector<ScalarType> & vec,
+                                                             CSysVector<ScalarType> & prod) const {
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    MatrixVectorProduct<BS>(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
@@ -792,6 +821,14 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  CALL_BLOCK_KERNEL(BuildILUPreconditionerImpl)
+
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::BuildILUPreconditionerImpl() {
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -812,7 +849,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
       /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
 
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
+      InverseDiagonalBlock_ILUMatrix<BS>(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
 
       /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
@@ -829,7 +866,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
         /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
         auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
+        MatrixMatrixProduct<BS>(Block_ij, &invM[jPoint*nVar*nVar], weight);
 
         /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
@@ -847,8 +884,8 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
           if (Block_ik != nullptr) {
             auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
+            MatrixMatrixProduct<BS>(weight, Block_jk, aux_block);
+            MatrixSubtraction<BS>(Block_ik, aux_block, Block_ik);
           }
         }
 
@@ -859,7 +896,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
           Block_ij[iVar] = weight[iVar];
       }
     }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
+    InverseDiagonalBlock_ILUMatrix<BS>(end-1, &invM[(end-1)*nVar*nVar]);
 
   }
 
@@ -871,6 +908,22 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  CALL_BLOCK_KERNEL(ComputeILUPreconditionerImpl, vec, prod)
+
+  /*--- MPI Parallelization ---*/
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::ComputeILUPreconditionerImpl(const CSysVector<ScalarType> & vec,
+                                                          CSysVector<ScalarType> & prod) const {
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
@@ -894,7 +947,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
         auto jPoint = col_ind_ilu[index];
         if (jPoint < begin) continue;
         auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
+        MatrixVectorProductSub<BS>(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
       }
     }
 
@@ -909,26 +962,24 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
         auto jPoint = col_ind_ilu[index];
         if (jPoint >= end) break;
         auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
+        MatrixVectorProductSub<BS>(Block_ij, &prod[jPoint*nVar], aux_vec);
       }
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+      MatrixVectorProduct<BS>(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
     }
   }
-
-  /*--- MPI Parallelization ---*/
-
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, CConfig *config) const {
+  CALL_BLOCK_KERNEL(ComputeLU_SGSPreconditionerImpl, vec, prod, geometry, config)
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                             CGeometry *geometry, CConfig *config) const {
 
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
@@ -951,9 +1002,9 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
     for (auto iPoint = begin; iPoint < end; ++iPoint) {
       auto idx = iPoint*nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
+      LowerProduct<BS>(prod, iPoint, begin, low_prod);        // Compute L.x*
+      VectorSubtraction<BS>(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
+      Gauss_Elimination<BS>(iPoint, &prod[idx]);              // Solve D.x* = y
     }
   }
 
@@ -982,10 +1033,10 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
     for (auto iPoint = row_end; iPoint > begin;) {
       iPoint--; // because of unsigned type
       auto idx = iPoint*nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
-      UpperProduct(prod, iPoint, col_end, up_prod);     // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
+      DiagonalProduct<BS>(prod, iPoint, dia_prod);          // Compute D.x*
+      UpperProduct<BS>(prod, iPoint, col_end, up_prod);     // Compute U.x_(n+1)
+      VectorSubtraction<BS>(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
+      Gauss_Elimination<BS>(iPoint, &prod[idx]);            // Solve D.x* = y
     }
   }
 
@@ -1046,7 +1097,7 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
           (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY))
       {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           LineletPoint[iLinelet].push_back(iPoint);
           check_Point[iPoint] = false;
           iLinelet++;
@@ -1282,11 +1333,18 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
                                              CSysVector<ScalarType> & res) const {
   SU2_OMP_BARRIER
+  CALL_BLOCK_KERNEL(ComputeResidualImpl, sol, f, res)
+}
+
+template<class ScalarType>
+template<unsigned long BS>
+void CSysMatrix<ScalarType>::ComputeResidualImpl(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
+                                                 CSysVector<ScalarType> & res) const {
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     ScalarType aux_vec[MAXNVAR];
-    RowProduct(sol, iPoint, aux_vec);
-    VectorSubtraction(aux_vec, &f[iPoint*nVar], &res[iPoint*nVar]);
+    RowProduct<BS>(sol, iPoint, aux_vec);
+    VectorSubtraction<BS>(aux_vec, &f[iPoint*nVar], &res[iPoint*nVar]);
   }
 }
 
@@ -1410,6 +1468,30 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
 
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::SetSubMatrix(const CSysMatrix<ScalarType>& B, unsigned long iVarOffset,
+                                          unsigned long jVarOffset) {
+
+  /*--- Same checks as MatrixMatrixAddition, except the sub-blocks must fit in the blocks. ---*/
+  bool ok = (row_ptr == B.row_ptr) && (col_ind == B.col_ind) && (nnz == B.nnz) &&
+            (iVarOffset+B.nVar <= nVar) && (jVarOffset+B.nEqn <= nEqn);
+
+  if (!ok) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Matrices do not have compatible sparsity or block sizes.", CURRENT_FUNCTION);
+  }
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_light_size, nVar*nEqn))
+  for (auto k = 0ul; k < nnz; ++k) {
+    auto dst = &matrix[k*nVar*nEqn + iVarOffset*nEqn + jVarOffset];
+    const auto src = &B.matrix[k*B.nVar*B.nEqn];
+    for (auto iVar = 0ul; iVar < B.nVar; ++iVar)
+      for (auto jVar = 0ul; jVar < B.nEqn; ++jVar)
+        dst[iVar*nEqn+jVar] = src[iVar*B.nEqn+jVar];
+  }
+
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildPastixPreconditioner(CGeometry *geometry, CConfig *config,
                                                        unsigned short kind_fact, bool transposed) {
@@ -1445,6 +1527,8 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+#undef CALL_BLOCK_KERNEL
+
 /*--- Explicit instantiations ---*/
 #ifdef CODI_FORWARD_TYPE
 /*--- In forward AD only the active type is used. ---*/
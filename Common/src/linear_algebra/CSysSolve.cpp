@@ -850,6 +850,11 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     RestartIter  = config->GetLinear_Solver_Restart_Frequency();
     SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
     ScreenOutput = false;
+
+    /*--- The coarse levels agglomerated along lines are smoothed along the same lines. ---*/
+
+    if ((geometry->GetMGLevel() != MESH_0) && config->GetMG_LineAgglomeration() && Jacobian.HasLinelets())
+      KindPrecond = LINELET;
   }
 
   /*--- Mesh Deformation mode ---*/
@@ -909,9 +914,16 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       break;
   }
 
-  /*--- Build preconditioner. ---*/
+  /*--- Build preconditioner, unless the one of the previous call can be reused (the preconditioner
+   *    data is stored in the matrix). The discrete adjoint uses it for the transposed system.
+   *    LINELET is not reused, it factorizes the current matrix blocks along the lines on every
+   *    application and only the inverse diagonal blocks of the other points would be lagged. ---*/
+
+  const bool reusable = !mesh_deform && !config->GetDiscrete_Adjoint() &&
+                        (KindPrecond == ILU || KindPrecond == JACOBI);
+  const bool rebuild = !reusable || prec_rebuild;
 
-  precond->Build();
+  if (rebuild) precond->Build();
 
   /*--- Solve system. ---*/
 
@@ -954,6 +966,19 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
   {
     Residual = residual;
     Iterations = IterLinSol;
+
+    /*--- Decide if the preconditioner will be rebuilt in the next call. The first
+     *    solve after a build is the reference for the ones that reuse it. ---*/
+    if (rebuild) {
+      prec_age = 0;
+      prec_ref_iter = IterLinSol;
+      prec_ref_res = max(residual, SolverTol);
+    }
+    prec_age++;
+
+    prec_rebuild = (prec_age >= prec_max_reuse) ||
+                   (IterLinSol > prec_iter_ratio * prec_ref_iter) ||
+                   (residual > prec_res_ratio * prec_ref_res);
   }
 
   HandleTemporariesOut(LinSysSol);
@@ -0,0 +1,222 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Implementation of the compression toolbox.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+#include <cstring>
+#include <limits>
+
+namespace CompressionToolbox {
+
+void ByteShuffle(const void* in, size_t n, size_t elemSize, void* out) {
+  const auto src = static_cast<const uint8_t*>(in);
+  auto dst = static_cast<uint8_t*>(out);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t b = 0; b < elemSize; ++b)
+      dst[b*n + i] = src[i*elemSize + b];
+}
+
+void ByteUnshuffle(const void* in, size_t n, size_t elemSize, void* out) {
+  const auto src = static_cast<const uint8_t*>(in);
+  auto dst = static_cast<uint8_t*>(out);
+  for (size_t b = 0; b < elemSize; ++b)
+    for (size_t i = 0; i < n; ++i)
+      dst[i*elemSize + b] = src[b*n + i];
+}
+
+namespace {
+
+/*--- Constants of the LZ4 block format. ---*/
+
+constexpr size_t MIN_MATCH = 4;       /*!< \brief Shortest match that can be encoded. */
+constexpr size_t LAST_LITERALS = 5;   /*!< \brief The last bytes of a block are always literals. */
+constexpr size_t MF_LIMIT = 12;       /*!< \brief The last match must start this far from the end. */
+constexpr size_t MAX_OFFSET = 65535;  /*!< \brief Matches are encoded with 16 bit offsets. */
+constexpr int HASH_LOG = 16;
+
+inline uint32_t Read32(const uint8_t* p) {
+  uint32_t v; memcpy(&v, p, sizeof(v)); return v;
+}
+
+inline uint32_t Hash(uint32_t seq) { return (seq * 2654435761U) >> (32-HASH_LOG); }
+
+/*--- Write the 255-byte continuation of a length that did not fit in the token. ---*/
+inline uint8_t* WriteLength(size_t len, uint8_t* op) {
+  for (; len >= 255; len -= 255) *op++ = 255;
+  *op++ = uint8_t(len);
+  return op;
+}
+
+/*--- Read the continuation of a length, returns false on truncated input. ---*/
+inline bool ReadLength(const uint8_t* src, size_t compSize, size_t& ip, size_t& len) {
+  uint8_t b;
+  do {
+    if (ip >= compSize) return false;
+    b = src[ip++];
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+/*--- Emit one sequence (literals followed by an optional match). ---*/
+inline uint8_t* WriteSequence(const uint8_t* literals, size_t litLen, size_t offset, size_t matchLen, uint8_t* op) {
+  uint8_t* token = op++;
+  *token = uint8_t((litLen < 15 ? litLen : 15) << 4);
+  if (litLen >= 15) op = WriteLength(litLen-15, op);
+  memcpy(op, literals, litLen);
+  op += litLen;
+  if (matchLen == 0) return op;
+
+  *op++ = uint8_t(offset & 0xFF);
+  *op++ = uint8_t(offset >> 8);
+  const size_t code = matchLen - MIN_MATCH;
+  *token |= uint8_t(code < 15 ? code : 15);
+  if (code >= 15) op = WriteLength(code-15, op);
+  return op;
+}
+
+}
+
+size_t LZ4Compress(const uint8_t* src, size_t n, uint8_t* dst) {
+
+  const size_t noPos = std::numeric_limits<size_t>::max();
+  uint8_t* op = dst;
+  size_t anchor = 0;
+
+  if (n > MF_LIMIT) {
+    std::vector<size_t> table(size_t(1) << HASH_LOG, noPos);
+    const size_t matchLimit = n - LAST_LITERALS;
+    size_t ip = 0;
+
+    while (ip + MF_LIMIT <= n) {
+      const uint32_t seq = Read32(src+ip);
+      const uint32_t h = Hash(seq);
+      const size_t ref = table[h];
+      table[h] = ip;
+
+      if (ref != noPos && ip-ref <= MAX_OFFSET && Read32(src+ref) == seq) {
+        size_t len = MIN_MATCH;
+        while (ip+len < matchLimit && src[ref+len] == src[ip+len]) ++len;
+
+        op = WriteSequence(src+anchor, ip-anchor, ip-ref, len, op);
+        ip += len;
+        anchor = ip;
+      }
+      else {
+        /*--- Skip faster over incompressible regions. ---*/
+        ip += 1 + ((ip-anchor) >> 6);
+      }
+    }
+  }
+
+  /*--- The block always ends with a literal-only sequence. ---*/
+  op = WriteSequence(src+anchor, n-anchor, 0, 0, op);
+
+  return size_t(op-dst);
+}
+
+bool LZ4Decompress(const uint8_t* src, size_t compSize, uint8_t* dst, size_t rawSize) {
+
+  size_t ip = 0, op = 0;
+
+  while (ip < compSize) {
+    const uint8_t token = src[ip++];
+
+    size_t litLen = token >> 4;
+    if (litLen == 15 && !ReadLength(src, compSize, ip, litLen)) return false;
+    if (ip+litLen > compSize || op+litLen > rawSize) return false;
+    memcpy(dst+op, src+ip, litLen);
+    ip += litLen;
+    op += litLen;
+
+    /*--- The last sequence has no match. ---*/
+    if (ip == compSize) break;
+
+    if (ip+2 > compSize) return false;
+    const size_t offset = src[ip] | (size_t(src[ip+1]) << 8);
+    ip += 2;
+    if (offset == 0 || offset > op) return false;
+
+    size_t matchLen = token & 15;
+    if (matchLen == 15 && !ReadLength(src, compSize, ip, matchLen)) return false;
+    matchLen += MIN_MATCH;
+    if (op+matchLen > rawSize) return false;
+
+    /*--- Byte-wise copy, the match may overlap the output. ---*/
+    for (size_t i = 0; i < matchLen; ++i, ++op) dst[op] = dst[op-offset];
+  }
+  return op == rawSize;
+}
+
+void CompressBlock(double* data, size_t nPoint, const std::vector<int>& codec,
+                   const std::vector<double>& tol, std::vector<uint8_t>& block) {
+
+  const size_t nField = codec.size();
+  const size_t rawSize = nPoint*sizeof(double);
+
+  std::vector<uint8_t> shuffled(rawSize);
+  block.resize(nField*(sizeof(uint64_t) + LZ4CompressBound(rawSize)));
+
+  size_t pos = 0;
+  for (size_t iField = 0; iField < nField; ++iField) {
+    double* field = data + iField*nPoint;
+
+    if (codec[iField] == CODEC_QUANTIZED_LZ4) Quantize(field, nPoint, tol[iField]);
+
+    ByteShuffle(field, nPoint, sizeof(double), shuffled.data());
+
+    const uint64_t compSize = LZ4Compress(shuffled.data(), rawSize, &block[pos+sizeof(uint64_t)]);
+    memcpy(&block[pos], &compSize, sizeof(uint64_t));
+    pos += sizeof(uint64_t) + compSize;
+  }
+  block.resize(pos);
+}
+
+bool DecompressBlock(const uint8_t* block, size_t blockSize, size_t nPoint, size_t nField, double* data) {
+
+  const size_t rawSize = nPoint*sizeof(double);
+  std::vector<uint8_t> shuffled(rawSize);
+  std::vector<double> field(nPoint);
+
+  size_t pos = 0;
+  for (size_t iField = 0; iField < nField; ++iField) {
+    uint64_t compSize;
+    if (pos+sizeof(uint64_t) > blockSize) return false;
+    memcpy(&compSize, block+pos, sizeof(uint64_t));
+    pos += sizeof(uint64_t);
+    if (pos+compSize > blockSize) return false;
+
+    if (!LZ4Decompress(block+pos, compSize, shuffled.data(), rawSize)) return false;
+    pos += compSize;
+
+    ByteUnshuffle(shuffled.data(), nPoint, sizeof(double), field.data());
+
+    for (size_t iPoint = 0; iPoint < nPoint; ++iPoint)
+      data[iPoint*nField + iField] = field[iPoint];
+  }
+  return pos == blockSize;
+}
+
+}
@@ -34,6 +34,8 @@
 #include <iostream>
 #include <string>
 #include <cmath>
+#include <vector>
+#include <memory>
 
 #define LEN_COMPONENTS 32
 
@@ -45,6 +47,23 @@ using namespace std;
 #include "../include/transport_model.hpp"
 #include "../../Common/include/CConfig.hpp"
 
+/*!
+ * \struct CFluidBatch
+ * \brief Arrays of the thermodynamic state of a batch of points, filled by the batched methods of CFluidModel.
+ * \note All arrays must have the size of the batch. Density and StaticEnergy are only set by ComputeState_PT.
+ */
+struct CFluidBatch {
+  su2double *Density = nullptr,  /*!< \brief Density. */
+  *StaticEnergy = nullptr,       /*!< \brief Internal energy. */
+  *Pressure = nullptr,           /*!< \brief Pressure. */
+  *Temperature = nullptr,        /*!< \brief Temperature. */
+  *SoundSpeed2 = nullptr,        /*!< \brief Speed of sound squared. */
+  *dPdrho_e = nullptr,           /*!< \brief DpDd_e. */
+  *dPde_rho = nullptr,           /*!< \brief DpDe_d. */
+  *dTdrho_e = nullptr,           /*!< \brief DTDd_e. */
+  *dTde_rho = nullptr;           /*!< \brief DTDe_d. */
+};
+
 /*!
  * \class CFluidModel
  * \brief Main class for defining the Thermo-Physical Model
@@ -304,6 +323,44 @@ public:
    */
   void SetEddyViscosity(su2double val_Mu_Turb);
 
+  /*!
+   * \brief Thermodynamic state of a batch of points from density and internal energy.
+   * \note The default implementation loops over SetTDState_rhoe, hence it modifies the state of the object,
+   *       the specialized ones (e.g. CIdealGas) are stateless and vectorized. Entropy is not computed.
+   * \param[in] nPoint - Number of points.
+   * \param[in] rho - Density of the points.
+   * \param[in] e - Internal energy of the points.
+   * \param[out] state - Arrays of the state (Density and StaticEnergy are not used).
+   */
+  virtual void ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e, const CFluidBatch& state);
+
+  /*!
+   * \brief Thermodynamic state of a batch of points from pressure and temperature.
+   * \note The default implementation loops over SetTDState_PT (see ComputeState_rhoe).
+   * \param[in] nPoint - Number of points.
+   * \param[in] P - Pressure of the points.
+   * \param[in] T - Temperature of the points.
+   * \param[out] state - Arrays of the state, including Density and StaticEnergy.
+   */
+  virtual void ComputeState_PT(unsigned long nPoint, const su2double *P, const su2double *T, const CFluidBatch& state);
+
+  /*!
+   * \brief Transport properties of a batch of points, with the viscosity and conductivity models of the fluid.
+   * \note The eddy viscosity is the one set with SetEddyViscosity, as in GetThermalConductivity.
+   * \param[in] nPoint - Number of points.
+   * \param[in] T - Temperature of the points.
+   * \param[in] rho - Density of the points.
+   * \param[out] mu - Laminar viscosity.
+   * \param[out] dmudrho - Derivative of the viscosity w.r.t. density at constant temperature.
+   * \param[out] dmudT - Derivative of the viscosity w.r.t. temperature at constant density.
+   * \param[out] kt - Thermal conductivity.
+   * \param[out] dktdrho - Derivative of the conductivity w.r.t. density at constant temperature.
+   * \param[out] dktdT - Derivative of the conductivity w.r.t. temperature at constant density.
+   */
+  void ComputeTransport(unsigned long nPoint, const su2double *T, const su2double *rho,
+                        su2double *mu, su2double *dmudrho, su2double *dmudT,
+                        su2double *kt, su2double *dktdrho, su2double *dktdT);
+
 };
 
 
@@ -350,6 +407,18 @@ public:
    */
   void SetTDState_rhoe (su2double rho, su2double e ) override;
 
+  /*!
+   * \brief Thermodynamic state of a batch of points from density and internal energy (stateless).
+   * \note The derived models (CVanDerWaalsGas, CPengRobinson) use the default implementation.
+   */
+  void ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e, const CFluidBatch& state) override;
+
+  /*!
+   * \brief Thermodynamic state of a batch of points from pressure and temperature (stateless).
+   * \note The derived models use the default implementation.
+   */
+  void ComputeState_PT(unsigned long nPoint, const su2double *P, const su2double *T, const CFluidBatch& state) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -608,6 +677,217 @@ public:
 
 };
 
+/*!
+ * \class CFluidTable
+ * \brief Thermodynamic state tabulated on a rectilinear grid in (rho, e), the data of CLookUpTableGas.
+ * \details The table is generated from another fluid model, or read from an ASCII file in SI units
+ *          (e.g. written by a previous run or by an external property library). It is stored
+ *          non-dimensional and passive, one table is shared by the fluid models of all threads.
+ */
+class CFluidTable {
+public:
+  /*!
+   * \brief Tabulated quantities, stored contiguously for each node.
+   */
+  enum : unsigned short {PRESSURE, TEMPERATURE, SOUNDSPEED2, DPDRHO_E, DPDE_RHO, DTDRHO_E, DTDE_RHO, ENTROPY, NFIELD};
+
+private:
+  vector<passivedouble> Rho;     /*!< \brief Density of the table nodes (increasing). */
+  vector<passivedouble> Energy;  /*!< \brief Internal energy of the table nodes (increasing). */
+  vector<passivedouble> Data;    /*!< \brief NFIELD values per node, the energy index runs fastest. */
+  passivedouble RhoInvDelta,     /*!< \brief Inverse of the mean density spacing (initial guess of the cell search). */
+  EnergyInvDelta;                /*!< \brief Inverse of the mean energy spacing (initial guess of the cell search). */
+
+  /*!
+   * \brief Scale factors from SI to non-dimensional values of (rho, e) and of the tabulated quantities.
+   */
+  static void GetScaleFactors(const CConfig *config, passivedouble *scale);
+
+  /*!
+   * \brief Set the mean spacings and check that the axes are increasing.
+   */
+  void SetSpacing();
+
+  /*!
+   * \brief Index of the interval of an axis containing a value, starting from the guess of uniform spacing.
+   * \return False if the value is outside the axis.
+   */
+  static bool FindInterval(const vector<passivedouble>& axis, passivedouble invDelta,
+                           passivedouble val, unsigned long& index);
+
+public:
+  /*!
+   * \brief Generate the table by evaluating a fluid model at the nodes.
+   * \note The energy range is the one spanned by the temperature range over the density range.
+   * \param[in] model - Fluid model evaluated (non-dimensional), its state is modified.
+   * \param[in] rhoMin, rhoMax - Density range (non-dimensional).
+   * \param[in] TMin, TMax - Temperature range (non-dimensional).
+   * \param[in] nRho, nEnergy - Number of nodes in density and internal energy.
+   */
+  CFluidTable(CFluidModel *model, su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax,
+              unsigned long nRho, unsigned long nEnergy);
+
+  /*!
+   * \brief Read the table from a file in SI units.
+   * \param[in] config - Definition of the particular problem (reference values).
+   * \param[in] filename - Name of the table file.
+   */
+  CFluidTable(const CConfig *config, const string& filename);
+
+  /*!
+   * \brief Write the table to a file in SI units.
+   * \param[in] config - Definition of the particular problem (reference values).
+   * \param[in] filename - Name of the table file.
+   */
+  void Write(const CConfig *config, const string& filename) const;
+
+  /*!
+   * \brief Find the cell containing (rho, e) and the bilinear weights in it.
+   * \param[out] iRho, iEnergy - Index of the lower node of the cell.
+   * \param[out] wRho, wEnergy - Relative position in the cell.
+   * \return False if the state is outside the table.
+   */
+  bool FindCell(su2double rho, su2double e, unsigned long& iRho, unsigned long& iEnergy,
+                su2double& wRho, su2double& wEnergy) const;
+
+  /*!
+   * \brief Internal energy such that a quantity increasing with e takes a given value at constant density.
+   * \note The interpolation is linear in e along the lines of constant density, hence the inversion is exact.
+   * \param[in] rho - Density.
+   * \param[in] iField - Tabulated quantity (e.g. PRESSURE or TEMPERATURE).
+   * \param[in] val - Value of the quantity.
+   * \param[out] e - Internal energy.
+   * \return False if the state is outside the table.
+   */
+  bool InvertEnergy(su2double rho, unsigned short iField, su2double val, su2double& e) const;
+
+  /*!
+   * \brief Values of the nodes of the table.
+   */
+  inline const passivedouble* GetNode(unsigned long iRho, unsigned long iEnergy) const {
+    return &Data[(iRho*Energy.size() + iEnergy)*NFIELD];
+  }
+
+  /*!
+   * \brief Number of nodes in density.
+   */
+  inline unsigned long GetnRho() const { return Rho.size(); }
+
+  /*!
+   * \brief Number of nodes in internal energy.
+   */
+  inline unsigned long GetnEnergy() const { return Energy.size(); }
+};
+
+/*!
+ * \class CLookUpTableGas
+ * \brief Child class for defining a tabulated (look-up table) model of another fluid model.
+ * \details The states in (rho, e), (P, rho) and (rho, T) are interpolated bilinearly in a CFluidTable,
+ *          the latter two by inverting the table along the lines of constant density. The other input
+ *          pairs (PT, hs, Ps), which only appear in boundary conditions, and the states outside the
+ *          table are computed by the wrapped model, the former are then interpolated at its (rho, e).
+ */
+class CLookUpTableGas : public CFluidModel {
+
+protected:
+  CFluidModel *Model;                    /*!< \brief Wrapped fluid model, owned by this class. */
+  shared_ptr<const CFluidTable> Table;   /*!< \brief Tabulated thermodynamic state, shared between threads. */
+
+  /*!
+   * \brief Copy the thermodynamic state of the wrapped model.
+   */
+  void CopyState();
+
+  /*!
+   * \brief Interpolate the state in the table, falls back to the wrapped model outside of it.
+   */
+  void Interpolate(su2double rho, su2double e);
+
+  /*!
+   * \brief Interpolate the tabulated quantities at a state (stateless).
+   * \param[out] val - CFluidTable::NFIELD values.
+   * \return False if the state is outside the table.
+   */
+  bool InterpolateTable(su2double rho, su2double e, su2double *val) const;
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] model - Wrapped fluid model (the ownership is transferred).
+   * \param[in] table - Table of the model.
+   */
+  CLookUpTableGas(CFluidModel *model, shared_ptr<const CFluidTable> table);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CLookUpTableGas(void) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe (su2double rho, su2double e ) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT (su2double P, su2double T ) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho (su2double P, su2double rho ) override;
+
+  /*!
+   * \brief Set the Dimensionless Energy using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho (su2double P, su2double rho ) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs (su2double h, su2double s ) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT (su2double rho, su2double T ) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps (su2double P, su2double s ) override;
+
+  /*!
+   * \brief Compute some derivatives of enthalpy and entropy needed for subsonic inflow BC (wrapped model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho (su2double P, su2double rho ) override;
+
+  /*!
+   * \brief Thermodynamic state of a batch of points from density and internal energy.
+   * \note Stateless for the points inside the table.
+   */
+  void ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e, const CFluidBatch& state) override;
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
@@ -0,0 +1,443 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Generic implementation of the gradient and limiter computation in one pass over the grid.
+ * \note See computeGradientsGreenGauss.hpp, computeGradientsLeastSquares.hpp
+ *       and computeLimiters_impl.hpp for the separate versions.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "computeGradientsLeastSquares.hpp"
+#include "../limiters/CLimiterDetails.hpp"
+
+
+/*!
+ * \brief Limiter of a point from the min/max values over its neighbors and its (final) gradient.
+ * \note Same operations as computeLimiters_impl, the neighbors are only used for their coordinates.
+ */
+template<class FieldType, class GradientType, class LimiterDetails>
+inline void computeLimiterOfPoint(size_t iPoint,
+                                  CGeometry& geometry,
+                                  size_t varBegin,
+                                  size_t varEnd,
+                                  const FieldType& field,
+                                  const GradientType& gradient,
+                                  const FieldType& fieldMin,
+                                  const FieldType& fieldMax,
+                                  const LimiterDetails& limiterDetails,
+                                  FieldType& limiter)
+{
+  constexpr size_t MAXNDIM = 3;
+  constexpr size_t MAXNVAR = 8;
+
+  const size_t nDim = geometry.GetnDim();
+  auto nodes = geometry.nodes;
+  const su2double* coord_i = nodes->GetCoord(iPoint);
+
+  su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    projMax[iVar] = projMin[iVar] = 0.0;
+
+  for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+  {
+    const su2double* coord_j = nodes->GetCoord(nodes->GetPoint(iPoint,iNeigh));
+
+    su2double dist_ij[MAXNDIM] = {0.0};
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      su2double proj = 0.0;
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+      projMax[iVar] = max(projMax[iVar], proj);
+      projMin[iVar] = min(projMin[iVar], proj);
+    }
+  }
+
+  su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+  for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+  {
+    su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                       fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+    su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                       fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+    limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+  }
+}
+
+
+/*!
+ * \brief Compute the gradient of a field (Green-Gauss or Least-Squares) and, optionally, its limiter,
+ *        in one pass over the neighbors of each point, with one MPI communication of each at the end.
+ * \note The results are the same as those of the separate functions. The min/max values over the
+ *       neighbors are found while integrating the gradient, and with least-squares the limiter of
+ *       each point is computed as soon as its gradient is final. The loops over variables are
+ *       innermost such that they can be vectorized.
+ * \note Grids with periodic boundaries need the separate functions (periodic communications
+ *       between the steps) and so does the discrete adjoint (no AD pre-accumulation here).
+ *
+ * Arguments:
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiCommGrad - Type of MPI communication of the gradient.
+ * \param[in] kindMpiCommLim - Type of MPI communication of the limiter.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem, used to identify types of boundaries.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] Smatrix - Optional, cached inverse least-squares matrices (see computeLeastSquaresMatrices).
+ * \param[in] limit - Compute the limiter.
+ * \param[in] field - Variable field.
+ * \param[in] varBegin - First variable index for which to compute the gradient (and limiter).
+ * \param[in] varEnd - End of computation range (nVar = end-begin).
+ * \param[out] gradient - Gradient of the field.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field.
+ *
+ * Template parameters:
+ * \param FieldType - Generic object with operator (iPoint,iVar)
+ * \param GradientType - Generic object with operator (iPoint,iVar,iDim)
+ * \param LimiterKind - Used to instantiate the right details class.
+ */
+template<class FieldType, class GradientType, ENUM_LIMITER LimiterKind>
+void computeGradientsAndLimiters_impl(CSolver* solver,
+                                      MPI_QUANTITIES kindMpiCommGrad,
+                                      MPI_QUANTITIES kindMpiCommLim,
+                                      CGeometry& geometry,
+                                      CConfig& config,
+                                      ENUM_FLOW_GRADIENT kindGradient,
+                                      const su2activematrix* Smatrix,
+                                      bool limit,
+                                      const FieldType& field,
+                                      size_t varBegin,
+                                      size_t varEnd,
+                                      GradientType& gradient,
+                                      FieldType& fieldMin,
+                                      FieldType& fieldMax,
+                                      FieldType& limiter)
+{
+  constexpr size_t MAXNDIM = 3;
+  constexpr size_t MAXNVAR = 8;
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nDim = geometry.GetnDim();
+  const bool greenGauss = (kindGradient == GREEN_GAUSS);
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  if (limit) limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  /*--- Gradient of each point, integrated over its faces (Green-Gauss) or
+   *    fitted to its neighbors (Least-Squares), and min/max of the field. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+    const su2double* coord_i = nodes->GetCoord(iPoint);
+
+    su2double field_i[MAXNVAR], grad[MAXNDIM][MAXNVAR], fMin[MAXNVAR], fMax[MAXNVAR];
+    su2double Rmatrix[MAXNDIM][MAXNDIM] = {{0.0}};
+
+    SU2_OMP_SIMD
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      field_i[iVar] = fMin[iVar] = fMax[iVar] = field(iPoint,iVar);
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        grad[iDim][iVar] = 0.0;
+    }
+
+    const su2double halfOnVol = greenGauss? 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint)) : 0.0;
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      if (greenGauss)
+      {
+        size_t iEdge = nodes->GetEdge(iPoint,iNeigh);
+
+        su2double dir = (iPoint == geometry.edges->GetNode(iEdge,0))? 1.0 : -1.0;
+        su2double weight = dir * halfOnVol;
+
+        const su2double* area = geometry.edges->GetNormal(iEdge);
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          SU2_OMP_SIMD
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+            su2double flux = weight * (field_i[iVar] + field(jPoint,iVar));
+            grad[iDim][iVar] += flux * area[iDim];
+          }
+        }
+      }
+      else
+      {
+        const su2double* coord_j = nodes->GetCoord(jPoint);
+
+        su2double dist_ij[MAXNDIM] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+
+        su2double weight = 1.0;
+
+        if (weighted)
+        {
+          weight = 0.0;
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            weight += dist_ij[iDim] * dist_ij[iDim];
+        }
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          if (Smatrix == nullptr)
+            addLeastSquaresContribution(nDim, dist_ij, weight,
+              [&](size_t iDim, size_t jDim) -> su2double& { return Rmatrix[iDim][jDim]; });
+
+          /*--- Entries of c:= transpose(A)*b ---*/
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            SU2_OMP_SIMD
+            for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+              su2double delta_ij = weight * (field(jPoint,iVar) - field_i[iVar]);
+              grad[iDim][iVar] += dist_ij[iDim] * delta_ij;
+            }
+          }
+        }
+      }
+
+      if (limit)
+      {
+        SU2_OMP_SIMD
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          fMax[iVar] = max(fMax[iVar], field(jPoint,iVar));
+          fMin[iVar] = min(fMin[iVar], field(jPoint,iVar));
+        }
+      }
+    }
+
+    if (greenGauss)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = grad[iDim][iVar];
+    }
+    else
+    {
+      /*--- Computation of the gradient: S*c ---*/
+
+      su2double S[MAXNDIM][MAXNDIM];
+
+      if (Smatrix != nullptr) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            S[iDim][jDim] = (*Smatrix)(iPoint, iDim*nDim+jDim);
+      }
+      else {
+        computeLeastSquaresInverse(nDim, [&](size_t iDim, size_t jDim) { return Rmatrix[iDim][jDim]; }, S);
+      }
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        su2double Cvector[MAXNVAR];
+
+        SU2_OMP_SIMD
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+          Cvector[iVar] = 0.0;
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            Cvector[iVar] += S[iDim][jDim] * grad[jDim][iVar];
+        }
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          gradient(iPoint, iVar, iDim) = Cvector[iVar];
+      }
+    }
+
+    if (limit)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        fieldMax(iPoint,iVar) = fMax[iVar];
+        fieldMin(iPoint,iVar) = fMin[iVar];
+      }
+
+      /*--- The least-squares gradient is final, limit it now. ---*/
+
+      if (!greenGauss)
+        computeLimiterOfPoint(iPoint, geometry, varBegin, varEnd, field, gradient,
+                              fieldMin, fieldMax, limiterDetails, limiter);
+    }
+  }
+
+  if (greenGauss)
+  {
+    /*--- Add boundary fluxes. ---*/
+
+    for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+    {
+      if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+          (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+      {
+        /*--- Work is shared in inner loop as two markers
+         *    may try to update the same point. ---*/
+
+        SU2_OMP_FOR_STAT(32)
+        for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
+        {
+          size_t iPoint = geometry.vertexData[iMarker].GetNode(iVertex);
+          auto nodes = geometry.nodes;
+
+          /*--- Halo points do not need to be considered. ---*/
+
+          if (!nodes->GetDomain(iPoint)) continue;
+
+          su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
+
+          const su2double* area = geometry.vertexData[iMarker].GetNormal(iVertex);
+
+          for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+          {
+            su2double flux = field(iPoint,iVar) / volume;
+
+            for (size_t iDim = 0; iDim < nDim; iDim++)
+              gradient(iPoint, iVar, iDim) -= flux * area[iDim];
+          }
+        }
+      }
+    }
+
+    /*--- The Green-Gauss gradient is final after the boundary fluxes, limit it now. ---*/
+
+    if (limit)
+    {
+      SU2_OMP_FOR_DYN(chunkSize)
+      for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+        computeLimiterOfPoint(iPoint, geometry, varBegin, varEnd, field, gradient,
+                              fieldMin, fieldMax, limiterDetails, limiter);
+    }
+  }
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  SU2_OMP_MASTER
+  if (solver != nullptr)
+  {
+    /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them. ---*/
+
+    solver->InitiateComms(&geometry, &config, kindMpiCommGrad);
+    solver->CompleteComms(&geometry, &config, kindMpiCommGrad);
+
+    if (limit) {
+      solver->InitiateComms(&geometry, &config, kindMpiCommLim);
+      solver->CompleteComms(&geometry, &config, kindMpiCommLim);
+    }
+  }
+  SU2_OMP_BARRIER
+
+}
+
+
+/*!
+ * \brief A wrapper function that instantiates computeGradientsAndLimiters_impl for "LimiterKind",
+ *        NO_LIMITER computes only the gradient. See computeLimiters.hpp.
+ */
+template<class FieldType, class GradientType>
+void computeGradientsAndLimiters(ENUM_LIMITER LimiterKind,
+                                 CSolver* solver,
+                                 MPI_QUANTITIES kindMpiCommGrad,
+                                 MPI_QUANTITIES kindMpiCommLim,
+                                 CGeometry& geometry,
+                                 CConfig& config,
+                                 ENUM_FLOW_GRADIENT kindGradient,
+                                 const su2activematrix* Smatrix,
+                                 const FieldType& field,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 GradientType& gradient,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter)
+{
+#define INSTANTIATE(KIND, LIMIT) \
+computeGradientsAndLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiCommGrad, \
+  kindMpiCommLim, geometry, config, kindGradient, Smatrix, LIMIT, field, varBegin, \
+  varEnd, gradient, fieldMin, fieldMax, limiter)
+
+  switch (LimiterKind) {
+    case NO_LIMITER:
+    {
+      /*--- The details class is not used. ---*/
+      INSTANTIATE(BARTH_JESPERSEN, false);
+      break;
+    }
+    case BARTH_JESPERSEN:
+    {
+      INSTANTIATE(BARTH_JESPERSEN, true);
+      break;
+    }
+    case VENKATAKRISHNAN:
+    {
+      INSTANTIATE(VENKATAKRISHNAN, true);
+      break;
+    }
+    case VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(VENKATAKRISHNAN_WANG, true);
+      break;
+    }
+    case WALL_DISTANCE:
+    {
+      INSTANTIATE(WALL_DISTANCE, true);
+      break;
+    }
+    case SHARP_EDGES:
+    {
+      INSTANTIATE(SHARP_EDGES, true);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("Unknown limiter type.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+}
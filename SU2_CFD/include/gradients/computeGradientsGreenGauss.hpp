@@ -141,7 +141,7 @@ void computeGradientsGreenGauss(CSolver* solver,
       SU2_OMP_FOR_STAT(32)
       for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
       {
-        size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+        size_t iPoint = geometry.vertexData[iMarker].GetNode(iVertex);
         auto nodes = geometry.nodes;
 
         /*--- Halo points do not need to be considered. ---*/
@@ -150,7 +150,7 @@ void computeGradientsGreenGauss(CSolver* solver,
 
         su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
 
-        const su2double* area = geometry.vertex[iMarker][iVertex]->GetNormal();
+        const su2double* area = geometry.vertexData[iMarker].GetNormal(iVertex);
 
         for (size_t iVar = varBegin; iVar < varEnd; iVar++)
         {
@@ -26,9 +26,135 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/omp_structure.hpp"
 
 
+/*!
+ * \brief Add the contribution of a neighbor to the upper triangular least-squares matrix R of a point.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] dist_ij - Distance vector from the point to the neighbor.
+ * \param[in] weight - Inverse weight of the neighbor.
+ * \param[in,out] Rmatrix - Generic object implementing operator (iDim, jDim), returning a reference.
+ */
+template<class RMatrixType>
+inline void addLeastSquaresContribution(size_t nDim, const su2double* dist_ij, su2double weight, RMatrixType&& Rmatrix)
+{
+  Rmatrix(0,0) += dist_ij[0]*dist_ij[0]*weight;
+  Rmatrix(0,1) += dist_ij[0]*dist_ij[1]*weight;
+  Rmatrix(1,1) += dist_ij[1]*dist_ij[1]*weight;
+
+  if (nDim == 3)
+  {
+    Rmatrix(0,2) += dist_ij[0]*dist_ij[2]*weight;
+    Rmatrix(1,2) += dist_ij[1]*dist_ij[2]*weight;
+    Rmatrix(2,1) += dist_ij[0]*dist_ij[2]*weight;
+    Rmatrix(2,2) += dist_ij[2]*dist_ij[2]*weight;
+  }
+}
+
+
+/*!
+ * \brief Compute the inverse of the least-squares matrix of a point, S := inv(R)*transpose(inv(R)).
+ * \note S is set to zero for (nearly) singular matrices.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] Rmatrix - Generic object implementing operator (iDim, jDim), entries accumulated
+ *            with addLeastSquaresContribution (and periodic communications).
+ * \param[out] Smatrix - Inverse matrix.
+ */
+template<class RMatrixType>
+inline void computeLeastSquaresInverse(size_t nDim, const RMatrixType& Rmatrix, su2double Smatrix[][3])
+{
+  /*--- Entries of upper triangular matrix R. ---*/
+
+  su2double r11 = Rmatrix(0,0);
+  su2double r12 = Rmatrix(0,1);
+  su2double r22 = Rmatrix(1,1);
+  su2double r13 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+
+  AD::SetPreaccIn(r11);
+  AD::SetPreaccIn(r12);
+  AD::SetPreaccIn(r22);
+
+  if (r11 >= 0.0) r11 = sqrt(r11);
+  if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
+  su2double tmp = r22-r12*r12;
+  if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
+
+  if (nDim == 3) {
+    r13   = Rmatrix(0,2);
+    r23_a = Rmatrix(1,2);
+    r23_b = Rmatrix(2,1);
+    r33   = Rmatrix(2,2);
+
+    AD::SetPreaccIn(r13);
+    AD::SetPreaccIn(r23_a);
+    AD::SetPreaccIn(r23_b);
+    AD::SetPreaccIn(r33);
+
+    if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
+
+    if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
+      r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+    } else {
+      r23 = 0.0;
+    }
+
+    tmp = r33 - r23*r23 - r13*r13;
+    if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
+  }
+
+  /*--- Compute determinant ---*/
+
+  su2double detR2 = (r11*r22)*(r11*r22);
+  if (nDim == 3) detR2 *= r33*r33;
+
+  /*--- Detect singular matrices ---*/
+
+  bool singular = false;
+
+  if (detR2 <= EPS) {
+    detR2 = 1.0;
+    singular = true;
+  }
+
+  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+  if (singular) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Smatrix[iDim][jDim] = 0.0;
+  }
+  else {
+    if (nDim == 2) {
+      Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[0][1] = -r11*r12/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/detR2;
+    }
+    else {
+      su2double z11 = r22*r33;
+      su2double z12 =-r12*r33;
+      su2double z13 = r12*r23-r13*r22;
+      su2double z22 = r11*r33;
+      su2double z23 =-r11*r23;
+      su2double z33 = r11*r22;
+
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[0][2] = (z13*z33)/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+      Smatrix[1][2] = (z23*z33)/detR2;
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/detR2;
+    }
+  }
+}
+
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -126,17 +252,8 @@ void computeGradientsLeastSquares(CSolver* solver,
       {
         weight = 1.0 / weight;
 
-        Rmatrix(iPoint,0,0) += dist_ij[0]*dist_ij[0]*weight;
-        Rmatrix(iPoint,0,1) += dist_ij[0]*dist_ij[1]*weight;
-        Rmatrix(iPoint,1,1) += dist_ij[1]*dist_ij[1]*weight;
-
-        if (nDim == 3)
-        {
-          Rmatrix(iPoint,0,2) += dist_ij[0]*dist_ij[2]*weight;
-          Rmatrix(iPoint,1,2) += dist_ij[1]*dist_ij[2]*weight;
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[2]*weight;
-          Rmatrix(iPoint,2,2) += dist_ij[2]*dist_ij[2]*weight;
-        }
+        addLeastSquaresContribution(nDim, dist_ij, weight,
+          [&](size_t iDim, size_t jDim) -> su2double& { return Rmatrix(iPoint, iDim, jDim); });
 
         /*--- Entries of c:= transpose(A)*b ---*/
 
@@ -181,95 +298,12 @@ void computeGradientsLeastSquares(CSolver* solver,
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
-    /*--- Entries of upper triangular matrix R. ---*/
-
-    su2double r11 = Rmatrix(iPoint,0,0);
-    su2double r12 = Rmatrix(iPoint,0,1);
-    su2double r22 = Rmatrix(iPoint,1,1);
-    su2double r13 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
-
     AD::StartPreacc();
-    AD::SetPreaccIn(r11);
-    AD::SetPreaccIn(r12);
-    AD::SetPreaccIn(r22);
-
-    if (r11 >= 0.0) r11 = sqrt(r11);
-    if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
-    su2double tmp = r22-r12*r12;
-    if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
-
-    if (nDim == 3) {
-      r13   = Rmatrix(iPoint,0,2);
-      r23_a = Rmatrix(iPoint,1,2);
-      r23_b = Rmatrix(iPoint,2,1);
-      r33   = Rmatrix(iPoint,2,2);
-
-      AD::SetPreaccIn(r13);
-      AD::SetPreaccIn(r23_a);
-      AD::SetPreaccIn(r23_b);
-      AD::SetPreaccIn(r33);
-
-      if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
-
-      if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
-        r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-      } else {
-        r23 = 0.0;
-      }
-
-      tmp = r33 - r23*r23 - r13*r13;
-      if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
-    }
-
-    /*--- Compute determinant ---*/
-
-    su2double detR2 = (r11*r22)*(r11*r22);
-    if (nDim == 3) detR2 *= r33*r33;
-
-    /*--- Detect singular matrices ---*/
-
-    bool singular = false;
-
-    if (detR2 <= EPS) {
-      detR2 = 1.0;
-      singular = true;
-    }
-
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
     su2double Smatrix[MAXNDIM][MAXNDIM];
 
-    if (singular) {
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        su2double z11 = r22*r33;
-        su2double z12 =-r12*r33;
-        su2double z13 = r12*r23-r13*r22;
-        su2double z22 = r11*r33;
-        su2double z23 =-r11*r23;
-        su2double z33 = r11*r22;
-
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
+    computeLeastSquaresInverse(nDim,
+      [&](size_t iDim, size_t jDim) { return Rmatrix(iPoint, iDim, jDim); }, Smatrix);
 
     for (size_t iDim = 0; iDim < nDim; ++iDim)
       for (size_t jDim = 0; jDim < nDim; ++jDim)
@@ -308,3 +342,63 @@ void computeGradientsLeastSquares(CSolver* solver,
   SU2_OMP_BARRIER
 
 }
+
+
+/*!
+ * \brief Compute the inverse least-squares matrix of each (non-halo) point, which only depends on the grid.
+ * \note Allows the matrices to be computed once on static grids, the contributions of periodic
+ *       boundaries are not included (those come from the periodic communications of the solver).
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[out] Smatrix - Inverse matrix of each point (row-major, nDim*nDim entries per point).
+ */
+inline void computeLeastSquaresMatrices(CGeometry& geometry, bool weighted, su2activematrix& Smatrix)
+{
+  constexpr size_t MAXNDIM = 3;
+
+  size_t nPointDomain = geometry.GetnPointDomain();
+  size_t nDim = geometry.GetnDim();
+
+  SU2_OMP_MASTER
+  Smatrix.resize(nPointDomain, nDim*nDim);
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_STAT(512)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+    const su2double* coord_i = nodes->GetCoord(iPoint);
+
+    su2double Rmatrix[MAXNDIM][MAXNDIM] = {{0.0}};
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+      const su2double* coord_j = nodes->GetCoord(jPoint);
+
+      su2double dist_ij[MAXNDIM] = {0.0}, weight = 1.0;
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+
+      if (weighted)
+      {
+        weight = 0.0;
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          weight += dist_ij[iDim] * dist_ij[iDim];
+      }
+
+      if (weight > 0.0)
+        addLeastSquaresContribution(nDim, dist_ij, 1.0 / weight,
+          [&](size_t iDim, size_t jDim) -> su2double& { return Rmatrix[iDim][jDim]; });
+    }
+
+    su2double S[MAXNDIM][MAXNDIM];
+
+    computeLeastSquaresInverse(nDim, [&](size_t iDim, size_t jDim) { return Rmatrix[iDim][jDim]; }, S);
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Smatrix(iPoint, iDim*nDim+jDim) = S[iDim][jDim];
+  }
+}
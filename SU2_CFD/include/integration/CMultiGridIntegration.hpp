@@ -33,6 +33,13 @@
  * \author F. Palacios
  */
 class CMultiGridIntegration final : public CIntegration {
+private:
+  /*!
+   * \brief Max chunk size of the dynamically scheduled loops over coarse points, the
+   *        work per point varies with the number of children.
+   */
+  enum : size_t {OMP_MAX_SIZE = 512};
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -265,6 +265,29 @@ public:
  */
 class CAvgGrad_Flow final : public CAvgGrad_Base {
 public:
+  /*!
+   * \brief Data of a pack of edges in structure-of-arrays layout (one lane per edge), for SIMD.
+   * \note All the lanes must hold valid data, the unused lanes of a partial pack can repeat an edge.
+   */
+  struct EdgePack {
+    enum : unsigned long {SIZE = 8};  /*!< \brief Number of edges (lanes) of a pack. */
+
+    su2double Normal[MAXNDIM][SIZE];           /*!< \brief Normal of the face of the edge. */
+    su2double Area[SIZE];                      /*!< \brief Area of the face (norm of the normal). */
+    su2double EdgeVector[MAXNDIM][SIZE];       /*!< \brief Vector from point i to point j. */
+    su2double Dist2[SIZE];                     /*!< \brief Squared length of the edge. */
+    su2double PrimVar_i[MAXNDIM+3][SIZE];      /*!< \brief Temperature, velocity, pressure and density at point i. */
+    su2double PrimVar_j[MAXNDIM+3][SIZE];      /*!< \brief Temperature, velocity, pressure and density at point j. */
+    su2double LamVisc_i[SIZE], LamVisc_j[SIZE];    /*!< \brief Laminar viscosity at points i and j. */
+    su2double EddyVisc_i[SIZE], EddyVisc_j[SIZE];  /*!< \brief Eddy viscosity at points i and j. */
+    su2double Grad_i[MAXNDIM+1][MAXNDIM][SIZE];    /*!< \brief Gradient of temperature and velocity at point i. */
+    su2double Grad_j[MAXNDIM+1][MAXNDIM][SIZE];    /*!< \brief Gradient of temperature and velocity at point j. */
+
+    su2double Flux[MAXNDIM+2][SIZE];                     /*!< \brief Projected viscous flux (output). */
+    su2double Jacobian_i[MAXNDIM+2][MAXNDIM+2][SIZE];    /*!< \brief Jacobian w.r.t. point i (output, implicit). */
+    su2double Jacobian_j[MAXNDIM+2][MAXNDIM+2][SIZE];    /*!< \brief Jacobian w.r.t. point j (output, implicit). */
+  };
+
   /*!
    * \brief Constructor of the class.
    * \param[in] val_nDim - Number of dimension of the problem.
@@ -282,6 +305,21 @@ public:
    */
   ResidualType<> ComputeResidual(const CConfig* config) override;
 
+  /*!
+   * \brief Whether the residual of packs of edges supports the options of the problem.
+   * \note The UQ perturbation, QCR and wall functions are only in the edge-wise version,
+   *       which is also kept for the discrete adjoint (preaccumulation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool SupportsEdgePack(const CConfig* config) const;
+
+  /*!
+   * \brief Compute the viscous flow residual of a pack of edges, same result as the edge-wise version.
+   * \param[in,out] pack - Data of the edges, and projected fluxes and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual(EdgePack& pack, const CConfig* config);
+
   /*!
    * \brief Compute the heat flux due to molecular and turbulent diffusivity
    * \param[in] val_gradprimvar - Gradient of the primitive variables.
@@ -31,8 +31,35 @@
 #include "../CNumerics.hpp"
 
 /*!
- * \class CSourcePieceWise_TurbSA
- * \brief Class for integrating the source terms of the Spalart-Allmaras turbulence model equation.
+ * \brief Data of a pack of points in structure-of-arrays layout (one lane per point), for SIMD
+ *        evaluation of the source terms of the turbulence models.
+ * \note All the lanes must hold valid data, the unused lanes of a partial pack can repeat a point.
+ */
+struct TurbSourcePack {
+  enum : unsigned long {SIZE = 8};     /*!< \brief Number of points (lanes) of a pack. */
+  enum : unsigned long {MAXNDIM = 3};  /*!< \brief Max number of space dimensions. */
+
+  su2double Density[SIZE];                    /*!< \brief Density. */
+  su2double Pressure[SIZE];                   /*!< \brief Pressure. */
+  su2double LamVisc[SIZE];                    /*!< \brief Laminar viscosity. */
+  su2double EddyVisc[SIZE];                   /*!< \brief Eddy viscosity. */
+  su2double Vorticity[3][SIZE];               /*!< \brief Vorticity (always 3 components). */
+  su2double StrainMag[SIZE];                  /*!< \brief Magnitude of the strain rate. */
+  su2double VelocityGrad[MAXNDIM][MAXNDIM][SIZE]; /*!< \brief Velocity gradient, [iDim][jDim] = d(u_iDim)/d(x_jDim). */
+  su2double TurbVar[2][SIZE];                 /*!< \brief Turbulence variables. */
+  su2double TurbVarGrad[MAXNDIM][SIZE];       /*!< \brief Gradient of the first turbulence variable. */
+  su2double F1[SIZE], F2[SIZE];               /*!< \brief Blending functions (SST). */
+  su2double CrossDiff[SIZE];                  /*!< \brief Cross diffusion (SST). */
+  su2double Distance[SIZE];                   /*!< \brief Wall distance (or DES length scale). */
+  su2double Volume[SIZE];                     /*!< \brief Volume of the dual cell. */
+
+  su2double Residual[2][SIZE];                /*!< \brief Source residual (output). */
+  su2double Jacobian[2][2][SIZE];             /*!< \brief Jacobian of the source residual (output). */
+};
+
+/*!
+ * \class CSourceBase_TurbSA
+ * \brief Base class for integrating the source terms of the Spalart-Allmaras turbulence model equation.
  * \ingroup SourceDiscr
  * \author A. Bueno.
  */
@@ -114,128 +141,75 @@ public:
    * \brief  ______________.
    */
   inline su2double GetCrossProduction(void) const final { return CrossProduction; }
-};
-
 
-/*!
- * \class CSourcePieceWise_TurbSA
- * \brief Class for integrating the source terms of the Spalart-Allmaras turbulence model equation.
- * \ingroup SourceDiscr
- * \author A. Bueno.
- */
-class CSourcePieceWise_TurbSA final : public CSourceBase_TurbSA {
-private:
-  su2double nu, Ji, fv1, fv2, ft2, Omega, S, Shat, inv_Shat, dist_i_2, Ji_2, Ji_3, inv_k2_d2;
-  su2double r, g, g_6, glim, fw;
-  su2double norm2_Grad;
-  su2double dfv1, dfv2, dShat;
-  su2double dr, dg, dfw;
-  unsigned short iDim;
-  bool transition;
+  using CNumerics::ComputeResidual;
 
-public:
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
+   * \brief Whether the residual of packs of points supports the options of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  CSourcePieceWise_TurbSA(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+  virtual bool SupportsPointPack(const CConfig* config) const = 0;
 
   /*!
-   * \brief Residual for source term integration.
+   * \brief Compute the source residual of a pack of points, same result as the point-wise version.
+   * \param[in,out] pack - Data of the points, and residuals and Jacobians (first variable).
    * \param[in] config - Definition of the particular problem.
-   * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
    */
-  ResidualType<> ComputeResidual(const CConfig* config) override;
-
+  virtual void ComputeResidual(TurbSourcePack& pack, const CConfig* config) = 0;
 };
 
+
 /*!
- * \class CSourcePieceWise_TurbSA_COMP
- * \brief Class for integrating the source terms of the Spalart-Allmaras CC modification turbulence model equation.
+ * \class CSourcePieceWise_TurbSA_T
+ * \brief Class for integrating the source terms of the Spalart-Allmaras turbulence model equation,
+ *        the variants of the model are compile-time options (see the aliases below).
+ * \tparam Edwards - Edwards modification, the vorticity is replaced by the strain rate.
+ * \tparam CompCorrection - Compressibility correction.
+ * \tparam Negative - Negative SA model.
  * \ingroup SourceDiscr
- * \author E.Molina, A. Bueno.
- * \version 7.0.5 "Blackbird"
+ * \author A. Bueno, E. Molina, F. Palacios.
  */
-class CSourcePieceWise_TurbSA_COMP final : public CSourceBase_TurbSA {
+template<bool Edwards, bool CompCorrection, bool Negative>
+class CSourcePieceWise_TurbSA_T final : public CSourceBase_TurbSA {
 private:
-  su2double nu, Ji, fv1, fv2, ft2, Omega, S, Shat, inv_Shat, dist_i_2, Ji_2, Ji_3, inv_k2_d2;
-  su2double r, g, g_6, glim, fw;
-  su2double norm2_Grad;
-  su2double dfv1, dfv2, dShat;
-  su2double dr, dg, dfw;
-  su2double aux_cc, CompCorrection, c5;
-  unsigned short iDim, jDim;
+  const bool transition;    /*!< \brief BC transition model (only with the original SA model). */
+  const su2double c5 = 3.5; /*!< \brief Constant of the compressibility correction. */
+  su2double tu = 0.0, rey = 0.0; /*!< \brief Free-stream turbulence intensity and Reynolds number (BC transition). */
 
-public:
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
-   * \param[in] config - Definition of the particular problem.
+   * \brief Source terms at one point.
    */
-  CSourcePieceWise_TurbSA_COMP(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+  struct PointTerms {
+    su2double Residual = 0.0, Jacobian = 0.0;
+    su2double Production = 0.0, Destruction = 0.0, CrossProduction = 0.0, GammaBC = 0.0;
+  };
 
   /*!
-   * \brief Residual for source term integration.
-   * \param[in] config - Definition of the particular problem.
-   * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
+   * \brief Strain rate used by the Edwards modification.
+   * \param[in] gradVel - Accessor of the velocity gradient, gradVel(iDim,jDim) = d(u_iDim)/d(x_jDim).
    */
-  ResidualType<> ComputeResidual(const CConfig* config) override;
-
-};
+  template<class VelocityGradient>
+  inline su2double StrainRate(const VelocityGradient& gradVel) const;
 
-/*!
- * \class CSourcePieceWise_TurbSA_E
- * \brief Class for integrating the source terms of the Spalart-Allmaras Edwards modification turbulence model equation.
- * \ingroup SourceDiscr
- * \author E.Molina, A. Bueno.
- * \version 7.0.5 "Blackbird"
- */
-class CSourcePieceWise_TurbSA_E final : public CSourceBase_TurbSA {
-private:
-  su2double nu, Ji, fv1, fv2, ft2, Omega, S, Shat, inv_Shat, dist_i_2, Ji_2, Ji_3, inv_k2_d2;
-  su2double r, g, g_6, glim, fw;
-  su2double norm2_Grad;
-  su2double dfv1, dfv2, dShat;
-  su2double dr, dg, dfw;
-  su2double Sbar;
-
-public:
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
-   * \param[in] config - Definition of the particular problem.
+   * \brief Square of the Frobenius norm of the velocity gradient, used by the compressibility correction.
+   * \param[in] gradVel - Accessor of the velocity gradient.
    */
-  CSourcePieceWise_TurbSA_E(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+  template<class VelocityGradient>
+  inline su2double VelocityGradientNorm2(const VelocityGradient& gradVel) const;
 
   /*!
-   * \brief Residual for source term integration.
-   * \param[in] config - Definition of the particular problem.
-   * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
+   * \brief Source terms and their Jacobian at a point, shared by the point-wise and pack versions.
+   * \param[in] density, lamVisc, nuTilde - Density, laminar viscosity, and SA variable.
+   * \param[in] omega - Vorticity magnitude (or strain rate), with the rotational correction.
+   * \param[in] norm2_Grad - Square of the norm of the gradient of the SA variable.
+   * \param[in] auxCC, soundSpeed - Velocity gradient norm and speed of sound (compressibility correction).
+   * \param[in] vmag - Velocity magnitude (BC transition).
+   * \param[in] dist, volume - Wall distance, and volume of the dual cell.
    */
-  ResidualType<> ComputeResidual(const CConfig* config) override;
-};
-
-/*!
- * \class CSourcePieceWise_TurbSA_E_COMP
- * \brief Class for integrating the source terms of the Spalart-Allmaras Edwards modification with CC turbulence model equation.
- * \ingroup SourceDiscr
- * \author E.Molina, A. Bueno.
- * \version 7.0.5 "Blackbird"
- */
-class CSourcePieceWise_TurbSA_E_COMP : public CSourceBase_TurbSA {
-private:
-  su2double nu, Ji, fv1, fv2, ft2, Omega, S, Shat, inv_Shat, dist_i_2, Ji_2, Ji_3, inv_k2_d2;
-  su2double r, g, g_6, glim, fw;
-  su2double norm2_Grad;
-  su2double dfv1, dfv2, dShat;
-  su2double dr, dg, dfw;
-  su2double Sbar;
-  su2double aux_cc, CompCorrection, c5;
-  unsigned short jDim;
+  inline PointTerms ComputePoint(su2double density, su2double lamVisc, su2double nuTilde, su2double omega,
+                                 su2double norm2_Grad, su2double auxCC, su2double soundSpeed,
+                                 su2double vmag, su2double dist, su2double volume) const;
 
 public:
   /*!
@@ -244,7 +218,7 @@ public:
    * \param[in] val_nVar - Number of variables of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  CSourcePieceWise_TurbSA_E_COMP(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+  CSourcePieceWise_TurbSA_T(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
 
   /*!
    * \brief Residual for source term integration.
@@ -252,40 +226,31 @@ public:
    * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
    */
   ResidualType<> ComputeResidual(const CConfig* config) override;
-};
-
-/*!
- * \class CSourcePieceWise_TurbSA_Neg
- * \brief Class for integrating the source terms of the Spalart-Allmaras turbulence model equation.
- * \ingroup SourceDiscr
- * \author F. Palacios
- */
-class CSourcePieceWise_TurbSA_Neg : public CSourceBase_TurbSA {
-private:
-  su2double nu, Ji, fv1, fv2, ft2, Omega, S, Shat, inv_Shat, dist_i_2, Ji_2, Ji_3, inv_k2_d2;
-  su2double r, g, g_6, glim, fw;
-  su2double norm2_Grad;
-  su2double dfv1, dfv2, dShat;
-  su2double dr, dg, dfw;
 
-public:
   /*!
-   * \brief Constructor of the class.
-   * \param[in] val_nDim - Number of dimensions of the problem.
-   * \param[in] val_nVar - Number of variables of the problem.
+   * \brief Whether the residual of packs of points supports the options of the problem.
+   * \note The BC transition model is only in the point-wise version, which is also kept for the discrete adjoint.
    * \param[in] config - Definition of the particular problem.
    */
-  CSourcePieceWise_TurbSA_Neg(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config);
+  bool SupportsPointPack(const CConfig* config) const override;
 
   /*!
-   * \brief Residual for source term integration.
+   * \brief Compute the source residual of a pack of points, same result as the point-wise version.
+   * \param[in,out] pack - Data of the points, and residuals and Jacobians (first variable).
    * \param[in] config - Definition of the particular problem.
-   * \return A lightweight const-view (read-only) of the residual/flux and Jacobians.
    */
-  ResidualType<> ComputeResidual(const CConfig* config) override;
+  void ComputeResidual(TurbSourcePack& pack, const CConfig* config) override;
 
 };
 
+/*--- Original model, and the compressibility correction (COMP), Edwards (E), and negative (Neg) variants. ---*/
+
+using CSourcePieceWise_TurbSA = CSourcePieceWise_TurbSA_T<false, false, false>;
+using CSourcePieceWise_TurbSA_COMP = CSourcePieceWise_TurbSA_T<false, true, false>;
+using CSourcePieceWise_TurbSA_E = CSourcePieceWise_TurbSA_T<true, false, false>;
+using CSourcePieceWise_TurbSA_E_COMP = CSourcePieceWise_TurbSA_T<true, true, false>;
+using CSourcePieceWise_TurbSA_Neg = CSourcePieceWise_TurbSA_T<false, false, true>;
+
 /*!
  * \class CSourcePieceWise_TurbSST
  * \brief Class for integrating the source terms of the Menter SST turbulence model equations.
@@ -343,6 +308,27 @@ private:
    */
   void GetMeanRateOfStrainMatrix(su2double **S_ij);
 
+  /*!
+   * \brief Source terms at one point.
+   */
+  struct PointTerms {
+    su2double Residual[2] = {0.0}, Jacobian[2][2] = {{0.0}};
+  };
+
+  /*!
+   * \brief Source terms and their Jacobian at a point, shared by the point-wise and pack versions.
+   * \param[in] density, eddyVisc - Density and eddy viscosity.
+   * \param[in] strainMag - Magnitude of the strain rate (perturbed if using UQ).
+   * \param[in] vorticityMag - Magnitude of the vorticity.
+   * \param[in] diverg - Divergence of the velocity.
+   * \param[in] kine, omega - Turbulence variables.
+   * \param[in] F1, F2, CDkw - Blending functions and cross diffusion.
+   * \param[in] dist, volume - Wall distance, and volume of the dual cell.
+   */
+  inline PointTerms ComputePoint(su2double density, su2double eddyVisc, su2double strainMag,
+                                 su2double vorticityMag, su2double diverg, su2double kine, su2double omega,
+                                 su2double F1, su2double F2, su2double CDkw, su2double dist, su2double volume) const;
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -390,4 +376,19 @@ public:
    */
   ResidualType<> ComputeResidual(const CConfig* config) override;
 
+  /*!
+   * \brief Whether the residual of packs of points supports the options of the problem.
+   * \note The UQ perturbation is only in the point-wise version, which is also kept for the
+   *       discrete adjoint (preaccumulation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool SupportsPointPack(const CConfig* config) const;
+
+  /*!
+   * \brief Compute the source residual of a pack of points, same result as the point-wise version.
+   * \param[in,out] pack - Data of the points, and residuals and Jacobians.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual(TurbSourcePack& pack, const CConfig* config);
+
 };
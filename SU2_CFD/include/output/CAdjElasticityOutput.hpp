@@ -36,6 +36,18 @@
  */
 class CAdjElasticityOutput final : public COutput {
 private:
+
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adjoint_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short adjoint_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short adjoint_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_z = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
   unsigned short nVar_FEM; //!< Number of FEM variables
 
 public:
@@ -37,6 +37,34 @@
 class CAdjFlowIncOutput final: public COutput {
 private:
 
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_pressure = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_velocity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_velocity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_velocity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_p1_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_pressure = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_velocity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_velocity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_velocity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_p1_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
   unsigned short turb_model; /*!< \brief The kind of turbulence model*/
   unsigned short rad_model;  /*!< \brief The kind of radiation model */
   bool heat;                 /*!< \brief Boolean indicating whether have a heat problem*/
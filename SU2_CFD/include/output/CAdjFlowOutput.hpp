@@ -37,6 +37,32 @@
 class CAdjFlowCompOutput final: public COutput {
 private:
 
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_density = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_density = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
   bool cont_adj;             /*!< \brief Boolean indicating whether we run a cont. adjoint problem */
   unsigned short turb_model; /*!< \brief The kind of turbulence model*/
 
@@ -35,6 +35,20 @@
  *  \date June 5, 2018.
  */
 class CAdjHeatOutput final: public COutput {
+private:
+
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short adj_temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_adj_temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short sensitivity = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
 public:
 
   /*!
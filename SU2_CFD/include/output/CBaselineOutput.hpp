@@ -37,6 +37,7 @@
 class CBaselineOutput : public COutput {
 
   std::vector<string> fields;
+  std::vector<unsigned short> fieldHandles;  /*!< \brief Handles of the fields, returned by AddVolumeOutput. */
 public:
 
   /*!
@@ -37,6 +37,28 @@
 class CElasticityOutput final: public COutput {
 protected:
 
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short displacement_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short displacement_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short displacement_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short velocity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short velocity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short velocity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short acceleration_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short acceleration_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short acceleration_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_xx = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_yy = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_xy = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_zz = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_xz = CFieldIndexTable::NOT_FOUND;
+    unsigned short stress_yz = CFieldIndexTable::NOT_FOUND;
+    unsigned short von_mises_stress = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
   unsigned short nVar_FEM; //!< Number of FEM variables
   bool linear_analysis,    //!< Boolean indicating a linear analysis
        nonlinear_analysis, //!< Boolean indicating a nonlinear analysis
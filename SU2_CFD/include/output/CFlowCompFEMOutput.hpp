@@ -39,6 +39,23 @@ class CVariable;
 class CFlowCompFEMOutput final: public CFlowOutput {
 private:
 
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short density = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short pressure = CFieldIndexTable::NOT_FOUND;
+    unsigned short temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short mach = CFieldIndexTable::NOT_FOUND;
+    unsigned short pressure_coeff = CFieldIndexTable::NOT_FOUND;
+    unsigned short laminar_viscosity = CFieldIndexTable::NOT_FOUND;
+    unsigned short eddy_viscosity = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
   unsigned short turb_model; //!< Kind of turbulence model
 
 public:
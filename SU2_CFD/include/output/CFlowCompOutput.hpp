@@ -39,6 +39,59 @@ class CVariable;
 class CFlowCompOutput final: public CFlowOutput {
 private:
 
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short density = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short grid_velocity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short grid_velocity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short grid_velocity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short pressure = CFieldIndexTable::NOT_FOUND;
+    unsigned short temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short mach = CFieldIndexTable::NOT_FOUND;
+    unsigned short pressure_coeff = CFieldIndexTable::NOT_FOUND;
+    unsigned short laminar_viscosity = CFieldIndexTable::NOT_FOUND;
+    unsigned short skin_friction_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short skin_friction_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short skin_friction_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short heat_flux = CFieldIndexTable::NOT_FOUND;
+    unsigned short y_plus = CFieldIndexTable::NOT_FOUND;
+    unsigned short eddy_viscosity = CFieldIndexTable::NOT_FOUND;
+    unsigned short intermittency = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_density = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_density = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_momentum_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_momentum_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_momentum_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_energy = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_tke = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short limiter_nu_tilde = CFieldIndexTable::NOT_FOUND;
+    unsigned short des_lengthscale = CFieldIndexTable::NOT_FOUND;
+    unsigned short wall_distance = CFieldIndexTable::NOT_FOUND;
+    unsigned short roe_dissipation = CFieldIndexTable::NOT_FOUND;
+    unsigned short vorticity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short vorticity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short vorticity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short vorticity = CFieldIndexTable::NOT_FOUND;
+    unsigned short q_criterion = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
   unsigned short turb_model; //!< Kind of turbulence model
   unsigned long lastInnerIter;
 
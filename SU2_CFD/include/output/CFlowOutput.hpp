@@ -31,6 +31,30 @@
 #include "../variables/CVariable.hpp"
 
 class CFlowOutput : public COutput{
+private:
+
+  struct {
+    unsigned short mean_density = CFieldIndexTable::NOT_FOUND;
+    unsigned short mean_velocity_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short mean_velocity_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short mean_velocity_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short mean_pressure = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_u = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_v = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_uv = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_p = CFieldIndexTable::NOT_FOUND;
+    unsigned short uuprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short vvprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short uvprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short pprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_w = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_uw = CFieldIndexTable::NOT_FOUND;
+    unsigned short rms_vw = CFieldIndexTable::NOT_FOUND;
+    unsigned short wwprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short uwprime = CFieldIndexTable::NOT_FOUND;
+    unsigned short vwprime = CFieldIndexTable::NOT_FOUND;
+  } timeAvgField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
 public:
   /*!
    * \brief Constructor of the class
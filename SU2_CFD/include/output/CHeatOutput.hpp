@@ -36,6 +36,17 @@
  *  \date June 5, 2018.
  */
 class CHeatOutput final: public COutput {
+private:
+
+  struct {
+    unsigned short coord_x = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_y = CFieldIndexTable::NOT_FOUND;
+    unsigned short coord_z = CFieldIndexTable::NOT_FOUND;
+    unsigned short temperature = CFieldIndexTable::NOT_FOUND;
+    unsigned short heat_flux = CFieldIndexTable::NOT_FOUND;
+    unsigned short res_temperature = CFieldIndexTable::NOT_FOUND;
+  } volumeField;  /*!< \brief Handles of the volume fields set by the Load functions, returned by AddVolumeOutput. */
+
 public:
 
   /*!
@@ -38,12 +38,15 @@
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
+#include "tools/CFieldIndexTable.hpp"
 #include "../../../Common/include/option_structure.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+class CInSituReductions;
 class CConfig;
 
 using namespace std;
@@ -58,6 +61,8 @@ protected:
 
   /*----------------------------- General ----------------------------*/
 
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for the loops over points. */
+
   int rank,     /*!< \brief MPI Rank. */
   size;         /*!< \brief MPI Size. */
 
@@ -133,6 +138,14 @@ protected:
   std::map<string, vector<HistoryOutputField> > historyOutputPerSurface_Map;
   /*! \brief Vector that contains the keys of the ::historyOutputPerSurface_Map in the order of their insertion. */
   std::vector<string>                           historyOutputPerSurface_List;
+  /*! \brief Fields of the ::historyOutput_Map indexed by their handle. */
+  std::vector<std::map<string, HistoryOutputField>::iterator>         historyOutput_Handles;
+  /*! \brief Fields of the ::historyOutputPerSurface_Map indexed by their handle. */
+  std::vector<std::map<string, vector<HistoryOutputField> >::iterator> historyOutputPerSurface_Handles;
+  /*! \brief Table from the keys of the history field names to their handles. */
+  CFieldIndexTable historyOutput_Table;
+  /*! \brief Table from the keys of the history per surface field names to their handles. */
+  CFieldIndexTable historyOutputPerSurface_Table;
 
   /*! \brief Requested history field names in the config file. */
   std::vector<string> requestedHistoryFields;
@@ -161,6 +174,9 @@ protected:
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
    CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+   vector<string> inSituFields;              //!< Volume fields reduced in-situ (empty if none)
+   CInSituReductions* inSituReductions;      //!< In-situ reductions (statistics, probes, slices)
+
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
 
@@ -194,16 +210,10 @@ protected:
   /*! \brief Vector that contains the keys of the ::volumeOutput_Map in the order of their insertion. */
   std::vector<string>                           volumeOutput_List;
 
-  /*! \brief Vector to cache the positions of the field in the data array */
-  std::vector<short>                            fieldIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                cachePosition;
-  /*! \brief Boolean to store whether the field index cache should be build. */
-  bool                                          buildFieldIndexCache;
-  /*! \brief Vector to cache the positions of the field in the data array */
-  std::vector<short>                            fieldGetIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                curGetFieldIndex;
+  /*! \brief Fields of the ::volumeOutput_Map indexed by their handle. */
+  std::vector<std::map<string, VolumeOutputField>::iterator> volumeOutput_Handles;
+  /*! \brief Table from the keys of the volume field names to their handles. */
+  CFieldIndexTable volumeOutput_Table;
 
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
@@ -368,12 +378,33 @@ public:
    * \param[in] field - Name of the field
    * \return Value of the field
    */
-  su2double GetHistoryFieldValue(string field){
-    return historyOutput_Map.at(field).value;
+  template<size_t N>
+  su2double GetHistoryFieldValue(const char (&field)[N]) const {
+    return GetHistoryFieldValue(FindField(historyOutput_Table, historyOutput_Handles, CFieldIndexTable::GetKey(field), field));
+  }
+  su2double GetHistoryFieldValue(const string& field) const {
+    return GetHistoryFieldValue(FindField(historyOutput_Table, historyOutput_Handles, CFieldIndexTable::GetKey(field), field.c_str()));
+  }
+
+  /*!
+   * \brief Get the value of particular history output field
+   * \param[in] handle - Handle of the field, as returned by AddHistoryOutput.
+   * \return Value of the field
+   */
+  su2double GetHistoryFieldValue(unsigned short handle) const {
+    return historyOutput_Handles[handle]->second.value;
   }
 
-  su2double GetHistoryFieldValuePerSurface(string field, unsigned short iMarker){
-    return historyOutputPerSurface_Map.at(field)[iMarker].value;
+  /*!
+   * \brief Get the value of particular history output field for a specific surface marker
+   * \param[in] field - Name of the field
+   * \param[in] iMarker - The index of the marker.
+   * \return Value of the field
+   */
+  su2double GetHistoryFieldValuePerSurface(const string& field, unsigned short iMarker) const {
+    const auto handle = FindField(historyOutputPerSurface_Table, historyOutputPerSurface_Handles,
+                                  CFieldIndexTable::GetKey(field), field.c_str());
+    return historyOutputPerSurface_Handles[handle]->second[iMarker].value;
   }
 
   /*!
@@ -507,6 +538,48 @@ protected:
    */
   void SetScreen_Output(CConfig *config);
 
+  /*!
+   * \brief Register a field of an output map in the table of handles.
+   * \param[in] it - Position of the field in the map.
+   * \param[in,out] table - Table from the keys of the names to the handles.
+   * \param[in,out] handles - Fields indexed by their handle.
+   * \return Handle of the field, fields that are added again keep their handle.
+   */
+  template<class Iterator>
+  static unsigned short RegisterField(Iterator it, CFieldIndexTable& table, vector<Iterator>& handles){
+    if (handles.size() >= CFieldIndexTable::NOT_FOUND){
+      SU2_MPI::Error("Too many output fields.", CURRENT_FUNCTION);
+    }
+    const unsigned short newHandle = handles.size();
+    const unsigned short handle = table.Insert(CFieldIndexTable::GetKey(it->first), newHandle);
+    if (handle == newHandle){
+      handles.push_back(it);
+    } else if (handles[handle] != it){
+      SU2_MPI::Error(string("Output fields ") + it->first + string(" and ") + handles[handle]->first +
+                     string(" have the same key, rename one of them."), CURRENT_FUNCTION);
+    }
+    return handle;
+  }
+
+  /*!
+   * \brief Find the handle of an output field from the key of its name.
+   * \note Keys are unique among the registered fields, names are not compared.
+   * \param[in] table - Table from the keys of the names to the handles.
+   * \param[in] handles - Fields indexed by their handle.
+   * \param[in] key - Key of the name.
+   * \param[in] name - Name of the field (for the error message).
+   * \return Handle of the field.
+   */
+  template<class Iterator>
+  static unsigned short FindField(const CFieldIndexTable& table, const vector<Iterator>& handles,
+                                  CFieldIndexTable::Key key, const char* name){
+    const unsigned short handle = table.Find(key);
+    if (handle == CFieldIndexTable::NOT_FOUND){
+      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
+    }
+    return handle;
+  }
+
   /*!
    * \brief Add a new field to the history output.
    * \param[in] name - Name for referencing it (in the config file and in the code).
@@ -515,25 +588,37 @@ protected:
    * \param[in] groupname - The name of the group this field belongs to.
    * \param[in] description - A description of the field.
    * \param[in] field_type - The type of the field (::HistoryFieldType).
+   * \return Handle of the field, to set its value without looking up the name.
    */
-  inline void AddHistoryOutput(string name, string field_name, ScreenOutputFormat format,
-                               string groupname, string description,
-                               HistoryFieldType field_type = HistoryFieldType::DEFAULT ){
+  inline unsigned short AddHistoryOutput(string name, string field_name, ScreenOutputFormat format,
+                                         string groupname, string description,
+                                         HistoryFieldType field_type = HistoryFieldType::DEFAULT ){
     historyOutput_Map[name] = HistoryOutputField(field_name, format, groupname, field_type, description);
     historyOutput_List.push_back(name);
+    return RegisterField(historyOutput_Map.find(name), historyOutput_Table, historyOutput_Handles);
   }
 
   /*!
    * \brief Set the value of a history output field
+   * \param[in] handle - Handle of the field, as returned by AddHistoryOutput.
+   * \param[in] value - The new value of this field.
+   */
+  inline void SetHistoryOutputValue(unsigned short handle, su2double value){
+    historyOutput_Handles[handle]->second.value = value;
+  }
+
+  /*!
+   * \brief Set the value of a history output field
+   * \note For literals the key of the name is a constant expression, no string is constructed.
    * \param[in] name - Name of the field.
    * \param[in] value - The new value of this field.
    */
-  inline void SetHistoryOutputValue(string name, su2double value){
-    if (historyOutput_Map.count(name) > 0){
-      historyOutput_Map[name].value = value;
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
+  template<size_t N>
+  inline void SetHistoryOutputValue(const char (&name)[N], su2double value){
+    SetHistoryOutputValue(FindField(historyOutput_Table, historyOutput_Handles, CFieldIndexTable::GetKey(name), name), value);
+  }
+  inline void SetHistoryOutputValue(const string& name, su2double value){
+    SetHistoryOutputValue(FindField(historyOutput_Table, historyOutput_Handles, CFieldIndexTable::GetKey(name), name.c_str()), value);
   }
 
   /*!
@@ -544,16 +629,30 @@ protected:
    * \param[in] groupname - The name of the group this field belongs to.
    * \param[in] marker_names - A list of markers. For every marker in this list a new field is created with "field_name + _marker_names[i]".
    * \param[in] field_type - The type of the field (::HistoryFieldType).
+   * \return Handle of the field, or CFieldIndexTable::NOT_FOUND if there are no markers.
    */
-  inline void AddHistoryOutputPerSurface(string name, string field_name, ScreenOutputFormat format,
-                                         string groupname, vector<string> marker_names,
-                                         HistoryFieldType field_type = HistoryFieldType::DEFAULT){
+  inline unsigned short AddHistoryOutputPerSurface(string name, string field_name, ScreenOutputFormat format,
+                                                   string groupname, vector<string> marker_names,
+                                                   HistoryFieldType field_type = HistoryFieldType::DEFAULT){
     if (marker_names.size() != 0){
       historyOutputPerSurface_List.push_back(name);
       for (unsigned short i = 0; i < marker_names.size(); i++){
         historyOutputPerSurface_Map[name].push_back(HistoryOutputField(field_name+"("+marker_names[i]+")", format, groupname, field_type, ""));
       }
+      return RegisterField(historyOutputPerSurface_Map.find(name), historyOutputPerSurface_Table,
+                           historyOutputPerSurface_Handles);
     }
+    return CFieldIndexTable::NOT_FOUND;
+  }
+
+  /*!
+   * \brief Set the value of a history output field for a specific surface marker
+   * \param[in] handle - Handle of the field, as returned by AddHistoryOutputPerSurface.
+   * \param[in] value - The new value of this field.
+   * \param[in] iMarker - The index of the marker.
+   */
+  inline void SetHistoryOutputPerSurfaceValue(unsigned short handle, su2double value, unsigned short iMarker){
+    historyOutputPerSurface_Handles[handle]->second[iMarker].value = value;
   }
 
   /*!
@@ -562,12 +661,14 @@ protected:
    * \param[in] value - The new value of this field.
    * \param[in] iMarker - The index of the marker.
    */
-  inline void SetHistoryOutputPerSurfaceValue(string name, su2double value, unsigned short iMarker){
-    if (historyOutputPerSurface_Map.count(name) > 0){
-      historyOutputPerSurface_Map[name][iMarker].value = value;
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
+  template<size_t N>
+  inline void SetHistoryOutputPerSurfaceValue(const char (&name)[N], su2double value, unsigned short iMarker){
+    SetHistoryOutputPerSurfaceValue(FindField(historyOutputPerSurface_Table, historyOutputPerSurface_Handles,
+                                              CFieldIndexTable::GetKey(name), name), value, iMarker);
+  }
+  inline void SetHistoryOutputPerSurfaceValue(const string& name, su2double value, unsigned short iMarker){
+    SetHistoryOutputPerSurfaceValue(FindField(historyOutputPerSurface_Table, historyOutputPerSurface_Handles,
+                                              CFieldIndexTable::GetKey(name), name.c_str()), value, iMarker);
   }
 
   /*!
@@ -576,33 +677,84 @@ protected:
    * \param[in] field_name - Header that is printed in the output files.
    * \param[in] groupname - The name of the group this field belongs to.
    * \param[in] description - Description of the volume field.
+   * \return Handle of the field, to access its values without looking up the name.
    */
-  inline void AddVolumeOutput(string name, string field_name, string groupname, string description){
+  inline unsigned short AddVolumeOutput(string name, string field_name, string groupname, string description){
     volumeOutput_Map[name] = VolumeOutputField(field_name, -1, groupname, description);
     volumeOutput_List.push_back(name);
+    return RegisterField(volumeOutput_Map.find(name), volumeOutput_Table, volumeOutput_Handles);
   }
 
-
   /*!
-   * \brief Set the value of a volume output field
+   * \brief Find the handle of a volume output field.
+   * \param[in] key - Key of the name of the field.
    * \param[in] name - Name of the field.
-   * \param[in] value - The new value of this field.
+   * \return Handle of the field.
+   */
+  inline unsigned short FindVolumeField(CFieldIndexTable::Key key, const char* name) const {
+    return FindField(volumeOutput_Table, volumeOutput_Handles, key, name);
+  }
+
+  /*!
+   * \brief Check that a handle refers to a registered volume field, e.g. that the handle
+   *        kept by an output class was returned by AddVolumeOutput.
+   * \param[in] handle - Handle of the field.
+   */
+  inline void CheckVolumeHandle(unsigned short handle) const {
+    if (handle >= volumeOutput_Handles.size()){
+      SU2_MPI::Error("Volume output field was not registered with AddVolumeOutput.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*!
+   * \brief Get the value of a volume output field
+   * \note The volume fields are accessed by name or by handle, both are thread-safe. Names are hashed
+   *       on each access, the per-point Load functions use the handles kept by the output classes.
+   * \param[in] handle - Handle of the field, as returned by AddVolumeOutput.
+   * \param[in] iPoint - Index of the point.
+   * \return Value of the field, 0 if the field is not part of the output.
    */
-  su2double GetVolumeOutputValue(string name, unsigned long iPoint);
+  su2double GetVolumeOutputValue(unsigned short handle, unsigned long iPoint) const;
+
+  template<size_t N>
+  inline su2double GetVolumeOutputValue(const char (&name)[N], unsigned long iPoint) const {
+    return GetVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name), iPoint);
+  }
+  inline su2double GetVolumeOutputValue(const string& name, unsigned long iPoint) const {
+    return GetVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name.c_str()), iPoint);
+  }
 
   /*!
    * \brief Set the value of a volume output field
-   * \param[in] name - Name of the field.
+   * \param[in] handle - Handle of the field, as returned by AddVolumeOutput.
+   * \param[in] iPoint - Index of the point.
    * \param[in] value - The new value of this field.
    */
-  void SetVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetVolumeOutputValue(unsigned short handle, unsigned long iPoint, su2double value);
+
+  template<size_t N>
+  inline void SetVolumeOutputValue(const char (&name)[N], unsigned long iPoint, su2double value){
+    SetVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name), iPoint, value);
+  }
+  inline void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
+    SetVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name.c_str()), iPoint, value);
+  }
 
   /*!
-   * \brief Set the value of a volume output field
-   * \param[in] name - Name of the field.
+   * \brief Add a value to the running average of a volume output field
+   * \param[in] handle - Handle of the field, as returned by AddVolumeOutput.
+   * \param[in] iPoint - Index of the point.
    * \param[in] value - The new value of this field.
    */
-  void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetAvgVolumeOutputValue(unsigned short handle, unsigned long iPoint, su2double value);
+
+  template<size_t N>
+  inline void SetAvgVolumeOutputValue(const char (&name)[N], unsigned long iPoint, su2double value){
+    SetAvgVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name), iPoint, value);
+  }
+  inline void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value){
+    SetAvgVolumeOutputValue(FindVolumeField(CFieldIndexTable::GetKey(name), name.c_str()), iPoint, value);
+  }
 
   /*!
    * \brief CheckHistoryOutput
@@ -667,6 +819,15 @@ protected:
    */
   void AllocateDataSorters(CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Reduce the volume data of the current time iteration (statistics, probes, slices).
+   * \note The reductions are allocated on the first call.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] TimeIter - Current time iteration.
+   */
+  void UpdateInSituReductions(CConfig *config, CGeometry *geometry, unsigned long TimeIter);
+
   /*--------------------------------- Virtual functions ---------------------------------------- */
 public:
 
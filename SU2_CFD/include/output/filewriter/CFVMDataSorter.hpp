@@ -35,6 +35,7 @@ class CFVMDataSorter final: public CParallelDataSorter{
 private:
 
   int* Local_Halo; //!< Array containing the flag whether a point is a halo node
+  bool connectivityLinearPartitioned; //!< Value of val_sort used to build the current connectivity
 
 public:
 
@@ -53,6 +54,8 @@ public:
 
   /*!
    * \brief Sort the connectivities (volume and surface) into data structures used for output file writing.
+   * \note The connectivity only depends on the global point numbering, once sorted it is reused by subsequent
+   *       calls with the same val_sort (the coordinates are part of the sorted data, not of the connectivity).
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] val_sort - boolean controlling whether the elements are sorted or simply loaded by their owning rank.
@@ -94,6 +94,7 @@ protected:
   /// Pointer used to allocate the memory used for ::passiveDoubleBuffer and ::doubleBuffer.
   char *dataBuffer;
   unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
+  unsigned long *idRecv;               //!< Local sorted index of each received point, kept to reuse the sorting plan
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
@@ -125,6 +126,8 @@ public:
 
   /*!
    * \brief Sort the output data for each grid node into a linear partitioning across all processors.
+   * \note The communication pattern and the sorted position of the points are computed by the first call,
+   *       subsequent calls only communicate the data values.
    */
   virtual void SortOutputData();
 
@@ -52,6 +52,23 @@ private:
    */
   unsigned long dataOffset;
 
+  unsigned short compression;      /*!< \brief Kind of compression of the appended data (ENUM_OUTPUT_COMPRESSION). */
+  vector<string> lossyFields;      /*!< \brief Fields that are quantized before compression. */
+  passivedouble lossyTolerance;    /*!< \brief Absolute error bound of the quantized fields. */
+
+  /*!
+   * \brief A data array compressed in the VTK block format, one block per rank.
+   */
+  struct CompressedArray {
+    vector<uint64_t> header;   /*!< \brief VTK compression header, written by the master rank. */
+    vector<uint8_t> block;     /*!< \brief The compressed block of this rank. */
+    unsigned long offset;      /*!< \brief Offset of the block within the compressed array (bytes). */
+    unsigned long totalSize;   /*!< \brief Size of the compressed array over all ranks (bytes). */
+  };
+
+  vector<CompressedArray> compressedArrays; /*!< \brief Compressed arrays in the order they are written. */
+  unsigned long nArraysDefined;             /*!< \brief Number of arrays already added to the header. */
+
 public:
 
   /*!
@@ -63,8 +80,14 @@ public:
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Kind of compression of the appended data (ENUM_OUTPUT_COMPRESSION).
+   * \param[in] valLossyFields - Names of the fields that are quantized before compression.
+   * \param[in] valLossyTolerance - Absolute error bound of the quantized fields.
    */
-  CParaviewXMLFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CParaviewXMLFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                         unsigned short valCompression = NO_COMPRESSION,
+                         vector<string> valLossyFields = {},
+                         passivedouble valLossyTolerance = 0.0);
 
   /*!
    * \brief Destructor
@@ -98,6 +121,30 @@ private:
    */
   void WriteDataArray(void *data, VTKDatatype type, unsigned long size, unsigned long globalSize, unsigned long offset);
 
+  /*!
+   * \brief Load all data arrays (coordinates, connectivity, fields) and write or compress them in order.
+   * \param[in] compress - Compress the arrays with ::CompressDataArray instead of writing them.
+   */
+  void LoadDataArrays(bool compress);
+
+  /*!
+   * \brief Compress an array (LZ4) and store it until it is written with ::WriteCompressedDataArray.
+   * \note VTK requires all blocks but the last one to have the same uncompressed size, therefore the
+   *       bytes of the array are first redistributed such that each rank holds one block.
+   * \param[in] data - Pointer to the data
+   * \param[in] type - The vtk datatype
+   * \param[in] size - The total size of the array
+   * \param[in] globalSize - The global size of the array over all processors
+   * \param[in] offset - The displacement in the file view for the current processor
+   */
+  void CompressDataArray(void *data, VTKDatatype type, unsigned long size, unsigned long globalSize, unsigned long offset);
+
+  /*!
+   * \brief Write a previously compressed array to the vtu file.
+   * \param[in] array - The compressed array.
+   */
+  void WriteCompressedDataArray(const CompressedArray& array);
+
   /*!
    * \brief Get the type string and size of a VTK datatype
    * \param[in]  type - The VTK datatype
@@ -30,6 +30,11 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+private:
+
+  unsigned short compression;      /*!< \brief Kind of compression of the data section (ENUM_OUTPUT_COMPRESSION). */
+  vector<string> lossyFields;      /*!< \brief Fields that may be quantized, i.e. visualization-only fields. */
+  passivedouble lossyTolerance;    /*!< \brief Absolute error bound of the quantized fields. */
 
 public:
 
@@ -42,8 +47,14 @@ public:
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Kind of compression of the data section (ENUM_OUTPUT_COMPRESSION).
+   * \param[in] valLossyFields - Names of the fields that are quantized before compression.
+   * \param[in] valLossyTolerance - Absolute error bound of the quantized fields.
    */
-  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                       unsigned short valCompression = NO_COMPRESSION,
+                       vector<string> valLossyFields = {},
+                       passivedouble valLossyTolerance = 0.0);
 
   /*!
    * \brief Destructor
@@ -55,4 +66,13 @@ public:
    */
   void Write_Data() override;
 
+private:
+
+  /*!
+   * \brief Write the data section as one compressed block per rank, preceded by an offset table.
+   * \note Layout: nVar codec ints, (size+1) cumulative point counts and (size+1) cumulative block sizes
+   *       in bytes (unsigned long), followed by the blocks (see CompressionToolbox::CompressBlock).
+   */
+  void WriteCompressedData();
+
 };
@@ -0,0 +1,143 @@
+/*!
+ * \file CSU2SeriesFileWriter.hpp
+ * \brief Headers fo the SU2 time series file writer class.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2SeriesFileWriter
+ * \brief Appends the sorted volume data of one time step to a single SU2 binary time series file.
+ * \note Layout of the file: SERIES_HEADER_INTS ints (tag, nFields, nDim, version), the global number of points,
+ *       of elements and the size of the mixed connectivity (unsigned long), the field names (CGNS_STRING_SIZE chars
+ *       each), the XDMF "Mixed" connectivity (long, written once), followed by one block per time step made of the
+ *       iteration (unsigned long), the time (double) and the point-major data of all fields as in SU2 binary restarts.
+ *       Every write also updates an XDMF index so that the series can be opened in Paraview.
+ */
+class CSU2SeriesFileWriter final: public CFileWriter{
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Extension of the XDMF index file.
+   */
+  const static string indexExt;
+
+  /*!
+   * \brief Magic number of the series files (hex representation of "SUS").
+   */
+  static constexpr int SERIES_FORMAT_TAG = 535553;
+
+  /*!
+   * \brief Number of ints at the beginning of the file.
+   */
+  static constexpr int SERIES_HEADER_INTS = 4;
+
+  /*!
+   * \brief Size of the header of each time step block (iteration and time).
+   */
+  static constexpr unsigned long STEP_HEADER_SIZE = sizeof(unsigned long) + sizeof(passivedouble);
+
+  /*!
+   * \brief Construct a file writer using the data sorter and the current time step.
+   * \param[in] valFileName - The name of the file (without iteration number).
+   * \param[in] valDataSorter - The parallel sorted data to write, the connectivity must be sorted.
+   * \param[in] valIter - Iteration (time step) of the data.
+   * \param[in] valTime - Physical time of the data.
+   */
+  CSU2SeriesFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                       unsigned long valIter, su2double valTime);
+
+  /*!
+   * \brief Destructor
+   */
+  ~CSU2SeriesFileWriter() override;
+
+  /*!
+   * \brief Append the sorted data to the series and update the index.
+   */
+  void Write_Data() override;
+
+  /*!
+   * \brief Find the data of a time step in a series file.
+   * \note Only the master rank reads the file, the results are broadcast.
+   * \param[in] val_filename - Name of the series file (with extension).
+   * \param[in] val_iter - Iteration (time step) to look for.
+   * \param[out] nFields - Number of fields in the file.
+   * \param[out] nPoints - Global number of points in the file.
+   * \param[out] fieldNames - Names of the fields.
+   * \param[out] dataOffset - Position in bytes of the point-major data of the time step.
+   * \return <TRUE> if the time step was found.
+   */
+  static bool FindTimeStep(const string& val_filename, unsigned long val_iter, unsigned long& nFields,
+                           unsigned long& nPoints, vector<string>& fieldNames, unsigned long& dataOffset);
+
+private:
+
+  unsigned long iter;   /*!< \brief Iteration of the data to write. */
+  passivedouble time;   /*!< \brief Physical time of the data to write. */
+
+  vector<unsigned long> stepIters;   /*!< \brief Iterations of the time steps in the file. */
+  vector<passivedouble> stepTimes;   /*!< \brief Physical times of the time steps in the file. */
+
+  unsigned long headerSize;    /*!< \brief Size in bytes of the header, i.e. position of the connectivity. */
+  unsigned long nMixedConn;    /*!< \brief Global size of the mixed connectivity. */
+  unsigned long stepSize;      /*!< \brief Size in bytes of the block of one time step. */
+
+  /*!
+   * \brief Read the header and the time steps of an existing file and check it is compatible with the current data.
+   * \note Only the master rank reads the file, the time steps at or beyond the current iteration are dropped.
+   * \return <TRUE> if the file exists and the data can be appended.
+   */
+  bool ReadSeries();
+
+  /*!
+   * \brief Write the header and the connectivity of a new file.
+   */
+  void WriteHeader();
+
+  /*!
+   * \brief Open an existing file for writing at a given position.
+   * \param[in] offset - Position in bytes where writing starts.
+   */
+  void OpenSeriesFile(unsigned long offset);
+
+  /*!
+   * \brief Remove the contents of the file beyond the last time step (e.g. after a restart from an earlier step).
+   * \param[in] fileSizeInBytes - The size of the file.
+   */
+  void TruncateSeriesFile(unsigned long fileSizeInBytes);
+
+  /*!
+   * \brief Write the XDMF index file referencing all time steps of the series.
+   */
+  void WriteIndex() const;
+
+};
@@ -33,6 +33,9 @@ class CSurfaceFVMDataSorter final: public CParallelDataSorter{
 
   CFVMDataSorter* volumeSorter;                    //!< Pointer to the volume sorter instance
   map<unsigned long,unsigned long> Renumber2Global; //! Structure to map the local sorted point ID to the global point ID
+  vector<unsigned long> surfacePoints;             //!< Local index in the volume sorter of each surface point
+  vector<string> sortedMarkers;                    //!< Markers of the currently sorted connectivity
+  bool sortingPlanValid;                           //!< Whether surfacePoints and the renumbered connectivity are up to date
 public:
 
   /*!
@@ -50,8 +53,8 @@ public:
 
   /*!
    * \brief Sort the output data for each grid node into a linear partitioning across all processors.
-   * \param[in] config - Definition of the particular problem.
-   * \param[in] geometry - Geometrical definition of the problem.
+   * \note The first call after sorting the connectivity renumbers it and determines the surface points,
+   *       subsequent calls only extract the data of those points from the volume sorter.
    */
   void SortOutputData() override;
 
@@ -66,7 +69,8 @@ public:
 
   /*!
    * \brief Sort the connectivities (volume and surface) into data structures used for output file writing.
-   * Only markers in the markerList argument will be sorted.
+   * Only markers in the markerList argument will be sorted. Nothing is done if the connectivity of the same
+   * markers is already sorted.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] markerList - List of markers to sort.
@@ -0,0 +1,131 @@
+/*!
+ * \file CFieldIndexTable.hpp
+ * \brief Hash table mapping the names of output fields to integer handles.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \class CFieldIndexTable
+ * \brief Open addressing hash table from the 64-bit FNV-1a key of a field name to the handle of the field.
+ * \note The table is only modified while the fields are registered, lookups are read-only and can be
+ *       done concurrently. The key of a string literal is a constant expression, the owner of the table
+ *       is responsible for detecting two names with the same key when they are inserted.
+ */
+class CFieldIndexTable {
+public:
+  using Key = std::uint64_t;
+  using Handle = unsigned short;
+
+  enum : Handle {NOT_FOUND = 0xFFFF};   /*!< \brief Handle returned for unknown keys. */
+
+  /*!
+   * \brief Key of a field name (FNV-1a), evaluated at compile time for string literals.
+   * \param[in] name - Null terminated name of the field.
+   * \param[in] hash - Hash of the preceding characters.
+   * \return Key of the name.
+   */
+  static constexpr Key GetKey(const char* name, Key hash = FNV_OFFSET) {
+    return (*name == '\0')? hash : GetKey(name+1, (hash ^ static_cast<unsigned char>(*name)) * FNV_PRIME);
+  }
+
+  /*!
+   * \brief Key of a field name given at runtime.
+   * \param[in] name - Name of the field.
+   * \return Key of the name, the same as for the equivalent literal.
+   */
+  static Key GetKey(const std::string& name) {
+    Key hash = FNV_OFFSET;
+    for (const char c : name) hash = (hash ^ static_cast<unsigned char>(c)) * FNV_PRIME;
+    return hash;
+  }
+
+  /*!
+   * \brief Find the handle of a key.
+   * \param[in] key - Key of the field name.
+   * \return Handle of the field or NOT_FOUND.
+   */
+  Handle Find(Key key) const {
+    if (keys.empty()) return NOT_FOUND;
+    const std::size_t mask = keys.size()-1;
+    for (std::size_t pos = key & mask; ; pos = (pos+1) & mask) {
+      if (handles[pos] == NOT_FOUND) return NOT_FOUND;
+      if (keys[pos] == key) return handles[pos];
+    }
+  }
+
+  /*!
+   * \brief Insert a key, if it is not in the table already.
+   * \param[in] key - Key of the field name.
+   * \param[in] handle - Handle of the field.
+   * \return The handle stored for the key, which differs from "handle" if the key already existed.
+   */
+  Handle Insert(Key key, Handle handle) {
+    const Handle existing = Find(key);
+    if (existing != NOT_FOUND) return existing;
+
+    /*--- Keep the load factor below 1/2 so that probe sequences stay short. ---*/
+    if (2*(nEntries+1) > keys.size()) Rehash(std::max<std::size_t>(64, 2*keys.size()));
+
+    Store(key, handle);
+    return handle;
+  }
+
+  /*!
+   * \brief Number of keys in the table.
+   */
+  std::size_t size() const { return nEntries; }
+
+private:
+  static constexpr Key FNV_OFFSET = 14695981039346656037ull;
+  static constexpr Key FNV_PRIME = 1099511628211ull;
+
+  std::vector<Key> keys;         /*!< \brief Keys of the slots (size is a power of 2). */
+  std::vector<Handle> handles;   /*!< \brief Handles of the slots, NOT_FOUND for empty slots. */
+  std::size_t nEntries = 0;      /*!< \brief Number of occupied slots. */
+
+  void Store(Key key, Handle handle) {
+    const std::size_t mask = keys.size()-1;
+    std::size_t pos = key & mask;
+    while (handles[pos] != NOT_FOUND) pos = (pos+1) & mask;
+    keys[pos] = key;
+    handles[pos] = handle;
+    ++nEntries;
+  }
+
+  void Rehash(std::size_t newSize) {
+    std::vector<Key> oldKeys(newSize, 0);
+    std::vector<Handle> oldHandles(newSize, NOT_FOUND);
+    keys.swap(oldKeys);
+    handles.swap(oldHandles);
+    nEntries = 0;
+    for (std::size_t i = 0; i < oldKeys.size(); ++i)
+      if (oldHandles[i] != NOT_FOUND) Store(oldKeys[i], oldHandles[i]);
+  }
+};
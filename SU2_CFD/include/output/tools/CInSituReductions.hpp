@@ -0,0 +1,137 @@
+/*!
+ * \file CInSituReductions.hpp
+ * \brief Headers of the in-situ reductions of the volume output data.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include "../../../../Common/include/mpi_structure.hpp"
+#include "../../../../Common/include/toolboxes/C2DContainer.hpp"
+
+class CConfig;
+class CGeometry;
+class CParallelDataSorter;
+
+using namespace std;
+
+/*!
+ * \class CInSituReductions
+ * \brief Reductions of the volume output fields computed during unsteady runs: running mean and variance,
+ *        time series at probes and planar slices, which otherwise require writing full snapshots.
+ * \note The reductions use the unsorted (partitioned) data of the volume data sorter, which is only
+ *       available at the points owned by each rank. Interpolated values are therefore computed as
+ *       sums of the contributions of the owned nodes over all ranks.
+ */
+class CInSituReductions {
+
+  /*!
+   * \brief Maximum number of nodes of the elements used to interpolate the probes.
+   */
+  static constexpr unsigned short MAX_PROBE_NODES = 8;
+
+  const int rank;                  /*!< \brief MPI rank. */
+  const unsigned short nDim;       /*!< \brief Physical dimension. */
+  const unsigned long nPointDomain;/*!< \brief Number of points owned by this rank. */
+
+  vector<short> fieldOffset;       /*!< \brief Offsets of the reduced fields in the volume data. */
+  vector<string> fieldNames;       /*!< \brief Names of the reduced fields. */
+
+  vector<short> meanOffset;        /*!< \brief Offsets of the running mean fields (empty if no statistics). */
+  vector<short> varOffset;         /*!< \brief Offsets of the running variance fields. */
+  su2passivematrix mean;           /*!< \brief Running mean of the fields at the owned points. */
+  su2passivematrix sumSqDev;       /*!< \brief Running sum of the squared deviations from the mean. */
+  unsigned long startIter;         /*!< \brief First time iteration included in the statistics. */
+  unsigned long nSamples = 0;      /*!< \brief Number of time iterations in the statistics. */
+  long lastIter = -1;              /*!< \brief Last time iteration that was reduced. */
+
+  unsigned long nProbes = 0;       /*!< \brief Number of probes. */
+  vector<long> probeNodes;         /*!< \brief Local index of the owned interpolation nodes of each probe (-1 if not owned). */
+  vector<passivedouble> probeWeights;  /*!< \brief Interpolation weights of the nodes of each probe. */
+  string probeFileName;            /*!< \brief Name of the file with the probe time series. */
+
+  vector<passivedouble> slicePlanes;   /*!< \brief Origin and normal of each slice. */
+  unsigned long sliceFreq;         /*!< \brief Writing frequency of the slices. */
+
+public:
+  /*!
+   * \brief Constructor, locates the probes in the partitioned mesh.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] offsets - Offsets of the reduced fields in the volume data.
+   * \param[in] names - Names of the reduced fields.
+   * \param[in] meanOffsets - Offsets of the running mean fields, empty if the statistics are not computed.
+   * \param[in] varOffsets - Offsets of the running variance fields.
+   */
+  CInSituReductions(CConfig *config, CGeometry *geometry, vector<short> offsets, vector<string> names,
+                    vector<short> meanOffsets, vector<short> varOffsets);
+
+  /*!
+   * \brief Reduce the data of a time iteration, the statistics are stored in the volume data.
+   * \note Must be called by all ranks after the volume data has been loaded, each time iteration is reduced once.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] volumeData - Data sorter holding the (unsorted) volume data.
+   * \param[in] timeIter - Current time iteration.
+   * \param[in] time - Current physical time.
+   */
+  void Update(CConfig *config, CGeometry *geometry, CParallelDataSorter *volumeData,
+              unsigned long timeIter, passivedouble time);
+
+private:
+  /*!
+   * \brief Find the element containing each probe and store the interpolation weights of the owned nodes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] coords - Coordinates of the probes.
+   */
+  void LocateProbes(CGeometry *geometry, const vector<passivedouble>& coords);
+
+  /*!
+   * \brief Add the current values to the running mean and variance and store them in the volume data.
+   * \param[in] volumeData - Data sorter holding the (unsorted) volume data.
+   * \param[in] timeIter - Current time iteration.
+   */
+  void UpdateStatistics(CParallelDataSorter *volumeData, unsigned long timeIter);
+
+  /*!
+   * \brief Interpolate the fields at the probes and append them to the probe file.
+   * \param[in] volumeData - Data sorter holding the (unsorted) volume data.
+   * \param[in] timeIter - Current time iteration.
+   * \param[in] time - Current physical time.
+   * \param[in] newFile - Whether to start a new file.
+   */
+  void WriteProbes(const CParallelDataSorter *volumeData, unsigned long timeIter, passivedouble time, bool newFile) const;
+
+  /*!
+   * \brief Intersect the edges of the mesh with a plane and write the interpolated fields as a point cloud.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] volumeData - Data sorter holding the (unsorted) volume data.
+   * \param[in] iSlice - Index of the slice.
+   * \param[in] fileName - Name of the slice file.
+   */
+  void WriteSlice(CGeometry *geometry, const CParallelDataSorter *volumeData,
+                  unsigned short iSlice, const string& fileName) const;
+
+};
@@ -44,6 +44,7 @@ protected:
 
   enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
   enum : size_t {OMP_MIN_SIZE = 32};   /*!< \brief Min chunk size for edge loops (max is color group size). */
+  enum : size_t {EDGE_PACK_SIZE = 8};  /*!< \brief Number of edges of the packs of the viscous residual. */
 
   unsigned long omp_chunk_size;  /*!< \brief Chunk size used in light point loops. */
 
@@ -388,11 +389,79 @@ protected:
    * \param[in] Output - boolean to determine whether to print output.
    * \return - The number of non-physical points.
    */
-  virtual unsigned long SetPrimitive_Variables(CSolver **solver_container,
-                                               CConfig *config, bool Output);
+  unsigned long SetPrimitive_Variables(CSolver **solver_container,
+                                       CConfig *config, bool Output) override;
 
 protected:
 
+  /*!
+   * \brief Apply a kernel to the packed vertices of a kind of boundary condition, the threads
+   *        share the vertices of each group (a point appears at most once per group).
+   * \param[in] pack - Packed vertices.
+   * \param[in] kernel - Callable taking the index of the packed vertex.
+   */
+  template<class Kernel>
+  static void LoopVertexPack(const CVertexPack& pack, Kernel&& kernel) {
+    for (auto iGroup = 0ul; iGroup < pack.GetnGroup(); ++iGroup) {
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto iPack = pack.GetGroupBegin(iGroup); iPack < pack.GetGroupEnd(iGroup); ++iPack)
+        kernel(iPack);
+    }
+  }
+
+  /*!
+   * \brief Far-field boundary condition at one domain vertex.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Surface marker of the vertex.
+   * \param[in] iVertex - Index of the vertex in the marker.
+   * \param[in] iPoint - Point of the vertex.
+   * \param[in] Point_Normal - Closest interior neighbor of the vertex.
+   * \param[in] VertexNormal - Normal of the vertex (as stored by CVertex).
+   */
+  void BC_Far_Field_Vertex(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                           CNumerics *visc_numerics, CConfig *config, unsigned short val_marker,
+                           unsigned long iVertex, unsigned long iPoint, unsigned long Point_Normal,
+                           const su2double *VertexNormal);
+
+  /*!
+   * \brief Subsonic inlet boundary condition at one domain vertex.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Surface marker of the vertex.
+   * \param[in] iVertex - Index of the vertex in the marker.
+   * \param[in] iPoint - Point of the vertex.
+   * \param[in] VertexNormal - Normal of the vertex (as stored by CVertex).
+   */
+  void BC_Inlet_Vertex(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                       CNumerics *visc_numerics, CConfig *config, unsigned short val_marker,
+                       unsigned long iVertex, unsigned long iPoint, const su2double *VertexNormal);
+
+  /*!
+   * \brief Outlet boundary condition at one domain vertex.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Surface marker of the vertex.
+   * \param[in] iVertex - Index of the vertex in the marker.
+   * \param[in] iPoint - Point of the vertex.
+   * \param[in] VertexNormal - Normal of the vertex (as stored by CVertex).
+   * \param[in] Coord - Coordinates of the point.
+   * \param[in] Outlet_Pressure - Specified (dimensional) back pressure of the marker.
+   */
+  void BC_Outlet_Vertex(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                        CNumerics *visc_numerics, CConfig *config, unsigned short val_marker,
+                        unsigned long iVertex, unsigned long iPoint, const su2double *VertexNormal,
+                        const su2double *Coord, su2double Outlet_Pressure);
+
 public:
 
   /*!
@@ -533,6 +602,39 @@ public:
   inline virtual void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                        CNumerics *numerics, CConfig *config) { }
 
+  /*!
+   * \brief Whether the viscous contribution is computed by packs of edges instead of edge by edge.
+   * \param[in] numerics - Description of the numerical method (viscous term).
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual bool ViscousEdgePacks(const CNumerics *numerics, const CConfig *config) const { return false; }
+
+  /*!
+   * \brief Compute the viscous contribution for a pack of edges.
+   * \param[in] nEdge - Number of edges in the pack, at most EDGE_PACK_SIZE.
+   * \param[in] edges - Edges of the pack.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void Viscous_Residual(unsigned long nEdge, const unsigned long *edges, CGeometry *geometry,
+                                       CSolver **solver_container, CNumerics *numerics, CConfig *config) { }
+
+  /*!
+   * \brief Compute the viscous contribution for the edges of a color, by packs of edges.
+   * \note The convective residual methods call this after the loop over the edges of each color
+   *       if ViscousEdgePacks is true, instead of the "fused" edge-wise viscous contribution.
+   * \param[in] color - Edges of the color.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class ColorType>
+  void Viscous_Residual_Packs(const ColorType& color, CGeometry *geometry, CSolver **solver_container,
+                              CNumerics *numerics, CConfig *config);
+
   /*!
    * \brief Recompute the extrapolated quantities, after MUSCL reconstruction,
    *        in a more thermodynamically consistent way.
@@ -637,6 +739,22 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) final;
 
+  /*!
+   * \brief Whether the gradients and limiters of the primitive variables are computed in one pass over the grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool GetFusedGradientLimiter(const CConfig *config) const;
+
+  /*!
+   * \brief Compute the gradient of the primitive variables, and optionally their limiter, in one pass over the grid.
+   * \note Same results as SetPrimitive_Gradient_GG/LS followed by SetPrimitive_Limiter, see GetFusedGradientLimiter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   * \param[in] limiter - Compute the limiter, only of the gradient used for upwind reconstruction.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config, bool reconstruction, bool limiter);
+
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] config - Definition of the particular problem.
@@ -695,6 +813,31 @@ public:
                     CConfig *config,
                     unsigned short val_marker) final;
 
+  /*!
+   * \brief Whether a kind of boundary condition is imposed over all its markers at once (far-field, inlet, outlet).
+   * \param[in] kindBC - Kind of boundary condition.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool GetPacked_BC(unsigned short kindBC, const CConfig *config) const override;
+
+  /*!
+   * \brief Impose a kind of boundary condition over the packed vertices of all its markers.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pack - Packed vertices of the markers of the kind.
+   * \param[in] kindBC - Kind of boundary condition.
+   */
+  void BC_Packed(CGeometry *geometry,
+                 CSolver **solver_container,
+                 CNumerics *conv_numerics,
+                 CNumerics *visc_numerics,
+                 CConfig *config,
+                 const CVertexPack& pack,
+                 unsigned short kindBC) override;
+
   /*!
    * \brief Impose the symmetry boundary condition using the residual.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1082,6 +1225,26 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Add the time step to the Jacobian diagonal and set the right hand side of the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the increments in LinSysSol, and communicate it.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over a nonlinear iteration for stability.
    * \param[in] solver - Container vector with all the solutions.
@@ -420,7 +420,7 @@ public:
    */
   unsigned long SetPrimitive_Variables(CSolver **solver_container,
                                        CConfig *config,
-                                       bool Output);
+                                       bool Output) override;
 
   /*!
    * \brief Compute a pressure sensor switch.
@@ -315,7 +315,7 @@ public:
    */
   unsigned long SetPrimitive_Variables(CSolver **solver_container,
                                        CConfig *config,
-                                       bool Output);
+                                       bool Output) override;
 
   /*!
    * \brief Impose a no-slip condition.
@@ -50,6 +50,19 @@ protected:
 
   vector<CMeshElement> element; /*!< \brief Vector which stores element information for each problem. */
 
+  /*--- Data of the RBF deformation method. The centers are a subset of the boundary nodes of all
+   *    ranks, selected greedily, they are kept between deformations and extended when needed. ---*/
+
+  bool rbf_deformation;                /*!< \brief Deform the mesh with RBF instead of elasticity. */
+  su2double RBF_Radius;                /*!< \brief Radius of the basis functions. */
+  vector<unsigned long> RBF_BoundPoint;/*!< \brief Owned boundary nodes where the displacement is imposed. */
+  vector<bool> RBF_BoundMoving;        /*!< \brief Whether the displacement of those nodes is prescribed (else fixed). */
+  vector<bool> RBF_BoundIsCenter;      /*!< \brief Whether those nodes are already RBF centers. */
+  vector<su2double> RBF_CenterCoord;   /*!< \brief Reference coordinates of the centers (all ranks). */
+  vector<int> RBF_CenterRank;          /*!< \brief Rank that owns each center. */
+  vector<unsigned long> RBF_CenterBound; /*!< \brief Index of each center in RBF_BoundPoint of its owner. */
+  su2passivematrix RBF_Generator;      /*!< \brief Inverse of the interpolation matrix of the centers. */
+
   /*!
    * \brief Compute the min and max volume of the elements in the domain.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -94,6 +107,30 @@ protected:
    */
   void UpdateMultiGrid(CGeometry **geometry, CConfig *config) const;
 
+  /*!
+   * \brief Apply the prescribed motions (translation, plunging, pitching, rotation) to the deforming surfaces.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSurfaceMotions(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Set the owned boundary nodes used by the RBF deformation and the radius of the basis functions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRBF_BoundaryPoints(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Interpolate the boundary displacements into the volume (LinSysSol) with radial basis functions.
+   * \note The centers are added greedily (those with the largest interpolation error, over all ranks) until the
+   *       boundary displacements are reproduced within DEFORM_RBF_TOLERANCE. The evaluation in the volume is
+   *       matrix-free, for compact basis functions only the centers in the neighboring bins are visited.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InterpolateDisplacements_RBF(CGeometry *geometry, CConfig *config);
+
   /*!
    * \brief Check the boundary vertex that are going to be moved.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -108,7 +145,7 @@ public:
   CMeshSolver(CGeometry *geometry, CConfig *config);
 
   /*!
-   * \brief Grid deformation using the linear elasticity equations.
+   * \brief Grid deformation using the linear elasticity equations, or radial basis functions.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
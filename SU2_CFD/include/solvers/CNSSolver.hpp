@@ -92,6 +92,21 @@ private:
                                           su2double& Res_Conv,
                                           su2double& Res_Visc) const;
 
+  /*!
+   * \brief Heat-flux wall boundary condition at one domain vertex.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Surface marker of the vertex.
+   * \param[in] iVertex - Index of the vertex in the marker.
+   * \param[in] iPoint - Point of the vertex.
+   * \param[in] Point_Normal - Closest interior neighbor of the vertex.
+   * \param[in] Normal - Normal of the vertex (as stored by CVertex).
+   * \param[in] Wall_HeatFlux - Specified (non-dimensional) heat flux of the marker.
+   */
+  void BC_HeatFlux_Wall_Vertex(CGeometry *geometry, const CConfig *config, unsigned short val_marker,
+                               unsigned long iVertex, unsigned long iPoint, unsigned long Point_Normal,
+                               const su2double *Normal, su2double Wall_HeatFlux);
+
   /*!
    * \brief Get the wall temperature at a given vertex of a given marker for CHT problems.
    */
@@ -345,6 +360,32 @@ public:
                         CConfig *config,
                         unsigned short val_marker) override;
 
+  /*!
+   * \brief Whether a kind of boundary condition is imposed over all its markers at once (heat-flux walls,
+   *        and the kinds of CEulerSolver).
+   * \param[in] kindBC - Kind of boundary condition.
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool GetPacked_BC(unsigned short kindBC, const CConfig *config) const override;
+
+  /*!
+   * \brief Impose a kind of boundary condition over the packed vertices of all its markers.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pack - Packed vertices of the markers of the kind.
+   * \param[in] kindBC - Kind of boundary condition.
+   */
+  void BC_Packed(CGeometry *geometry,
+                 CSolver **solver_container,
+                 CNumerics *conv_numerics,
+                 CNumerics *visc_numerics,
+                 CConfig *config,
+                 const CVertexPack& pack,
+                 unsigned short kindBC) override;
+
   /*!
    * \brief Impose the Navier-Stokes boundary condition (strong).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -464,6 +505,25 @@ public:
   void Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                         CNumerics *numerics, CConfig *config) override;
 
+  /*!
+   * \brief Whether the viscous contribution is computed by packs of edges (CAvgGrad_Flow numerics).
+   * \param[in] numerics - Description of the numerical method (viscous term).
+   * \param[in] config - Definition of the particular problem.
+   */
+  bool ViscousEdgePacks(const CNumerics *numerics, const CConfig *config) const override;
+
+  /*!
+   * \brief Compute the viscous contribution for a pack of edges.
+   * \param[in] nEdge - Number of edges in the pack, at most EDGE_PACK_SIZE.
+   * \param[in] edges - Edges of the pack.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Viscous_Residual(unsigned long nEdge, const unsigned long *edges, CGeometry *geometry,
+                        CSolver **solver_container, CNumerics *numerics, CConfig *config) override;
+
   /*!
    * \brief Get the skin friction coefficient.
    * \param[in] val_marker - Surface marker where the coefficient is computed.
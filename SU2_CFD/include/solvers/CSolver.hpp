@@ -1119,6 +1119,31 @@ public:
                                    CConfig *config,
                                    unsigned short val_marker) { }
 
+  /*!
+   * \brief Whether a kind of boundary condition is imposed over all its markers at once, by BC_Packed.
+   * \param[in] kindBC - Kind of boundary condition.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual bool GetPacked_BC(unsigned short kindBC, const CConfig *config) const { return false; }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the numerical method.
+   * \param[in] visc_numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pack - Packed vertices of the markers of the kind.
+   * \param[in] kindBC - Kind of boundary condition.
+   */
+  inline virtual void BC_Packed(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CNumerics *conv_numerics,
+                                CNumerics *visc_numerics,
+                                CConfig *config,
+                                const CVertexPack& pack,
+                                unsigned short kindBC) { }
+
   /*!
    * \brief Impose via the residual the Euler boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1496,6 +1521,37 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void PrepareImplicitIteration(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CConfig *config) { }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CompleteImplicitIteration(CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CConfig *config) { }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Output - boolean to determine whether to print output.
+   * \return - The number of non-physical points.
+   */
+  inline virtual unsigned long SetPrimitive_Variables(CSolver **solver_container,
+                                                      CConfig *config,
+                                                      bool Output) { return 0; }
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Container vector with all the solutions.
@@ -3630,6 +3686,38 @@ public:
                                CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Check if a binary restart of an unsteady problem has to be read from a time series (TIME_SERIES output),
+   *        which is the case when the restart file of the time step does not exist.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the restart file of the time step (without extension).
+   * \param[out] series_filename - Name of the series file (with extension).
+   * \param[out] val_iter - Time iteration to read from the series.
+   * \return <TRUE> if the series should be read.
+   */
+  bool FindRestartSeries(const CConfig *config, const string& val_filename,
+                         string& series_filename, unsigned long& val_iter) const;
+
+  /*!
+   * \brief Read one time step of a SU2 time series file (see CSU2SeriesFileWriter) as if it was a binary restart.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_filename - Name of the series file (with extension).
+   * \param[in] val_iter - Time iteration to read.
+   */
+  void Read_SU2_Restart_Series(CGeometry *geometry, const string& val_filename, unsigned long val_iter);
+
+  /*!
+   * \brief Read the data section of a compressed native SU2 restart file (see CSU2BinaryFileWriter).
+   * \note The blocks are decoded by ranks chosen cyclically and the values are then routed
+   *       to the ranks that own the points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_filename - Name of the restart file (with extension).
+   * \param[in] disp - Position of the codec and offset tables in the file (bytes).
+   */
+  void Read_SU2_Restart_Binary_Compressed(CGeometry *geometry,
+                                          const string& val_filename,
+                                          unsigned long disp);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
+struct TurbSourcePack;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -74,6 +76,17 @@ protected:
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  /*--- Block-coupled implicit system of the flow and turbulence equations (COUPLED_TURB_SOLVE). ---*/
+#ifndef CODI_FORWARD_TYPE
+  CSysMatrix<su2mixedfloat> CoupledJacobian; /*!< \brief Jacobian of the flow and turbulence equations. */
+  CSysSolve<su2mixedfloat>  CoupledSystem;   /*!< \brief Linear solver of the coupled system. */
+#else
+  CSysMatrix<su2double> CoupledJacobian;
+  CSysSolve<su2double>  CoupledSystem;
+#endif
+  CSysVector<su2double> CoupledLinSysRes;    /*!< \brief Right hand side of the coupled system. */
+  CSysVector<su2double> CoupledLinSysSol;    /*!< \brief Solution (increments) of the coupled system. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -84,6 +97,35 @@ protected:
    */
   inline CVariable* GetBaseClassPointerToNodes() final { return nodes; }
 
+  /*!
+   * \brief Gather the data of a pack of points for the source terms, the unused lanes repeat the first point.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] flowNodes - Variables of the flow solver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iPointBegin - First point of the pack.
+   * \param[in] nPointPack - Number of points of the pack.
+   * \param[in] desLength - Use the DES length scale instead of the wall distance.
+   * \param[out] pack - Data of the points.
+   */
+  void GatherSourcePack(const CGeometry *geometry, CVariable *flowNodes, const CConfig *config,
+                        unsigned long iPointBegin, unsigned long nPointPack, bool desLength,
+                        TurbSourcePack& pack) const;
+
+  /*!
+   * \brief Subtract the source residuals and Jacobians of a pack of points, in point order.
+   * \param[in] iPointBegin - First point of the pack.
+   * \param[in] nPointPack - Number of points of the pack.
+   * \param[in] pack - Residuals and Jacobians of the points.
+   */
+  void ScatterSourcePack(unsigned long iPointBegin, unsigned long nPointPack, const TurbSourcePack& pack);
+
+  /*!
+   * \brief Allocate the coupled system of the flow and turbulence equations, the flow solver is compressible.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeCoupledSystem(CGeometry *geometry, CConfig *config);
+
 private:
 
   /*!
@@ -106,6 +148,18 @@ private:
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Assemble and solve the coupled system of the flow and turbulence equations, split the increments
+   *        in the LinSysSol of each solver, and update the flow solution and primitive variables.
+   * \note The implicit systems of both solvers must have been prepared (see PrepareImplicitIteration).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SolveCoupledSystem(CGeometry *geometry,
+                          CSolver **solver_container,
+                          CConfig *config);
+
 public:
 
   /*!
@@ -250,6 +304,27 @@ public:
   void ImplicitEuler_Iteration(CGeometry *geometry,
                                CSolver **solver_container,
                                CConfig *config) override;
+
+  /*!
+   * \brief Add the time step to the Jacobian diagonal and set the right hand side of the implicit system.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the increments in LinSysSol, and communicate it.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time-Stepping Strategy.
    * \param[in] geometry - Geometric definition of the problem.
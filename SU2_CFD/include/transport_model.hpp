@@ -95,6 +95,20 @@ public:
    */
   virtual   void SetDerViscosity(su2double T, su2double rho);
 
+  /*!
+   * \brief Viscosity and its derivatives for a batch of points.
+   * \note The default implementation loops over SetViscosity and SetDerViscosity, hence it modifies
+   *       the state of the object, the specialized ones are stateless and vectorized.
+   * \param[in] nPoint - Number of points.
+   * \param[in] T - Temperature of the points.
+   * \param[in] rho - Density of the points.
+   * \param[out] mu - Viscosity.
+   * \param[out] dmudrho - Derivative w.r.t. density at constant temperature.
+   * \param[out] dmudT - Derivative w.r.t. temperature at constant density.
+   */
+  virtual void ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                su2double *mu, su2double *dmudrho, su2double *dmudT);
+
 };
 
 /*!
@@ -123,6 +137,12 @@ public:
    */
   ~CConstantViscosity(void) override;
 
+  /*!
+   * \brief Viscosity and its derivatives for a batch of points.
+   */
+  void ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                        su2double *mu, su2double *dmudrho, su2double *dmudT) override;
+
 };
 
 /*!
@@ -165,6 +185,12 @@ public:
    */
   void SetDerViscosity(su2double T, su2double rho) override;
 
+  /*!
+   * \brief Viscosity and its derivatives for a batch of points.
+   */
+  void ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                        su2double *mu, su2double *dmudrho, su2double *dmudT) override;
+
 };
 
 /*!
@@ -199,6 +225,12 @@ public:
    */
   void SetViscosity(su2double T, su2double rho) override;
 
+  /*!
+   * \brief Viscosity and its derivatives for a batch of points.
+   */
+  void ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                        su2double *mu, su2double *dmudrho, su2double *dmudT) override;
+
 };
 
 /*!
@@ -250,6 +282,27 @@ public:
    */
   virtual void SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp);
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   * \note The default implementation loops over SetConductivity and SetDerConductivity, hence it modifies
+   *       the state of the object, the specialized ones are stateless and vectorized.
+   * \param[in] nPoint - Number of points.
+   * \param[in] T - Temperature of the points.
+   * \param[in] rho - Density of the points.
+   * \param[in] mu_lam - Laminar viscosity of the points.
+   * \param[in] mu_turb - Eddy viscosity (same for all points).
+   * \param[in] cp - Specific heat at constant pressure (same for all points).
+   * \param[in] dmudrho - Derivative of the laminar viscosity w.r.t. density.
+   * \param[in] dmudT - Derivative of the laminar viscosity w.r.t. temperature.
+   * \param[out] kt - Thermal conductivity.
+   * \param[out] dktdrho - Derivative w.r.t. density at constant temperature.
+   * \param[out] dktdT - Derivative w.r.t. temperature at constant density.
+   */
+  virtual void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                   const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                   const su2double *dmudrho, const su2double *dmudT,
+                                   su2double *kt, su2double *dktdrho, su2double *dktdT);
+
 };
 
 /*!
@@ -277,6 +330,14 @@ public:
    */
   ~CConstantConductivity(void) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 /*!
@@ -313,6 +374,14 @@ public:
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 /*!
@@ -354,6 +423,14 @@ public:
    */
   void SetDerConductivity(su2double T, su2double rho, su2double dmudrho_T, su2double dmudT_rho, su2double cp) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 /*!
@@ -390,6 +467,14 @@ public:
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 /*!
@@ -424,6 +509,14 @@ public:
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 /*!
@@ -459,6 +552,14 @@ public:
    */
   void SetConductivity(su2double T, su2double rho, su2double mu_lam, su2double mu_turb, su2double cp) override;
 
+  /*!
+   * \brief Thermal conductivity and its derivatives for a batch of points.
+   */
+  void ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                           const su2double *dmudrho, const su2double *dmudT,
+                           su2double *kt, su2double *dktdrho, su2double *dktdT) override;
+
 };
 
 #include "transport_model.inl"
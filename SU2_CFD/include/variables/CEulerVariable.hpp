@@ -55,6 +55,8 @@ protected:
   MatrixType Solution_New;     /*!< \brief New solution container for Classical RK4. */
 
 public:
+  static constexpr unsigned long MAXBATCH = 64;  /*!< \brief Maximum number of points of the batched primitive updates. */
+
   /*!
    * \brief Constructor of the class.
    * \param[in] density - Value of the flow density (initialization value).
@@ -242,6 +244,16 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a range of points with the batched fluid model.
+   * \note The points with a non-physical state are updated with SetPrimVar(iPoint, FluidModel).
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] iPointEnd - End of the range (exclusive), at most MAXBATCH points after iPointBegin.
+   * \param[in] FluidModel - Fluid model.
+   * \return Number of points with a non-physical state.
+   */
+  unsigned long SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd, CFluidModel *FluidModel);
+
   /*!
    * \brief A virtual member.
    */
@@ -174,6 +174,19 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a range of points with the batched fluid and transport models.
+   * \note The points with a non-physical state are updated with SetPrimVar(iPoint, eddy_visc, turb_ke, FluidModel).
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] iPointEnd - End of the range (exclusive), at most MAXBATCH points after iPointBegin.
+   * \param[in] eddy_visc - Eddy viscosity of the points of the range.
+   * \param[in] turb_ke - Turbulent kinetic energy of the points of the range.
+   * \param[in] FluidModel - Fluid model.
+   * \return Number of points with a non-physical state.
+   */
+  unsigned long SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd, const su2double *eddy_visc,
+                           const su2double *turb_ke, CFluidModel *FluidModel);
+
   /*!
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
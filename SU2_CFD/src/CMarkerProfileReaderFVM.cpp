@@ -194,7 +194,7 @@ void CMarkerProfileReaderFVM::MergeProfileMarkers() {
     if (config->GetMarker_All_KindBC(iMarker) == markerType) {
       numberOfProfiles++;
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Only communicate owned nodes to avoid duplicates. ---*/
 
@@ -259,7 +259,7 @@ void CMarkerProfileReaderFVM::MergeProfileMarkers() {
     if (config->GetMarker_All_KindBC(iMarker) == markerType) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Only communicate owned nodes to avoid duplicates. ---*/
 
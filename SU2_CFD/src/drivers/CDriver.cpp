@@ -741,31 +741,61 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   unsigned short requestedMGlevels = config->GetnMGLevels();
   const bool fea = config->GetStructuralProblem();
 
-  /*--- Definition of the geometry class to store the primal grid in the partitioning process.
-   *    All ranks process the grid and call ParMETIS for partitioning ---*/
+  /*--- Wall-clock time of each stage, reported at the end (maximum over the ranks). ---*/
 
-  CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  vector<string> stageName;
+  vector<su2double> stageTime;
+  passivedouble stageStart = SU2_MPI::Wtime();
 
-  /*--- Set the dimension --- */
+  auto EndStage = [&](const string& name) {
+    const passivedouble now = SU2_MPI::Wtime();
+    stageName.push_back(name);
+    stageTime.push_back(now-stageStart);
+    stageStart = now;
+  };
 
-  nDim = geometry_aux->GetnDim();
+  /*--- Allocate the memory of the current domain. ---*/
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  geometry = new CGeometry *[config->GetnMGLevels()+1];
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  /*--- The partitioned grid of a previous run is reused if it was made from
+   the same grid, with the same number of ranks. ---*/
 
-  /*--- Allocate the memory of the current domain, and divide the grid
-     between the ranks. ---*/
+  const unsigned long cacheKey = config->GetGeometry_Cache()? CPhysicalGeometry::GetPartitionCacheKey(config) : 0;
+  const bool cached = config->GetGeometry_Cache() && CPhysicalGeometry::CheckPartitionCache(config, cacheKey);
 
-  geometry = new CGeometry *[config->GetnMGLevels()+1];
+  if (cached) {
 
-  /*--- Build the grid data structures using the ParMETIS coloring. ---*/
+    geometry[MESH_0] = new CPhysicalGeometry(config, CPhysicalGeometry::GetPartitionCacheFileName(config), nZone);
 
-  geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
+    /*--- Set the dimension --- */
 
-  /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+    nDim = geometry[MESH_0]->GetnDim();
+  }
+  else {
 
-  delete geometry_aux;
+    /*--- Definition of the geometry class to store the primal grid in the partitioning process.
+     *    All ranks process the grid and call ParMETIS for partitioning ---*/
+
+    CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+
+    /*--- Set the dimension --- */
+
+    nDim = geometry_aux->GetnDim();
+
+    /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+
+    geometry_aux->SetColorGrid_Parallel(config);
+
+    /*--- Build the grid data structures using the ParMETIS coloring, and divide
+     the grid between the ranks (the partition is cached if requested). ---*/
+
+    geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config, cacheKey);
+
+    /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+
+    delete geometry_aux;
+  }
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetSendReceive(config);
@@ -773,26 +803,30 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetBoundaries(config);
 
+  EndStage(cached? "Loading the partition cache" : "Reading and partitioning");
+
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  EndStage("Point connectivity");
+
+  /*--- Renumbering points using Reverse Cuthill McKee ordering,
+   the point connectivity is permuted accordingly. ---*/
 
   if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
   geometry[MESH_0]->SetRCM_Ordering(config);
 
-  /*--- recompute elements surrounding points, points surrounding points ---*/
-
-  if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
-  geometry[MESH_0]->SetPoint_Connectivity();
+  EndStage("Renumbering (RCM)");
 
   /*--- Compute elements surrounding elements ---*/
 
   if (rank == MASTER_NODE) cout << "Setting element connectivity." << endl;
   geometry[MESH_0]->SetElement_Connectivity();
 
+  EndStage("Element connectivity");
+
   /*--- Check the orientation before computing geometrical quantities ---*/
 
   geometry[MESH_0]->SetBoundVolume();
@@ -802,23 +836,31 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[MESH_0]->Check_BoundElem_Orientation(config);
   }
 
+  EndStage("Orientation check");
+
   /*--- Create the edge structure ---*/
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
   geometry[MESH_0]->SetVertex(config);
 
+  EndStage("Edges and vertices");
+
   /*--- Compute cell center of gravity ---*/
 
   if ((rank == MASTER_NODE) && (!fea)) cout << "Computing centers of gravity." << endl;
   geometry[MESH_0]->SetCoord_CG();
 
+  EndStage("Centers of gravity");
+
   /*--- Create the control volume structures ---*/
 
   if ((rank == MASTER_NODE) && (!fea)) cout << "Setting the control volume structure." << endl;
   geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
   geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
 
+  EndStage("Dual grid");
+
   /*--- Visualize a dual control volume if requested ---*/
 
   if ((config->GetVisualize_CV() >= 0) &&
@@ -830,6 +872,10 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
   geometry[MESH_0]->FindNormal_Neighbor(config);
 
+  /*--- Pack the vertices of the markers of each kind of boundary condition. ---*/
+
+  geometry[MESH_0]->SetVertexPacks(config);
+
   /*--- Store the global to local mapping. ---*/
 
   if (rank == MASTER_NODE) cout << "Storing a mapping from global to local point index." << endl;
@@ -845,12 +891,15 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (rank == MASTER_NODE) cout << "Checking for periodicity." << endl;
   geometry[MESH_0]->Check_Periodicity(config);
 
+  EndStage("Neighbors, curvature, periodicity");
+
   /*--- Compute mesh quality statistics on the fine grid. ---*/
 
   if (!fea) {
     if (rank == MASTER_NODE)
       cout << "Computing mesh quality statistics for the dual control volumes." << endl;
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
+    EndStage("Mesh quality statistics");
   }
 
   geometry[MESH_0]->SetMGLevel(MESH_0);
@@ -883,6 +932,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     /*--- Find closest neighbor to a surface point ---*/
 
     geometry[iMGlevel]->FindNormal_Neighbor(config);
+    geometry[iMGlevel]->SetVertexPacks(config);
 
     /*--- Store our multigrid index. ---*/
 
@@ -900,6 +950,8 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   }
 
+  if (config->GetnMGLevels() != 0) EndStage("Multigrid agglomeration");
+
   /*--- For unsteady simulations, initialize the grid volumes
    and coordinates for previous solutions. Loop over all zones/grids ---*/
 
@@ -940,6 +992,23 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
   }
 
+  EndStage("Communication patterns");
+
+  /*--- Report the time of each stage, the slowest rank determines the total. ---*/
+
+  vector<su2double> maxStageTime(stageTime.size());
+  SU2_MPI::Allreduce(stageTime.data(), maxStageTime.data(), stageTime.size(), MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    su2double totalTime = 0.0;
+    cout << "\nGeometry preprocessing times (s), maximum over the ranks:" << endl;
+    for (auto iStage = 0ul; iStage < stageName.size(); iStage++) {
+      cout << "  " << left << setw(40) << stageName[iStage] << right << setw(12) << maxStageTime[iStage] << endl;
+      totalTime += maxStageTime[iStage];
+    }
+    cout << "  " << left << setw(40) << "Sum of the stages" << right << setw(12) << totalTime << endl;
+  }
+
 }
 
 void CDriver::Geometrical_Preprocessing_DGFEM(CConfig* config, CGeometry **&geometry) {
@@ -107,3 +107,41 @@ void CFluidModel::SetThermalConductivityModel (CConfig *config) {
   
 }
 
+void CFluidModel::ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e,
+                                    const CFluidBatch& state) {
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    SetTDState_rhoe(rho[iPoint], e[iPoint]);
+    state.Pressure[iPoint] = Pressure;
+    state.Temperature[iPoint] = Temperature;
+    state.SoundSpeed2[iPoint] = SoundSpeed2;
+    state.dPdrho_e[iPoint] = dPdrho_e;
+    state.dPde_rho[iPoint] = dPde_rho;
+    state.dTdrho_e[iPoint] = dTdrho_e;
+    state.dTde_rho[iPoint] = dTde_rho;
+  }
+}
+
+void CFluidModel::ComputeState_PT(unsigned long nPoint, const su2double *P, const su2double *T,
+                                  const CFluidBatch& state) {
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    SetTDState_PT(P[iPoint], T[iPoint]);
+    state.Density[iPoint] = Density;
+    state.StaticEnergy[iPoint] = StaticEnergy;
+    state.Pressure[iPoint] = Pressure;
+    state.Temperature[iPoint] = Temperature;
+    state.SoundSpeed2[iPoint] = SoundSpeed2;
+    state.dPdrho_e[iPoint] = dPdrho_e;
+    state.dPde_rho[iPoint] = dPde_rho;
+    state.dTdrho_e[iPoint] = dTdrho_e;
+    state.dTde_rho[iPoint] = dTde_rho;
+  }
+}
+
+void CFluidModel::ComputeTransport(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                   su2double *mu, su2double *dmudrho, su2double *dmudT,
+                                   su2double *kt, su2double *dktdrho, su2double *dktdT) {
+
+  LaminarViscosity->ComputeViscosity(nPoint, T, rho, mu, dmudrho, dmudT);
+
+  ThermalConductivity->ComputeConductivity(nPoint, T, rho, mu, Mu_Turb, Cp, dmudrho, dmudT, kt, dktdrho, dktdT);
+}
@@ -0,0 +1,435 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the tabulated (look-up table) fluid model.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/fluid_model.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+
+CFluidTable::CFluidTable(CFluidModel *model, su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax,
+                         unsigned long nRho, unsigned long nEnergy) {
+
+  if ((nRho < 2) || (nEnergy < 2) || !(rhoMax > rhoMin) || !(TMax > TMin) || !(rhoMin > 0.0))
+    SU2_MPI::Error("Invalid ranges or sizes of the fluid table.", CURRENT_FUNCTION);
+
+  Rho.resize(nRho);
+  for (auto iRho = 0ul; iRho < nRho; ++iRho)
+    Rho[iRho] = SU2_TYPE::GetValue(rhoMin + iRho*(rhoMax-rhoMin)/(nRho-1));
+
+  /*--- The energy range is the one spanned by the temperature range at the tabulated densities. ---*/
+
+  passivedouble eMin = numeric_limits<passivedouble>::max();
+  passivedouble eMax = numeric_limits<passivedouble>::lowest();
+
+  for (auto rho : Rho) {
+    model->SetTDState_rhoT(rho, TMin);
+    eMin = min(eMin, SU2_TYPE::GetValue(model->GetStaticEnergy()));
+    model->SetTDState_rhoT(rho, TMax);
+    eMax = max(eMax, SU2_TYPE::GetValue(model->GetStaticEnergy()));
+  }
+
+  Energy.resize(nEnergy);
+  for (auto iEnergy = 0ul; iEnergy < nEnergy; ++iEnergy)
+    Energy[iEnergy] = eMin + iEnergy*(eMax-eMin)/(nEnergy-1);
+
+  /*--- Evaluate the model at the nodes. ---*/
+
+  Data.resize(nRho*nEnergy*NFIELD);
+
+  for (auto iRho = 0ul; iRho < nRho; ++iRho) {
+    for (auto iEnergy = 0ul; iEnergy < nEnergy; ++iEnergy) {
+
+      model->SetTDState_rhoe(Rho[iRho], Energy[iEnergy]);
+
+      auto node = &Data[(iRho*nEnergy + iEnergy)*NFIELD];
+      node[PRESSURE]    = SU2_TYPE::GetValue(model->GetPressure());
+      node[TEMPERATURE] = SU2_TYPE::GetValue(model->GetTemperature());
+      node[SOUNDSPEED2] = SU2_TYPE::GetValue(model->GetSoundSpeed2());
+      node[DPDRHO_E]    = SU2_TYPE::GetValue(model->GetdPdrho_e());
+      node[DPDE_RHO]    = SU2_TYPE::GetValue(model->GetdPde_rho());
+      node[DTDRHO_E]    = SU2_TYPE::GetValue(model->GetdTdrho_e());
+      node[DTDE_RHO]    = SU2_TYPE::GetValue(model->GetdTde_rho());
+      node[ENTROPY]     = SU2_TYPE::GetValue(model->GetEntropy());
+    }
+  }
+
+  for (auto val : Data) {
+    if (!std::isfinite(val))
+      SU2_MPI::Error("The fluid model is not defined at all the nodes of the table, reduce its ranges.",
+                     CURRENT_FUNCTION);
+  }
+
+  SetSpacing();
+}
+
+CFluidTable::CFluidTable(const CConfig *config, const string& filename) {
+
+  ifstream file(filename);
+  if (file.fail())
+    SU2_MPI::Error("Unable to open the fluid table " + filename, CURRENT_FUNCTION);
+
+  /*--- Header, lines starting with % are comments. ---*/
+
+  unsigned long nRho = 0, nEnergy = 0;
+  string line, keyword;
+
+  while ((nRho == 0 || nEnergy == 0) && getline(file, line)) {
+    if (line.empty() || line[0] == '%') continue;
+    istringstream stream(line);
+    stream >> keyword;
+    if (keyword == "NRHO=") stream >> nRho;
+    else if (keyword == "NENERGY=") stream >> nEnergy;
+    else break;
+  }
+
+  if (nRho < 2 || nEnergy < 2)
+    SU2_MPI::Error("The header of the fluid table " + filename + " is missing NRHO= or NENERGY=.", CURRENT_FUNCTION);
+
+  /*--- One line per node with rho, e, and the tabulated quantities, the energy index runs fastest. ---*/
+
+  passivedouble scale[2+NFIELD];
+  GetScaleFactors(config, scale);
+
+  Rho.resize(nRho);
+  Energy.resize(nEnergy);
+  Data.resize(nRho*nEnergy*NFIELD);
+
+  for (auto iRho = 0ul; iRho < nRho; ++iRho) {
+    for (auto iEnergy = 0ul; iEnergy < nEnergy; ++iEnergy) {
+
+      do {
+        if (!getline(file, line))
+          SU2_MPI::Error("The fluid table " + filename + " has less nodes than declared.", CURRENT_FUNCTION);
+      } while (line.empty() || line[0] == '%');
+
+      istringstream stream(line);
+      passivedouble rho = 0.0, e = 0.0;
+      stream >> rho >> e;
+
+      auto node = &Data[(iRho*nEnergy + iEnergy)*NFIELD];
+      for (auto iField = 0u; iField < NFIELD; ++iField)
+        stream >> node[iField];
+
+      if (stream.fail())
+        SU2_MPI::Error("Invalid node in the fluid table " + filename + ":\n" + line, CURRENT_FUNCTION);
+
+      rho /= scale[0];
+      e /= scale[1];
+      for (auto iField = 0u; iField < NFIELD; ++iField)
+        node[iField] /= scale[2+iField];
+
+      /*--- The grid of the table must be rectilinear. ---*/
+
+      if (iEnergy == 0) Rho[iRho] = rho;
+      if (iRho == 0) Energy[iEnergy] = e;
+
+      if ((fabs(rho-Rho[iRho]) > 1e-8*fabs(rho)) || (fabs(e-Energy[iEnergy]) > 1e-8*fabs(e)))
+        SU2_MPI::Error("The nodes of the fluid table " + filename + " are not on a rectilinear grid in (rho, e).",
+                       CURRENT_FUNCTION);
+    }
+  }
+
+  SetSpacing();
+}
+
+void CFluidTable::GetScaleFactors(const CConfig *config, passivedouble *scale) {
+
+  const passivedouble rhoRef = SU2_TYPE::GetValue(config->GetDensity_Ref());
+  const passivedouble pRef = SU2_TYPE::GetValue(config->GetPressure_Ref());
+  const passivedouble tRef = SU2_TYPE::GetValue(config->GetTemperature_Ref());
+  const passivedouble eRef = pRef/rhoRef;
+
+  scale[0] = rhoRef;
+  scale[1] = eRef;
+  scale[2+PRESSURE]    = pRef;
+  scale[2+TEMPERATURE] = tRef;
+  scale[2+SOUNDSPEED2] = eRef;
+  scale[2+DPDRHO_E]    = pRef/rhoRef;
+  scale[2+DPDE_RHO]    = pRef/eRef;
+  scale[2+DTDRHO_E]    = tRef/rhoRef;
+  scale[2+DTDE_RHO]    = tRef/eRef;
+  scale[2+ENTROPY]     = eRef/tRef;
+}
+
+void CFluidTable::SetSpacing() {
+
+  for (auto axis : {&Rho, &Energy}) {
+    for (auto i = 1ul; i < axis->size(); ++i) {
+      if (!((*axis)[i] > (*axis)[i-1]))
+        SU2_MPI::Error("The density and energy of the fluid table must be increasing.", CURRENT_FUNCTION);
+    }
+  }
+  RhoInvDelta = (Rho.size()-1) / (Rho.back()-Rho.front());
+  EnergyInvDelta = (Energy.size()-1) / (Energy.back()-Energy.front());
+}
+
+void CFluidTable::Write(const CConfig *config, const string& filename) const {
+
+  ofstream file(filename);
+  if (file.fail())
+    SU2_MPI::Error("Unable to open the fluid table " + filename, CURRENT_FUNCTION);
+
+  passivedouble scale[2+NFIELD];
+  GetScaleFactors(config, scale);
+
+  file << "% SU2 fluid table in SI units, one line per node, the energy index runs fastest:\n"
+       << "% rho e P T c^2 dP/drho_e dP/de_rho dT/drho_e dT/de_rho s\n"
+       << "NRHO= " << Rho.size() << "\n"
+       << "NENERGY= " << Energy.size() << "\n";
+
+  file << scientific << setprecision(15);
+
+  for (auto iRho = 0ul; iRho < Rho.size(); ++iRho) {
+    for (auto iEnergy = 0ul; iEnergy < Energy.size(); ++iEnergy) {
+      file << Rho[iRho]*scale[0] << " " << Energy[iEnergy]*scale[1];
+      auto node = GetNode(iRho, iEnergy);
+      for (auto iField = 0u; iField < NFIELD; ++iField)
+        file << " " << node[iField]*scale[2+iField];
+      file << "\n";
+    }
+  }
+}
+
+bool CFluidTable::FindInterval(const vector<passivedouble>& axis, passivedouble invDelta,
+                               passivedouble val, unsigned long& index) {
+
+  const auto last = axis.size()-2;
+
+  /*--- The negated test also rejects NaN. ---*/
+  if (!((val >= axis.front()) && (val <= axis.back()))) return false;
+
+  /*--- Exact for uniform axes, otherwise a binary search. ---*/
+  index = min<unsigned long>((val-axis.front())*invDelta, last);
+
+  if ((val < axis[index]) || (val > axis[index+1])) {
+    index = upper_bound(axis.begin(), axis.end(), val) - axis.begin();
+    index = min(index-1, last);
+  }
+  return true;
+}
+
+bool CFluidTable::FindCell(su2double rho, su2double e, unsigned long& iRho, unsigned long& iEnergy,
+                           su2double& wRho, su2double& wEnergy) const {
+
+  if (!FindInterval(Rho, RhoInvDelta, SU2_TYPE::GetValue(rho), iRho) ||
+      !FindInterval(Energy, EnergyInvDelta, SU2_TYPE::GetValue(e), iEnergy)) return false;
+
+  wRho = (rho-Rho[iRho]) / (Rho[iRho+1]-Rho[iRho]);
+  wEnergy = (e-Energy[iEnergy]) / (Energy[iEnergy+1]-Energy[iEnergy]);
+  return true;
+}
+
+bool CFluidTable::InvertEnergy(su2double rho, unsigned short iField, su2double val, su2double& e) const {
+
+  unsigned long iRho = 0;
+  if (!FindInterval(Rho, RhoInvDelta, SU2_TYPE::GetValue(rho), iRho)) return false;
+
+  const su2double wRho = (rho-Rho[iRho]) / (Rho[iRho+1]-Rho[iRho]);
+
+  auto lineValue = [&](unsigned long iEnergy) {
+    return (1.0-wRho)*GetNode(iRho,iEnergy)[iField] + wRho*GetNode(iRho+1,iEnergy)[iField];
+  };
+
+  /*--- Bisection over the energy intervals. ---*/
+
+  const passivedouble target = SU2_TYPE::GetValue(val);
+  unsigned long lo = 0, hi = Energy.size()-1;
+
+  if (!((target >= SU2_TYPE::GetValue(lineValue(lo))) && (target <= SU2_TYPE::GetValue(lineValue(hi)))))
+    return false;
+
+  while (hi-lo > 1) {
+    const auto mid = (lo+hi)/2;
+    if (SU2_TYPE::GetValue(lineValue(mid)) <= target) lo = mid;
+    else hi = mid;
+  }
+
+  const su2double valLo = lineValue(lo), delta = lineValue(hi) - valLo;
+
+  e = Energy[lo];
+  if (delta != 0.0) e += (val-valLo) / delta * (Energy[hi]-Energy[lo]);
+  return true;
+}
+
+CLookUpTableGas::CLookUpTableGas(CFluidModel *model, shared_ptr<const CFluidTable> table) :
+  CFluidModel(), Model(model), Table(table) {
+
+  Cp = Model->GetCp();
+  Cv = Model->GetCv();
+}
+
+CLookUpTableGas::~CLookUpTableGas(void) { delete Model; }
+
+void CLookUpTableGas::CopyState() {
+
+  Density = Model->GetDensity();
+  StaticEnergy = Model->GetStaticEnergy();
+  Pressure = Model->GetPressure();
+  Temperature = Model->GetTemperature();
+  SoundSpeed2 = Model->GetSoundSpeed2();
+  dPdrho_e = Model->GetdPdrho_e();
+  dPde_rho = Model->GetdPde_rho();
+  dTdrho_e = Model->GetdTdrho_e();
+  dTde_rho = Model->GetdTde_rho();
+  Entropy = Model->GetEntropy();
+}
+
+bool CLookUpTableGas::InterpolateTable(su2double rho, su2double e, su2double *val) const {
+
+  unsigned long iRho, iEnergy;
+  su2double wRho, wEnergy;
+
+  if (!Table->FindCell(rho, e, iRho, iEnergy, wRho, wEnergy)) return false;
+
+  const passivedouble* node[] = {Table->GetNode(iRho, iEnergy),   Table->GetNode(iRho, iEnergy+1),
+                                 Table->GetNode(iRho+1, iEnergy), Table->GetNode(iRho+1, iEnergy+1)};
+
+  const su2double weight[] = {(1.0-wRho)*(1.0-wEnergy), (1.0-wRho)*wEnergy, wRho*(1.0-wEnergy), wRho*wEnergy};
+
+  for (auto iField = 0u; iField < CFluidTable::NFIELD; ++iField)
+    val[iField] = weight[0]*node[0][iField] + weight[1]*node[1][iField] +
+                  weight[2]*node[2][iField] + weight[3]*node[3][iField];
+  return true;
+}
+
+void CLookUpTableGas::Interpolate(su2double rho, su2double e) {
+
+  su2double val[CFluidTable::NFIELD];
+
+  if (!InterpolateTable(rho, e, val)) {
+    Model->SetTDState_rhoe(rho, e);
+    CopyState();
+    return;
+  }
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = val[CFluidTable::PRESSURE];
+  Temperature = val[CFluidTable::TEMPERATURE];
+  SoundSpeed2 = val[CFluidTable::SOUNDSPEED2];
+  dPdrho_e = val[CFluidTable::DPDRHO_E];
+  dPde_rho = val[CFluidTable::DPDE_RHO];
+  dTdrho_e = val[CFluidTable::DTDRHO_E];
+  dTde_rho = val[CFluidTable::DTDE_RHO];
+  Entropy = val[CFluidTable::ENTROPY];
+}
+
+void CLookUpTableGas::SetTDState_rhoe(su2double rho, su2double e) { Interpolate(rho, e); }
+
+void CLookUpTableGas::SetTDState_PT(su2double P, su2double T) {
+
+  Model->SetTDState_PT(P, T);
+  Interpolate(Model->GetDensity(), Model->GetStaticEnergy());
+}
+
+void CLookUpTableGas::SetTDState_Prho(su2double P, su2double rho) {
+
+  su2double e;
+  if (Table->InvertEnergy(rho, CFluidTable::PRESSURE, P, e)) {
+    Interpolate(rho, e);
+  }
+  else {
+    Model->SetTDState_Prho(P, rho);
+    CopyState();
+  }
+}
+
+void CLookUpTableGas::SetEnergy_Prho(su2double P, su2double rho) {
+
+  su2double e;
+  if (Table->InvertEnergy(rho, CFluidTable::PRESSURE, P, e)) {
+    StaticEnergy = e;
+  }
+  else {
+    Model->SetEnergy_Prho(P, rho);
+    StaticEnergy = Model->GetStaticEnergy();
+  }
+}
+
+void CLookUpTableGas::SetTDState_hs(su2double h, su2double s) {
+
+  Model->SetTDState_hs(h, s);
+  Interpolate(Model->GetDensity(), Model->GetStaticEnergy());
+}
+
+void CLookUpTableGas::SetTDState_rhoT(su2double rho, su2double T) {
+
+  su2double e;
+  if (Table->InvertEnergy(rho, CFluidTable::TEMPERATURE, T, e)) {
+    Interpolate(rho, e);
+  }
+  else {
+    Model->SetTDState_rhoT(rho, T);
+    CopyState();
+  }
+}
+
+void CLookUpTableGas::SetTDState_Ps(su2double P, su2double s) {
+
+  Model->SetTDState_Ps(P, s);
+  Interpolate(Model->GetDensity(), Model->GetStaticEnergy());
+}
+
+void CLookUpTableGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+
+  Model->ComputeDerivativeNRBC_Prho(P, rho);
+
+  dhdrho_P = Model->Getdhdrho_P();
+  dhdP_rho = Model->GetdhdP_rho();
+  dsdrho_P = Model->Getdsdrho_P();
+  dsdP_rho = Model->GetdsdP_rho();
+}
+
+void CLookUpTableGas::ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e,
+                                        const CFluidBatch& state) {
+
+  su2double val[CFluidTable::NFIELD];
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+    if (!InterpolateTable(rho[iPoint], e[iPoint], val)) {
+      Model->SetTDState_rhoe(rho[iPoint], e[iPoint]);
+      val[CFluidTable::PRESSURE] = Model->GetPressure();
+      val[CFluidTable::TEMPERATURE] = Model->GetTemperature();
+      val[CFluidTable::SOUNDSPEED2] = Model->GetSoundSpeed2();
+      val[CFluidTable::DPDRHO_E] = Model->GetdPdrho_e();
+      val[CFluidTable::DPDE_RHO] = Model->GetdPde_rho();
+      val[CFluidTable::DTDRHO_E] = Model->GetdTdrho_e();
+      val[CFluidTable::DTDE_RHO] = Model->GetdTde_rho();
+    }
+    state.Pressure[iPoint] = val[CFluidTable::PRESSURE];
+    state.Temperature[iPoint] = val[CFluidTable::TEMPERATURE];
+    state.SoundSpeed2[iPoint] = val[CFluidTable::SOUNDSPEED2];
+    state.dPdrho_e[iPoint] = val[CFluidTable::DPDRHO_E];
+    state.dPde_rho[iPoint] = val[CFluidTable::DPDE_RHO];
+    state.dTdrho_e[iPoint] = val[CFluidTable::DTDRHO_E];
+    state.dTde_rho[iPoint] = val[CFluidTable::DTDE_RHO];
+  }
+}
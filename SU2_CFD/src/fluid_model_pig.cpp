@@ -27,6 +27,8 @@
 
 
 #include "../include/fluid_model.hpp"
+#include "../../Common/include/omp_structure.hpp"
+#include <typeinfo>
 
 CIdealGas::CIdealGas() : CFluidModel() {
 
@@ -78,6 +80,50 @@ void CIdealGas::SetTDState_rhoe (su2double rho, su2double e ) {
     Entropy = (1.0/Gamma_Minus_One*log(Temperature) + log(1.0/Density))*Gas_Constant;
 }
 
+void CIdealGas::ComputeState_rhoe(unsigned long nPoint, const su2double *rho, const su2double *e,
+                                  const CFluidBatch& state) {
+
+  /*--- The derived (real gas) models override the scalar methods, their batches are evaluated
+   *    with those by the default implementation. ---*/
+
+  if (typeid(*this) != typeid(CIdealGas)) {
+    CFluidModel::ComputeState_rhoe(nPoint, rho, e, state);
+    return;
+  }
+
+  /*--- Same expressions as SetTDState_rhoe. ---*/
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const su2double pressure = Gamma_Minus_One*rho[iPoint]*e[iPoint];
+    state.Pressure[iPoint] = pressure;
+    state.Temperature[iPoint] = Gamma_Minus_One*e[iPoint]/Gas_Constant;
+    state.SoundSpeed2[iPoint] = Gamma*pressure/rho[iPoint];
+    state.dPdrho_e[iPoint] = Gamma_Minus_One*e[iPoint];
+    state.dPde_rho[iPoint] = Gamma_Minus_One*rho[iPoint];
+    state.dTdrho_e[iPoint] = 0.0;
+    state.dTde_rho[iPoint] = Gamma_Minus_One/Gas_Constant;
+  }
+}
+
+void CIdealGas::ComputeState_PT(unsigned long nPoint, const su2double *P, const su2double *T,
+                                const CFluidBatch& state) {
+
+  if (typeid(*this) != typeid(CIdealGas)) {
+    CFluidModel::ComputeState_PT(nPoint, P, T, state);
+    return;
+  }
+
+  /*--- Same expressions as SetTDState_PT. ---*/
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    state.Density[iPoint] = P[iPoint]/(T[iPoint]*Gas_Constant);
+    state.StaticEnergy[iPoint] = T[iPoint]*Gas_Constant/Gamma_Minus_One;
+  }
+  ComputeState_rhoe(nPoint, state.Density, state.StaticEnergy, state);
+}
+
 void CIdealGas::SetTDState_PT (su2double P, su2double T ) {
   su2double e = T*Gas_Constant/Gamma_Minus_One;
   su2double rho = P/(T*Gas_Constant);
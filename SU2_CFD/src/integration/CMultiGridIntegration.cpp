@@ -302,16 +302,20 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   unsigned short Boundary, iMarker, iChildren, iVar;
   su2double Area_Parent, Area_Children;
   const su2double *Solution_Fine = nullptr, *Solution_Coarse = nullptr;
+  su2double *Solution = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
+  const size_t chunkSize = computeStaticChunkSize(geo_coarse->GetnPointDomain(), omp_get_num_threads(), OMP_MAX_SIZE);
 
-  su2double *Solution = new su2double[nVar];
+  /*--- The correction is stored in Solution_Old of the coarse grid. ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
     Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
 
+    Solution = sol_coarse->GetNodes()->GetSolution_Old(Point_Coarse);
+
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
@@ -326,13 +330,8 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
 
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] += Solution_Coarse[iVar];
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse,Solution);
   }
 
-  delete [] Solution;
-
   /*--- Remove any contributions from no-slip walls. ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -344,7 +343,7 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
 
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        Point_Coarse = geo_coarse->vertexData[iMarker].GetNode(iVertex);
 
         /*--- For dirichlet boundary condtions, set the correction to zero.
          Note that Solution_Old stores the correction not the actual value ---*/
@@ -364,9 +363,9 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   }
   SU2_OMP_BARRIER
 
-  /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
+  /*--- Each fine point is the child of a single coarse point, the threads write to disjoint blocks. ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
@@ -435,7 +434,7 @@ void CMultiGridIntegration::SmoothProlongated_Correction(unsigned short RunTime_
 
         SU2_OMP_FOR_STAT(32)
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           Residual_Old = solver->GetNodes()->GetResidual_Old(iPoint);
           solver->LinSysRes.SetBlock(iPoint, Residual_Old);
         }
@@ -483,9 +482,11 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   unsigned long Point_Fine, Point_Coarse;
   unsigned short iChildren;
 
-  /// TODO: Need to check for possible race condition here (multiple coarse points setting the same fine).
+  const size_t chunkSize = computeStaticChunkSize(geo_coarse->GetnPointDomain(), omp_get_num_threads(), OMP_MAX_SIZE);
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  /*--- Each fine point is the child of a single coarse point, the threads write to disjoint blocks. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
@@ -500,18 +501,19 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iVar, iChildren;
   const su2double *Residual_Fine;
+  su2double *Residual = nullptr;
 
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
 
-  su2double *Residual = new su2double[nVar];
+  const size_t chunkSize = computeStaticChunkSize(geo_coarse->GetnPointDomain(), omp_get_num_threads(), OMP_MAX_SIZE);
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
     sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
 
-    for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
+    Residual = sol_coarse->GetNodes()->GetResTruncError(Point_Coarse);
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
       Point_Fine = geo_coarse->nodes->GetChildren_CV(Point_Coarse, iChildren);
@@ -519,11 +521,8 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
-    sol_coarse->GetNodes()->AddRes_TruncError(Point_Coarse, Residual);
   }
 
-  delete [] Residual;
-
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
         (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
@@ -531,7 +530,7 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
 
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        Point_Coarse = geo_coarse->vertexData[iMarker].GetNode(iVertex);
         sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
     }
@@ -559,21 +558,24 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
   unsigned short iMarker, iVar, iChildren, iDim;
   su2double Area_Parent, Area_Children, Vector[3] = {0.0};
   const su2double *Solution_Fine = nullptr, *Grid_Vel = nullptr;
+  su2double *Solution = nullptr;
 
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const unsigned short nVar = sol_coarse->GetnVar();
   const unsigned short nDim = geo_fine->GetnDim();
   const bool grid_movement = config->GetGrid_Movement();
 
-  su2double *Solution = new su2double[nVar];
+  const size_t chunkSize = computeStaticChunkSize(geo_coarse->GetnPointDomain(), omp_get_num_threads(), OMP_MAX_SIZE);
 
   /*--- Compute coarse solution from fine solution ---*/
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPointDomain(), omp_get_num_threads()))
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
 
     Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
 
+    Solution = sol_coarse->GetNodes()->GetSolution(Point_Coarse);
+
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
 
     for (iChildren = 0; iChildren < geo_coarse->nodes->GetnChildren_CV(Point_Coarse); iChildren++) {
@@ -586,12 +588,8 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
       }
     }
 
-    sol_coarse->GetNodes()->SetSolution(Point_Coarse, Solution);
-
   }
 
-  delete [] Solution;
-
   /*--- Update the solution at the no-slip walls ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -602,7 +600,7 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
 
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        Point_Coarse = geo_coarse->vertexData[iMarker].GetNode(iVertex);
 
         if (Solver_Position == FLOW_SOL) {
 
@@ -647,18 +645,19 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
   unsigned short iVar, iDim, iChildren;
   su2double Area_Parent, Area_Children;
   const su2double* const* Gradient_fine = nullptr;
+  su2double **Gradient = nullptr;
 
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
 
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double [nDim];
+  const size_t chunkSize = computeStaticChunkSize(geo_coarse->GetnPoint(), omp_get_num_threads(), OMP_MAX_SIZE);
 
-  SU2_OMP_FOR_STAT(roundUpDiv(geo_coarse->GetnPoint(), omp_get_num_threads()))
+  SU2_OMP_FOR_DYN(chunkSize)
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
     Area_Parent = geo_coarse->nodes->GetVolume(Point_Coarse);
 
+    Gradient = sol_coarse->GetNodes()->GetGradient(Point_Coarse);
+
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
         Gradient[iVar][iDim] = 0.0;
@@ -672,13 +671,8 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
         for (iDim = 0; iDim < nDim; iDim++)
           Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Area_Children/Area_Parent;
     }
-    sol_coarse->GetNodes()->SetGradient(Point_Coarse,Gradient);
   }
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-
 }
 
 void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSolver ***solver_container,
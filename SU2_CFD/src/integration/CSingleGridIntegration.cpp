@@ -193,7 +193,7 @@ void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSys
 
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
-        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        Point_Coarse = geo_coarse->vertexData[iMarker].GetNode(iVertex);
         sol_coarse->GetNodes()->SetmuT(Point_Coarse,0.0);
       }
     }
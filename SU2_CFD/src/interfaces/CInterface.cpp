@@ -107,7 +107,7 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
       nLocalVertexDonor = donor_geometry->GetnVertex(Marker_Donor);
 
       for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-        Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+        Point_Donor = donor_geometry->vertexData[Marker_Donor].GetNode(iVertex);
         if (donor_geometry->nodes->GetDomain(Point_Donor))
           nLocalVertexDonorOwned++;
       }
@@ -164,7 +164,7 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 
 
     for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-      Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+      Point_Donor = donor_geometry->vertexData[Marker_Donor].GetNode(iVertex);
 
       /*--- If this processor owns the node ---*/
 
@@ -232,7 +232,7 @@ void CInterface::BroadcastData(CSolver *donor_solution, CSolver *target_solution
 
       for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
 
-        Point_Target = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+        Point_Target = target_geometry->vertexData[Marker_Target].GetNode(iVertex);
 
         /*--- If this processor owns the node ---*/
         if (target_geometry->nodes->GetDomain(Point_Target)) {
@@ -67,8 +67,8 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
 
   Coord         = donor_geometry->nodes->GetCoord(Point_Donor);
 
-  Normal        = donor_geometry->vertex[Marker_Donor][Vertex_Donor]->GetNormal();
-  PointNormal   = donor_geometry->vertex[Marker_Donor][Vertex_Donor]->GetNormal_Neighbor();
+  Normal        = donor_geometry->vertexData[Marker_Donor].GetNormal(Vertex_Donor);
+  PointNormal   = donor_geometry->vertexData[Marker_Donor].GetNormal_Neighbor(Vertex_Donor);
   Coord_Normal  = donor_geometry->nodes->GetCoord(PointNormal);
 
   Twall = 0.0; Tnormal = 0.0; dTdn = 0.0; dist2 = 0.0; Area = 0.0;
@@ -137,7 +137,7 @@ void CConjugateHeatInterface::GetDonor_Variable(CSolver *donor_solution, CGeomet
   }
   else if (incompressible_flow) {
 
-    iPoint = donor_geometry->vertex[Marker_Donor][Vertex_Donor]->GetNode();
+    iPoint = donor_geometry->vertexData[Marker_Donor].GetNode(Vertex_Donor);
 
     thermal_conductivityND  = donor_solution->GetNodes()->GetThermalConductivity(iPoint);
     heat_flux_density       = thermal_conductivityND*dTdn;
@@ -114,10 +114,10 @@ void CFlowTractionInterface::GetDonor_Variable(CSolver *flow_solution, CGeometry
       viscous_flow = false; break;
   }
 
-  const auto Point_Flow = flow_geometry->vertex[Marker_Flow][Vertex_Flow]->GetNode();
+  const auto Point_Flow = flow_geometry->vertexData[Marker_Flow].GetNode(Vertex_Flow);
 
   // Get the normal at the vertex: this normal goes inside the fluid domain.
-  const su2double* Normal_Flow = flow_geometry->vertex[Marker_Flow][Vertex_Flow]->GetNormal();
+  const su2double* Normal_Flow = flow_geometry->vertexData[Marker_Flow].GetNormal(Vertex_Flow);
 
   // If we do not want integrated tractions, i.e. forces, we will need to divide by area.
   su2double oneOnArea = 1.0;
@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/numerics/flow/flow_diffusion.hpp"
+#include "../../../../Common/include/omp_structure.hpp"
 
 CAvgGrad_Base::CAvgGrad_Base(unsigned short val_nDim,
                              unsigned short val_nVar,
@@ -692,6 +693,211 @@ CNumerics::ResidualType<> CAvgGrad_Flow::ComputeResidual(const CConfig* config)
 
 }
 
+bool CAvgGrad_Flow::SupportsEdgePack(const CConfig* config) const {
+  return !using_uq && !config->GetQCR() && !config->GetWall_Functions() && !config->GetDiscrete_Adjoint();
+}
+
+void CAvgGrad_Flow::ComputeResidual(EdgePack& pack, const CConfig* config) {
+
+  /*--- The operations are those of the edge-wise version, in the same order, with the
+   *    loop over the edges (lanes) innermost. The edge geometry comes from the pack. ---*/
+
+  implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  constexpr auto N = EdgePack::SIZE;
+  const unsigned short nPrimVarGrad = nDim+1;
+  const unsigned short iEnergy = nVar-1;
+
+  unsigned short iVar, jVar, iDim, jDim;
+  unsigned long iLane;
+
+  /*--- Mean values. ---*/
+
+  su2double MeanV[MAXNDIM+3][N], MeanLam[N], MeanEddy[N], MeanGrad[MAXNDIM+1][MAXNDIM][N];
+
+  for (iVar = 0; iVar < nPrimVar; iVar++) {
+    SU2_OMP_SIMD
+    for (iLane = 0; iLane < N; iLane++)
+      MeanV[iVar][iLane] = 0.5*(pack.PrimVar_i[iVar][iLane]+pack.PrimVar_j[iVar][iLane]);
+  }
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < N; iLane++) {
+    MeanLam[iLane] = 0.5*(pack.LamVisc_i[iLane] + pack.LamVisc_j[iLane]);
+    MeanEddy[iLane] = 0.5*(pack.EddyVisc_i[iLane] + pack.EddyVisc_j[iLane]);
+  }
+
+  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      SU2_OMP_SIMD
+      for (iLane = 0; iLane < N; iLane++)
+        MeanGrad[iVar][iDim][iLane] = 0.5*(pack.Grad_i[iVar][iDim][iLane] + pack.Grad_j[iVar][iDim][iLane]);
+    }
+  }
+
+  /*--- Projection of the mean gradient in the direction of the edge. ---*/
+
+  if (correct_gradient) {
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      su2double Proj[N];
+      SU2_OMP_SIMD
+      for (iLane = 0; iLane < N; iLane++) {
+        Proj[iLane] = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Proj[iLane] += MeanGrad[iVar][iDim][iLane]*pack.EdgeVector[iDim][iLane];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) {
+        SU2_OMP_SIMD
+        for (iLane = 0; iLane < N; iLane++) {
+          const su2double corr = (Proj[iLane] - (pack.PrimVar_j[iVar][iLane]-pack.PrimVar_i[iVar][iLane])) *
+                                 pack.EdgeVector[iDim][iLane] / pack.Dist2[iLane];
+          MeanGrad[iVar][iDim][iLane] -= (pack.Dist2[iLane] != 0.0)? corr : su2double(0.0);
+        }
+      }
+    }
+  }
+
+  /*--- Stress tensor and heat flux. ---*/
+
+  su2double tau[MAXNDIM][MAXNDIM][N], heat_flux[MAXNDIM][N];
+
+  const su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < N; iLane++) {
+    const su2double total_viscosity = MeanLam[iLane] + MeanEddy[iLane];
+
+    su2double div_vel = 0.0;
+    for (iDim = 0 ; iDim < nDim; iDim++)
+      div_vel += MeanGrad[iDim+1][iDim][iLane];
+
+    for (iDim = 0 ; iDim < nDim; iDim++)
+      for (jDim = 0 ; jDim < nDim; jDim++)
+        tau[iDim][jDim][iLane] = total_viscosity*( MeanGrad[jDim+1][iDim][iLane] + MeanGrad[iDim+1][jDim][iLane] )
+                               - TWO3*total_viscosity*div_vel*delta[iDim][jDim];
+
+    const su2double heat_flux_factor = Cp * (MeanLam[iLane]/Prandtl_Lam + MeanEddy[iLane]/Prandtl_Turb);
+    for (iDim = 0; iDim < nDim; iDim++)
+      heat_flux[iDim][iLane] = heat_flux_factor*MeanGrad[0][iDim][iLane];
+  }
+
+  /*--- Projected flux, the momentum flux in direction iDim is the row iDim of tau. ---*/
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < N; iLane++) {
+    pack.Flux[0][iLane] = 0.0;
+    for (iVar = 1; iVar <= iEnergy; iVar++)
+      pack.Flux[iVar][iLane] = 0.0;
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      su2double energy_flux = tau[iDim][0][iLane]*MeanV[1][iLane];
+      for (jDim = 1; jDim < nDim; jDim++)
+        energy_flux += tau[iDim][jDim][iLane]*MeanV[jDim+1][iLane];
+      energy_flux += heat_flux[iDim][iLane];
+
+      for (jDim = 0; jDim < nDim; jDim++)
+        pack.Flux[jDim+1][iLane] += tau[iDim][jDim][iLane]*pack.Normal[iDim][iLane];
+      pack.Flux[iEnergy][iLane] += energy_flux*pack.Normal[iDim][iLane];
+    }
+  }
+
+  if (!implicit) return;
+
+  /*--- Jacobians of the stress tensor and heat flux (see SetTauJacobian and SetHeatFluxJacobian). ---*/
+
+  su2double tau_jac[MAXNDIM][MAXNDIM+1][N], heat_flux_jac[MAXNDIM+2][N];
+
+  const su2double cpoR = Gamma/Gamma_Minus_One;
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < N; iLane++) {
+    const su2double dist_ij = sqrt(pack.Dist2[iLane]);
+    const su2double Density = MeanV[nDim+2][iLane];
+    const su2double Pressure = MeanV[nDim+1][iLane];
+    const su2double total_viscosity = MeanLam[iLane] + MeanEddy[iLane];
+    const su2double xi = total_viscosity/(Density*dist_ij);
+
+    su2double UnitNormal[MAXNDIM];
+    for (iDim = 0; iDim < nDim; iDim++)
+      UnitNormal[iDim] = pack.Normal[iDim][iLane]/pack.Area[iLane];
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (jDim = 0; jDim < nDim; jDim++)
+        tau_jac[iDim][jDim+1][iLane] = -xi*(delta[iDim][jDim] + UnitNormal[iDim]*UnitNormal[jDim]/3.0);
+
+      tau_jac[iDim][0][iLane] = 0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        tau_jac[iDim][0][iLane] -= tau_jac[iDim][jDim+1][iLane]*MeanV[jDim+1][iLane];
+    }
+
+    su2double sqvel = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      sqvel += MeanV[iDim+1][iLane]*MeanV[iDim+1][iLane];
+
+    const su2double phi = Gamma_Minus_One/Density;
+    const su2double heat_flux_factor = MeanLam[iLane]/Prandtl_Lam + MeanEddy[iLane]/Prandtl_Turb;
+    const su2double conductivity_over_Rd = cpoR*heat_flux_factor/dist_ij;
+
+    heat_flux_jac[0][iLane] = conductivity_over_Rd * (-Pressure/(Density*Density) + 0.5*sqvel*phi);
+    for (iDim = 0; iDim < nDim; iDim++)
+      heat_flux_jac[iDim+1][iLane] = conductivity_over_Rd * (-phi*MeanV[iDim+1][iLane]);
+    heat_flux_jac[iEnergy][iLane] = conductivity_over_Rd * phi;
+  }
+
+  /*--- Projected Jacobians (see GetViscousProjJacs). ---*/
+
+  SU2_OMP_SIMD
+  for (iLane = 0; iLane < N; iLane++) {
+    const su2double dS = pack.Area[iLane];
+    const su2double factor = 0.5/MeanV[nDim+2][iLane];
+
+    for (jVar = 0; jVar < nVar; jVar++)
+      pack.Jacobian_i[0][jVar][iLane] = 0.0;
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (jVar = 0; jVar <= nDim; jVar++)
+        pack.Jacobian_i[iDim+1][jVar][iLane] = dS*tau_jac[iDim][jVar][iLane];
+      pack.Jacobian_i[iDim+1][iEnergy][iLane] = dS*0.0;
+    }
+
+    su2double contraction = tau_jac[0][0][iLane]*MeanV[1][iLane];
+    for (iDim = 1; iDim < nDim; iDim++)
+      contraction += tau_jac[iDim][0][iLane]*MeanV[iDim+1][iLane];
+
+    pack.Jacobian_i[iEnergy][0][iLane] = dS*(contraction - heat_flux_jac[0][iLane]);
+    for (iDim = 0; iDim < nDim; iDim++)
+      pack.Jacobian_i[iEnergy][iDim+1][iLane] = -dS*(tau_jac[iDim][0][iLane] + heat_flux_jac[iDim+1][iLane]);
+    pack.Jacobian_i[iEnergy][iEnergy][iLane] = -dS*heat_flux_jac[iEnergy][iLane];
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        pack.Jacobian_j[iVar][jVar][iLane] = -pack.Jacobian_i[iVar][jVar][iLane];
+
+    su2double proj_viscousflux_vel = pack.Flux[1][iLane]*MeanV[1][iLane];
+    for (iDim = 1; iDim < nDim; iDim++)
+      proj_viscousflux_vel += pack.Flux[iDim+1][iLane]*MeanV[iDim+1][iLane];
+
+    pack.Jacobian_i[iEnergy][0][iLane] -= factor*proj_viscousflux_vel;
+    pack.Jacobian_j[iEnergy][0][iLane] -= factor*proj_viscousflux_vel;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      pack.Jacobian_i[iEnergy][iDim+1][iLane] += factor*pack.Flux[iDim+1][iLane];
+      pack.Jacobian_j[iEnergy][iDim+1][iLane] += factor*pack.Flux[iDim+1][iLane];
+    }
+  }
+
+  /*--- Degenerate edges (zero length) have no Jacobian. ---*/
+
+  for (iLane = 0; iLane < N; iLane++) {
+    if (pack.Dist2[iLane] != 0.0) continue;
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++) {
+        pack.Jacobian_i[iVar][jVar][iLane] = 0.0;
+        pack.Jacobian_j[iVar][jVar][iLane] = 0.0;
+      }
+    }
+  }
+}
+
 void CAvgGrad_Flow::SetHeatFluxVector(const su2double* const *val_gradprimvar,
                                       const su2double val_laminar_viscosity,
                                       const su2double val_eddy_viscosity) {
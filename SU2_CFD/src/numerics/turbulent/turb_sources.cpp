@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/numerics/turbulent/turb_sources.hpp"
+#include "../../../../Common/include/omp_structure.hpp"
 
 CSourceBase_TurbSA::CSourceBase_TurbSA(unsigned short val_nDim,
                                        unsigned short val_nVar,
@@ -57,316 +58,22 @@ CSourceBase_TurbSA::CSourceBase_TurbSA(unsigned short val_nDim,
 
 }
 
-CSourcePieceWise_TurbSA::CSourcePieceWise_TurbSA(unsigned short val_nDim,
-                                                 unsigned short val_nVar,
-                                                 const CConfig* config) :
-                         CSourceBase_TurbSA(val_nDim, val_nVar, config) {
+template<bool Edwards, bool CompCorrection, bool Negative>
+CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::CSourcePieceWise_TurbSA_T(unsigned short val_nDim,
+                                                                                      unsigned short val_nVar,
+                                                                                      const CConfig* config) :
+  CSourceBase_TurbSA(val_nDim, val_nVar, config),
+  transition(!Edwards && !CompCorrection && !Negative && (config->GetKind_Trans_Model() == BC)) {
 
-  transition = (config->GetKind_Trans_Model() == BC);
-}
-
-CNumerics::ResidualType<> CSourcePieceWise_TurbSA::ComputeResidual(const CConfig* config) {
-
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
-//  BC Transition Model variables
-  su2double vmag, rey, re_theta, re_theta_t, re_v;
-  su2double tu , nu_cr, nu_t, nu_BC, chi_1, chi_2, term1, term2, term_exponential;
-
-  if (incompressible) {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+4];
-  }
-  else {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+5];
-  }
-
-  Residual        = 0.0;
-  Production      = 0.0;
-  Destruction     = 0.0;
-  CrossProduction = 0.0;
-  Jacobian_i[0]   = 0.0;
-
-  gamma_BC = 0.0;
-  vmag = 0.0;
-  tu   = config->GetTurbulenceIntensity_FreeStream();
-  rey  = config->GetReynolds();
-
-  if (nDim==2) {
-    vmag = sqrt(V_i[1]*V_i[1]+V_i[2]*V_i[2]);
-  }
-  else {
-    vmag = sqrt(V_i[1]*V_i[1]+V_i[2]*V_i[2]+V_i[3]*V_i[3]);
-  }
-
-  /*--- Evaluate Omega ---*/
-
-  Omega = sqrt(Vorticity_i[0]*Vorticity_i[0] + Vorticity_i[1]*Vorticity_i[1] + Vorticity_i[2]*Vorticity_i[2]);
-
-  /*--- Rotational correction term ---*/
-
-  if (rotating_frame) { Omega += 2.0*min(0.0, StrainMag_i-Omega); }
-
-  if (dist_i > 1e-10) {
-
-    /*--- Production term ---*/
-
-    dist_i_2 = dist_i*dist_i;
-    nu = Laminar_Viscosity_i/Density_i;
-    Ji = TurbVar_i[0]/nu;
-    Ji_2 = Ji*Ji;
-    Ji_3 = Ji_2*Ji;
-    fv1 = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    S = Omega;
-    inv_k2_d2 = 1.0/(k2*dist_i_2);
-
-    Shat = S + TurbVar_i[0]*fv2*inv_k2_d2;
-    Shat = max(Shat, 1.0e-10);
-    inv_Shat = 1.0/Shat;
-
-//    Original SA model
-//    Production = cb1*(1.0-ft2)*Shat*TurbVar_i[0]*Volume;
-
-    if (transition) {
-
-//    BC model constants
-      chi_1 = 0.002;
-      chi_2 = 5.0;
-
-      nu_t = (TurbVar_i[0]*fv1); //S-A variable
-      nu_cr = chi_2/rey;
-      nu_BC = (nu_t)/(vmag*dist_i);
-
-      re_v   = ((Density_i*pow(dist_i,2.))/(Laminar_Viscosity_i))*Omega;
-      re_theta = re_v/2.193;
-      re_theta_t = (803.73 * pow((tu + 0.6067),-1.027)); //MENTER correlation
-      //re_theta_t = 163.0 + exp(6.91-tu); //ABU-GHANNAM & SHAW correlation
-
-      term1 = sqrt(max(re_theta-re_theta_t,0.)/(chi_1*re_theta_t));
-      term2 = sqrt(max(nu_BC-nu_cr,0.)/(nu_cr));
-      term_exponential = (term1 + term2);
-      gamma_BC = 1.0 - exp(-term_exponential);
-
-      Production = gamma_BC*cb1*Shat*TurbVar_i[0]*Volume;
-    }
-    else {
-      Production = cb1*Shat*TurbVar_i[0]*Volume;
-    }
-
-    /*--- Destruction term ---*/
-
-    r = min(TurbVar_i[0]*inv_Shat*inv_k2_d2,10.0);
-    g = r + cw2*(pow(r,6.0)-r);
-    g_6 =  pow(g,6.0);
-    glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
-    fw = g*glim;
-
-//    Original SA model
-//    Destruction = (cw1*fw-cb1*ft2/k2)*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
-
-    Destruction = cw1*fw*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
-
-    /*--- Diffusion term ---*/
-
-    norm2_Grad = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
-
-    CrossProduction = cb2_sigma*norm2_Grad*Volume;
-
-    Residual = Production - Destruction + CrossProduction;
-
-    /*--- Implicit part, production term ---*/
-
-    dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
-    dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
-    if ( Shat <= 1.0e-10 ) dShat = 0.0;
-    else dShat = (fv2+TurbVar_i[0]*dfv2)*inv_k2_d2;
-
-    if (transition) {
-      Jacobian_i[0] += gamma_BC*cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
-    }
-    else {
-      Jacobian_i[0] += cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
-    }
-
-    /*--- Implicit part, destruction term ---*/
-
-    dr = (Shat-TurbVar_i[0]*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
-    if (r == 10.0) dr = 0.0;
-    dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
-    dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
-    Jacobian_i[0] -= cw1*(dfw*TurbVar_i[0] +  2.0*fw)*TurbVar_i[0]/dist_i_2*Volume;
-
-  }
-
-//  AD::SetPreaccOut(Residual);
-//  AD::EndPreacc();
-
-  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
-
-}
-
-CSourcePieceWise_TurbSA_COMP::CSourcePieceWise_TurbSA_COMP(unsigned short val_nDim,
-                                                           unsigned short val_nVar,
-                                                           const CConfig* config) :
-                              CSourceBase_TurbSA(val_nDim, val_nVar, config), c5(3.5) { }
-
-CNumerics::ResidualType<> CSourcePieceWise_TurbSA_COMP::ComputeResidual(const CConfig* config) {
-
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
-  if (incompressible) {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+4];
+  if (transition) {
+    tu  = config->GetTurbulenceIntensity_FreeStream();
+    rey = config->GetReynolds();
   }
-  else {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+5];
-  }
-
-  Residual        = 0.0;
-  Production      = 0.0;
-  Destruction     = 0.0;
-  CrossProduction = 0.0;
-  Jacobian_i[0]   = 0.0;
-
-  /*--- Evaluate Omega ---*/
-
-  Omega = sqrt(Vorticity_i[0]*Vorticity_i[0] + Vorticity_i[1]*Vorticity_i[1] + Vorticity_i[2]*Vorticity_i[2]);
-
-  /*--- Rotational correction term ---*/
-
-  if (rotating_frame) { Omega += 2.0*min(0.0, StrainMag_i-Omega); }
-
-  if (dist_i > 1e-10) {
-
-    /*--- Production term ---*/
-
-    dist_i_2 = dist_i*dist_i;
-    nu = Laminar_Viscosity_i/Density_i;
-    Ji = TurbVar_i[0]/nu;
-    Ji_2 = Ji*Ji;
-    Ji_3 = Ji_2*Ji;
-    fv1 = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    S = Omega;
-    inv_k2_d2 = 1.0/(k2*dist_i_2);
-
-    Shat = S + TurbVar_i[0]*fv2*inv_k2_d2;
-    Shat = max(Shat, 1.0e-10);
-    inv_Shat = 1.0/Shat;
-
-    /*--- Production term ---*/;
-
-    Production = cb1*Shat*TurbVar_i[0]*Volume;
-
-    /*--- Destruction term ---*/
-
-    r = min(TurbVar_i[0]*inv_Shat*inv_k2_d2,10.0);
-    g = r + cw2*(pow(r,6.0)-r);
-    g_6 = pow(g,6.0);
-    glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
-    fw = g*glim;
-
-    Destruction = cw1*fw*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
-
-    /*--- Diffusion term ---*/
-
-    norm2_Grad = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
-
-    CrossProduction = cb2_sigma*norm2_Grad*Volume;
-
-    Residual = Production - Destruction + CrossProduction;
-
-    /*--- Compressibility Correction term ---*/
-    Pressure_i = V_i[nDim+1];
-    SoundSpeed_i = sqrt(Pressure_i*Gamma/Density_i);
-    aux_cc=0;
-    for(iDim=0;iDim<nDim;++iDim){
-      for(jDim=0;jDim<nDim;++jDim){
-        aux_cc+=PrimVar_Grad_i[1+iDim][jDim]*PrimVar_Grad_i[1+iDim][jDim];}}
-    CompCorrection=c5*(TurbVar_i[0]*TurbVar_i[0]/(SoundSpeed_i*SoundSpeed_i))*aux_cc*Volume;
-
-    Residual -= CompCorrection;
-
-    /*--- Implicit part, production term ---*/
-
-    dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
-    dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
-    if ( Shat <= 1.0e-10 ) dShat = 0.0;
-    else dShat = (fv2+TurbVar_i[0]*dfv2)*inv_k2_d2;
-    Jacobian_i[0] += cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
-
-    /*--- Implicit part, destruction term ---*/
-
-    dr = (Shat-TurbVar_i[0]*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
-    if (r == 10.0) dr = 0.0;
-    dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
-    dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
-    Jacobian_i[0] -= cw1*(dfw*TurbVar_i[0] + 2.0*fw)*TurbVar_i[0]/dist_i_2*Volume;
-
-    /* Compressibility Correction */
-    Jacobian_i[0] -= 2.0*c5*(TurbVar_i[0]/(SoundSpeed_i*SoundSpeed_i))*aux_cc*Volume;
-
-  }
-
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
-
-  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
-
 }
 
-CSourcePieceWise_TurbSA_E::CSourcePieceWise_TurbSA_E(unsigned short val_nDim,
-                                                     unsigned short val_nVar,
-                                                     const CConfig* config) :
-                           CSourceBase_TurbSA(val_nDim, val_nVar, config) { }
-
-CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E::ComputeResidual(const CConfig* config) {
-
-  unsigned short iDim, jDim;
-
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
-
-  if (incompressible) {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+4];
-  }
-  else {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+5];
-  }
-
-  Residual        = 0.0;
-  Production      = 0.0;
-  Destruction     = 0.0;
-  CrossProduction = 0.0;
-  Jacobian_i[0]   = 0.0;
+template<bool Edwards, bool CompCorrection, bool Negative>
+template<class VelocityGradient>
+su2double CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::StrainRate(const VelocityGradient& gradVel) const {
 
   /*
    From NASA Turbulence model site. http://turbmodels.larc.nasa.gov/spalart.html
@@ -375,242 +82,166 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E::ComputeResidual(const CConf
    In this modificaton Omega is replaced by Strain Rate
    */
 
-  /*--- Evaluate Omega, here Omega is the Strain Rate ---*/
-
-  Sbar = 0.0;
-  for(iDim=0;iDim<nDim;++iDim){
-    for(jDim=0;jDim<nDim;++jDim){
-      Sbar+= (PrimVar_Grad_i[1+iDim][jDim]+PrimVar_Grad_i[1+jDim][iDim])*(PrimVar_Grad_i[1+iDim][jDim]);}}
-  for(iDim=0;iDim<nDim;++iDim){
-    Sbar-= ((2.0/3.0)*pow(PrimVar_Grad_i[1+iDim][iDim],2.0));}
-
-  Omega= sqrt(max(Sbar,0.0));
-
-  /*--- Rotational correction term ---*/
-
-  if (rotating_frame) { Omega += 2.0*min(0.0, StrainMag_i-Omega); }
-
-  if (dist_i > 1e-10) {
-
-    /*--- Production term ---*/
+  su2double Sbar = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+    for (unsigned short jDim = 0; jDim < nDim; ++jDim)
+      Sbar += (gradVel(iDim,jDim)+gradVel(jDim,iDim))*gradVel(iDim,jDim);
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+    Sbar -= (2.0/3.0)*pow(gradVel(iDim,iDim),2.0);
 
-    dist_i_2 = dist_i*dist_i;
-    nu = Laminar_Viscosity_i/Density_i;
-    Ji = TurbVar_i[0]/nu;
-    Ji_2 = Ji*Ji;
-    Ji_3 = Ji_2*Ji;
-    fv1 = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    S = Omega;
-    inv_k2_d2 = 1.0/(k2*dist_i_2);
-
-    //Shat = S + TurbVar_i[0]*fv2*inv_k2_d2;
-    Shat = max(S*((1.0/max(Ji,1.0e-16))+fv1),1.0e-16);
-
-    Shat = max(Shat, 1.0e-10);
-    inv_Shat = 1.0/Shat;
-
-    /*--- Production term ---*/;
-
-    Production = cb1*Shat*TurbVar_i[0]*Volume;
-
-    /*--- Destruction term ---*/
+  return sqrt(max(Sbar,0.0));
+}
 
-    r = min(TurbVar_i[0]*inv_Shat*inv_k2_d2,10.0);
-    r=tanh(r)/tanh(1.0);
+template<bool Edwards, bool CompCorrection, bool Negative>
+template<class VelocityGradient>
+su2double CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::VelocityGradientNorm2(const VelocityGradient& gradVel) const {
 
-    g = r + cw2*(pow(r,6.0)-r);
-    g_6 = pow(g,6.0);
-    glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
-    fw = g*glim;
+  su2double aux_cc = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+    for (unsigned short jDim = 0; jDim < nDim; ++jDim)
+      aux_cc += gradVel(iDim,jDim)*gradVel(iDim,jDim);
+  return aux_cc;
+}
 
-    Destruction = cw1*fw*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
+template<bool Edwards, bool CompCorrection, bool Negative>
+typename CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::PointTerms
+CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::ComputePoint(su2double density, su2double lamVisc,
+                                                                          su2double nuTilde, su2double omega,
+                                                                          su2double norm2_Grad, su2double auxCC,
+                                                                          su2double soundSpeed, su2double vmag,
+                                                                          su2double dist, su2double volume) const {
+  PointTerms out;
 
-    /*--- Diffusion term ---*/
+  if (!(dist > 1e-10)) return out;
 
-    norm2_Grad = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-        norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
+  const su2double dist_2 = dist*dist;
 
-    CrossProduction = cb2_sigma*norm2_Grad*Volume;
+  /*--- Negative SA model, for negative values of the variable. ---*/
 
-    Residual = Production - Destruction + CrossProduction;
+  if (Negative && !(nuTilde > 0.0)) {
 
-    /*--- Implicit part, production term ---*/
+    out.Production = cb1*(1.0-ct3)*omega*nuTilde*volume;
+    out.Destruction = cw1*nuTilde*nuTilde/dist_2*volume;
+    out.CrossProduction = cb2_sigma*norm2_Grad*volume;
 
-    dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
-    dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
+    out.Residual = out.Production + out.Destruction + out.CrossProduction;
 
-    if ( Shat <= 1.0e-10 ) dShat = 0.0;
-    else dShat = -S*pow(Ji,-2.0)/nu + S*dfv1;
-    Jacobian_i[0] += cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
+    out.Jacobian += cb1*(1.0-ct3)*omega*volume;
+    out.Jacobian += 2.0*cw1*nuTilde/dist_2*volume;
 
-    /*--- Implicit part, destruction term ---*/
+    return out;
+  }
 
-    dr = (Shat-TurbVar_i[0]*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
-    dr=(1-pow(tanh(r),2.0))*(dr)/tanh(1.0);
-    dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
-    dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
-    Jacobian_i[0] -= cw1*(dfw*TurbVar_i[0] + 2.0*fw)*TurbVar_i[0]/dist_i_2*Volume;
+  /*--- Production term ---*/
 
-  }
+  const su2double nu = lamVisc/density;
+  const su2double Ji = nuTilde/nu;
+  const su2double Ji_2 = Ji*Ji;
+  const su2double Ji_3 = Ji_2*Ji;
+  const su2double fv1 = Ji_3/(Ji_3+cv1_3);
+  const su2double fv2 = 1.0 - Ji/(1.0+Ji*fv1);
+  const su2double S = omega;
+  const su2double inv_k2_d2 = 1.0/(k2*dist_2);
 
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
+  su2double Shat;
+  if (Edwards) Shat = max(S*((1.0/max(Ji,1.0e-16))+fv1),1.0e-16);
+  else Shat = S + nuTilde*fv2*inv_k2_d2;
+  Shat = max(Shat, 1.0e-10);
+  const su2double inv_Shat = 1.0/Shat;
 
-  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
+//    Original SA model
+//    Production = cb1*(1.0-ft2)*Shat*TurbVar_i[0]*Volume;
 
-}
+  if (transition) {
 
-CSourcePieceWise_TurbSA_E_COMP::CSourcePieceWise_TurbSA_E_COMP(unsigned short val_nDim,
-                                                               unsigned short val_nVar,
-                                                               const CConfig* config) :
-                                CSourceBase_TurbSA(val_nDim, val_nVar, config) { }
+//    BC model constants
+    const su2double chi_1 = 0.002;
+    const su2double chi_2 = 5.0;
 
-CNumerics::ResidualType<> CSourcePieceWise_TurbSA_E_COMP::ComputeResidual(const CConfig* config) {
+    const su2double nu_t = (nuTilde*fv1); //S-A variable
+    const su2double nu_cr = chi_2/rey;
+    const su2double nu_BC = (nu_t)/(vmag*dist);
 
-  unsigned short iDim;
+    const su2double re_v = ((density*pow(dist,2.))/(lamVisc))*omega;
+    const su2double re_theta = re_v/2.193;
+    const su2double re_theta_t = (803.73 * pow((tu + 0.6067),-1.027)); //MENTER correlation
+    //re_theta_t = 163.0 + exp(6.91-tu); //ABU-GHANNAM & SHAW correlation
 
-  //  AD::StartPreacc();
-  //  AD::SetPreaccIn(V_i, nDim+6);
-  //  AD::SetPreaccIn(Vorticity_i, nDim);
-  //  AD::SetPreaccIn(StrainMag_i);
-  //  AD::SetPreaccIn(TurbVar_i[0]);
-  //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-  //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+    const su2double term1 = sqrt(max(re_theta-re_theta_t,0.)/(chi_1*re_theta_t));
+    const su2double term2 = sqrt(max(nu_BC-nu_cr,0.)/(nu_cr));
+    const su2double term_exponential = (term1 + term2);
+    out.GammaBC = 1.0 - exp(-term_exponential);
 
-  if (incompressible) {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+4];
+    out.Production = out.GammaBC*cb1*Shat*nuTilde*volume;
   }
   else {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+5];
+    out.Production = cb1*Shat*nuTilde*volume;
   }
 
-  Residual        = 0.0;
-  Production      = 0.0;
-  Destruction     = 0.0;
-  CrossProduction = 0.0;
-  Jacobian_i[0]   = 0.0;
+  /*--- Destruction term ---*/
 
-  /*
-   From NASA Turbulence model site. http://turbmodels.larc.nasa.gov/spalart.html
-   This form was developed primarily to improve the near-wall numerical behavior of the model (i.e., the goal was to improve the convergence behavior). The reference is:
-   Edwards, J. R. and Chandra, S. "Comparison of Eddy Viscosity-Transport Turbulence Models for Three-Dimensional, Shock-Separated Flowfields," AIAA Journal, Vol. 34, No. 4, 1996, pp. 756-763.
-   In this modificaton Omega is replaced by Strain Rate
-   */
-
-  /*--- Evaluate Omega, here Omega is the Strain Rate ---*/
+  su2double r = min(nuTilde*inv_Shat*inv_k2_d2,10.0);
+  if (Edwards) r = tanh(r)/tanh(1.0);
 
-  Sbar = 0.0;
-  for(iDim=0;iDim<nDim;++iDim){
-    for(jDim=0;jDim<nDim;++jDim){
-      Sbar+= (PrimVar_Grad_i[1+iDim][jDim]+PrimVar_Grad_i[1+jDim][iDim])*(PrimVar_Grad_i[1+iDim][jDim]);}}
-  for(iDim=0;iDim<nDim;++iDim){
-    Sbar-= ((2.0/3.0)*pow(PrimVar_Grad_i[1+iDim][iDim],2.0));}
-
-  Omega= sqrt(max(Sbar,0.0));
-
-  /*--- Rotational correction term ---*/
-
-  if (rotating_frame) { Omega += 2.0*min(0.0, StrainMag_i-Omega); }
+  const su2double g = r + cw2*(pow(r,6.0)-r);
+  const su2double g_6 = pow(g,6.0);
+  const su2double glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
+  const su2double fw = g*glim;
 
-  if (dist_i > 1e-10) {
-
-    /*--- Production term ---*/
-
-    dist_i_2 = dist_i*dist_i;
-    nu = Laminar_Viscosity_i/Density_i;
-    Ji = TurbVar_i[0]/nu;
-    Ji_2 = Ji*Ji;
-    Ji_3 = Ji_2*Ji;
-    fv1 = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    S = Omega;
-    inv_k2_d2 = 1.0/(k2*dist_i_2);
-
-    Shat = max(S*((1.0/max(Ji,1.0e-16))+fv1),1.0e-16);
-
-    Shat = max(Shat, 1.0e-10);
-    inv_Shat = 1.0/Shat;
-
-    /*--- Production term ---*/;
-
-    Production = cb1*Shat*TurbVar_i[0]*Volume;
-
-    /*--- Destruction term ---*/
-
-    r = min(TurbVar_i[0]*inv_Shat*inv_k2_d2,10.0);
-    r=tanh(r)/tanh(1.0);
-
-    g = r + cw2*(pow(r,6.0)-r);
-    g_6 = pow(g,6.0);
-    glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
-    fw = g*glim;
+//    Original SA model
+//    Destruction = (cw1*fw-cb1*ft2/k2)*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
 
-    Destruction = cw1*fw*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
+  out.Destruction = cw1*fw*nuTilde*nuTilde/dist_2*volume;
 
-    /*--- Diffusion term ---*/
+  /*--- Diffusion term ---*/
 
-    norm2_Grad = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-        norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
+  out.CrossProduction = cb2_sigma*norm2_Grad*volume;
 
-    CrossProduction = cb2_sigma*norm2_Grad*Volume;
+  out.Residual = out.Production - out.Destruction + out.CrossProduction;
 
-    Residual = Production - Destruction + CrossProduction;
+  /*--- Compressibility Correction term ---*/
 
-    /*--- Compressibility Correction term ---*/
-    Pressure_i = V_i[nDim+1];
-    SoundSpeed_i = sqrt(Pressure_i*Gamma/Density_i);
-    aux_cc=0;
-    for(iDim=0;iDim<nDim;++iDim){
-        for(jDim=0;jDim<nDim;++jDim){
-            aux_cc+=PrimVar_Grad_i[1+iDim][jDim]*PrimVar_Grad_i[1+iDim][jDim];}}
-    CompCorrection=c5*(TurbVar_i[0]*TurbVar_i[0]/(SoundSpeed_i*SoundSpeed_i))*aux_cc*Volume;
+  if (CompCorrection) {
+    out.Residual -= c5*(nuTilde*nuTilde/(soundSpeed*soundSpeed))*auxCC*volume;
+  }
 
-    Residual -= CompCorrection;
+  /*--- Implicit part, production term ---*/
 
-    /*--- Implicit part, production term ---*/
+  const su2double dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
+  const su2double dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
 
-    dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
-    dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
+  su2double dShat;
+  if ( Shat <= 1.0e-10 ) dShat = 0.0;
+  else if (Edwards) dShat = -S*pow(Ji,-2.0)/nu + S*dfv1;
+  else dShat = (fv2+nuTilde*dfv2)*inv_k2_d2;
 
-    if ( Shat <= 1.0e-10 ) dShat = 0.0;
-    else dShat = -S*pow(Ji,-2.0)/nu + S*dfv1;
-    Jacobian_i[0] += cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
+  if (transition) {
+    out.Jacobian += out.GammaBC*cb1*(nuTilde*dShat+Shat)*volume;
+  }
+  else {
+    out.Jacobian += cb1*(nuTilde*dShat+Shat)*volume;
+  }
 
-    /*--- Implicit part, destruction term ---*/
+  /*--- Implicit part, destruction term ---*/
 
-    dr = (Shat-TurbVar_i[0]*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
-    dr=(1-pow(tanh(r),2.0))*(dr)/tanh(1.0);
-    dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
-    dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
-    Jacobian_i[0] -= cw1*(dfw*TurbVar_i[0] + 2.0*fw)*TurbVar_i[0]/dist_i_2*Volume;
+  su2double dr = (Shat-nuTilde*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
+  if (Edwards) dr = (1-pow(tanh(r),2.0))*(dr)/tanh(1.0);
+  else if (r == 10.0) dr = 0.0;
+  const su2double dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
+  const su2double dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
+  out.Jacobian -= cw1*(dfw*nuTilde + 2.0*fw)*nuTilde/dist_2*volume;
 
-    /* Compressibility Correction */
-    Jacobian_i[0] -= 2.0*c5*(TurbVar_i[0]/(SoundSpeed_i*SoundSpeed_i))*aux_cc*Volume;
+  /*--- Compressibility Correction ---*/
 
+  if (CompCorrection) {
+    out.Jacobian -= 2.0*c5*(nuTilde/(soundSpeed*soundSpeed))*auxCC*volume;
   }
 
-  //  AD::SetPreaccOut(Residual);
-  //  AD::EndPreacc();
-
-  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
-
+  return out;
 }
 
-CSourcePieceWise_TurbSA_Neg::CSourcePieceWise_TurbSA_Neg(unsigned short val_nDim,
-                                                         unsigned short val_nVar,
-                                                         const CConfig* config) :
-                             CSourceBase_TurbSA(val_nDim, val_nVar, config) { }
-
-CNumerics::ResidualType<> CSourcePieceWise_TurbSA_Neg::ComputeResidual(const CConfig* config) {
-
-  unsigned short iDim;
+template<bool Edwards, bool CompCorrection, bool Negative>
+CNumerics::ResidualType<> CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::ComputeResidual(const CConfig* config) {
 
 //  AD::StartPreacc();
 //  AD::SetPreaccIn(V_i, nDim+6);
@@ -620,138 +251,101 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA_Neg::ComputeResidual(const CCo
 //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
 //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
 
-  if (incompressible) {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+4];
-  }
-  else {
-    Density_i = V_i[nDim+2];
-    Laminar_Viscosity_i = V_i[nDim+5];
-  }
+  Density_i = V_i[nDim+2];
+  Laminar_Viscosity_i = incompressible? V_i[nDim+4] : V_i[nDim+5];
 
-  Residual        = 0.0;
-  Production      = 0.0;
-  Destruction     = 0.0;
-  CrossProduction = 0.0;
-  Jacobian_i[0]   = 0.0;
+  auto gradVel = [&](unsigned short iDim, unsigned short jDim) { return PrimVar_Grad_i[1+iDim][jDim]; };
 
-  /*--- Evaluate Omega ---*/
+  /*--- Evaluate Omega (the strain rate for the Edwards modification) ---*/
 
-  Omega = sqrt(Vorticity_i[0]*Vorticity_i[0] + Vorticity_i[1]*Vorticity_i[1] + Vorticity_i[2]*Vorticity_i[2]);
+  su2double Omega;
+  if (Edwards) Omega = StrainRate(gradVel);
+  else Omega = sqrt(Vorticity_i[0]*Vorticity_i[0] + Vorticity_i[1]*Vorticity_i[1] + Vorticity_i[2]*Vorticity_i[2]);
 
   /*--- Rotational correction term ---*/
 
   if (rotating_frame) { Omega += 2.0*min(0.0, StrainMag_i-Omega); }
 
-  if (dist_i > 1e-10) {
+  su2double norm2_Grad = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
 
-    if (TurbVar_i[0] > 0.0) {
-
-      /*--- Production term ---*/
-
-      dist_i_2 = dist_i*dist_i;
-      nu = Laminar_Viscosity_i/Density_i;
-      Ji = TurbVar_i[0]/nu;
-      Ji_2 = Ji*Ji;
-      Ji_3 = Ji_2*Ji;
-      fv1 = Ji_3/(Ji_3+cv1_3);
-      fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-      ft2 = ct3*exp(-ct4*Ji_2);
-      S = Omega;
-      inv_k2_d2 = 1.0/(k2*dist_i_2);
-
-      Shat = S + TurbVar_i[0]*fv2*inv_k2_d2;
-      Shat = max(Shat, 1.0e-10);
-      inv_Shat = 1.0/Shat;
-
-      /*--- Production term ---*/;
-
-      //    Original SA model
-      //    Production = cb1*(1.0-ft2)*Shat*TurbVar_i[0]*Volume;
-
-      Production = cb1*Shat*TurbVar_i[0]*Volume;
-
-      /*--- Destruction term ---*/
-
-      r = min(TurbVar_i[0]*inv_Shat*inv_k2_d2,10.0);
-      g = r + cw2*(pow(r,6.0)-r);
-      g_6 =  pow(g,6.0);
-      glim = pow((1.0+cw3_6)/(g_6+cw3_6),1.0/6.0);
-      fw = g*glim;
-
-      Destruction = cw1*fw*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
-
-      /*--- Diffusion term ---*/
-
-      norm2_Grad = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
-
-      CrossProduction = cb2_sigma*norm2_Grad*Volume;
-
-      Residual = Production - Destruction + CrossProduction;
-
-      /*--- Implicit part, production term ---*/
-
-      dfv1 = 3.0*Ji_2*cv1_3/(nu*pow(Ji_3+cv1_3,2.));
-      dfv2 = -(1/nu-Ji_2*dfv1)/pow(1.+Ji*fv1,2.);
-      if ( Shat <= 1.0e-10 ) dShat = 0.0;
-      else dShat = (fv2+TurbVar_i[0]*dfv2)*inv_k2_d2;
-      Jacobian_i[0] += cb1*(TurbVar_i[0]*dShat+Shat)*Volume;
-
-      /*--- Implicit part, destruction term ---*/
-
-      dr = (Shat-TurbVar_i[0]*dShat)*inv_Shat*inv_Shat*inv_k2_d2;
-      if (r == 10.0) dr = 0.0;
-      dg = dr*(1.+cw2*(6.0*pow(r,5.0)-1.0));
-      dfw = dg*glim*(1.-g_6/(g_6+cw3_6));
-      Jacobian_i[0] -= cw1*(dfw*TurbVar_i[0] +  2.0*fw)*TurbVar_i[0]/dist_i_2*Volume;
-
-    }
-
-    else {
-
-      /*--- Production term ---*/
-
-      dist_i_2 = dist_i*dist_i;
+  su2double aux_cc = 0.0;
+  if (CompCorrection) {
+    Pressure_i = V_i[nDim+1];
+    SoundSpeed_i = sqrt(Pressure_i*Gamma/Density_i);
+    aux_cc = VelocityGradientNorm2(gradVel);
+  }
 
-      /*--- Production term ---*/;
+  su2double vmag = 0.0;
+  if (transition) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      vmag += V_i[iDim+1]*V_i[iDim+1];
+    vmag = sqrt(vmag);
+  }
 
-      Production = cb1*(1.0-ct3)*Omega*TurbVar_i[0]*Volume;
+  const auto terms = ComputePoint(Density_i, Laminar_Viscosity_i, TurbVar_i[0], Omega, norm2_Grad,
+                                  aux_cc, SoundSpeed_i, vmag, dist_i, Volume);
+  Residual        = terms.Residual;
+  Jacobian_i[0]   = terms.Jacobian;
+  Production      = terms.Production;
+  Destruction     = terms.Destruction;
+  CrossProduction = terms.CrossProduction;
+  gamma_BC        = terms.GammaBC;
 
-      /*--- Destruction term ---*/
+//  AD::SetPreaccOut(Residual);
+//  AD::EndPreacc();
 
-      Destruction = cw1*TurbVar_i[0]*TurbVar_i[0]/dist_i_2*Volume;
+  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
 
-      /*--- Diffusion term ---*/
+}
 
-      norm2_Grad = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        norm2_Grad += TurbVar_Grad_i[0][iDim]*TurbVar_Grad_i[0][iDim];
+template<bool Edwards, bool CompCorrection, bool Negative>
+bool CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::SupportsPointPack(const CConfig* config) const {
+  return !transition && !config->GetDiscrete_Adjoint();
+}
 
-      CrossProduction = cb2_sigma*norm2_Grad*Volume;
+template<bool Edwards, bool CompCorrection, bool Negative>
+void CSourcePieceWise_TurbSA_T<Edwards,CompCorrection,Negative>::ComputeResidual(TurbSourcePack& pack,
+                                                                                 const CConfig* config) {
+  constexpr auto N = TurbSourcePack::SIZE;
 
-      Residual = Production + Destruction + CrossProduction;
+  SU2_OMP_SIMD
+  for (unsigned long iLane = 0; iLane < N; iLane++) {
 
-      /*--- Implicit part, production term ---*/
+    auto gradVel = [&](unsigned short iDim, unsigned short jDim) { return pack.VelocityGrad[iDim][jDim][iLane]; };
 
-      Jacobian_i[0] += cb1*(1.0-ct3)*Omega*Volume;
+    su2double Omega;
+    if (Edwards) Omega = StrainRate(gradVel);
+    else Omega = sqrt(pack.Vorticity[0][iLane]*pack.Vorticity[0][iLane] +
+                      pack.Vorticity[1][iLane]*pack.Vorticity[1][iLane] +
+                      pack.Vorticity[2][iLane]*pack.Vorticity[2][iLane]);
 
-      /*--- Implicit part, destruction term ---*/
+    if (rotating_frame) { Omega += 2.0*min(0.0, pack.StrainMag[iLane]-Omega); }
 
-      Jacobian_i[0] += 2.0*cw1*TurbVar_i[0]/dist_i_2*Volume;
+    su2double norm2_Grad = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      norm2_Grad += pack.TurbVarGrad[iDim][iLane]*pack.TurbVarGrad[iDim][iLane];
 
+    su2double aux_cc = 0.0, soundSpeed = 0.0;
+    if (CompCorrection) {
+      soundSpeed = sqrt(pack.Pressure[iLane]*Gamma/pack.Density[iLane]);
+      aux_cc = VelocityGradientNorm2(gradVel);
     }
 
+    const auto terms = ComputePoint(pack.Density[iLane], pack.LamVisc[iLane], pack.TurbVar[0][iLane], Omega,
+                                    norm2_Grad, aux_cc, soundSpeed, 0.0, pack.Distance[iLane], pack.Volume[iLane]);
+    pack.Residual[0][iLane] = terms.Residual;
+    pack.Jacobian[0][0][iLane] = terms.Jacobian;
   }
-
-//  AD::SetPreaccOut(Residual);
-//  AD::EndPreacc();
-
-  return ResidualType<>(&Residual, &Jacobian_i, nullptr);
-
 }
 
+template class CSourcePieceWise_TurbSA_T<false, false, false>;
+template class CSourcePieceWise_TurbSA_T<false, true, false>;
+template class CSourcePieceWise_TurbSA_T<true, false, false>;
+template class CSourcePieceWise_TurbSA_T<true, true, false>;
+template class CSourcePieceWise_TurbSA_T<false, false, true>;
+
 CSourcePieceWise_TurbSST::CSourcePieceWise_TurbSST(unsigned short val_nDim,
                                                    unsigned short val_nVar,
                                                    const su2double *constants,
@@ -783,6 +377,71 @@ CSourcePieceWise_TurbSST::CSourcePieceWise_TurbSST(unsigned short val_nDim,
 
 }
 
+CSourcePieceWise_TurbSST::PointTerms
+CSourcePieceWise_TurbSST::ComputePoint(su2double density, su2double eddyVisc, su2double strainMag,
+                                       su2double vorticityMag, su2double diverg, su2double kine, su2double omega,
+                                       su2double F1, su2double F2, su2double CDkw, su2double dist,
+                                       su2double volume) const {
+  PointTerms out;
+
+  /*--- Computation of blended constants for the source terms---*/
+
+  const su2double alfa_blended = F1*alfa_1 + (1.0 - F1)*alfa_2;
+  const su2double beta_blended = F1*beta_1 + (1.0 - F1)*beta_2;
+
+  if (dist > 1e-10) {
+
+   /*--- Production ---*/
+
+   su2double pk = eddyVisc*strainMag*strainMag - 2.0/3.0*density*kine*diverg;
+   pk = min(pk,20.0*beta_star*density*omega*kine);
+   pk = max(pk,0.0);
+
+   const su2double zeta = max(omega, vorticityMag*F2/a1);
+
+   su2double pw = strainMag*strainMag - 2.0/3.0*zeta*diverg;
+   pw = alfa_blended*density*max(pw,0.0);
+
+   /*--- Sustaining terms, if desired. Note that if the production terms are
+         larger equal than the sustaining terms, the original formulation is
+         obtained again. This is in contrast to the version in literature
+         where the sustaining terms are simply added. This latter approach could
+         lead to problems for very big values of the free-stream turbulence
+         intensity. ---*/
+
+   if ( sustaining_terms ) {
+     const su2double sust_k = beta_star*density*kAmb*omegaAmb;
+     const su2double sust_w = beta_blended*density*omegaAmb*omegaAmb;
+
+     pk = max(pk, sust_k);
+     pw = max(pw, sust_w);
+   }
+
+   /*--- Add the production terms to the residuals. ---*/
+
+   out.Residual[0] += pk*volume;
+   out.Residual[1] += pw*volume;
+
+   /*--- Dissipation ---*/
+
+   out.Residual[0] -= beta_star*density*omega*kine*volume;
+   out.Residual[1] -= beta_blended*density*omega*omega*volume;
+
+   /*--- Cross diffusion ---*/
+
+   out.Residual[1] += (1.0 - F1)*CDkw*volume;
+
+   /*--- Implicit part ---*/
+
+   out.Jacobian[0][0] = -beta_star*omega*volume;
+   out.Jacobian[0][1] = -beta_star*kine*volume;
+   out.Jacobian[1][0] = 0.0;
+   out.Jacobian[1][1] = -2.0*beta_blended*omega*volume;
+  }
+
+  return out;
+}
+
 CNumerics::ResidualType<> CSourcePieceWise_TurbSST::ComputeResidual(const CConfig* config) {
 
   AD::StartPreacc();
@@ -794,9 +453,6 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSST::ComputeResidual(const CConfi
   AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
   AD::SetPreaccIn(Vorticity_i, 3);
 
-  unsigned short iDim;
-  su2double alfa_blended, beta_blended;
-  su2double diverg, pk, pw, zeta;
   su2double VorticityMag = sqrt(Vorticity_i[0]*Vorticity_i[0] +
                                 Vorticity_i[1]*Vorticity_i[1] +
                                 Vorticity_i[2]*Vorticity_i[2]);
@@ -816,94 +472,66 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSST::ComputeResidual(const CConfi
     Eddy_Viscosity_i = V_i[nDim+6];
   }
 
-  Residual[0] = 0.0;       Residual[1] = 0.0;
-  Jacobian_i[0][0] = 0.0;  Jacobian_i[0][1] = 0.0;
-  Jacobian_i[1][0] = 0.0;  Jacobian_i[1][1] = 0.0;
-
-  /*--- Computation of blended constants for the source terms---*/
-
-  alfa_blended = F1_i*alfa_1 + (1.0 - F1_i)*alfa_2;
-  beta_blended = F1_i*beta_1 + (1.0 - F1_i)*beta_2;
+  su2double diverg = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    diverg += PrimVar_Grad_i[iDim+1][iDim];
 
-  if (dist_i > 1e-10) {
+  /* if using UQ methodolgy, calculate production using perturbed Reynolds stress matrix */
 
-   /*--- Production ---*/
-
-   diverg = 0.0;
-   for (iDim = 0; iDim < nDim; iDim++)
-     diverg += PrimVar_Grad_i[iDim+1][iDim];
-
-   /* if using UQ methodolgy, calculate production using perturbed Reynolds stress matrix */
-
-   if (using_uq){
-     SetReynoldsStressMatrix(TurbVar_i[0]);
-     SetPerturbedRSM(TurbVar_i[0], config);
-     SetPerturbedStrainMag(TurbVar_i[0]);
-     pk = Eddy_Viscosity_i*PerturbedStrainMag*PerturbedStrainMag
-          - 2.0/3.0*Density_i*TurbVar_i[0]*diverg;
-   }
-   else {
-     pk = Eddy_Viscosity_i*StrainMag_i*StrainMag_i - 2.0/3.0*Density_i*TurbVar_i[0]*diverg;
-   }
-
-
-   pk = min(pk,20.0*beta_star*Density_i*TurbVar_i[1]*TurbVar_i[0]);
-   pk = max(pk,0.0);
-
-   zeta = max(TurbVar_i[1], VorticityMag*F2_i/a1);
+  su2double strainMag = StrainMag_i;
 
-   /* if using UQ methodolgy, calculate production using perturbed Reynolds stress matrix */
+  if (using_uq && (dist_i > 1e-10)) {
+    SetReynoldsStressMatrix(TurbVar_i[0]);
+    SetPerturbedRSM(TurbVar_i[0], config);
+    SetPerturbedStrainMag(TurbVar_i[0]);
+    strainMag = PerturbedStrainMag;
+  }
 
-   if (using_uq){
-     pw = PerturbedStrainMag * PerturbedStrainMag - 2.0/3.0*zeta*diverg;
-   }
-   else {
-     pw = StrainMag_i*StrainMag_i - 2.0/3.0*zeta*diverg;
-   }
-   pw = alfa_blended*Density_i*max(pw,0.0);
+  const auto terms = ComputePoint(Density_i, Eddy_Viscosity_i, strainMag, VorticityMag, diverg,
+                                  TurbVar_i[0], TurbVar_i[1], F1_i, F2_i, CDkw_i, dist_i, Volume);
 
-   /*--- Sustaining terms, if desired. Note that if the production terms are
-         larger equal than the sustaining terms, the original formulation is
-         obtained again. This is in contrast to the version in literature
-         where the sustaining terms are simply added. This latter approach could
-         lead to problems for very big values of the free-stream turbulence
-         intensity. ---*/
+  for (unsigned short iVar = 0; iVar < 2; iVar++) {
+    Residual[iVar] = terms.Residual[iVar];
+    for (unsigned short jVar = 0; jVar < 2; jVar++)
+      Jacobian_i[iVar][jVar] = terms.Jacobian[iVar][jVar];
+  }
 
-   if ( sustaining_terms ) {
-     const su2double sust_k = beta_star*Density_i*kAmb*omegaAmb;
-     const su2double sust_w = beta_blended*Density_i*omegaAmb*omegaAmb;
+  AD::SetPreaccOut(Residual, nVar);
+  AD::EndPreacc();
 
-     pk = max(pk, sust_k);
-     pw = max(pw, sust_w);
-   }
+  return ResidualType<>(Residual, Jacobian_i, nullptr);
 
-   /*--- Add the production terms to the residuals. ---*/
+}
 
-   Residual[0] += pk*Volume;
-   Residual[1] += pw*Volume;
+bool CSourcePieceWise_TurbSST::SupportsPointPack(const CConfig* config) const {
+  return !using_uq && !config->GetDiscrete_Adjoint();
+}
 
-   /*--- Dissipation ---*/
+void CSourcePieceWise_TurbSST::ComputeResidual(TurbSourcePack& pack, const CConfig* config) {
 
-   Residual[0] -= beta_star*Density_i*TurbVar_i[1]*TurbVar_i[0]*Volume;
-   Residual[1] -= beta_blended*Density_i*TurbVar_i[1]*TurbVar_i[1]*Volume;
+  constexpr auto N = TurbSourcePack::SIZE;
 
-   /*--- Cross diffusion ---*/
+  SU2_OMP_SIMD
+  for (unsigned long iLane = 0; iLane < N; iLane++) {
 
-   Residual[1] += (1.0 - F1_i)*CDkw_i*Volume;
+    const su2double VorticityMag = sqrt(pack.Vorticity[0][iLane]*pack.Vorticity[0][iLane] +
+                                        pack.Vorticity[1][iLane]*pack.Vorticity[1][iLane] +
+                                        pack.Vorticity[2][iLane]*pack.Vorticity[2][iLane]);
+    su2double diverg = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      diverg += pack.VelocityGrad[iDim][iDim][iLane];
 
-   /*--- Implicit part ---*/
+    const auto terms = ComputePoint(pack.Density[iLane], pack.EddyVisc[iLane], pack.StrainMag[iLane],
+                                    VorticityMag, diverg, pack.TurbVar[0][iLane], pack.TurbVar[1][iLane],
+                                    pack.F1[iLane], pack.F2[iLane], pack.CrossDiff[iLane],
+                                    pack.Distance[iLane], pack.Volume[iLane]);
 
-   Jacobian_i[0][0] = -beta_star*TurbVar_i[1]*Volume;
-   Jacobian_i[0][1] = -beta_star*TurbVar_i[0]*Volume;
-   Jacobian_i[1][0] = 0.0;
-   Jacobian_i[1][1] = -2.0*beta_blended*TurbVar_i[1]*Volume;
+    for (unsigned short iVar = 0; iVar < 2; iVar++) {
+      pack.Residual[iVar][iLane] = terms.Residual[iVar];
+      for (unsigned short jVar = 0; jVar < 2; jVar++)
+        pack.Jacobian[iVar][jVar][iLane] = terms.Jacobian[iVar][jVar];
+    }
   }
-
-  AD::SetPreaccOut(Residual, nVar);
-  AD::EndPreacc();
-
-  return ResidualType<>(Residual, Jacobian_i, nullptr);
-
 }
 
 void CSourcePieceWise_TurbSST::GetMeanRateOfStrainMatrix(su2double **S_ij)
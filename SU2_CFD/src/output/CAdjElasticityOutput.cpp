@@ -149,48 +149,48 @@ void CAdjElasticityOutput::LoadVolumeData(CConfig *config, CGeometry *geometry,
   CVariable* Node_Struc = solver[ADJFEA_SOL]->GetNodes();
   CPoint*    Node_Geo  = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
+  SetVolumeOutputValue(volumeField.coord_x, iPoint,  Node_Geo->GetCoord(iPoint, 0));
+  SetVolumeOutputValue(volumeField.coord_y, iPoint,  Node_Geo->GetCoord(iPoint, 1));
   if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+    SetVolumeOutputValue(volumeField.coord_z, iPoint, Node_Geo->GetCoord(iPoint, 2));
 
-  SetVolumeOutputValue("ADJOINT-X", iPoint, Node_Struc->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("ADJOINT-Y", iPoint, Node_Struc->GetSolution(iPoint, 1));
+  SetVolumeOutputValue(volumeField.adjoint_x, iPoint, Node_Struc->GetSolution(iPoint, 0));
+  SetVolumeOutputValue(volumeField.adjoint_y, iPoint, Node_Struc->GetSolution(iPoint, 1));
   if (nVar_FEM == 3)
-    SetVolumeOutputValue("ADJOINT-Z", iPoint, Node_Struc->GetSolution(iPoint, 2));
+    SetVolumeOutputValue(volumeField.adjoint_z, iPoint, Node_Struc->GetSolution(iPoint, 2));
 
-  SetVolumeOutputValue("SENSITIVITY-X", iPoint, Node_Struc->GetSensitivity(iPoint, 0));
-  SetVolumeOutputValue("SENSITIVITY-Y", iPoint, Node_Struc->GetSensitivity(iPoint, 1));
+  SetVolumeOutputValue(volumeField.sensitivity_x, iPoint, Node_Struc->GetSensitivity(iPoint, 0));
+  SetVolumeOutputValue(volumeField.sensitivity_y, iPoint, Node_Struc->GetSensitivity(iPoint, 1));
   if (nDim == 3)
-    SetVolumeOutputValue("SENSITIVITY-Z", iPoint, Node_Struc->GetSensitivity(iPoint, 2));
+    SetVolumeOutputValue(volumeField.sensitivity_z, iPoint, Node_Struc->GetSensitivity(iPoint, 2));
 }
 
 void CAdjElasticityOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid coordinates
-  AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
+  volumeField.coord_x = AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
+  volumeField.coord_y = AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
   if (nDim == 3)
-    AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
+    volumeField.coord_z = AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
 
   /// BEGIN_GROUP: SOLUTION, DESCRIPTION: Adjoint variables of the current objective function.
   /// DESCRIPTION: Adjoint x-component.
-  AddVolumeOutput("ADJOINT-X", "Adjoint_x", "SOLUTION", "adjoint of displacement in the x direction");
+  volumeField.adjoint_x = AddVolumeOutput("ADJOINT-X", "Adjoint_x", "SOLUTION", "adjoint of displacement in the x direction");
   /// DESCRIPTION: Adjoint y-component.
-  AddVolumeOutput("ADJOINT-Y", "Adjoint_y", "SOLUTION", "adjoint of displacement in the y direction");
+  volumeField.adjoint_y = AddVolumeOutput("ADJOINT-Y", "Adjoint_y", "SOLUTION", "adjoint of displacement in the y direction");
   if (nVar_FEM == 3)
     /// DESCRIPTION: Adjoint z-component.
-    AddVolumeOutput("ADJOINT-Z", "Adjoint_z", "SOLUTION", "adjoint of displacement in the z direction");
+    volumeField.adjoint_z = AddVolumeOutput("ADJOINT-Z", "Adjoint_z", "SOLUTION", "adjoint of displacement in the z direction");
   /// END_GROUP
 
   /// BEGIN_GROUP: SENSITIVITY, DESCRIPTION: Geometrical sensitivities of the current objective function.
   /// DESCRIPTION: Sensitivity x-component.
-  AddVolumeOutput("SENSITIVITY-X", "Sensitivity_x", "SENSITIVITY", "geometric sensitivity in the x direction");
+  volumeField.sensitivity_x = AddVolumeOutput("SENSITIVITY-X", "Sensitivity_x", "SENSITIVITY", "geometric sensitivity in the x direction");
   /// DESCRIPTION: Sensitivity y-component.
-  AddVolumeOutput("SENSITIVITY-Y", "Sensitivity_y", "SENSITIVITY", "geometric sensitivity  in the y direction");
+  volumeField.sensitivity_y = AddVolumeOutput("SENSITIVITY-Y", "Sensitivity_y", "SENSITIVITY", "geometric sensitivity  in the y direction");
   if (nDim == 3)
     /// DESCRIPTION: Sensitivity z-component.
-    AddVolumeOutput("SENSITIVITY-Z", "Sensitivity_z", "SENSITIVITY", "geometric sensitivity  in the z direction");
+    volumeField.sensitivity_z = AddVolumeOutput("SENSITIVITY-Z", "Sensitivity_z", "SENSITIVITY", "geometric sensitivity  in the z direction");
   /// END_GROUP
 
 }
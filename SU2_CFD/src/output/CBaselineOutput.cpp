@@ -84,16 +84,18 @@ void CBaselineOutput::SetVolumeOutputFields(CConfig *config){
     }
   }
 
+  fieldHandles.resize(fields.size());
+
   // Grid coordinates
-  AddVolumeOutput(fields[0], fields[0], "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput(fields[1], fields[1], "COORDINATES", "y-component of the coordinate vector");
+  fieldHandles[0] = AddVolumeOutput(fields[0], fields[0], "COORDINATES", "x-component of the coordinate vector");
+  fieldHandles[1] = AddVolumeOutput(fields[1], fields[1], "COORDINATES", "y-component of the coordinate vector");
   if (nDim == 3)
-    AddVolumeOutput(fields[2], fields[2], "COORDINATES", "z-component of the coordinate vector");
+    fieldHandles[2] = AddVolumeOutput(fields[2], fields[2], "COORDINATES", "z-component of the coordinate vector");
 
   // Add all the remaining fields
 
   for (iField = nDim; iField < fields.size(); iField++){
-    AddVolumeOutput(fields[iField], fields[iField], "SOLUTION","");
+    fieldHandles[iField] = AddVolumeOutput(fields[iField], fields[iField], "SOLUTION","");
   }
 
 }
@@ -111,7 +113,7 @@ void CBaselineOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
   CVariable* Node_Sol  = solver[0]->GetNodes();
 
   for (iField = 0; iField < fields.size(); iField++){
-    SetVolumeOutputValue(fields[iField], iPoint, Node_Sol->GetSolution(iPoint, iField));
+    SetVolumeOutputValue(fieldHandles[iField], iPoint, Node_Sol->GetSolution(iPoint, iField));
   }
 
 }
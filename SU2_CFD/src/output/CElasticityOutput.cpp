@@ -169,70 +169,70 @@ void CElasticityOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSo
   CVariable* Node_Struc = solver[FEA_SOL]->GetNodes();
   CPoint*    Node_Geo  = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
+  SetVolumeOutputValue(volumeField.coord_x, iPoint,  Node_Geo->GetCoord(iPoint, 0));
+  SetVolumeOutputValue(volumeField.coord_y, iPoint,  Node_Geo->GetCoord(iPoint, 1));
   if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+    SetVolumeOutputValue(volumeField.coord_z, iPoint, Node_Geo->GetCoord(iPoint, 2));
 
-  SetVolumeOutputValue("DISPLACEMENT-X", iPoint, Node_Struc->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("DISPLACEMENT-Y", iPoint, Node_Struc->GetSolution(iPoint, 1));
-  if (nDim == 3) SetVolumeOutputValue("DISPLACEMENT-Z", iPoint, Node_Struc->GetSolution(iPoint, 2));
+  SetVolumeOutputValue(volumeField.displacement_x, iPoint, Node_Struc->GetSolution(iPoint, 0));
+  SetVolumeOutputValue(volumeField.displacement_y, iPoint, Node_Struc->GetSolution(iPoint, 1));
+  if (nDim == 3) SetVolumeOutputValue(volumeField.displacement_z, iPoint, Node_Struc->GetSolution(iPoint, 2));
 
   if(dynamic){
-    SetVolumeOutputValue("VELOCITY-X", iPoint, Node_Struc->GetSolution_Vel(iPoint, 0));
-    SetVolumeOutputValue("VELOCITY-Y", iPoint, Node_Struc->GetSolution_Vel(iPoint, 1));
-    if (nDim == 3) SetVolumeOutputValue("VELOCITY-Z", iPoint, Node_Struc->GetSolution_Vel(iPoint, 2));
+    SetVolumeOutputValue(volumeField.velocity_x, iPoint, Node_Struc->GetSolution_Vel(iPoint, 0));
+    SetVolumeOutputValue(volumeField.velocity_y, iPoint, Node_Struc->GetSolution_Vel(iPoint, 1));
+    if (nDim == 3) SetVolumeOutputValue(volumeField.velocity_z, iPoint, Node_Struc->GetSolution_Vel(iPoint, 2));
 
-    SetVolumeOutputValue("ACCELERATION-X", iPoint, Node_Struc->GetSolution_Accel(iPoint, 0));
-    SetVolumeOutputValue("ACCELERATION-Y", iPoint, Node_Struc->GetSolution_Accel(iPoint, 1));
-    if (nDim == 3) SetVolumeOutputValue("ACCELERATION-Z", iPoint, Node_Struc->GetSolution_Accel(iPoint, 2));
+    SetVolumeOutputValue(volumeField.acceleration_x, iPoint, Node_Struc->GetSolution_Accel(iPoint, 0));
+    SetVolumeOutputValue(volumeField.acceleration_y, iPoint, Node_Struc->GetSolution_Accel(iPoint, 1));
+    if (nDim == 3) SetVolumeOutputValue(volumeField.acceleration_z, iPoint, Node_Struc->GetSolution_Accel(iPoint, 2));
   }
 
-  SetVolumeOutputValue("STRESS-XX", iPoint, Node_Struc->GetStress_FEM(iPoint)[0]);
-  SetVolumeOutputValue("STRESS-YY", iPoint, Node_Struc->GetStress_FEM(iPoint)[1]);
-  SetVolumeOutputValue("STRESS-XY", iPoint, Node_Struc->GetStress_FEM(iPoint)[2]);
+  SetVolumeOutputValue(volumeField.stress_xx, iPoint, Node_Struc->GetStress_FEM(iPoint)[0]);
+  SetVolumeOutputValue(volumeField.stress_yy, iPoint, Node_Struc->GetStress_FEM(iPoint)[1]);
+  SetVolumeOutputValue(volumeField.stress_xy, iPoint, Node_Struc->GetStress_FEM(iPoint)[2]);
   if (nDim == 3){
-    SetVolumeOutputValue("STRESS-ZZ", iPoint, Node_Struc->GetStress_FEM(iPoint)[3]);
-    SetVolumeOutputValue("STRESS-XZ", iPoint, Node_Struc->GetStress_FEM(iPoint)[4]);
-    SetVolumeOutputValue("STRESS-YZ", iPoint, Node_Struc->GetStress_FEM(iPoint)[5]);
+    SetVolumeOutputValue(volumeField.stress_zz, iPoint, Node_Struc->GetStress_FEM(iPoint)[3]);
+    SetVolumeOutputValue(volumeField.stress_xz, iPoint, Node_Struc->GetStress_FEM(iPoint)[4]);
+    SetVolumeOutputValue(volumeField.stress_yz, iPoint, Node_Struc->GetStress_FEM(iPoint)[5]);
   }
-  SetVolumeOutputValue("VON_MISES_STRESS", iPoint, Node_Struc->GetVonMises_Stress(iPoint));
+  SetVolumeOutputValue(volumeField.von_mises_stress, iPoint, Node_Struc->GetVonMises_Stress(iPoint));
 
 }
 
 void CElasticityOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid coordinates
-  AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
+  volumeField.coord_x = AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
+  volumeField.coord_y = AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
   if (nDim == 3)
-    AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
+    volumeField.coord_z = AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
 
-  AddVolumeOutput("DISPLACEMENT-X",    "Displacement_x", "SOLUTION", "x-component of the displacement vector");
-  AddVolumeOutput("DISPLACEMENT-Y",    "Displacement_y", "SOLUTION", "y-component of the displacement vector");
-  if (nDim == 3) AddVolumeOutput("DISPLACEMENT-Z", "Displacement_z", "SOLUTION", "z-component of the displacement vector");
+  volumeField.displacement_x = AddVolumeOutput("DISPLACEMENT-X",    "Displacement_x", "SOLUTION", "x-component of the displacement vector");
+  volumeField.displacement_y = AddVolumeOutput("DISPLACEMENT-Y",    "Displacement_y", "SOLUTION", "y-component of the displacement vector");
+  if (nDim == 3) volumeField.displacement_z = AddVolumeOutput("DISPLACEMENT-Z", "Displacement_z", "SOLUTION", "z-component of the displacement vector");
 
   if(dynamic){
-    AddVolumeOutput("VELOCITY-X",    "Velocity_x", "VELOCITY", "x-component of the velocity vector");
-    AddVolumeOutput("VELOCITY-Y",    "Velocity_y", "VELOCITY", "y-component of the velocity vector");
-    if (nDim == 3) AddVolumeOutput("VELOCITY-Z", "Velocity_z", "VELOCITY", "z-component of the velocity vector");
+    volumeField.velocity_x = AddVolumeOutput("VELOCITY-X",    "Velocity_x", "VELOCITY", "x-component of the velocity vector");
+    volumeField.velocity_y = AddVolumeOutput("VELOCITY-Y",    "Velocity_y", "VELOCITY", "y-component of the velocity vector");
+    if (nDim == 3) volumeField.velocity_z = AddVolumeOutput("VELOCITY-Z", "Velocity_z", "VELOCITY", "z-component of the velocity vector");
 
-    AddVolumeOutput("ACCELERATION-X",    "Acceleration_x", "ACCELERATION", "x-component of the acceleration vector");
-    AddVolumeOutput("ACCELERATION-Y",    "Acceleration_y", "ACCELERATION", "y-component of the acceleration vector");
-    if (nDim == 3) AddVolumeOutput("ACCELERATION-Z", "Acceleration_z", "ACCELERATION", "z-component of the acceleration vector");
+    volumeField.acceleration_x = AddVolumeOutput("ACCELERATION-X",    "Acceleration_x", "ACCELERATION", "x-component of the acceleration vector");
+    volumeField.acceleration_y = AddVolumeOutput("ACCELERATION-Y",    "Acceleration_y", "ACCELERATION", "y-component of the acceleration vector");
+    if (nDim == 3) volumeField.acceleration_z = AddVolumeOutput("ACCELERATION-Z", "Acceleration_z", "ACCELERATION", "z-component of the acceleration vector");
   }
 
-  AddVolumeOutput("STRESS-XX",    "Sxx", "STRESS", "x-component of the normal stress vector");
-  AddVolumeOutput("STRESS-YY",    "Syy", "STRESS", "y-component of the normal stress vector");
-  AddVolumeOutput("STRESS-XY",    "Sxy", "STRESS", "xy shear stress component");
+  volumeField.stress_xx = AddVolumeOutput("STRESS-XX",    "Sxx", "STRESS", "x-component of the normal stress vector");
+  volumeField.stress_yy = AddVolumeOutput("STRESS-YY",    "Syy", "STRESS", "y-component of the normal stress vector");
+  volumeField.stress_xy = AddVolumeOutput("STRESS-XY",    "Sxy", "STRESS", "xy shear stress component");
 
   if (nDim == 3) {
-    AddVolumeOutput("STRESS-ZZ",    "Szz", "STRESS", "z-component of the normal stress vector");
-    AddVolumeOutput("STRESS-XZ",    "Sxz", "STRESS", "xz shear stress component");
-    AddVolumeOutput("STRESS-YZ",    "Syz", "STRESS", "yz shear stress component");
+    volumeField.stress_zz = AddVolumeOutput("STRESS-ZZ",    "Szz", "STRESS", "z-component of the normal stress vector");
+    volumeField.stress_xz = AddVolumeOutput("STRESS-XZ",    "Sxz", "STRESS", "xz shear stress component");
+    volumeField.stress_yz = AddVolumeOutput("STRESS-YZ",    "Syz", "STRESS", "yz shear stress component");
   }
 
-  AddVolumeOutput("VON_MISES_STRESS", "Von_Mises_Stress", "STRESS", "von-Mises stress");
+  volumeField.von_mises_stress = AddVolumeOutput("VON_MISES_STRESS", "Von_Mises_Stress", "STRESS", "von-Mises stress");
 
 }
 bool CElasticityOutput::SetInit_Residuals(CConfig *config){
@@ -130,31 +130,31 @@ void CFlowCompFEMOutput::SetHistoryOutputFields(CConfig *config){
 void CFlowCompFEMOutput::SetVolumeOutputFields(CConfig *config){
 
   // Grid coordinates
-  AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
-  AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
+  volumeField.coord_x = AddVolumeOutput("COORD-X", "x", "COORDINATES", "x-component of the coordinate vector");
+  volumeField.coord_y = AddVolumeOutput("COORD-Y", "y", "COORDINATES", "y-component of the coordinate vector");
   if (nDim == 3)
-    AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
+    volumeField.coord_z = AddVolumeOutput("COORD-Z", "z", "COORDINATES", "z-component of the coordinate vector");
 
   // Solution variables
-  AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density");
-  AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector");
-  AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector");
+  volumeField.density = AddVolumeOutput("DENSITY",    "Density",    "SOLUTION", "Density");
+  volumeField.momentum_x = AddVolumeOutput("MOMENTUM-X", "Momentum_x", "SOLUTION", "x-component of the momentum vector");
+  volumeField.momentum_y = AddVolumeOutput("MOMENTUM-Y", "Momentum_y", "SOLUTION", "y-component of the momentum vector");
   if (nDim == 3)
-    AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector");
-  AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy");
+    volumeField.momentum_z = AddVolumeOutput("MOMENTUM-Z", "Momentum_z", "SOLUTION", "z-component of the momentum vector");
+  volumeField.energy = AddVolumeOutput("ENERGY",     "Energy",     "SOLUTION", "Energy");
 
   // Primitive variables
-  AddVolumeOutput("PRESSURE",    "Pressure",                "PRIMITIVE", "Pressure");
-  AddVolumeOutput("TEMPERATURE", "Temperature",             "PRIMITIVE", "Temperature");
-  AddVolumeOutput("MACH",        "Mach",                    "PRIMITIVE", "Mach number");
-  AddVolumeOutput("PRESSURE_COEFF", "Pressure_Coefficient", "PRIMITIVE", "Pressure coefficient");
+  volumeField.pressure = AddVolumeOutput("PRESSURE",    "Pressure",                "PRIMITIVE", "Pressure");
+  volumeField.temperature = AddVolumeOutput("TEMPERATURE", "Temperature",             "PRIMITIVE", "Temperature");
+  volumeField.mach = AddVolumeOutput("MACH",        "Mach",                    "PRIMITIVE", "Mach number");
+  volumeField.pressure_coeff = AddVolumeOutput("PRESSURE_COEFF", "Pressure_Coefficient", "PRIMITIVE", "Pressure coefficient");
 
   if (config->GetKind_Solver() == FEM_NAVIER_STOKES){
-    AddVolumeOutput("LAMINAR_VISCOSITY", "Laminar_Viscosity", "PRIMITIVE", "Laminar viscosity");
+    volumeField.laminar_viscosity = AddVolumeOutput("LAMINAR_VISCOSITY", "Laminar_Viscosity", "PRIMITIVE", "Laminar viscosity");
   }
 
   if (config->GetKind_Solver() == FEM_LES && (config->GetKind_SGS_Model() != IMPLICIT_LES)) {
-    AddVolumeOutput("EDDY_VISCOSITY", "Eddy_Viscosity", "PRIMITIVE", "Turbulent eddy viscosity");
+    volumeField.eddy_viscosity = AddVolumeOutput("EDDY_VISCOSITY", "Eddy_Viscosity", "PRIMITIVE", "Turbulent eddy viscosity");
   }
 }
 
@@ -201,31 +201,31 @@ void CFlowCompFEMOutput::LoadVolumeDataFEM(CConfig *config, CGeometry *geometry,
   DGFluidModel->SetTDState_rhoe(U[0], StaticEnergy);
 
 
-  SetVolumeOutputValue("COORD-X",        index, coor[0]);
-  SetVolumeOutputValue("COORD-Y",        index, coor[1]);
+  SetVolumeOutputValue(volumeField.coord_x,        index, coor[0]);
+  SetVolumeOutputValue(volumeField.coord_y,        index, coor[1]);
   if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z",      index, coor[2]);
-  SetVolumeOutputValue("DENSITY",        index, U[0]);
-  SetVolumeOutputValue("MOMENTUM-X",     index, U[1]);
-  SetVolumeOutputValue("MOMENTUM-Y",     index, U[2]);
+    SetVolumeOutputValue(volumeField.coord_z,      index, coor[2]);
+  SetVolumeOutputValue(volumeField.density,        index, U[0]);
+  SetVolumeOutputValue(volumeField.momentum_x,     index, U[1]);
+  SetVolumeOutputValue(volumeField.momentum_y,     index, U[2]);
   if (nDim == 3){
-    SetVolumeOutputValue("MOMENTUM-Z",   index,  U[3]);
-    SetVolumeOutputValue("ENERGY",       index,  U[4]);
+    SetVolumeOutputValue(volumeField.momentum_z,   index,  U[3]);
+    SetVolumeOutputValue(volumeField.energy,       index,  U[4]);
   } else {
-    SetVolumeOutputValue("ENERGY",       index,  U[3]);
+    SetVolumeOutputValue(volumeField.energy,       index,  U[3]);
   }
 
-  SetVolumeOutputValue("PRESSURE",       index, DGFluidModel->GetPressure());
-  SetVolumeOutputValue("TEMPERATURE",    index, DGFluidModel->GetTemperature());
-  SetVolumeOutputValue("MACH",           index, sqrt(Velocity2)/DGFluidModel->GetSoundSpeed());
-  SetVolumeOutputValue("PRESSURE_COEFF", index, DGFluidModel->GetCp());
+  SetVolumeOutputValue(volumeField.pressure,       index, DGFluidModel->GetPressure());
+  SetVolumeOutputValue(volumeField.temperature,    index, DGFluidModel->GetTemperature());
+  SetVolumeOutputValue(volumeField.mach,           index, sqrt(Velocity2)/DGFluidModel->GetSoundSpeed());
+  SetVolumeOutputValue(volumeField.pressure_coeff, index, DGFluidModel->GetCp());
 
   if (config->GetKind_Solver() == FEM_NAVIER_STOKES){
-    SetVolumeOutputValue("LAMINAR_VISCOSITY", index, DGFluidModel->GetLaminarViscosity());
+    SetVolumeOutputValue(volumeField.laminar_viscosity, index, DGFluidModel->GetLaminarViscosity());
   }
   if ((config->GetKind_Solver()  == FEM_LES) && (config->GetKind_SGS_Model() != IMPLICIT_LES)){
     // todo: Export Eddy instead of Laminar viscosity
-    SetVolumeOutputValue("EDDY_VISCOSITY", index, DGFluidModel->GetLaminarViscosity());
+    SetVolumeOutputValue(volumeField.eddy_viscosity, index, DGFluidModel->GetLaminarViscosity());
   }
 }
 
@@ -183,11 +183,11 @@ void CFlowOutput::SetAnalyzeSurface(CSolver *solver, CGeometry *geometry, CConfi
     if (config->GetMarker_All_Analyze(iMarker) == YES) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
-          geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+          geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
           if (axisymmetric) {
             if (geometry->nodes->GetCoord(iPoint, 1) != 0.0)
@@ -858,9 +858,9 @@ void CFlowOutput::Set_CpInverseDesign(CSolver *solver, CGeometry *geometry, CCon
 
           /*--- The Pressure file uses the global numbering ---*/
 
-          iPoint = geometry->nodes->GetGlobalIndex(geometry->vertex[iMarker][iVertex]->GetNode());
+          iPoint = geometry->nodes->GetGlobalIndex(geometry->vertexData[iMarker].GetNode(iVertex));
 
-          if (geometry->vertex[iMarker][iVertex]->GetNode() < geometry->GetnPointDomain()) {
+          if (geometry->vertexData[iMarker].GetNode(iVertex) < geometry->GetnPointDomain()) {
             Point2Vertex[iPoint][0] = iMarker;
             Point2Vertex[iPoint][1] = iVertex;
             PointInDomain[iPoint] = true;
@@ -913,7 +913,7 @@ void CFlowOutput::Set_CpInverseDesign(CSolver *solver, CGeometry *geometry, CCon
           (Boundary == NEARFIELD_BOUNDARY)) {
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           Cp = solver->GetCPressure(iMarker, iVertex);
           CpTarget = solver->GetCPressureTarget(iMarker, iVertex);
@@ -2878,69 +2878,69 @@ bool CFlowOutput::WriteVolume_Output(CConfig *config, unsigned long Iter, bool f
 }
 
 void CFlowOutput::SetTimeAveragedFields(){
-  AddVolumeOutput("MEAN_DENSITY", "MeanDensity", "TIME_AVERAGE", "Mean density");
-  AddVolumeOutput("MEAN_VELOCITY-X", "MeanVelocity_x", "TIME_AVERAGE", "Mean velocity x-component");
-  AddVolumeOutput("MEAN_VELOCITY-Y", "MeanVelocity_y", "TIME_AVERAGE", "Mean velocity y-component");
+  timeAvgField.mean_density = AddVolumeOutput("MEAN_DENSITY", "MeanDensity", "TIME_AVERAGE", "Mean density");
+  timeAvgField.mean_velocity_x = AddVolumeOutput("MEAN_VELOCITY-X", "MeanVelocity_x", "TIME_AVERAGE", "Mean velocity x-component");
+  timeAvgField.mean_velocity_y = AddVolumeOutput("MEAN_VELOCITY-Y", "MeanVelocity_y", "TIME_AVERAGE", "Mean velocity y-component");
   if (nDim == 3)
-    AddVolumeOutput("MEAN_VELOCITY-Z", "MeanVelocity_z", "TIME_AVERAGE", "Mean velocity z-component");
-
-  AddVolumeOutput("MEAN_PRESSURE", "MeanPressure", "TIME_AVERAGE", "Mean pressure");
-  AddVolumeOutput("RMS_U",   "RMS[u]", "TIME_AVERAGE", "RMS u");
-  AddVolumeOutput("RMS_V",   "RMS[v]", "TIME_AVERAGE", "RMS v");
-  AddVolumeOutput("RMS_UV",  "RMS[uv]", "TIME_AVERAGE", "RMS uv");
-  AddVolumeOutput("RMS_P",   "RMS[Pressure]",   "TIME_AVERAGE", "RMS Pressure");
-  AddVolumeOutput("UUPRIME", "u'u'", "TIME_AVERAGE", "Mean Reynolds-stress component u'u'");
-  AddVolumeOutput("VVPRIME", "v'v'", "TIME_AVERAGE", "Mean Reynolds-stress component v'v'");
-  AddVolumeOutput("UVPRIME", "u'v'", "TIME_AVERAGE", "Mean Reynolds-stress component u'v'");
-  AddVolumeOutput("PPRIME",  "p'p'",   "TIME_AVERAGE", "Mean pressure fluctuation p'p'");
+    timeAvgField.mean_velocity_z = AddVolumeOutput("MEAN_VELOCITY-Z", "MeanVelocity_z", "TIME_AVERAGE", "Mean velocity z-component");
+
+  timeAvgField.mean_pressure = AddVolumeOutput("MEAN_PRESSURE", "MeanPressure", "TIME_AVERAGE", "Mean pressure");
+  timeAvgField.rms_u = AddVolumeOutput("RMS_U",   "RMS[u]", "TIME_AVERAGE", "RMS u");
+  timeAvgField.rms_v = AddVolumeOutput("RMS_V",   "RMS[v]", "TIME_AVERAGE", "RMS v");
+  timeAvgField.rms_uv = AddVolumeOutput("RMS_UV",  "RMS[uv]", "TIME_AVERAGE", "RMS uv");
+  timeAvgField.rms_p = AddVolumeOutput("RMS_P",   "RMS[Pressure]",   "TIME_AVERAGE", "RMS Pressure");
+  timeAvgField.uuprime = AddVolumeOutput("UUPRIME", "u'u'", "TIME_AVERAGE", "Mean Reynolds-stress component u'u'");
+  timeAvgField.vvprime = AddVolumeOutput("VVPRIME", "v'v'", "TIME_AVERAGE", "Mean Reynolds-stress component v'v'");
+  timeAvgField.uvprime = AddVolumeOutput("UVPRIME", "u'v'", "TIME_AVERAGE", "Mean Reynolds-stress component u'v'");
+  timeAvgField.pprime = AddVolumeOutput("PPRIME",  "p'p'",   "TIME_AVERAGE", "Mean pressure fluctuation p'p'");
   if (nDim == 3){
-    AddVolumeOutput("RMS_W",   "RMS[w]", "TIME_AVERAGE", "RMS u");
-    AddVolumeOutput("RMS_UW", "RMS[uw]", "TIME_AVERAGE", "RMS uw");
-    AddVolumeOutput("RMS_VW", "RMS[vw]", "TIME_AVERAGE", "RMS vw");
-    AddVolumeOutput("WWPRIME", "w'w'", "TIME_AVERAGE", "Mean Reynolds-stress component w'w'");
-    AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
-    AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
+    timeAvgField.rms_w = AddVolumeOutput("RMS_W",   "RMS[w]", "TIME_AVERAGE", "RMS u");
+    timeAvgField.rms_uw = AddVolumeOutput("RMS_UW", "RMS[uw]", "TIME_AVERAGE", "RMS uw");
+    timeAvgField.rms_vw = AddVolumeOutput("RMS_VW", "RMS[vw]", "TIME_AVERAGE", "RMS vw");
+    timeAvgField.wwprime = AddVolumeOutput("WWPRIME", "w'w'", "TIME_AVERAGE", "Mean Reynolds-stress component w'w'");
+    timeAvgField.uwprime = AddVolumeOutput("UWPRIME", "w'u'", "TIME_AVERAGE", "Mean Reynolds-stress component w'u'");
+    timeAvgField.vwprime = AddVolumeOutput("VWPRIME", "w'v'", "TIME_AVERAGE", "Mean Reynolds-stress component w'v'");
   }
 }
 
 void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, CVariable *Node_Flow){
-  SetAvgVolumeOutputValue("MEAN_DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint,0));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint,1));
+  SetAvgVolumeOutputValue(timeAvgField.mean_density, iPoint, Node_Flow->GetDensity(iPoint));
+  SetAvgVolumeOutputValue(timeAvgField.mean_velocity_x, iPoint, Node_Flow->GetVelocity(iPoint,0));
+  SetAvgVolumeOutputValue(timeAvgField.mean_velocity_y, iPoint, Node_Flow->GetVelocity(iPoint,1));
   if (nDim == 3)
-    SetAvgVolumeOutputValue("MEAN_VELOCITY-Z", iPoint, Node_Flow->GetVelocity(iPoint,2));
+    SetAvgVolumeOutputValue(timeAvgField.mean_velocity_z, iPoint, Node_Flow->GetVelocity(iPoint,2));
 
-  SetAvgVolumeOutputValue("MEAN_PRESSURE", iPoint, Node_Flow->GetPressure(iPoint));
+  SetAvgVolumeOutputValue(timeAvgField.mean_pressure, iPoint, Node_Flow->GetPressure(iPoint));
 
-  SetAvgVolumeOutputValue("RMS_U", iPoint, pow(Node_Flow->GetVelocity(iPoint,0),2));
-  SetAvgVolumeOutputValue("RMS_V", iPoint, pow(Node_Flow->GetVelocity(iPoint,1),2));
-  SetAvgVolumeOutputValue("RMS_UV", iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1));
-  SetAvgVolumeOutputValue("RMS_P", iPoint, pow(Node_Flow->GetPressure(iPoint),2));
+  SetAvgVolumeOutputValue(timeAvgField.rms_u, iPoint, pow(Node_Flow->GetVelocity(iPoint,0),2));
+  SetAvgVolumeOutputValue(timeAvgField.rms_v, iPoint, pow(Node_Flow->GetVelocity(iPoint,1),2));
+  SetAvgVolumeOutputValue(timeAvgField.rms_uv, iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1));
+  SetAvgVolumeOutputValue(timeAvgField.rms_p, iPoint, pow(Node_Flow->GetPressure(iPoint),2));
   if (nDim == 3){
-    SetAvgVolumeOutputValue("RMS_W", iPoint, pow(Node_Flow->GetVelocity(iPoint,2),2));
-    SetAvgVolumeOutputValue("RMS_VW", iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1));
-    SetAvgVolumeOutputValue("RMS_UW", iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
+    SetAvgVolumeOutputValue(timeAvgField.rms_w, iPoint, pow(Node_Flow->GetVelocity(iPoint,2),2));
+    SetAvgVolumeOutputValue(timeAvgField.rms_vw, iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1));
+    SetAvgVolumeOutputValue(timeAvgField.rms_uw, iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
   }
 
-  const su2double umean  = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
-  const su2double uumean = GetVolumeOutputValue("RMS_U", iPoint);
-  const su2double vmean  = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
-  const su2double vvmean = GetVolumeOutputValue("RMS_V", iPoint);
-  const su2double uvmean = GetVolumeOutputValue("RMS_UV", iPoint);
-  const su2double pmean  = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
-  const su2double ppmean = GetVolumeOutputValue("RMS_P", iPoint);
-
-  SetVolumeOutputValue("UUPRIME", iPoint, -(umean*umean - uumean));
-  SetVolumeOutputValue("VVPRIME", iPoint, -(vmean*vmean - vvmean));
-  SetVolumeOutputValue("UVPRIME", iPoint, -(umean*vmean - uvmean));
-  SetVolumeOutputValue("PPRIME",  iPoint, -(pmean*pmean - ppmean));
+  const su2double umean  = GetVolumeOutputValue(timeAvgField.mean_velocity_x, iPoint);
+  const su2double uumean = GetVolumeOutputValue(timeAvgField.rms_u, iPoint);
+  const su2double vmean  = GetVolumeOutputValue(timeAvgField.mean_velocity_y, iPoint);
+  const su2double vvmean = GetVolumeOutputValue(timeAvgField.rms_v, iPoint);
+  const su2double uvmean = GetVolumeOutputValue(timeAvgField.rms_uv, iPoint);
+  const su2double pmean  = GetVolumeOutputValue(timeAvgField.mean_pressure, iPoint);
+  const su2double ppmean = GetVolumeOutputValue(timeAvgField.rms_p, iPoint);
+
+  SetVolumeOutputValue(timeAvgField.uuprime, iPoint, -(umean*umean - uumean));
+  SetVolumeOutputValue(timeAvgField.vvprime, iPoint, -(vmean*vmean - vvmean));
+  SetVolumeOutputValue(timeAvgField.uvprime, iPoint, -(umean*vmean - uvmean));
+  SetVolumeOutputValue(timeAvgField.pprime,  iPoint, -(pmean*pmean - ppmean));
   if (nDim == 3){
-    const su2double wmean  = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
-    const su2double wwmean = GetVolumeOutputValue("RMS_W", iPoint);
-    const su2double uwmean = GetVolumeOutputValue("RMS_UW", iPoint);
-    const su2double vwmean = GetVolumeOutputValue("RMS_VW", iPoint);
-    SetVolumeOutputValue("WWPRIME", iPoint, -(wmean*wmean - wwmean));
-    SetVolumeOutputValue("UWPRIME", iPoint, -(umean*wmean - uwmean));
-    SetVolumeOutputValue("VWPRIME",  iPoint, -(vmean*wmean - vwmean));
+    const su2double wmean  = GetVolumeOutputValue(timeAvgField.mean_velocity_z, iPoint);
+    const su2double wwmean = GetVolumeOutputValue(timeAvgField.rms_w, iPoint);
+    const su2double uwmean = GetVolumeOutputValue(timeAvgField.rms_uw, iPoint);
+    const su2double vwmean = GetVolumeOutputValue(timeAvgField.rms_vw, iPoint);
+    SetVolumeOutputValue(timeAvgField.wwprime, iPoint, -(wmean*wmean - wwmean));
+    SetVolumeOutputValue(timeAvgField.uwprime, iPoint, -(umean*wmean - uwmean));
+    SetVolumeOutputValue(timeAvgField.vwprime,  iPoint, -(vmean*wmean - vwmean));
   }
 }
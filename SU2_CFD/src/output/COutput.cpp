@@ -40,6 +40,8 @@
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2SeriesFileWriter.hpp"
+#include "../../include/output/tools/CInSituReductions.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 
 
@@ -160,14 +162,13 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   convergence        = false;
 
-  buildFieldIndexCache = false;
-
   curInnerIter = 0;
   curOuterIter = 0;
   curTimeIter  = 0;
 
   volumeDataSorter = nullptr;
   surfaceDataSorter = nullptr;
+  inSituReductions = nullptr;
 
   headerNeeded = false;
 
@@ -184,6 +185,8 @@ COutput::~COutput(void) {
 
   delete surfaceDataSorter;
   surfaceDataSorter = nullptr;
+
+  delete inSituReductions;
 }
 
 
@@ -381,10 +384,40 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter, config->GetKind_Output_Compression(),
+                                            config->GetOutput_Lossy_Fields(),
+                                            SU2_TYPE::GetValue(config->GetOutput_Lossy_Tolerance()));
 
       break;
 
+    case TIME_SERIES:
+    {
+      /*--- All time steps are appended to the same file, i.e. without iteration number. ---*/
+
+      unsigned long seriesIter = config->GetTime_Domain()? curTimeIter : curInnerIter;
+
+      if (fileName.empty()) {
+        fileName = config->GetFilename(restartFilename, "", curTimeIter);
+        string baseName;
+        unsigned long fileIter;
+        if (config->GetTime_Domain() && config->SplitUnsteady_FileName(fileName, baseName, fileIter))
+          fileName = baseName;
+      }
+
+      /*--- The connectivity is needed for the index. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      if (rank == MASTER_NODE) {
+          (*fileWritingTable) << "SU2 time series" << fileName + CSU2SeriesFileWriter::fileExt;
+      }
+
+      const su2double seriesTime = config->GetTime_Domain()? GetHistoryFieldValue("CUR_TIME") : su2double(0.0);
+
+      fileWriter = new CSU2SeriesFileWriter(fileName, volumeDataSorter, seriesIter, seriesTime);
+
+      break;
+    }
     case MESH:
 
       if (fileName.empty())
@@ -457,7 +490,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
         (*fileWritingTable) << "Paraview" << fileName + CParaviewXMLFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(fileName, volumeDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(fileName, volumeDataSorter, config->GetKind_Output_Compression(),
+                                              config->GetOutput_Lossy_Fields(),
+                                              SU2_TYPE::GetValue(config->GetOutput_Lossy_Tolerance()));
 
       break;
 
@@ -644,7 +679,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "Paraview surface" << fileName + CParaviewXMLFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(fileName, surfaceDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(fileName, surfaceDataSorter, config->GetKind_Output_Compression(),
+                                              config->GetOutput_Lossy_Fields(),
+                                              SU2_TYPE::GetValue(config->GetOutput_Lossy_Tolerance()));
 
       break;
 
@@ -755,6 +792,11 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
   if (writeFiles || config->GetTime_Domain())
     LoadDataIntoSorter(config, geometry, solver_container);
 
+  /*--- Reduce the data of the time step in-situ (statistics, probes and slices). ---*/
+
+  if (!inSituFields.empty())
+    UpdateInSituReductions(config, geometry, iter);
+
   if (writeFiles){
 
     /*--- Partition and sort the data --- */
@@ -1448,6 +1490,35 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
 
   SetVolumeOutputFields(config);
 
+  /*--- Fields reduced in-situ during unsteady runs must be loaded,
+   * their running statistics are additional volume fields. ---*/
+
+  if (config->GetTime_Domain() && !femOutput && config->GetKind_SU2() == SU2_CFD)
+    inSituFields = config->GetInSitu_Fields();
+
+  for (const auto& name : inSituFields) {
+    if (volumeOutput_Map.count(name) == 0) {
+      SU2_MPI::Error(string("Cannot find volume output field ") + name + string(" of INSITU_FIELDS"), CURRENT_FUNCTION);
+    }
+    if (config->GetInSitu_Statistics()) {
+      const string fieldName = volumeOutput_Map.at(name).fieldName;
+      AddVolumeOutput("AVG_" + name, "Avg[" + fieldName + "]", "INSITU_STATISTICS", "Running mean of " + fieldName);
+      AddVolumeOutput("VAR_" + name, "Var[" + fieldName + "]", "INSITU_STATISTICS", "Running variance of " + fieldName);
+    }
+    const auto& group = volumeOutput_Map.at(name).outputGroup;
+    if (std::find(requestedVolumeFields.begin(), requestedVolumeFields.end(), name) == requestedVolumeFields.end() &&
+        std::find(requestedVolumeFields.begin(), requestedVolumeFields.end(), group) == requestedVolumeFields.end()){
+      requestedVolumeFields.emplace_back(name);
+      nRequestedVolumeFields++;
+    }
+  }
+
+  if (!inSituFields.empty() && config->GetInSitu_Statistics() &&
+      std::find(requestedVolumeFields.begin(), requestedVolumeFields.end(), "INSITU_STATISTICS") == requestedVolumeFields.end()){
+    requestedVolumeFields.emplace_back("INSITU_STATISTICS");
+    nRequestedVolumeFields++;
+  }
+
   /*---Coordinates and solution groups must be always in the output.
    * If they are not requested, add them here. ---*/
 
@@ -1537,18 +1608,37 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
   }
 }
 
+void COutput::UpdateInSituReductions(CConfig *config, CGeometry *geometry, unsigned long TimeIter){
+
+  if (inSituReductions == nullptr) {
+
+    vector<short> offsets, meanOffsets, varOffsets;
+    vector<string> names;
+
+    for (const auto& name : inSituFields) {
+      offsets.push_back(volumeOutput_Map.at(name).offset);
+      names.push_back(volumeOutput_Map.at(name).fieldName);
+      if (config->GetInSitu_Statistics()) {
+        meanOffsets.push_back(volumeOutput_Map.at("AVG_" + name).offset);
+        varOffsets.push_back(volumeOutput_Map.at("VAR_" + name).offset);
+      }
+    }
+
+    inSituReductions = new CInSituReductions(config, geometry, offsets, names, meanOffsets, varOffsets);
+  }
+
+  const passivedouble time = SU2_TYPE::GetValue(GetHistoryFieldValue("CUR_TIME"));
+
+  inSituReductions->Update(config, geometry, volumeDataSorter, TimeIter, time);
+
+}
+
 void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
 
   unsigned short iMarker = 0;
   unsigned long iPoint = 0, jPoint = 0;
   unsigned long iVertex = 0;
 
-  /*--- Reset the offset cache and index --- */
-  cachePosition = 0;
-  fieldIndexCache.clear();
-  curGetFieldIndex = 0;
-  fieldGetIndexCache.clear();
-
   if (femOutput){
 
     /*--- Create an object of the class CMeshFEM_DG and retrieve the necessary
@@ -1566,8 +1656,6 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
       for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
 
-        buildFieldIndexCache = fieldIndexCache.empty();
-
         LoadVolumeDataFEM(config, geometry, solver, l, jPoint, j);
 
         jPoint++;
@@ -1577,22 +1665,18 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-
-      /*--- Load the volume data into the data sorter. --- */
+    /*--- Load the volume data into the data sorter. The fields are accessed
+     * by key or handle, which does not modify the output object, and each
+     * point only writes its own data, hence the points can be loaded in parallel. --- */
 
-      buildFieldIndexCache = fieldIndexCache.empty();
-
-      LoadVolumeData(config, geometry, solver, iPoint);
+    const unsigned long nPointDomain = geometry->GetnPointDomain();
+    const size_t omp_chunk_size = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE);
 
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
+    for (unsigned long iPointDomain = 0; iPointDomain < nPointDomain; iPointDomain++) {
+      LoadVolumeData(config, geometry, solver, iPointDomain);
     }
 
-    /*--- Reset the offset cache and index --- */
-    cachePosition = 0;
-    fieldIndexCache.clear();
-    curGetFieldIndex = 0;
-    fieldGetIndexCache.clear();
-
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
       /*--- We only want to have surface values on solid walls ---*/
@@ -1600,14 +1684,12 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
       if (config->GetSolid_Wall(iMarker)){
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++){
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           /*--- Load the surface data into the data sorter. --- */
 
           if(geometry->nodes->GetDomain(iPoint)){
 
-            buildFieldIndexCache = fieldIndexCache.empty();
-
             LoadSurfaceData(config, geometry, solver, iPoint, iMarker, iVertex);
 
           }
@@ -1617,118 +1699,43 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   }
 }
 
-void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
-
-  if (buildFieldIndexCache){
-
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
-
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
-
-    /*--- Use the offset cache for the access ---*/
+void COutput::SetVolumeOutputValue(unsigned short handle, unsigned long iPoint, su2double value){
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
+  CheckVolumeHandle(handle);
+  const short Offset = volumeOutput_Handles[handle]->second.offset;
+  if (Offset != -1){
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
   }
 
 }
 
-su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
-
-  if (buildFieldIndexCache){
-
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
-
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldGetIndexCache.push_back(Offset);
-      if (Offset != -1){
-        return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
-
-    /*--- Use the offset cache for the access ---*/
-
-    const short Offset = fieldGetIndexCache[curGetFieldIndex++];
+su2double COutput::GetVolumeOutputValue(unsigned short handle, unsigned long iPoint) const {
 
-    if (curGetFieldIndex == fieldGetIndexCache.size()){
-      curGetFieldIndex = 0;
-    }
-    if (Offset != -1){
-      return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-    }
+  CheckVolumeHandle(handle);
+  const short Offset = volumeOutput_Handles[handle]->second.offset;
+  if (Offset != -1){
+    return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
   }
 
   return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetAvgVolumeOutputValue(unsigned short handle, unsigned long iPoint, su2double value){
 
   const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
 
-  if (buildFieldIndexCache){
-
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
-
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
-
-        const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-        const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
-
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
-
-    /*--- Use the offset cache for the access ---*/
+  CheckVolumeHandle(handle);
+  const short Offset = volumeOutput_Handles[handle]->second.offset;
+  if (Offset != -1){
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
+    const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
+    const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
 
-      const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
-
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
   }
 
 }
 
-
-
-
-
 void COutput::Postprocess_HistoryData(CConfig *config){
 
   map<string, pair<su2double, int> > Average;
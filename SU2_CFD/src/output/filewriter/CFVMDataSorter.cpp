@@ -34,6 +34,8 @@ CFVMDataSorter::CFVMDataSorter(CConfig *config, CGeometry *geometry, const vecto
 
   nDim = geometry->GetnDim();
 
+  connectivityLinearPartitioned = false;
+
   std::vector<unsigned long> globalID;
 
   nGlobalPointBeforeSort = geometry->GetGlobal_nPointDomain();
@@ -91,7 +93,7 @@ void CFVMDataSorter::SetHaloPoints(CGeometry *geometry, CConfig *config){
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
 
@@ -112,6 +114,10 @@ void CFVMDataSorter::SetHaloPoints(CGeometry *geometry, CConfig *config){
 
 void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
 
+  /*--- Nothing to do if the connectivity was already sorted the same way. ---*/
+
+  if (connectivitySorted && (connectivityLinearPartitioned == val_sort)) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -128,6 +134,7 @@ void CFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool
   SetTotalElements();
 
   connectivitySorted = true;
+  connectivityLinearPartitioned = val_sort;
 
 }
 
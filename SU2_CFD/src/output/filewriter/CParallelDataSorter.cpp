@@ -64,6 +64,7 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   passiveDoubleBuffer = nullptr;
   doubleBuffer = nullptr;
   idSend       = nullptr;
+  idRecv       = nullptr;
   nSends = 0;
   nRecvs = 0;
 
@@ -78,7 +79,9 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
   nElemConn_Cum = new int[size+1]();
   
   linearPartitioner = nullptr;
-  
+
+  connectivitySorted = false;
+
   nElemPerType.fill(0);
   nElemPerTypeGlobal.fill(0);
 
@@ -104,6 +107,7 @@ CParallelDataSorter::~CParallelDataSorter(){
   delete [] Conn_Pyra_Par;
 
   delete [] connSend;
+  delete [] idRecv;
 
   delete [] dataBuffer;
 }
@@ -118,20 +122,26 @@ void CParallelDataSorter::SortOutputData() {
   int ind;
 #endif
 
+  /*--- The global IDs of the received points do not change between calls, they are
+   communicated only the first time and kept afterwards, i.e. subsequent calls
+   only move the data values (the sorting plan is reused). ---*/
+
+  const bool sendIDs = (idRecv == nullptr);
+  const int nMessages = sendIDs? 2 : 1;
+
   /*--- Allocate the memory that we need for receiving the conn
    values and then cue up the non-blocking receives. Note that
    we do not include our own rank in the communications. We will
    directly copy our own data later. ---*/
 
-
-  unsigned long *idRecv = new unsigned long[nPoint_Recv[size]]();
+  if (sendIDs) idRecv = new unsigned long[nPoint_Recv[size]]();
 
 #ifdef HAVE_MPI
   /*--- We need double the number of messages to send both the conn.
    and the global IDs. ---*/
 
-  send_req = new SU2_MPI::Request[2*nSends];
-  recv_req = new SU2_MPI::Request[2*nRecvs];
+  send_req = new SU2_MPI::Request[nMessages*nSends];
+  recv_req = new SU2_MPI::Request[nMessages*nRecvs];
 
   unsigned long iMessage = 0;
   for (int ii=0; ii<size; ii++) {
@@ -166,7 +176,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Repeat the process to communicate the global IDs. ---*/
 
   iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
+  for (int ii=0; sendIDs && ii<size; ii++) {
     if ((ii != rank) && (nPoint_Recv[ii+1] > nPoint_Recv[ii])) {
       int ll     = nPoint_Recv[ii];
       int kk     = nPoint_Recv[ii+1] - nPoint_Recv[ii];
@@ -182,7 +192,7 @@ void CParallelDataSorter::SortOutputData() {
   /*--- Launch the non-blocking sends of the global IDs. ---*/
 
   iMessage = 0;
-  for (int ii=0; ii<size; ii++) {
+  for (int ii=0; sendIDs && ii<size; ii++) {
     if ((ii != rank) && (nPoint_Send[ii+1] > nPoint_Send[ii])) {
       int ll = nPoint_Send[ii];
       int kk = nPoint_Send[ii+1] - nPoint_Send[ii];
@@ -204,20 +214,22 @@ void CParallelDataSorter::SortOutputData() {
 
   for (int nn=ll; nn<kk; nn++, mm++) doubleBuffer[mm] = connSend[nn];
 
-  mm = nPoint_Recv[rank];
-  ll = nPoint_Send[rank];
-  kk = nPoint_Send[rank+1];
+  if (sendIDs) {
+    mm = nPoint_Recv[rank];
+    ll = nPoint_Send[rank];
+    kk = nPoint_Send[rank+1];
 
-  for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
+    for (int nn=ll; nn<kk; nn++, mm++) idRecv[mm] = idSend[nn];
+  }
 
   /*--- Wait for the non-blocking sends and recvs to complete. ---*/
 
 #ifdef HAVE_MPI
-  int number = 2*nSends;
+  int number = nMessages*nSends;
   for (int ii = 0; ii < number; ii++)
     SU2_MPI::Waitany(number, send_req, &ind, &status);
 
-  number = 2*nRecvs;
+  number = nMessages*nRecvs;
   for (int ii = 0; ii < number; ii++)
     SU2_MPI::Waitany(number, recv_req, &ind, &status);
 
@@ -254,19 +266,23 @@ void CParallelDataSorter::SortOutputData() {
 
   delete [] tmpBuffer;
 
-  /*--- Store the total number of local points my rank has for
-   the current section after completing the communications. ---*/
+  if (sendIDs) {
 
-  nPoints = nPoint_Recv[size];
+    /*--- Store the total number of local points my rank has for
+     the current section after completing the communications. ---*/
 
-  /*--- Reduce the total number of points we will write in the output files. ---*/
+    nPoints = nPoint_Recv[size];
 
-  SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
-                     MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    /*--- Reduce the total number of points we will write in the output files. ---*/
 
-  /*--- Free temporary memory from communications ---*/
+    SU2_MPI::Allreduce(&nPoints, &nPointsGlobal, 1,
+                       MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 
-  delete [] idRecv;
+    /*--- The send buffer of the global IDs is not needed anymore. ---*/
+
+    delete [] idSend;
+    idSend = nullptr;
+  }
 }
 
 void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalID){
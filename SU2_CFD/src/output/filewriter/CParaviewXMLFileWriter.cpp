@@ -27,11 +27,17 @@
 
 #include "../../../include/output/filewriter/CParaviewXMLFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 const string CParaviewXMLFileWriter::fileExt = ".vtu";
 
-CParaviewXMLFileWriter::CParaviewXMLFileWriter(string valFileName, CParallelDataSorter *valDataSorter) :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){
+CParaviewXMLFileWriter::CParaviewXMLFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                               unsigned short valCompression, vector<string> valLossyFields,
+                                               passivedouble valLossyTolerance) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  compression(valCompression),
+  lossyFields(std::move(valLossyFields)),
+  lossyTolerance(valLossyTolerance){
 
   /* Check for big endian. We have to swap bytes otherwise.
    * Since size of character is 1 byte when the character pointer
@@ -60,19 +66,17 @@ void CParaviewXMLFileWriter::Write_Data(){
 
   const int NCOORDS = 3;
   const unsigned short nDim = dataSorter->GetnDim();
-  unsigned short iDim = 0;
 
   /*--- Array containing the field names we want to output ---*/
 
   const vector<string>& fieldNames = dataSorter->GetFieldNames();
 
-  unsigned long iPoint, iElem;
-
   char str_buf[255];
 
   OpenMPIFile();
-  
+
   dataOffset = 0;
+  nArraysDefined = 0;
 
   /*--- Communicate the number of total points that will be
    written by each rank. After this communication, each proc knows how
@@ -89,27 +93,27 @@ void CParaviewXMLFileWriter::Write_Data(){
 
   unsigned long myElem, myElemStorage, GlobalElem, GlobalElemStorage;
 
-  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
-                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
-                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
-                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
-                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
-                nParallel_Pris = dataSorter->GetnElem(PRISM),
-                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
-
   myElem            = dataSorter->GetnElem();
   myElemStorage     = dataSorter->GetnConn();
   GlobalElem        = dataSorter->GetnElemGlobal();
   GlobalElemStorage = dataSorter->GetnConnGlobal();
 
+  /*--- The offsets of compressed arrays are only known after compressing them,
+   therefore all arrays are compressed before the header is written. ---*/
+
+  compressedArrays.clear();
+  if (compression != NO_COMPRESSION) LoadDataArrays(true);
+
   /* Write the ASCII XML header. Note that we use the appended format for the data,
   * which means that all data is appended at the end of the file in one binary blob.
   */
 
+  const string compressor = (compression != NO_COMPRESSION)? " compressor=\"vtkLZ4DataCompressor\"" : "";
+
   if (!bigEndian){
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   } else {
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   }
 
   WriteMPIString("<UnstructuredGrid>\n", MASTER_NODE);
@@ -189,6 +193,69 @@ void CParaviewXMLFileWriter::Write_Data(){
 
   WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
 
+  if (compression != NO_COMPRESSION) {
+    for (const auto& array : compressedArrays) WriteCompressedDataArray(array);
+    compressedArrays.clear();
+  }
+  else {
+    LoadDataArrays(false);
+  }
+
+  WriteMPIString("</AppendedData>\n", MASTER_NODE);
+  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+
+  CloseMPIFile();
+
+}
+
+void CParaviewXMLFileWriter::LoadDataArrays(bool compress){
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  unsigned short iDim = 0;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  unsigned long iPoint, iElem;
+
+  const unsigned long myPoint = dataSorter->GetnPoints(), GlobalPoint = dataSorter->GetnPointsGlobal();
+  const unsigned long myElem = dataSorter->GetnElem(), GlobalElem = dataSorter->GetnElemGlobal();
+  const unsigned long myElemStorage = dataSorter->GetnConn(), GlobalElemStorage = dataSorter->GetnConnGlobal();
+
+  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
+                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
+                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
+                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
+                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
+                nParallel_Pris = dataSorter->GetnElem(PRISM),
+                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
+
+  auto writeArray = [&](void* data, VTKDatatype type, unsigned long size, unsigned long globalSize, unsigned long offset){
+    if (compress) CompressDataArray(data, type, size, globalSize, offset);
+    else WriteDataArray(data, type, size, globalSize, offset);
+  };
+
+  /*--- Visualization fields may be quantized, before conversion to float. ---*/
+
+  vector<bool> quantize(fieldNames.size(), false);
+  for (size_t iVar = 0; compress && iVar < fieldNames.size(); iVar++)
+    quantize[iVar] = find(lossyFields.begin(), lossyFields.end(), fieldNames[iVar]) != lossyFields.end();
+
+  auto getValue = [&](unsigned short iVar, unsigned long jPoint){
+    passivedouble val = dataSorter->GetData(iVar, jPoint);
+    if (quantize[iVar]) CompressionToolbox::Quantize(&val, 1, lossyTolerance);
+    return float(val);
+  };
+
+  /*--- Adjust container start location to avoid point coords. ---*/
+
+  unsigned short varStart = 2;
+  if (nDim == 3) varStart++;
+
+  unsigned short iField, VarCounter = varStart;
+
   /*--- Load/write the 1D buffer of point coordinates. Note that we
    always have 3 coordinate dimensions, even for 2D problems. ---*/
 
@@ -198,14 +265,14 @@ void CParaviewXMLFileWriter::Write_Data(){
       if (nDim == 2 && iDim == 2) {
         dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
       } else {
-        float val = (float)dataSorter->GetData(iDim, iPoint);
+        float val = getValue(iDim, iPoint);
         dataBufferFloat[iPoint*NCOORDS + iDim] = val;
       }
     }
   }
 
-  WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
-                 dataSorter->GetnPointCumulative(rank)*NCOORDS);
+  writeArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, NCOORDS*myPoint, GlobalPoint*NCOORDS,
+             dataSorter->GetnPointCumulative(rank)*NCOORDS);
 
   /*--- Load/write 1D buffers for the connectivity of each element type. ---*/
 
@@ -232,9 +299,9 @@ void CParaviewXMLFileWriter::Write_Data(){
   copyToBuffer(PRISM,         nParallel_Pris, N_POINTS_PRISM);
   copyToBuffer(PYRAMID,       nParallel_Pyra, N_POINTS_PYRAMID);
 
-  WriteDataArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
-                 dataSorter->GetnElemConnCumulative(rank));
-  WriteDataArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  writeArray(connBuf.data(), VTKDatatype::INT32, myElemStorage, GlobalElemStorage,
+             dataSorter->GetnElemConnCumulative(rank));
+  writeArray(offsetBuf.data(), VTKDatatype::INT32, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
 
   /*--- Load/write the cell type for all elements in the file. ---*/
 
@@ -249,11 +316,10 @@ void CParaviewXMLFileWriter::Write_Data(){
   std::fill(typeIter, typeIter+nParallel_Pris, PRISM);         typeIter += nParallel_Pris;
   std::fill(typeIter, typeIter+nParallel_Pyra, PYRAMID);       typeIter += nParallel_Pyra;
 
-  WriteDataArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
+  writeArray(typeBuf.data(), VTKDatatype::UINT8, myElem, GlobalElem, dataSorter->GetnElemCumulative(rank));
 
   /*--- Loop over all variables that have been registered in the output. ---*/
 
-  VarCounter = varStart;
   for (iField = varStart; iField < fieldNames.size(); iField++) {
 
     /*--- Check whether this field is a vector or scalar. ---*/
@@ -289,14 +355,14 @@ void CParaviewXMLFileWriter::Write_Data(){
           if (nDim == 2 && iDim == 2) {
             dataBufferFloat[iPoint*NCOORDS + iDim] = 0.0;
           } else {
-            val = (float)dataSorter->GetData(VarCounter+iDim,iPoint);
+            val = getValue(VarCounter+iDim, iPoint);
             dataBufferFloat[iPoint*NCOORDS + iDim] = val;
           }
         }
       }
 
-      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS, 
-                     dataSorter->GetnPointCumulative(rank)*NCOORDS);
+      writeArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint*NCOORDS, GlobalPoint*NCOORDS,
+                 dataSorter->GetnPointCumulative(rank)*NCOORDS);
 
       VarCounter++;
 
@@ -307,23 +373,18 @@ void CParaviewXMLFileWriter::Write_Data(){
        This will be replaced with a derived data type most likely. ---*/
 
       for (iPoint = 0; iPoint < myPoint; iPoint++) {
-        float val = (float)dataSorter->GetData(VarCounter,iPoint);
+        float val = getValue(VarCounter, iPoint);
         dataBufferFloat[iPoint] = val;
       }
 
-      WriteDataArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
-                     dataSorter->GetnPointCumulative(rank));
+      writeArray(dataBufferFloat.data(), VTKDatatype::FLOAT32, myPoint, GlobalPoint,
+                 dataSorter->GetnPointCumulative(rank));
 
       VarCounter++;
     }
 
   }
 
-  WriteMPIString("</AppendedData>\n", MASTER_NODE);
-  WriteMPIString("</VTKFile>\n", MASTER_NODE);
-
-  CloseMPIFile();
-
 }
 
 void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
@@ -389,6 +450,103 @@ void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
                  string(" offset=") + offsetStr +
                  string(" format=\"appended\"/>\n"), MASTER_NODE);
 
-  dataOffset += totalByteSize + sizeof(unsigned long);
+  if (compression != NO_COMPRESSION) {
+    const auto& array = compressedArrays[nArraysDefined];
+    dataOffset += array.header.size()*sizeof(uint64_t) + array.totalSize;
+  } else {
+    dataOffset += totalByteSize + sizeof(unsigned long);
+  }
+  nArraysDefined++;
+
+}
+
+void CParaviewXMLFileWriter::CompressDataArray(void* data, VTKDatatype type, unsigned long arraySize,
+                                               unsigned long globalSize, unsigned long offset){
+
+  std::string typeStr;
+  unsigned long typeSize = 0;
+
+  GetTypeInfo(type, typeStr, typeSize);
+
+  const unsigned long byteSize = arraySize*typeSize;
+  const unsigned long totalByteSize = globalSize*typeSize;
+
+  /*--- Rank i holds the uncompressed bytes [i*blockSize, (i+1)*blockSize) of the array. ---*/
+
+  const unsigned long blockSize = max<unsigned long>(1, (totalByteSize + size - 1) / size);
+  const unsigned long nBlocks = (totalByteSize + blockSize - 1) / blockSize;
+  const unsigned long blockBegin = min(rank*blockSize, totalByteSize);
+  const unsigned long blockEnd = min(blockBegin + blockSize, totalByteSize);
+
+  vector<uint8_t> rawBlock(blockEnd - blockBegin);
+
+#ifdef HAVE_MPI
+
+  /*--- Redistribute the bytes, the current and the new partitions are both contiguous. ---*/
+
+  unsigned long myOffset = offset*typeSize;
+  vector<unsigned long> allOffsets(size+1);
+  SU2_MPI::Allgather(&myOffset, 1, MPI_UNSIGNED_LONG, allOffsets.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  allOffsets[size] = totalByteSize;
+
+  auto overlap = [](unsigned long b1, unsigned long e1, unsigned long b2, unsigned long e2, unsigned long& begin) {
+    begin = max(b1, b2);
+    return int(min(e1, e2) > begin ? min(e1, e2) - begin : 0);
+  };
+
+  vector<int> nSend(size), sendDisp(size), nRecv(size), recvDisp(size);
+  unsigned long begin;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    const unsigned long destBegin = min(iRank*blockSize, totalByteSize);
+    nSend[iRank] = overlap(myOffset, myOffset+byteSize, destBegin, min(destBegin+blockSize, totalByteSize), begin);
+    sendDisp[iRank] = nSend[iRank]? int(begin - myOffset) : 0;
+    nRecv[iRank] = overlap(allOffsets[iRank], allOffsets[iRank+1], blockBegin, blockEnd, begin);
+    recvDisp[iRank] = nRecv[iRank]? int(begin - blockBegin) : 0;
+  }
+
+  MPI_Alltoallv(data, nSend.data(), sendDisp.data(), MPI_BYTE,
+                rawBlock.data(), nRecv.data(), recvDisp.data(), MPI_BYTE, MPI_COMM_WORLD);
+#else
+  memcpy(rawBlock.data(), data, byteSize);
+#endif
+
+  CompressedArray array;
+  array.block.resize(CompressionToolbox::LZ4CompressBound(rawBlock.size()));
+  array.block.resize(CompressionToolbox::LZ4Compress(rawBlock.data(), rawBlock.size(), array.block.data()));
+
+  /*--- Gather the compressed sizes to build the header and the file offsets. ---*/
+
+  unsigned long compSize = (rank < int(nBlocks))? array.block.size() : 0;
+  if (rank >= int(nBlocks)) array.block.clear();
+
+  vector<unsigned long> allCompSizes(size);
+  SU2_MPI::Allgather(&compSize, 1, MPI_UNSIGNED_LONG, allCompSizes.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  array.offset = 0;
+  array.totalSize = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) array.offset += allCompSizes[iRank];
+    array.totalSize += allCompSizes[iRank];
+  }
+
+  /*--- VTK header: number of blocks, block size, size of the last partial block (0 if full), compressed sizes. ---*/
+
+  array.header = {nBlocks, (nBlocks > 0)? blockSize : 0, (nBlocks > 0)? totalByteSize % blockSize : 0};
+  for (unsigned long iBlock = 0; iBlock < nBlocks; iBlock++) array.header.push_back(allCompSizes[iBlock]);
+
+  compressedArrays.push_back(std::move(array));
+
+}
+
+void CParaviewXMLFileWriter::WriteCompressedDataArray(const CompressedArray& array){
+
+  if (!WriteMPIBinaryData(array.header.data(), array.header.size()*sizeof(uint64_t), MASTER_NODE)){
+    SU2_MPI::Error("Writing compression header failed", CURRENT_FUNCTION);
+  }
+
+  if (!WriteMPIBinaryDataAll(array.block.data(), array.block.size(), array.totalSize, array.offset)){
+    SU2_MPI::Error("Writing data array failed", CURRENT_FUNCTION);
+  }
 
 }
@@ -26,11 +26,17 @@
  */
 
 #include "../../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter)  :
-  CFileWriter(std::move(valFileName), valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           unsigned short valCompression, vector<string> valLossyFields,
+                                           passivedouble valLossyTolerance)  :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  compression(valCompression),
+  lossyFields(std::move(valLossyFields)),
+  lossyTolerance(valLossyTolerance){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter(){
@@ -53,11 +59,17 @@ void CSU2BinaryFileWriter::Write_Data(){
   /*--- Prepare the first ints containing the counts. The first is a
    magic number that we can use to check for binary files (it is the hex
    representation for "SU2"). The second two values are number of variables
-   and number of points (DoFs). ---*/
+   and number of points (DoFs). For compressed files the last two values are
+   the format tag and the number of blocks (one per writing rank). ---*/
 
   int var_buf_size = 5;
   int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
 
+  if (compression != NO_COMPRESSION) {
+    var_buf[3] = CompressionToolbox::COMPRESSED_FORMAT_TAG;
+    var_buf[4] = size;
+  }
+
   /*--- Open the file using MPI I/O ---*/
   
   OpenMPIFile();
@@ -76,7 +88,13 @@ void CSU2BinaryFileWriter::Write_Data(){
     strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
-    
+
+  if (compression != NO_COMPRESSION) {
+    WriteCompressedData();
+    CloseMPIFile();
+    return;
+  }
+
   /*--- Compute various data sizes --- */
   
   unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
@@ -93,3 +111,54 @@ void CSU2BinaryFileWriter::Write_Data(){
   CloseMPIFile();
 
 }
+
+void CSU2BinaryFileWriter::WriteCompressedData(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned short nVar = fieldNames.size();
+  const unsigned long nParallel_Poin = dataSorter->GetnPoints();
+
+  /*--- Choose the codec of each field, only the requested (visualization) fields are quantized. ---*/
+
+  vector<int> codec(nVar, CompressionToolbox::CODEC_SHUFFLE_LZ4);
+  vector<double> tolerance(nVar, 0.0);
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+    if (find(lossyFields.begin(), lossyFields.end(), fieldNames[iVar]) != lossyFields.end()) {
+      codec[iVar] = CompressionToolbox::CODEC_QUANTIZED_LZ4;
+      tolerance[iVar] = lossyTolerance;
+    }
+  }
+
+  /*--- Copy the data of this rank field by field and compress it as one independent block. ---*/
+
+  vector<passivedouble> fieldData(nVar*nParallel_Poin);
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned long iPoint = 0; iPoint < nParallel_Poin; iPoint++)
+      fieldData[iVar*nParallel_Poin + iPoint] = dataSorter->GetData(iVar, iPoint);
+
+  vector<uint8_t> block;
+  CompressionToolbox::CompressBlock(fieldData.data(), nParallel_Poin, codec, tolerance, block);
+
+  /*--- Build the offset table, i.e. the first point and the first byte of each block. ---*/
+
+  unsigned long blockSize = block.size();
+  vector<unsigned long> allBlockSizes(size);
+  SU2_MPI::Allgather(&blockSize, 1, MPI_UNSIGNED_LONG, allBlockSizes.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  vector<unsigned long> pointOffset(size+1), byteOffset(size+1, 0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    pointOffset[iRank] = dataSorter->GetnPointCumulative(iRank);
+    byteOffset[iRank+1] = byteOffset[iRank] + allBlockSizes[iRank];
+  }
+  pointOffset[size] = dataSorter->GetnPointsGlobal();
+
+  WriteMPIBinaryData(codec.data(), nVar*sizeof(int), MASTER_NODE);
+  WriteMPIBinaryData(pointOffset.data(), (size+1)*sizeof(unsigned long), MASTER_NODE);
+  WriteMPIBinaryData(byteOffset.data(), (size+1)*sizeof(unsigned long), MASTER_NODE);
+
+  /*--- Collectively write the blocks. ---*/
+
+  WriteMPIBinaryDataAll(block.data(), blockSize, byteOffset[size], byteOffset[rank]);
+
+}
@@ -0,0 +1,380 @@
+/*!
+ * \file CSU2SeriesFileWriter.cpp
+ * \brief Filewriter class for SU2 binary time series files.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2SeriesFileWriter.hpp"
+#include <cstdint>
+#if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+const string CSU2SeriesFileWriter::fileExt = ".series";
+const string CSU2SeriesFileWriter::indexExt = ".xdmf";
+
+constexpr int CSU2SeriesFileWriter::SERIES_FORMAT_TAG;
+constexpr int CSU2SeriesFileWriter::SERIES_HEADER_INTS;
+constexpr unsigned long CSU2SeriesFileWriter::STEP_HEADER_SIZE;
+
+namespace {
+
+/*--- Element types of the connectivity and their XDMF topology codes. ---*/
+
+const GEO_TYPE elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+const unsigned short elemNodes[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                    N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+const int64_t xdmfTypes[] = {4, 5, 6, 9, 8, 7};
+
+}
+
+CSU2SeriesFileWriter::CSU2SeriesFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                           unsigned long valIter, su2double valTime) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  iter(valIter),
+  time(SU2_TYPE::GetValue(valTime)){
+
+  const unsigned long nVar = dataSorter->GetFieldNames().size();
+
+  headerSize = SERIES_HEADER_INTS*sizeof(int) + 3*sizeof(unsigned long) + nVar*CGNS_STRING_SIZE;
+
+  /*--- Each element is stored as its XDMF type followed by its nodes. ---*/
+
+  nMixedConn = dataSorter->GetnConnGlobal() + dataSorter->GetnElemGlobal();
+
+  stepSize = STEP_HEADER_SIZE + nVar*dataSorter->GetnPointsGlobal()*sizeof(passivedouble);
+
+}
+
+CSU2SeriesFileWriter::~CSU2SeriesFileWriter(){
+
+}
+
+void CSU2SeriesFileWriter::Write_Data(){
+
+  const unsigned long nVar = dataSorter->GetFieldNames().size();
+  const unsigned long nParallel_Poin = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+
+  /*--- Check whether the data can be appended to an existing file, the master
+   rank reads the existing time steps and all ranks get the number of steps kept. ---*/
+
+  int append = 0;
+  if (rank == MASTER_NODE) append = ReadSeries();
+  SU2_MPI::Bcast(&append, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  unsigned long nSteps = stepIters.size();
+  SU2_MPI::Bcast(&nSteps, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  const unsigned long stepOffset = headerSize + nMixedConn*sizeof(int64_t) + nSteps*stepSize;
+
+  if (append) {
+    OpenSeriesFile(stepOffset);
+  } else {
+    OpenMPIFile();
+    WriteHeader();
+  }
+
+  /*--- Append the block of this time step, the master writes the iteration and the time. ---*/
+
+  WriteMPIBinaryData(&iter, sizeof(unsigned long), MASTER_NODE);
+  WriteMPIBinaryData(&time, sizeof(passivedouble), MASTER_NODE);
+
+  unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
+  unsigned long sizeInBytesLocal    = sizeInBytesPerPoint*nParallel_Poin;
+  unsigned long sizeInBytesGlobal   = sizeInBytesPerPoint*nPoint_Global;
+  unsigned long offsetInBytes       = sizeInBytesPerPoint*dataSorter->GetnPointCumulative(rank);
+
+  WriteMPIBinaryDataAll(dataSorter->GetData(), sizeInBytesLocal, sizeInBytesGlobal, offsetInBytes);
+
+  /*--- Drop the steps that were written beyond the current one (e.g. before a restart). ---*/
+
+  TruncateSeriesFile(stepOffset + stepSize);
+
+  CloseMPIFile();
+
+  /*--- Update the index. ---*/
+
+  if (rank == MASTER_NODE) {
+    stepIters.push_back(iter);
+    stepTimes.push_back(time);
+    WriteIndex();
+  }
+
+}
+
+bool CSU2SeriesFileWriter::ReadSeries(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nVar = fieldNames.size();
+
+  stepIters.clear();
+  stepTimes.clear();
+
+  ifstream series_file(fileName.c_str(), ios::in | ios::binary);
+  if (!series_file.is_open()) return false;
+
+  /*--- The file must contain the same fields on the same mesh. ---*/
+
+  int var_buf[SERIES_HEADER_INTS] = {0};
+  unsigned long size_buf[3] = {0};
+  series_file.read(reinterpret_cast<char*>(var_buf), sizeof(var_buf));
+  series_file.read(reinterpret_cast<char*>(size_buf), sizeof(size_buf));
+
+  if (!series_file || var_buf[0] != SERIES_FORMAT_TAG || var_buf[1] != int(nVar) ||
+      var_buf[2] != int(dataSorter->GetnDim()) || size_buf[0] != dataSorter->GetnPointsGlobal() ||
+      size_buf[1] != dataSorter->GetnElemGlobal() || size_buf[2] != nMixedConn) return false;
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+    series_file.read(str_buf, CGNS_STRING_SIZE);
+    if (!series_file || strncmp(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE) != 0) return false;
+  }
+
+  /*--- Collect the time steps before the current one, the others will be overwritten. ---*/
+
+  series_file.seekg(0, ios::end);
+  const unsigned long fileSizeInBytes = series_file.tellg();
+
+  for (unsigned long pos = headerSize + nMixedConn*sizeof(int64_t); pos + stepSize <= fileSizeInBytes; pos += stepSize) {
+    unsigned long stepIter;
+    passivedouble stepTime;
+    series_file.seekg(pos);
+    series_file.read(reinterpret_cast<char*>(&stepIter), sizeof(unsigned long));
+    series_file.read(reinterpret_cast<char*>(&stepTime), sizeof(passivedouble));
+    if (!series_file || stepIter >= iter) break;
+    stepIters.push_back(stepIter);
+    stepTimes.push_back(stepTime);
+  }
+
+  return true;
+}
+
+void CSU2SeriesFileWriter::WriteHeader(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nVar = fieldNames.size();
+
+  int var_buf[SERIES_HEADER_INTS] = {SERIES_FORMAT_TAG, int(nVar), int(dataSorter->GetnDim()), 1};
+  unsigned long size_buf[3] = {dataSorter->GetnPointsGlobal(), dataSorter->GetnElemGlobal(), nMixedConn};
+
+  WriteMPIBinaryData(var_buf, SERIES_HEADER_INTS*sizeof(int), MASTER_NODE);
+  WriteMPIBinaryData(size_buf, 3*sizeof(unsigned long), MASTER_NODE);
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (unsigned long iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  /*--- Mixed connectivity of the elements of this rank (0-based). ---*/
+
+  vector<int64_t> connBuf;
+  connBuf.reserve(dataSorter->GetnConn() + dataSorter->GetnElem());
+
+  for (unsigned short iType = 0; iType < 6; iType++) {
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(elemTypes[iType]); iElem++) {
+      connBuf.push_back(xdmfTypes[iType]);
+      for (unsigned short iNode = 0; iNode < elemNodes[iType]; iNode++)
+        connBuf.push_back(int64_t(dataSorter->GetElem_Connectivity(elemTypes[iType], iElem, iNode))-1);
+    }
+  }
+
+  const unsigned long offset = dataSorter->GetnElemConnCumulative(rank) + dataSorter->GetnElemCumulative(rank);
+
+  WriteMPIBinaryDataAll(connBuf.data(), connBuf.size()*sizeof(int64_t), nMixedConn*sizeof(int64_t),
+                        offset*sizeof(int64_t));
+
+}
+
+void CSU2SeriesFileWriter::OpenSeriesFile(unsigned long offset){
+
+#ifdef HAVE_MPI
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(), MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open file ") + fileName, CURRENT_FUNCTION);
+  }
+
+  disp = offset;
+#else
+  fhw = fopen(fileName.c_str(), "r+b");
+
+  if (!fhw || fseek(fhw, offset, SEEK_SET) != 0) {
+    SU2_MPI::Error(string("Unable to open file ") + fileName, CURRENT_FUNCTION);
+  }
+#endif
+
+  fileSize = 0.0;
+  usedTime = 0;
+
+}
+
+void CSU2SeriesFileWriter::TruncateSeriesFile(unsigned long fileSizeInBytes){
+
+#ifdef HAVE_MPI
+  MPI_File_set_size(fhw, fileSizeInBytes);
+#else
+  fflush(fhw);
+#if defined(_WIN32) || defined(_WIN64) || defined (__WINDOWS__)
+  _chsize_s(_fileno(fhw), fileSizeInBytes);
+#else
+  if (ftruncate(fileno(fhw), fileSizeInBytes) != 0) {
+    SU2_MPI::Error(string("Unable to truncate file ") + fileName, CURRENT_FUNCTION);
+  }
+#endif
+#endif
+
+}
+
+void CSU2SeriesFileWriter::WriteIndex() const {
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const unsigned long nVar = fieldNames.size();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  const unsigned short nDim = dataSorter->GetnDim();
+
+  /*--- The data is referenced relative to the location of the index. ---*/
+
+  const string dataFile = fileName.substr(fileName.find_last_of("/\\")+1);
+  const string indexFile = fileName.substr(0, fileName.size()-fileExt.size()) + indexExt;
+
+  ofstream index_file(indexFile.c_str());
+
+  /*--- Select one or more columns of the point-major data of a time step. ---*/
+
+  auto dataColumns = [&](unsigned long stepOffset, unsigned long first, unsigned long count) {
+    index_file << "<DataItem ItemType=\"HyperSlab\" Dimensions=\"" << nPoint_Global << " " << count << "\">\n"
+               << "<DataItem Dimensions=\"3 2\" Format=\"XML\">0 " << first << " 1 1 "
+               << nPoint_Global << " " << count << "</DataItem>\n"
+               << "<DataItem Dimensions=\"" << nPoint_Global << " " << nVar << "\" NumberType=\"Float\" Precision=\"8\""
+               << " Format=\"Binary\" Endian=\"Native\" Seek=\"" << stepOffset + STEP_HEADER_SIZE << "\">"
+               << dataFile << "</DataItem>\n"
+               << "</DataItem>\n";
+  };
+
+  index_file.precision(15);
+  index_file << "<?xml version=\"1.0\" ?>\n"
+             << "<Xdmf Version=\"2.0\">\n"
+             << "<Domain>\n";
+
+  /*--- The connectivity is shared by all time steps. ---*/
+
+  index_file << "<Topology Name=\"Mesh\" TopologyType=\"Mixed\" NumberOfElements=\"" << dataSorter->GetnElemGlobal() << "\">\n"
+             << "<DataItem Dimensions=\"" << nMixedConn << "\" NumberType=\"Int\" Precision=\"8\" Format=\"Binary\""
+             << " Endian=\"Native\" Seek=\"" << headerSize << "\">" << dataFile << "</DataItem>\n"
+             << "</Topology>\n";
+
+  index_file << "<Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for (unsigned long iStep = 0; iStep < stepIters.size(); iStep++) {
+
+    const unsigned long stepOffset = headerSize + nMixedConn*sizeof(int64_t) + iStep*stepSize;
+
+    index_file << "<Grid Name=\"Iteration_" << stepIters[iStep] << "\" GridType=\"Uniform\">\n"
+               << "<Time Value=\"" << stepTimes[iStep] << "\"/>\n"
+               << "<Topology Reference=\"/Xdmf/Domain/Topology[1]\"/>\n";
+
+    /*--- The coordinates are the first fields. ---*/
+
+    index_file << "<Geometry GeometryType=\"" << (nDim == 3? "XYZ" : "XY") << "\">\n";
+    dataColumns(stepOffset, 0, nDim);
+    index_file << "</Geometry>\n";
+
+    for (unsigned long iVar = nDim; iVar < nVar; iVar++) {
+      index_file << "<Attribute Name=\"" << fieldNames[iVar] << "\" AttributeType=\"Scalar\" Center=\"Node\">\n";
+      dataColumns(stepOffset, iVar, 1);
+      index_file << "</Attribute>\n";
+    }
+
+    index_file << "</Grid>\n";
+  }
+
+  index_file << "</Grid>\n"
+             << "</Domain>\n"
+             << "</Xdmf>\n";
+
+}
+
+bool CSU2SeriesFileWriter::FindTimeStep(const string& val_filename, unsigned long val_iter, unsigned long& nFields,
+                                        unsigned long& nPoints, vector<string>& fieldNames, unsigned long& dataOffset){
+
+  const int rank = SU2_MPI::GetRank();
+
+  unsigned long info[4] = {0, 0, 0, 0};
+  vector<char> names;
+
+  if (rank == MASTER_NODE) {
+
+    ifstream series_file(val_filename.c_str(), ios::in | ios::binary);
+
+    int var_buf[SERIES_HEADER_INTS] = {0};
+    unsigned long size_buf[3] = {0};
+    series_file.read(reinterpret_cast<char*>(var_buf), sizeof(var_buf));
+    series_file.read(reinterpret_cast<char*>(size_buf), sizeof(size_buf));
+
+    if (series_file && var_buf[0] == SERIES_FORMAT_TAG) {
+
+      const unsigned long nVar = var_buf[1];
+      names.resize(nVar*CGNS_STRING_SIZE);
+      series_file.read(names.data(), names.size());
+
+      const unsigned long headerSize = SERIES_HEADER_INTS*sizeof(int) + 3*sizeof(unsigned long) + nVar*CGNS_STRING_SIZE;
+      const unsigned long stepSize = STEP_HEADER_SIZE + nVar*size_buf[0]*sizeof(passivedouble);
+
+      series_file.seekg(0, ios::end);
+      const unsigned long fileSizeInBytes = series_file.tellg();
+
+      for (unsigned long pos = headerSize + size_buf[2]*sizeof(int64_t); pos + stepSize <= fileSizeInBytes; pos += stepSize) {
+        unsigned long stepIter = 0;
+        series_file.seekg(pos);
+        series_file.read(reinterpret_cast<char*>(&stepIter), sizeof(unsigned long));
+        if (stepIter == val_iter) {
+          info[0] = 1; info[1] = nVar; info[2] = size_buf[0]; info[3] = pos + STEP_HEADER_SIZE;
+          break;
+        }
+      }
+    }
+  }
+
+  SU2_MPI::Bcast(info, 4, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (info[0] == 0) return false;
+
+  nFields = info[1];
+  nPoints = info[2];
+  dataOffset = info[3];
+
+  names.resize(nFields*CGNS_STRING_SIZE);
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+
+  fieldNames.clear();
+  for (unsigned long iVar = 0; iVar < nFields; iVar++) {
+    const char* name = &names[iVar*CGNS_STRING_SIZE];
+    fieldNames.emplace_back(name, strnlen(name, CGNS_STRING_SIZE));
+  }
+
+  return true;
+}
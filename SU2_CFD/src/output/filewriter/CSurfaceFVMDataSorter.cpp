@@ -37,6 +37,7 @@ CSurfaceFVMDataSorter::CSurfaceFVMDataSorter(CConfig *config, CGeometry *geometr
   this->volumeSorter = valVolumeSorter;
 
   connectivitySorted = false;
+  sortingPlanValid = false;
 
   nGlobalPointBeforeSort = geometry->GetGlobal_nPointDomain();
   nLocalPointsBeforeSort  = geometry->GetnPointDomain();
@@ -64,6 +65,18 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   int *Local_Halo = nullptr;
   int iNode, count;
 
+  /*--- If the surface points and the renumbering of the connectivity are known
+   from a previous call, only the data has to be extracted from the volume sorter. ---*/
+
+  if (sortingPlanValid) {
+    for (iPoint = 0; iPoint < nPoints; iPoint++) {
+      for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+        passiveDoubleBuffer[iPoint*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfacePoints[iPoint]);
+      }
+    }
+    return;
+  }
+
 #ifdef HAVE_MPI
   SU2_MPI::Request *send_req, *recv_req;
   SU2_MPI::Status status;
@@ -400,6 +413,7 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   nPoints = 0;
   Renumber2Global.clear();
+  surfacePoints.clear();
 
   for (iPoint = 0; iPoint < volumeSorter->GetnPoints(); iPoint++) {
     if (surfPoint[iPoint] != -1) {
@@ -408,6 +422,10 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
       Renumber2Global[nPoints] = surfPoint[iPoint];
 
+      /*--- Save the local index in the volume sorter to reuse it in subsequent calls. ---*/
+
+      surfacePoints.push_back(iPoint);
+
       /*--- Increment total number of surface points found locally. ---*/
 
       nPoints++;
@@ -444,13 +462,9 @@ void CSurfaceFVMDataSorter::SortOutputData() {
 
   passiveDoubleBuffer = new passivedouble[nPoints*VARS_PER_POINT];
 
-  for (int jj = 0; jj < VARS_PER_POINT; jj++) {
-    count = 0;
-    for (int ii = 0; ii < (int)volumeSorter->GetnPoints(); ii++) {
-      if (surfPoint[ii] !=-1) {
-        passiveDoubleBuffer[count*VARS_PER_POINT + jj] = volumeSorter->GetData(jj,ii);
-        count++;
-      }
+  for (iPoint = 0; iPoint < nPoints; iPoint++) {
+    for (int jj = 0; jj < VARS_PER_POINT; jj++) {
+      passiveDoubleBuffer[iPoint*VARS_PER_POINT + jj] = volumeSorter->GetData(jj, surfacePoints[iPoint]);
     }
   }
   /*--- Reduce the total number of surf points we have. This will be
@@ -1080,6 +1094,10 @@ void CSurfaceFVMDataSorter::SortOutputData() {
   delete [] nElem_Flag;
   delete [] Local_Halo;
 
+  /*--- The connectivity is now renumbered, until it is sorted again only the data needs to be updated. ---*/
+
+  sortingPlanValid = true;
+
 }
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, bool val_sort) {
@@ -1100,6 +1118,15 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
 
 void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometry, const vector<string> &markerList) {
 
+  /*--- The sorted (and renumbered) connectivity of the same markers is reused. The marker list
+   can differ between ranks (e.g. ranks that do not have the marker), therefore the decision has
+   to be taken collectively since the sorting itself involves collective communication. ---*/
+
+  int reuse = connectivitySorted && (markerList == sortedMarkers), allReuse = 0;
+  SU2_MPI::Allreduce(&reuse, &allReuse, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  if (allReuse) return;
+
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
@@ -1115,6 +1142,12 @@ void CSurfaceFVMDataSorter::SortConnectivity(CConfig *config, CGeometry *geometr
   SetTotalElements();
 
   connectivitySorted = true;
+  sortedMarkers = markerList;
+
+  /*--- The new connectivity uses the global numbering of the volume points, the plan to extract and
+   renumber the surface points is recomputed by the next call to SortOutputData. ---*/
+
+  sortingPlanValid = false;
 
 }
 
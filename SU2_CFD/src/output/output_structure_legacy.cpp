@@ -484,7 +484,7 @@ void COutputLegacy::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_Plotting(iMarker) == YES) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
         xCoord = geometry->nodes->GetCoord(iPoint, 0);
         yCoord = geometry->nodes->GetCoord(iPoint, 1);
@@ -540,7 +540,7 @@ void COutputLegacy::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_Plotting(iMarker) == YES)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) nLocalVertex_Surface++;
       }
 
@@ -612,7 +612,7 @@ void COutputLegacy::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_Plotting(iMarker) == YES)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) {
           Buffer_Send_Press[nVertex_Surface] = FlowSolver->GetNodes()->GetPressure(iPoint);
           Buffer_Send_CPress[nVertex_Surface] = FlowSolver->GetCPressure(iMarker, iVertex);
@@ -830,7 +830,7 @@ void COutputLegacy::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry,
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_Plotting(iMarker) == YES)
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
           Solution = AdjSolver->GetNodes()->GetSolution(iPoint);
           xCoord = geometry->nodes->GetCoord(iPoint, 0);
@@ -869,7 +869,7 @@ void COutputLegacy::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry,
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_Plotting(iMarker) == YES)
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
           Solution = AdjSolver->GetNodes()->GetSolution(iPoint);
 
@@ -916,7 +916,7 @@ void COutputLegacy::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_Plotting(iMarker) == YES)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) nLocalVertex_Surface ++;
       }
 
@@ -956,10 +956,10 @@ void COutputLegacy::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_Plotting(iMarker) == YES)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) {
           Solution = AdjSolver->GetNodes()->GetSolution(iPoint);
-          //Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          //Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Coord = geometry->nodes->GetCoord(iPoint);
           //d = AdjSolver->GetNodes()->GetForceProj_Vector(iPoint);
           Buffer_Send_GlobalPoint[nVertex_Surface] = geometry->nodes->GetGlobalIndex(iPoint);
@@ -1288,7 +1288,7 @@ void COutputLegacy::MergeCoordinates(CConfig *config, CGeometry *geometry) {
     if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
       SendRecv = config->GetMarker_All_SendRecv(iMarker);
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- For SU2_CFD and SU2_SOL we want to remove the periodic halo nodes,
          * but for SU2_DEF we want them to be included, therefore the definition of a periodic point
@@ -1388,7 +1388,7 @@ void COutputLegacy::MergeCoordinates(CConfig *config, CGeometry *geometry) {
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           /*--- For SU2_CFD and SU2_SOL we want to remove the periodic halo nodes,
            * but for SU2_DEF we want them to be included, therefore the definition of a periodic point
@@ -1652,7 +1652,7 @@ void COutputLegacy::MergeVolumetricConnectivity(CConfig *config, CGeometry *geom
       if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
         SendRecv = config->GetMarker_All_SendRecv(iMarker);
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
               (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 0) &&
@@ -1723,7 +1723,7 @@ void COutputLegacy::MergeVolumetricConnectivity(CConfig *config, CGeometry *geom
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         iGlobal_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
@@ -2023,7 +2023,7 @@ void COutputLegacy::MergeSurfaceConnectivity(CConfig *config, CGeometry *geometr
     if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
       SendRecv = config->GetMarker_All_SendRecv(iMarker);
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
             (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 0) &&
             (SendRecv < 0)) {
@@ -2092,7 +2092,7 @@ void COutputLegacy::MergeSurfaceConnectivity(CConfig *config, CGeometry *geometr
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         iGlobal_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
@@ -2482,7 +2482,7 @@ void COutputLegacy::MergeSolution(CConfig *config, CGeometry *geometry, CSolver
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -2960,7 +2960,7 @@ void COutputLegacy::MergeSolution(CConfig *config, CGeometry *geometry, CSolver
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
         if (config->GetMarker_All_Plotting(iMarker) == YES) {
           for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
             Aux_Frict_x[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 0);
             Aux_Frict_y[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 1);
             if (geometry->GetnDim() == 3) Aux_Frict_z[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2);
@@ -3043,7 +3043,7 @@ void COutputLegacy::MergeSolution(CConfig *config, CGeometry *geometry, CSolver
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
         if (config->GetMarker_All_Plotting(iMarker) == YES) {
           for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
             Aux_Heat[iPoint] = solver[FLOW_SOL]->GetHeatFlux(iMarker, iVertex);
             Aux_yPlus[iPoint] = solver[FLOW_SOL]->GetYPlus(iMarker, iVertex);
           }
@@ -3234,8 +3234,8 @@ void COutputLegacy::MergeSolution(CConfig *config, CGeometry *geometry, CSolver
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
         if (config->GetMarker_All_Plotting(iMarker) == YES) {
           for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-            Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+            iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+            Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
             Area = sqrt (Area);
@@ -3782,7 +3782,7 @@ void COutputLegacy::MergeBaselineSolution(CConfig *config, CGeometry *geometry,
     if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
       SendRecv = config->GetMarker_All_SendRecv(iMarker);
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
             (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1) &&
             (SendRecv < 0)) {
@@ -3860,7 +3860,7 @@ void COutputLegacy::MergeBaselineSolution(CConfig *config, CGeometry *geometry,
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -9152,12 +9152,12 @@ void COutputLegacy::SetCp_InverseDesign(CSolver *solver_container, CGeometry *ge
         /*--- The Pressure file uses the global numbering ---*/
 
 #ifndef HAVE_MPI
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 #else
-        iPoint = geometry->nodes->GetGlobalIndex(geometry->vertex[iMarker][iVertex]->GetNode());
+        iPoint = geometry->nodes->GetGlobalIndex(geometry->vertexData[iMarker].GetNode(iVertex));
 #endif
 
-        if (geometry->vertex[iMarker][iVertex]->GetNode() < geometry->GetnPointDomain()) {
+        if (geometry->vertexData[iMarker].GetNode(iVertex) < geometry->GetnPointDomain()) {
           Point2Vertex[iPoint][0] = iMarker;
           Point2Vertex[iPoint][1] = iVertex;
           PointInDomain[iPoint] = true;
@@ -9237,7 +9237,7 @@ void COutputLegacy::SetCp_InverseDesign(CSolver *solver_container, CGeometry *ge
         (Boundary == NEARFIELD_BOUNDARY)) {
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         Cp = solver_container->GetCPressure(iMarker, iVertex);
         CpTarget = solver_container->GetCPressureTarget(iMarker, iVertex);
@@ -9304,12 +9304,12 @@ void COutputLegacy::SetHeatFlux_InverseDesign(CSolver *solver_container, CGeomet
         /*--- The Pressure file uses the global numbering ---*/
 
 #ifndef HAVE_MPI
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 #else
-        iPoint = geometry->nodes->GetGlobalIndex(geometry->vertex[iMarker][iVertex]->GetNode());
+        iPoint = geometry->nodes->GetGlobalIndex(geometry->vertexData[iMarker].GetNode(iVertex));
 #endif
 
-        if (geometry->vertex[iMarker][iVertex]->GetNode() < geometry->GetnPointDomain()) {
+        if (geometry->vertexData[iMarker].GetNode(iVertex) < geometry->GetnPointDomain()) {
           Point2Vertex[iPoint][0] = iMarker;
           Point2Vertex[iPoint][1] = iVertex;
           PointInDomain[iPoint] = true;
@@ -9387,7 +9387,7 @@ void COutputLegacy::SetHeatFlux_InverseDesign(CSolver *solver_container, CGeomet
         (Boundary == NEARFIELD_BOUNDARY)) {
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         HeatFlux = solver_container->GetHeatFlux(iMarker, iVertex);
         HeatFluxTarget = solver_container->GetHeatFluxTarget(iMarker, iVertex);
@@ -9464,8 +9464,8 @@ void COutputLegacy::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Face_Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Coord = geometry->nodes->GetCoord(iPoint);
 
         /*--- Using Face_Normal(z), and Coord(z) we identify only a surface,
@@ -9496,8 +9496,8 @@ void COutputLegacy::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Face_Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Coord = geometry->nodes->GetCoord(iPoint);
 
         if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0)) {
@@ -9562,8 +9562,8 @@ void COutputLegacy::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Face_Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Coord = geometry->nodes->GetCoord(iPoint);
 
         if (geometry->nodes->GetDomain(iPoint))
@@ -9623,8 +9623,8 @@ void COutputLegacy::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Face_Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Coord = geometry->nodes->GetCoord(iPoint);
 
         if (geometry->nodes->GetDomain(iPoint))
@@ -10123,7 +10123,7 @@ void COutputLegacy::SpecialOutput_Distortion(CSolver *solver, CGeometry *geometr
       string Marker_TagBound = config->GetMarker_All_TagBound(iMarker);
       if (Marker_TagBound == Analyze_TagBound) {
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           if (geometry->nodes->GetDomain(iPoint)) nLocalVertex_Surface++;
         }
       }
@@ -10214,7 +10214,7 @@ void COutputLegacy::SpecialOutput_Distortion(CSolver *solver, CGeometry *geometr
       if (Marker_TagBound == Analyze_TagBound) {
 
         for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -10257,7 +10257,7 @@ void COutputLegacy::SpecialOutput_Distortion(CSolver *solver, CGeometry *geometr
 
             Buffer_Send_q[nVertex_Surface] = 0.5*Density*Velocity2;
 
-            Vector = geometry->vertex[iMarker][iVertex]->GetNormal();
+            Vector = geometry->vertexData[iMarker].GetNormal(iVertex);
             Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) { Area += Vector[iDim]*Vector[iDim]; } Area = sqrt(Area);
             Buffer_Send_Area[nVertex_Surface] = Area;
 
@@ -11209,8 +11209,8 @@ void COutputLegacy::SetSensitivity_Files(CGeometry ***geometry, CConfig **config
         nVertex = geometry[iZone][INST_0]->GetnVertex(iMarker);
 
         for (iVertex = 0; iVertex < nVertex; iVertex++) {
-          iPoint = geometry[iZone][INST_0]->vertex[iMarker][iVertex]->GetNode();
-          Normal = geometry[iZone][INST_0]->vertex[iMarker][iVertex]->GetNormal();
+          iPoint = geometry[iZone][INST_0]->vertexData[iMarker].GetNode(iVertex);
+          Normal = geometry[iZone][INST_0]->vertexData[iMarker].GetNormal(iVertex);
           Prod = 0.0;
           Area = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) {
@@ -12517,7 +12517,7 @@ void COutputLegacy::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSo
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_Plotting(iMarker) == YES) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           Aux_Frict_x[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 0);
           Aux_Frict_y[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 1);
           if (geometry->GetnDim() == 3) Aux_Frict_z[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2);
@@ -12553,7 +12553,7 @@ void COutputLegacy::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSo
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -13161,7 +13161,7 @@ void COutputLegacy::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry,
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_Plotting(iMarker) == YES) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           Aux_Frict_x[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 0);
           Aux_Frict_y[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 1);
           if (geometry->GetnDim() == 3) Aux_Frict_z[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2);
@@ -13196,7 +13196,7 @@ void COutputLegacy::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry,
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -13685,8 +13685,8 @@ void COutputLegacy::LoadLocalData_AdjFlow(CConfig *config, CGeometry *geometry,
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_Plotting(iMarker) == YES) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt (Area);
@@ -13718,7 +13718,7 @@ void COutputLegacy::LoadLocalData_AdjFlow(CConfig *config, CGeometry *geometry,
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -14025,7 +14025,7 @@ void COutputLegacy::LoadLocalData_Elasticity(CConfig *config, CGeometry *geometr
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -14251,7 +14251,7 @@ void COutputLegacy::LoadLocalData_Base(CConfig *config, CGeometry *geometry, CSo
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo[iPoint] = false;
@@ -14442,7 +14442,7 @@ void COutputLegacy::SortVolumetricConnectivity(CConfig *config, CGeometry *geome
       if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
         SendRecv = config->GetMarker_All_SendRecv(iMarker);
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
               (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 0) &&
@@ -14515,7 +14515,7 @@ void COutputLegacy::SortVolumetricConnectivity(CConfig *config, CGeometry *geome
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
@@ -15028,7 +15028,7 @@ void COutputLegacy::SortSurfaceConnectivity(CConfig *config, CGeometry *geometry
       if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
         SendRecv = config->GetMarker_All_SendRecv(iMarker);
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
               (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 0) &&
@@ -15101,7 +15101,7 @@ void COutputLegacy::SortSurfaceConnectivity(CConfig *config, CGeometry *geometry
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
@@ -15591,7 +15591,7 @@ void COutputLegacy::SortOutputData(CConfig *config, CGeometry *geometry) {
        be some periodic halo nodes that send info to the same rank. ---*/
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                       (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
         if (isPeriodic) Local_Halo[iPoint] = false;
@@ -16012,7 +16012,7 @@ void COutputLegacy::SortOutputData_Surface(CConfig *config, CGeometry *geometry)
        be some periodic halo nodes that send info to the same rank. ---*/
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                       (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
         if (isPeriodic) Local_Halo[iPoint] = false;
@@ -16541,7 +16541,7 @@ void COutputLegacy::SortOutputData_Surface(CConfig *config, CGeometry *geometry)
       if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
         SendRecv = config->GetMarker_All_SendRecv(iMarker);
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
               (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 0) &&
@@ -16613,7 +16613,7 @@ void COutputLegacy::SortOutputData_Surface(CConfig *config, CGeometry *geometry)
       RecvFrom = abs(SendRecv)-1;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Global_Index = geometry->nodes->GetGlobalIndex(iPoint);
 
         /*--- We need to keep one copy of overlapping halo cells. ---*/
@@ -17831,7 +17831,7 @@ void COutputLegacy::WriteCSV_Slice(CConfig *config, CGeometry *geometry,
        be some periodic halo nodes that send info to the same rank. ---*/
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                       (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
         if (isPeriodic) Local_Halo[iPoint] = false;
@@ -18155,11 +18155,11 @@ void COutputLegacy::SpecialOutput_AnalyzeSurface(CSolver *solver, CGeometry *geo
     if (config->GetMarker_All_Analyze(iMarker) == YES) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
-          geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+          geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
           if (axisymmetric) {
             if (geometry->nodes->GetCoord(iPoint, 1) != 0.0)
@@ -20408,7 +20408,7 @@ void COutputLegacy::PrepareOffsets(CConfig *config, CGeometry *geometry) {
          be some periodic halo nodes that send info to the same rank. ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
                         (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
           if (isPeriodic) Local_Halo_Sort[iPoint] = false;
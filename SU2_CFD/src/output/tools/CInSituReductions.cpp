@@ -0,0 +1,380 @@
+/*!
+ * \file CInSituReductions.cpp
+ * \brief Implementation of the in-situ reductions of the volume output data.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/tools/CInSituReductions.hpp"
+#include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include "../../../../Common/include/CConfig.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../../Common/include/adt_structure.hpp"
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+constexpr unsigned short CInSituReductions::MAX_PROBE_NODES;
+
+CInSituReductions::CInSituReductions(CConfig *config, CGeometry *geometry, vector<short> offsets, vector<string> names,
+                                     vector<short> meanOffsets, vector<short> varOffsets) :
+  rank(SU2_MPI::GetRank()),
+  nDim(geometry->GetnDim()),
+  nPointDomain(geometry->GetnPointDomain()),
+  fieldOffset(std::move(offsets)),
+  fieldNames(std::move(names)),
+  meanOffset(std::move(meanOffsets)),
+  varOffset(std::move(varOffsets)),
+  startIter(config->GetStartWindowIteration()),
+  sliceFreq(config->GetInSitu_Slice_Freq()) {
+
+  if (!meanOffset.empty()) {
+    mean.resize(nPointDomain, fieldOffset.size()) = 0.0;
+    sumSqDev.resize(nPointDomain, fieldOffset.size()) = 0.0;
+  }
+
+  vector<passivedouble> probeCoords;
+  for (const auto& coord : config->GetInSitu_Probes())
+    probeCoords.push_back(SU2_TYPE::GetValue(coord));
+
+  if (!probeCoords.empty()) {
+    LocateProbes(geometry, probeCoords);
+    probeFileName = config->GetMultizone_FileName("probes", config->GetiZone(), ".csv");
+  }
+
+  for (const auto& value : config->GetInSitu_Slices())
+    slicePlanes.push_back(SU2_TYPE::GetValue(value));
+
+}
+
+void CInSituReductions::LocateProbes(CGeometry *geometry, const vector<passivedouble>& coords) {
+
+  const int size = SU2_MPI::GetSize();
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned long nElem = geometry->GetnElem();
+
+  nProbes = coords.size()/nDim;
+
+  /*--- Build a local ADT of the elements of this rank, including the ones with halo nodes. ---*/
+
+  vector<su2double> volCoor(nDim*nPoint);
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      volCoor[iPoint*nDim+iDim] = geometry->nodes->GetCoord(iPoint, iDim);
+
+  vector<unsigned long> elemConn, elemID(nElem);
+  vector<unsigned short> elemType(nElem), markerID(nElem, 0);
+
+  for (unsigned long iElem = 0; iElem < nElem; iElem++) {
+    elemType[iElem] = geometry->elem[iElem]->GetVTK_Type();
+    elemID[iElem] = iElem;
+    for (unsigned short iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++)
+      elemConn.push_back(geometry->elem[iElem]->GetNode(iNode));
+  }
+
+  CADTElemClass localVolumeADT(nDim, volCoor, elemConn, elemType, markerID, elemID, false);
+
+  /*--- Search the probes, the lowest rank that contains a probe does the interpolation. ---*/
+
+  vector<int> foundRank(nProbes, size), probeRank(nProbes);
+  vector<unsigned long> foundElem(nProbes);
+  vector<su2double> foundWeights(nProbes*MAX_PROBE_NODES, 0.0);
+
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+    su2double coor[3] = {0.0}, parCoor[3] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) coor[iDim] = coords[iProbe*nDim+iDim];
+
+    unsigned short marker;
+    unsigned long elem;
+    int rankID;
+    if (localVolumeADT.DetermineContainingElement(coor, marker, elem, rankID, parCoor,
+                                                  &foundWeights[iProbe*MAX_PROBE_NODES])) {
+      foundRank[iProbe] = rank;
+      foundElem[iProbe] = elem;
+    }
+  }
+
+  SU2_MPI::Allreduce(foundRank.data(), probeRank.data(), nProbes, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  /*--- Share the global indices (shifted by one, zero is unused) and the weights of the interpolation nodes. ---*/
+
+  vector<unsigned long> myNodes(nProbes*MAX_PROBE_NODES, 0), globalNodes(nProbes*MAX_PROBE_NODES);
+  vector<su2double> myWeights(nProbes*MAX_PROBE_NODES, 0.0), weights(nProbes*MAX_PROBE_NODES);
+
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+    if (probeRank[iProbe] == size) {
+      SU2_MPI::Error(string("Probe ") + to_string(iProbe) + string(" in INSITU_PROBES is outside of the domain."),
+                     CURRENT_FUNCTION);
+    }
+    if (probeRank[iProbe] != rank) continue;
+
+    const auto elem = geometry->elem[foundElem[iProbe]];
+    for (unsigned short iNode = 0; iNode < elem->GetnNodes(); iNode++) {
+      myNodes[iProbe*MAX_PROBE_NODES+iNode] = geometry->nodes->GetGlobalIndex(elem->GetNode(iNode)) + 1;
+      myWeights[iProbe*MAX_PROBE_NODES+iNode] = foundWeights[iProbe*MAX_PROBE_NODES+iNode];
+    }
+  }
+
+  SU2_MPI::Allreduce(myNodes.data(), globalNodes.data(), myNodes.size(), MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(myWeights.data(), weights.data(), myWeights.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  /*--- Keep the nodes owned by this rank, each node contributes on exactly one rank. ---*/
+
+  probeNodes.assign(nProbes*MAX_PROBE_NODES, -1);
+  probeWeights.assign(nProbes*MAX_PROBE_NODES, 0.0);
+
+  for (unsigned long iNode = 0; iNode < globalNodes.size(); iNode++) {
+    if (globalNodes[iNode] == 0) continue;
+    const long iPoint = geometry->GetGlobal_to_Local_Point(globalNodes[iNode]-1);
+    if (iPoint >= 0 && static_cast<unsigned long>(iPoint) < nPointDomain) {
+      probeNodes[iNode] = iPoint;
+      probeWeights[iNode] = SU2_TYPE::GetValue(weights[iNode]);
+    }
+  }
+
+}
+
+void CInSituReductions::Update(CConfig *config, CGeometry *geometry, CParallelDataSorter *volumeData,
+                               unsigned long timeIter, passivedouble time) {
+
+  /*--- The output may be requested more than once per time iteration (e.g. at the end of the run). ---*/
+
+  if (static_cast<long>(timeIter) == lastIter) return;
+
+  const bool newFiles = (lastIter < 0) && !config->GetRestart();
+  lastIter = timeIter;
+
+  if (!meanOffset.empty()) UpdateStatistics(volumeData, timeIter);
+
+  if (nProbes > 0) WriteProbes(volumeData, timeIter, time, newFiles);
+
+  if (timeIter % sliceFreq == 0) {
+    for (unsigned short iSlice = 0; iSlice < slicePlanes.size()/(2*nDim); iSlice++) {
+      const string fileName = config->GetFilename("slice_" + to_string(iSlice), ".csv", timeIter);
+      WriteSlice(geometry, volumeData, iSlice, fileName);
+    }
+  }
+
+}
+
+void CInSituReductions::UpdateStatistics(CParallelDataSorter *volumeData, unsigned long timeIter) {
+
+  const unsigned long nField = fieldOffset.size();
+
+  /*--- Welford's update of the mean and of the sum of the squared deviations. ---*/
+
+  if (timeIter >= startIter) {
+    nSamples++;
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned long iField = 0; iField < nField; iField++) {
+        const passivedouble value = SU2_TYPE::GetValue(volumeData->GetUnsorted_Data(iPoint, fieldOffset[iField]));
+        const passivedouble delta = value - mean(iPoint, iField);
+        mean(iPoint, iField) += delta / nSamples;
+        sumSqDev(iPoint, iField) += delta * (value - mean(iPoint, iField));
+      }
+    }
+  }
+
+  const passivedouble scaling = (nSamples > 0)? 1.0 / nSamples : 0.0;
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned long iField = 0; iField < nField; iField++) {
+      volumeData->SetUnsorted_Data(iPoint, meanOffset[iField], mean(iPoint, iField));
+      volumeData->SetUnsorted_Data(iPoint, varOffset[iField], sumSqDev(iPoint, iField) * scaling);
+    }
+  }
+
+}
+
+void CInSituReductions::WriteProbes(const CParallelDataSorter *volumeData, unsigned long timeIter,
+                                    passivedouble time, bool newFile) const {
+
+  const unsigned long nField = fieldOffset.size();
+
+  /*--- Contributions of the owned nodes, summed over the ranks. ---*/
+
+  vector<su2double> myValues(nProbes*nField, 0.0), values(nProbes*nField);
+
+  for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++) {
+    for (unsigned short iNode = 0; iNode < MAX_PROBE_NODES; iNode++) {
+      const long iPoint = probeNodes[iProbe*MAX_PROBE_NODES+iNode];
+      if (iPoint < 0) continue;
+      const passivedouble weight = probeWeights[iProbe*MAX_PROBE_NODES+iNode];
+      for (unsigned long iField = 0; iField < nField; iField++)
+        myValues[iProbe*nField+iField] += weight * volumeData->GetUnsorted_Data(iPoint, fieldOffset[iField]);
+    }
+  }
+
+  SU2_MPI::Allreduce(myValues.data(), values.data(), myValues.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Append a line to the file, the header is written when a new file is started. ---*/
+
+  bool writeHeader = newFile;
+  if (!writeHeader) {
+    ifstream probe_file(probeFileName.c_str());
+    writeHeader = !probe_file.is_open();
+  }
+
+  ofstream probe_file(probeFileName.c_str(), writeHeader? ios::out : ios::app);
+
+  if (writeHeader) {
+    probe_file << "\"Time_Iter\",\"Cur_Time\"";
+    for (unsigned long iProbe = 0; iProbe < nProbes; iProbe++)
+      for (unsigned long iField = 0; iField < nField; iField++)
+        probe_file << ",\"Probe" << iProbe << "_" << fieldNames[iField] << "\"";
+    probe_file << "\n";
+  }
+
+  probe_file << timeIter << "," << std::scientific << std::setprecision(15) << time;
+  for (const auto& value : values) probe_file << "," << SU2_TYPE::GetValue(value);
+  probe_file << "\n";
+
+}
+
+void CInSituReductions::WriteSlice(CGeometry *geometry, const CParallelDataSorter *volumeData,
+                                   unsigned short iSlice, const string& fileName) const {
+
+  const unsigned long nField = fieldOffset.size();
+  const unsigned long nValue = nDim + nField;
+  const passivedouble *origin = &slicePlanes[iSlice*2*nDim];
+  const passivedouble *normal = origin + nDim;
+  const auto nodes = geometry->nodes;
+
+  auto Distance = [&](unsigned long iPoint) {
+    passivedouble dist = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      dist += (SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - origin[iDim]) * normal[iDim];
+    return dist;
+  };
+
+  /*--- Intersect the edges that have at least one owned node with the plane. Edges shared by several ranks
+   are identified by the global indices of their nodes, each rank adds the contribution of the nodes it owns. ---*/
+
+  vector<unsigned long> myKeys;
+  vector<passivedouble> myValues;
+
+  for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    unsigned long iPoint = geometry->edges->GetNode(iEdge, 0);
+    unsigned long jPoint = geometry->edges->GetNode(iEdge, 1);
+    if (iPoint >= nPointDomain && jPoint >= nPointDomain) continue;
+
+    passivedouble iDist = Distance(iPoint), jDist = Distance(jPoint);
+    if ((iDist < 0.0) == (jDist < 0.0)) continue;
+
+    if (nodes->GetGlobalIndex(iPoint) > nodes->GetGlobalIndex(jPoint)) {
+      swap(iPoint, jPoint);
+      swap(iDist, jDist);
+    }
+
+    const passivedouble t = iDist / (iDist - jDist);
+
+    myKeys.push_back(nodes->GetGlobalIndex(iPoint));
+    myKeys.push_back(nodes->GetGlobalIndex(jPoint));
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      myValues.push_back((1.0-t) * SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) +
+                         t * SU2_TYPE::GetValue(nodes->GetCoord(jPoint, iDim)));
+
+    for (unsigned long iField = 0; iField < nField; iField++) {
+      passivedouble value = 0.0;
+      if (iPoint < nPointDomain)
+        value += (1.0-t) * SU2_TYPE::GetValue(volumeData->GetUnsorted_Data(iPoint, fieldOffset[iField]));
+      if (jPoint < nPointDomain)
+        value += t * SU2_TYPE::GetValue(volumeData->GetUnsorted_Data(jPoint, fieldOffset[iField]));
+      myValues.push_back(value);
+    }
+  }
+
+  /*--- Gather the intersections on the master rank. ---*/
+
+  vector<unsigned long> keys;
+  vector<passivedouble> values;
+
+#ifdef HAVE_MPI
+  const int size = SU2_MPI::GetSize();
+  int myCount = myKeys.size()/2;
+  vector<int> counts(size), keyCounts(size), keyDispl(size), valueCounts(size), valueDispl(size);
+
+  SU2_MPI::Gather(&myCount, 1, MPI_INT, counts.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    int nTotal = 0;
+    for (int iRank = 0; iRank < size; iRank++) {
+      keyCounts[iRank] = 2*counts[iRank];
+      keyDispl[iRank] = 2*nTotal;
+      valueCounts[iRank] = nValue*counts[iRank];
+      valueDispl[iRank] = nValue*nTotal;
+      nTotal += counts[iRank];
+    }
+    keys.resize(2*nTotal);
+    values.resize(nValue*nTotal);
+  }
+
+  /*--- The values are passive, the MPI wrappers are not needed. ---*/
+
+  MPI_Gatherv(myKeys.data(), myKeys.size(), MPI_UNSIGNED_LONG, keys.data(), keyCounts.data(), keyDispl.data(),
+              MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Gatherv(myValues.data(), myValues.size(), MPI_DOUBLE, values.data(), valueCounts.data(), valueDispl.data(),
+              MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#else
+  keys = std::move(myKeys);
+  values = std::move(myValues);
+#endif
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Merge the contributions of the ranks to the same intersection, sorted by edge. ---*/
+
+  map<pair<unsigned long, unsigned long>, unsigned long> edgeMap;
+  vector<passivedouble> slice;
+
+  for (unsigned long iCut = 0; iCut < keys.size()/2; iCut++) {
+    const auto edge = make_pair(keys[2*iCut], keys[2*iCut+1]);
+    const passivedouble *value = &values[iCut*nValue];
+
+    auto it = edgeMap.find(edge);
+    if (it == edgeMap.end()) {
+      edgeMap[edge] = slice.size();
+      slice.insert(slice.end(), value, value+nValue);
+    } else {
+      for (unsigned long iField = 0; iField < nField; iField++)
+        slice[it->second+nDim+iField] += value[nDim+iField];
+    }
+  }
+
+  ofstream slice_file(fileName.c_str());
+
+  slice_file << "\"x\",\"y\"";
+  if (nDim == 3) slice_file << ",\"z\"";
+  for (const auto& name : fieldNames) slice_file << ",\"" << name << "\"";
+  slice_file << "\n";
+
+  slice_file << std::scientific << std::setprecision(15);
+  for (const auto& cut : edgeMap) {
+    for (unsigned long iValue = 0; iValue < nValue; iValue++)
+      slice_file << (iValue? "," : "") << slice[cut.second+iValue];
+    slice_file << "\n";
+  }
+
+}
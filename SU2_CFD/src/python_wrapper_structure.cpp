@@ -257,7 +257,7 @@ unsigned long CDriver::GetNumberHaloVertices(unsigned short iMarker){
 
   nHaloVertices = 0;
   for(iVertex = 0; iVertex < geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker]; iVertex++){
-    iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+    iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
     if(!(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint))) nHaloVertices += 1;
   }
 
@@ -269,7 +269,7 @@ unsigned long CDriver::GetVertexGlobalIndex(unsigned short iMarker, unsigned lon
 
   unsigned long iPoint, GlobalIndex;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   GlobalIndex = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetGlobalIndex(iPoint);
 
   return GlobalIndex;
@@ -280,7 +280,7 @@ bool CDriver::IsAHaloNode(unsigned short iMarker, unsigned long iVertex) {
 
   unsigned long iPoint;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   if(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint)) return false;
   else return true;
 
@@ -306,7 +306,7 @@ passivedouble CDriver::GetVertexCoordX(unsigned short iMarker, unsigned long iVe
   su2double* Coord;
   unsigned long iPoint;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
   return SU2_TYPE::GetValue(Coord[0]);
 
@@ -317,7 +317,7 @@ passivedouble CDriver::GetVertexCoordY(unsigned short iMarker, unsigned long iVe
   su2double* Coord;
   unsigned long iPoint;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
   return SU2_TYPE::GetValue(Coord[1]);
 }
@@ -328,7 +328,7 @@ passivedouble CDriver::GetVertexCoordZ(unsigned short iMarker, unsigned long iVe
   unsigned long iPoint;
 
   if(nDim == 3) {
-    iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+    iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
     Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
     return SU2_TYPE::GetValue(Coord[2]);
   }
@@ -369,12 +369,12 @@ bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned long iVertex)
 
   su2double Pinf = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetPressure_Inf();
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   /*--- It is necessary to distinguish the halo nodes from the others, since they introduce non physical forces. ---*/
   if(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint)) {
     /*--- Get the normal at the vertex: this normal goes inside the fluid domain. ---*/
-    Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNormal();
+    Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNormal(iVertex);
     AreaSquare = 0.0;
     for(iDim = 0; iDim < nDim; iDim++) {
       AreaSquare += Normal[iDim]*Normal[iDim];
@@ -463,7 +463,7 @@ void CDriver::SetVertexCoordX(unsigned short iMarker, unsigned long iVertex, pas
   unsigned long iPoint;
   su2double *Coord;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
 
   PyWrapVarCoord[0] = newPosX - Coord[0];
@@ -475,7 +475,7 @@ void CDriver::SetVertexCoordY(unsigned short iMarker, unsigned long iVertex, pas
   unsigned long iPoint;
   su2double *Coord;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
 
   PyWrapVarCoord[1] = newPosY - Coord[1];
@@ -486,7 +486,7 @@ void CDriver::SetVertexCoordZ(unsigned short iMarker, unsigned long iVertex, pas
   unsigned long iPoint;
   su2double *Coord;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   Coord = geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetCoord(iPoint);
 
   if(nDim > 2) {
@@ -515,7 +515,7 @@ passivedouble CDriver::GetVertexTemperature(unsigned short iMarker, unsigned lon
 
   bool compressible = (config_container[ZONE_0]->GetKind_Regime() == COMPRESSIBLE);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   if(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint) && compressible){
     vertexWallTemp = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
@@ -545,7 +545,7 @@ bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned long iVer
   bool compressible = (config_container[ZONE_0]->GetKind_Regime() == COMPRESSIBLE);
   bool halo;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   if(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint)){
     halo = false;
@@ -600,10 +600,10 @@ passivedouble CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned
   vertexWallHeatFlux = 0.0;
   dTdn = 0.0;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   if(geometry_container[ZONE_0][INST_0][MESH_0]->nodes->GetDomain(iPoint) && compressible){
-    Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNormal();
+    Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNormal(iVertex);
     Area = 0.0;
     for (iDim = 0; iDim < nDim; iDim++)
       Area += Normal[iDim]*Normal[iDim];
@@ -641,7 +641,7 @@ passivedouble CDriver::GetThermalConductivity(unsigned short iMarker, unsigned l
   su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
   su2double laminar_viscosity, thermal_conductivity;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   laminar_viscosity    = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetNodes()->GetLaminarViscosity(iPoint);
   thermal_conductivity = Cp * (laminar_viscosity/Prandtl_Lam);
 
@@ -657,7 +657,7 @@ vector<passivedouble> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsig
   vector<su2double> ret_Normal(3, 0.0);
   vector<passivedouble> ret_Normal_passive(3, 0.0);
 
-  Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNormal();
+  Normal = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNormal(iVertex);
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
       Area += Normal[iDim]*Normal[iDim];
@@ -968,7 +968,7 @@ void CDriver::SetMeshDisplacement(unsigned short iMarker, unsigned long iVertex,
   PyWrapVarCoord[1] = DispY;
   PyWrapVarCoord[2] = DispZ;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL]->GetNodes()->SetBound_Disp(iPoint,PyWrapVarCoord);
 
@@ -989,7 +989,7 @@ vector<passivedouble> CDriver::GetMeshDisp_Sensitivity(unsigned short iMarker, u
   vector<su2double> Disp_Sens(3, 0.0);
   vector<passivedouble> Disp_Sens_passive(3, 0.0);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   CSolver *solver =  solver_container[ZONE_0][INST_0][MESH_0][ADJMESH_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
@@ -1016,7 +1016,7 @@ void CDriver::SetFEA_Loads(unsigned short iMarker, unsigned long iVertex, passiv
   PyWrapNodalForce[1] = LoadY;
   PyWrapNodalForce[2] = LoadZ;
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL]->GetNodes()->Set_FlowTraction(iPoint,PyWrapNodalForce);
 
 }
@@ -1027,7 +1027,7 @@ vector<passivedouble> CDriver::GetFEA_Displacements(unsigned short iMarker, unsi
   vector<su2double> Displacements(3, 0.0);
   vector<passivedouble> Displacements_passive(3, 0.0);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
@@ -1052,7 +1052,7 @@ vector<passivedouble> CDriver::GetFEA_Velocity(unsigned short iMarker, unsigned
   vector<su2double> Velocity(3, 0.0);
   vector<passivedouble> Velocity_passive(3,0.0);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
@@ -1083,7 +1083,7 @@ vector<passivedouble> CDriver::GetFEA_Velocity_n(unsigned short iMarker, unsigne
   vector<su2double> Velocity_n(3, 0.0);
   vector<passivedouble> Velocity_n_passive(3, 0.0);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FEA_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
@@ -1115,7 +1115,7 @@ vector<passivedouble> CDriver::GetFlowLoad_Sensitivity(unsigned short iMarker, u
   vector<su2double> FlowLoad_Sens(3, 0.0);
   vector<passivedouble> FlowLoad_Sens_passive(3, 0.0);
 
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][ADJFEA_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
 
@@ -1184,7 +1184,7 @@ void CDriver::SetSourceTerm_DispAdjoint(unsigned short iMarker, unsigned long iV
 
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][ADJFEA_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   solver->GetNodes()->SetSourceTerm_DispAdjoint(iPoint, 0, val_AdjointX);
   solver->GetNodes()->SetSourceTerm_DispAdjoint(iPoint, 1, val_AdjointY);
@@ -1201,7 +1201,7 @@ vector<passivedouble> CDriver::GetVertex_UndeformedCoord(unsigned short iMarker,
 
   CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][MESH_SOL];
   CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
-  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertex[iMarker][iVertex]->GetNode();
+  iPoint = geometry_container[ZONE_0][INST_0][MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
   if (solver != nullptr) {
     MeshCoord[0] = solver->GetNodes()->GetMesh_Coord(iPoint,0);
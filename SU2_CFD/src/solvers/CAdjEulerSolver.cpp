@@ -301,9 +301,9 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
         if (Marker_Tag == Monitoring_Tag) {
           iMarker = jMarker;
           for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
             if (geometry->nodes->GetDomain(iPoint)) {
-              Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+              Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
               Area = 0.0;
               for (iDim = 0; iDim < nDim; iDim++)
                 Area += Normal[iDim]*Normal[iDim];
@@ -450,7 +450,7 @@ void CAdjEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geo
       if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
           (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
             Buffer_Send_nPointTotal++;
@@ -551,7 +551,7 @@ void CAdjEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geo
           (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
 
@@ -766,7 +766,7 @@ void CAdjEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
             Buffer_Send_nPointTotal++;
@@ -866,7 +866,7 @@ void CAdjEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
 
@@ -1067,7 +1067,7 @@ void CAdjEulerSolver::SetForceProj_Vector(CGeometry *geometry, CSolver **solver_
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
         for (iDim=0; iDim<nDim; iDim++)
           ForceProj_Vector[iDim]=0.0;
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         nodes->SetForceProj_Vector(iPoint,ForceProj_Vector);
       }
   }
@@ -1088,13 +1088,13 @@ void CAdjEulerSolver::SetForceProj_Vector(CGeometry *geometry, CSolver **solver_
         (config->GetMarker_All_Monitoring(iMarker) == YES)) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         x = geometry->nodes->GetCoord(iPoint, 0);
         y = geometry->nodes->GetCoord(iPoint, 1);
         if (nDim == 3) z = geometry->nodes->GetCoord(iPoint, 2);
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         ForceProj_Vector2 = nodes->GetForceProj_Vector(iPoint);
         for (iDim=0; iDim<nDim;iDim++)
           ForceProj_Vector[iDim]=ForceProj_Vector2[iDim];
@@ -1334,8 +1334,8 @@ void CAdjEulerSolver::SetIntBoundary_Jump(CGeometry *geometry, CSolver **solver_
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
@@ -2074,11 +2074,11 @@ void CAdjEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *confi
         config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
-          Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+          Point_Normal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
           /*--- Interpolate & compute difference in the conserved variables ---*/
 
@@ -2377,7 +2377,7 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
     /*--- Loop over points on the surface to store the auxiliary variable ---*/
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) {
           Psi = nodes->GetSolution(iPoint);
           U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
@@ -2412,11 +2412,11 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
 
     if (config->GetMarker_All_KindBC(iMarker) == EULER_WALL) {
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) {
 
           d = nodes->GetForceProj_Vector(iPoint);
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Area = 0;
           for (iDim = 0; iDim < nDim; iDim++)
             Area += Normal[iDim]*Normal[iDim];
@@ -2481,12 +2481,12 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
       if (config->GetMarker_All_KindBC(iMarker) == OUTLET_FLOW) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
           Psi = nodes->GetSolution(iPoint);
           U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           Mach_Inf   = config->GetMach();
           if (grid_movement) Mach_Inf = config->GetMach_Motion();
@@ -2528,12 +2528,12 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
       Sens_Temp[iMarker]  = 0.0;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
           Psi = nodes->GetSolution(iPoint);
           U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           Mach_Inf   = config->GetMach();
           if (grid_movement) Mach_Inf = config->GetMach_Motion();
@@ -2679,11 +2679,11 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
       Sens_Temp[iMarker]  = 0.0;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           p = solver_container[FLOW_SOL]->GetNodes()->GetPressure(iPoint);
 
           Mach_Inf   = config->GetMach();
@@ -2808,9 +2808,9 @@ void CAdjEulerSolver::Smooth_Sensitivity(CGeometry *geometry, CSolver **solver_c
 
       ArchLength[0] = 0.0;
       for (iVertex = 1; iVertex < nVertex; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex-1]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex-1);
         Coord_begin = geometry->nodes->GetCoord(iPoint);
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Coord_end = geometry->nodes->GetCoord(iPoint);
         dist = sqrt (pow( Coord_end[0]-Coord_begin[0], 2.0) + pow( Coord_end[1]-Coord_begin[1], 2.0));
         ArchLength[iVertex] = ArchLength[iVertex-1] + dist;
@@ -3035,10 +3035,10 @@ void CAdjEulerSolver::BC_Euler_Wall(CGeometry      *geometry,
   Psi      = new su2double[nVar];
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
       /*--- Create a copy of the adjoint solution ---*/
       Psi_Aux = nodes->GetSolution(iPoint);
@@ -3179,11 +3179,11 @@ void CAdjEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contain
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
 
       Area = 0;
       for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
@@ -3334,7 +3334,7 @@ void CAdjEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solve
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex_iPoint = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_jPoint = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -3358,7 +3358,7 @@ void CAdjEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solve
 
       /*--- Set Normal ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       numerics->SetNormal(Normal);
 
@@ -3399,7 +3399,7 @@ void CAdjEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solve
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex_iPoint = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_jPoint = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -3414,7 +3414,7 @@ void CAdjEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solve
 
       /*--- Set Normal ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       numerics->SetNormal(Normal);
 
@@ -3497,7 +3497,7 @@ void CAdjEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
   /*--- Loop over all the vertices ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- If the node belongs to the domain ---*/
 
@@ -3505,11 +3505,11 @@ void CAdjEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Set the normal vector ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -3603,7 +3603,7 @@ void CAdjEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check that the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -3611,7 +3611,7 @@ void CAdjEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -3664,7 +3664,7 @@ void CAdjEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_
 
         /*--- Index of the closest interior node ---*/
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
         /*--- Points in edge, coordinates and normal vector---*/
 
@@ -3718,7 +3718,7 @@ void CAdjEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check that the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -3726,7 +3726,7 @@ void CAdjEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -3779,7 +3779,7 @@ void CAdjEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver
 
         /*--- Index of the closest interior node ---*/
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
         /*--- Points in edge, coordinates and normal vector---*/
 
@@ -3836,7 +3836,7 @@ void CAdjEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check that the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -3844,7 +3844,7 @@ void CAdjEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -3954,7 +3954,7 @@ void CAdjEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
       if (config->GetViscous()) {
         /*--- Index of the closest interior node ---*/
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
         /*--- Points in edge, coordinates and normal vector---*/
 
@@ -4027,7 +4027,7 @@ void CAdjEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   /*--- Loop over all the vertices ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- If the node belong to the domain ---*/
 
@@ -4035,7 +4035,7 @@ void CAdjEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4049,7 +4049,7 @@ void CAdjEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Set the normal point ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       conv_numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(Point_Normal));
 
@@ -4296,7 +4296,7 @@ void CAdjEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_con
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- If the node belong to the domain ---*/
 
@@ -4304,7 +4304,7 @@ void CAdjEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_con
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4419,7 +4419,7 @@ void CAdjEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_co
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check that the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -4427,7 +4427,7 @@ void CAdjEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_co
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4438,7 +4438,7 @@ void CAdjEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_co
 
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Allocate the value at the exhaust ---*/
 
@@ -4503,7 +4503,7 @@ void CAdjEulerSolver::BC_ActDisk_Inlet(CGeometry *geometry, CSolver **solver_con
 
     GlobalIndex_inlet = solver_container[FLOW_SOL]->GetDonorGlobalIndex(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
 
     /*--- If the node belong to the domain ---*/
@@ -4512,7 +4512,7 @@ void CAdjEulerSolver::BC_ActDisk_Inlet(CGeometry *geometry, CSolver **solver_con
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4636,7 +4636,7 @@ void CAdjEulerSolver::BC_ActDisk_Outlet(CGeometry *geometry, CSolver **solver_co
 
     GlobalIndex_inlet = solver_container[FLOW_SOL]->GetDonorGlobalIndex(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
 
     /*--- Check that the node belongs to the domain (i.e., not a halo node) and to discard the perimeter ---*/
@@ -4645,7 +4645,7 @@ void CAdjEulerSolver::BC_ActDisk_Outlet(CGeometry *geometry, CSolver **solver_co
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4668,7 +4668,7 @@ void CAdjEulerSolver::BC_ActDisk_Outlet(CGeometry *geometry, CSolver **solver_co
       unsigned long Point_Normal;
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Adjoint flow solution at the outlet (this should be improved using characteristics bc) ---*/
 
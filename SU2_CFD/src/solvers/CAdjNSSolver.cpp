@@ -238,9 +238,9 @@ CAdjNSSolver::CAdjNSSolver(CGeometry *geometry, CConfig *config, unsigned short
          if (Marker_Tag == Monitoring_Tag) {
            iMarker = jMarker;
            for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-             iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+             iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
              if (geometry->nodes->GetDomain(iPoint)) {
-               Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+               Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
                Area = 0.0;
                for (iDim = 0; iDim < nDim; iDim++)
                  Area += Normal[iDim]*Normal[iDim];
@@ -695,7 +695,7 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -708,7 +708,7 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
 
           /*--- Compute face area and the unit normal to the surface ---*/
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) { Area += Normal[iDim]*Normal[iDim]; } Area = sqrt(Area);
           for (iDim = 0; iDim < nDim; iDim++) { UnitNormal[iDim] = Normal[iDim] / Area; }
 
@@ -925,12 +925,12 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
       Sens_BPress[iMarker] = 0.0;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
           Psi = nodes->GetSolution(iPoint);
           U = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           Mach_Inf   = config->GetMach();
           if (grid_movement) Mach_Inf = config->GetMach_Motion();
@@ -1079,11 +1079,11 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
       Sens_BPress[iMarker] = 0.0;
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           p = solver_container[FLOW_SOL]->GetNodes()->GetPressure(iPoint);
 
           Mach_Inf   = config->GetMach();
@@ -1231,7 +1231,7 @@ void CAdjNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -1239,7 +1239,7 @@ void CAdjNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       /*--- Initialize the convective & viscous residuals to zero ---*/
@@ -1378,7 +1378,7 @@ void CAdjNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
 
             /*--- Compute closest normal neighbor ---*/
 
-            Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+            Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
             /*--- Get coordinates of i & nearest normal and compute distance ---*/
 
@@ -1451,7 +1451,7 @@ void CAdjNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
 
             /*--- Compute closest normal neighbor ---*/
 
-            Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+            Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
             /*--- Get coordinates of i & nearest normal and compute distance ---*/
 
@@ -1616,7 +1616,7 @@ void CAdjNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -1635,7 +1635,7 @@ void CAdjNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
         Psi[iVar] = nodes->GetSolution(iPoint,iVar);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       Volume = geometry->nodes->GetVolume(iPoint);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
@@ -188,7 +188,7 @@ void CAdjTurbSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_cont
   unsigned long iPoint, iVertex;
 
   for (iVertex = 0; iVertex<geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
@@ -212,7 +212,7 @@ void CAdjTurbSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_co
   unsigned long iPoint, iVertex;
 
   for (iVertex = 0; iVertex<geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
@@ -236,10 +236,10 @@ void CAdjTurbSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Set Normal ---*/
-    conv_numerics->SetNormal(geometry->vertex[val_marker][iVertex]->GetNormal());
+    conv_numerics->SetNormal(geometry->vertexData[val_marker].GetNormal(iVertex));
 
     /*--- Set Conservative variables (for convection) ---*/
     su2double* U_i = solver_container[FLOW_SOL]->GetNodes()->GetSolution(iPoint);
@@ -27,6 +27,7 @@
 
 
 #include "../../include/solvers/CBaselineSolver.hpp"
+#include "../../include/output/filewriter/CSU2SeriesFileWriter.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 
 CBaselineSolver::CBaselineSolver(void) : CSolver() { }
@@ -97,7 +98,32 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
 
     /*--- Multizone problems require the number of the zone to be appended. ---*/
 
-    filename = config->GetFilename(filename, ".dat", config->GetTimeIter());
+    filename = config->GetFilename(filename, "", config->GetTimeIter());
+
+    /*--- Unsteady solutions written to a time series have their fields in the series header. ---*/
+
+    string series_filename;
+    unsigned long series_iter;
+    if (FindRestartSeries(config, filename, series_filename, series_iter)) {
+      unsigned long nFields, nPoints, disp;
+      vector<string> seriesFields;
+      if (!CSU2SeriesFileWriter::FindTimeStep(series_filename, series_iter, nFields, nPoints, seriesFields, disp)) {
+        SU2_MPI::Error(string("Unable to find time iteration ") + to_string(series_iter) +
+                       string(" in the SU2 time series file ") + series_filename, CURRENT_FUNCTION);
+      }
+      nVar = nFields;
+      fields.push_back("Point_ID");
+      for (const auto& name : seriesFields) {
+#ifdef HAVE_MPI
+        fields.push_back("\"" + name + "\"");
+#else
+        fields.push_back(name);
+#endif
+      }
+      return;
+    }
+
+    filename += ".dat";
 
     char fname[100];
     strcpy(fname, filename.c_str());
@@ -805,8 +805,8 @@ void CDiscAdjSolver::SetSurface_Sensitivity(CGeometry *geometry, CConfig *config
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Prod = 0.0;
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) {
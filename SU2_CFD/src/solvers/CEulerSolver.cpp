@@ -33,6 +33,7 @@
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
+#include "../../include/gradients/computeGradientsAndLimiters.hpp"
 
 void CEulerSolver::AeroCoeffsArray::allocate(int size) {
   _size = size;
@@ -254,8 +255,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    System.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Flow());
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+        ((iMesh != MESH_0) && config->GetMG_LineAgglomeration())) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE)
         cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
@@ -1111,7 +1114,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
           (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
           //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
 //          if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint)) && (!ActDisk_Perimeter)) {
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
@@ -1214,7 +1217,7 @@ void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geomet
       if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
           (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
@@ -1450,7 +1453,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
             Buffer_Send_nPointTotal++;
@@ -1550,7 +1553,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
       if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
           if ((iDomain == jDomain) && (geometry->nodes->GetDomain(iPoint))) {
             iGlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
@@ -2006,6 +2009,8 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
   assert(FluidModel.empty() && "Potential memory leak!");
   FluidModel.resize(omp_get_max_threads());
 
+  shared_ptr<const CFluidTable> fluidTable;
+
   SU2_OMP_PARALLEL
   {
     const int thread = omp_get_thread_num();
@@ -2034,6 +2039,48 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
         break;
     }
 
+    /*--- Replace the model by a look-up table of it, the table is shared by the threads. ---*/
+
+    if (config->GetFluid_Table()) {
+      SU2_OMP_MASTER
+      {
+        const string fileName = config->GetFluid_Table_FileName();
+        const bool writeTable = (rank == MASTER_NODE) && (iMesh == MESH_0);
+
+        if (config->GetFluid_Table_Read()) {
+          fluidTable = make_shared<const CFluidTable>(config, fileName);
+        }
+        else {
+          const su2double* rhoRange = config->GetFluid_Table_Density();
+          const su2double* TRange = config->GetFluid_Table_Temperature();
+
+          su2double rhoMin = 0.2*Density_FreeStreamND, rhoMax = 5.0*Density_FreeStreamND;
+          if (rhoRange[1] > 0.0) {
+            rhoMin = rhoRange[0] / config->GetDensity_Ref();
+            rhoMax = rhoRange[1] / config->GetDensity_Ref();
+          }
+          su2double TMin = 0.5*Temperature_FreeStreamND, TMax = 2.0*Temperature_FreeStreamND;
+          if (TRange[1] > 0.0) {
+            TMin = TRange[0] / config->GetTemperature_Ref();
+            TMax = TRange[1] / config->GetTemperature_Ref();
+          }
+
+          fluidTable = make_shared<const CFluidTable>(FluidModel[thread], rhoMin, rhoMax, TMin, TMax,
+                                                      config->GetFluid_Table_nDensity(),
+                                                      config->GetFluid_Table_nEnergy());
+          if (writeTable) fluidTable->Write(config, fileName);
+        }
+
+        if (writeTable)
+          cout << "Fluid model tabulated with " << fluidTable->GetnRho() << "x" << fluidTable->GetnEnergy()
+               << " nodes in (rho, e)" << (config->GetFluid_Table_Read()? ", read from " : ", written to ")
+               << fileName << "." << endl;
+      }
+      SU2_OMP_BARRIER
+
+      FluidModel[thread] = new CLookUpTableGas(FluidModel[thread], fluidTable);
+    }
+
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
     if (viscous) {
       GetFluidModel()->SetLaminarViscosityModel(config);
@@ -2602,21 +2649,30 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    if (GetFusedGradientLimiter(config)) {
 
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+      /*--- Gradient and limiter computation in one pass. ---*/
+
+      SetPrimitive_Gradient_Limiter(geometry, config, true, limiter && !van_albada);
     }
+    else {
+
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
+
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
 
-    /*--- Limiter computation ---*/
+      /*--- Limiter computation ---*/
 
-    if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
-      SetPrimitive_Limiter(geometry, config);
+      if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
+        SetPrimitive_Limiter(geometry, config);
+    }
   }
 
 }
@@ -2627,17 +2683,22 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The points are updated in batches, to evaluate the fluid model on arrays. ---*/
+
+  constexpr unsigned long MAXBATCH = CEulerVariable::MAXBATCH;
+  const unsigned long nBatch = roundUpDiv(nPoint, MAXBATCH);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, MAXBATCH))
+  for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
 
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+    const unsigned long iPointBegin = iBatch*MAXBATCH;
+    const unsigned long iPointEnd = min(nPoint, iPointBegin+MAXBATCH);
 
-    /* Check for non-realizable states for reporting. */
+    /* Count the non-realizable states for reporting. */
 
-    if (!physical) nonPhysicalPoints++;
+    nonPhysicalPoints += nodes->SetPrimVar(iPointBegin, iPointEnd, GetFluidModel());
   }
 
   return nonPhysicalPoints;
@@ -2742,11 +2803,11 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
         /*--- Point identification, Normal vector and area ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
         Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
         /*--- Mean Values ---*/
@@ -2903,6 +2964,37 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
 }
 
+template<class ColorType>
+void CEulerSolver::Viscous_Residual_Packs(const ColorType& color, CGeometry *geometry, CSolver **solver_container,
+                                          CNumerics *numerics, CConfig *config) {
+
+  /*--- Chunks of the color are split in packs of edges, the chunk size is at least
+   *    OMP_MIN_SIZE and a multiple of both the color group size and the pack size,
+   *    otherwise the edges of one group could be processed by two threads. ---*/
+#ifdef HAVE_OMP
+  const unsigned long chunkSize = nextMultiple(OMP_MIN_SIZE, leastCommonMultiple(color.groupSize, EDGE_PACK_SIZE));
+#else
+  const unsigned long chunkSize = nextMultiple(OMP_MIN_SIZE, EDGE_PACK_SIZE);
+#endif
+  const unsigned long nChunk = roundUpDiv(color.size, chunkSize);
+
+  SU2_OMP_FOR_DYN(1)
+  for (auto iChunk = 0ul; iChunk < nChunk; ++iChunk) {
+    const auto kEnd = min<unsigned long>(color.size, (iChunk+1)*chunkSize);
+
+    for (auto k = iChunk*chunkSize; k < kEnd; k += EDGE_PACK_SIZE) {
+      const auto nEdgePack = min<unsigned long>(EDGE_PACK_SIZE, kEnd-k);
+
+      unsigned long edges[EDGE_PACK_SIZE];
+      for (auto iEdge = 0ul; iEdge < nEdgePack; ++iEdge)
+        edges[iEdge] = color.indices[k+iEdge];
+
+      Viscous_Residual(nEdgePack, edges, geometry, solver_container, numerics, config);
+    }
+  }
+
+}
+
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
@@ -2911,6 +3003,10 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+  CNumerics* visc_numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Viscous contribution by packs of edges, after the convective loop of each color. ---*/
+  const bool viscous_packs = ViscousEdgePacks(visc_numerics, config);
 
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring)
@@ -2972,9 +3068,12 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 
     /*--- Viscous contribution. ---*/
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    if (!viscous_packs)
+      Viscous_Residual(iEdge, geometry, solver_container, visc_numerics, config);
   }
+
+  if (viscous_packs)
+    Viscous_Residual_Packs(color, geometry, solver_container, visc_numerics, config);
   } // end color loop
 
   if (ReducerStrategy) {
@@ -3009,6 +3108,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+  CNumerics* visc_numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Viscous contribution by packs of edges, after the convective loop of each color. ---*/
+  const bool viscous_packs = ViscousEdgePacks(visc_numerics, config);
 
   /*--- Static arrays of MUSCL-reconstructed primitives and secondaries (thread safety). ---*/
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
@@ -3200,9 +3303,12 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Viscous contribution. ---*/
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    if (!viscous_packs)
+      Viscous_Residual(iEdge, geometry, solver_container, visc_numerics, config);
   }
+
+  if (viscous_packs)
+    Viscous_Residual_Packs(color, geometry, solver_container, visc_numerics, config);
   } // end color loop
 
   if (ReducerStrategy) {
@@ -3575,8 +3681,8 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      auto Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
       su2double Area = 0.0;
       for (unsigned short iDim = 0; iDim < nDim; iDim++)
         Area += pow(Normal[iDim],2);
@@ -3855,7 +3961,7 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         Pressure = nodes->GetPressure(iPoint);
 
@@ -3866,7 +3972,7 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
         if ( (geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES) ) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Coord = geometry->nodes->GetCoord(iPoint);
 
           /*--- Quadratic objective function for the near-field.
@@ -4184,14 +4290,14 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Note that the pressure coefficient is computed at the
          halo cells (for visualization purposes), but not the forces ---*/
 
         if ( (geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES) ) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Coord = geometry->nodes->GetCoord(iPoint);
           Density   = nodes->GetDensity(iPoint);
 
@@ -4558,7 +4664,28 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint();
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- With the coupled solve the turbulence solver solves the system of both
+   *    solvers, and completes the iteration, once its own residual is known. ---*/
+
+  if (config->GetCoupled_Turb_Solve()) return;
+
+  /*--- Solve or smooth the linear system. ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
   const bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   const bool low_mach_prec = config->Low_Mach_Preconditioning();
 
@@ -4660,17 +4787,11 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       delete [] LowMachPrec[iVar];
     delete [] LowMachPrec;
   }
+}
 
-  /*--- Solve or smooth the linear system. ---*/
-
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
-  SU2_OMP_BARRIER
+void CEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
+  const bool adjoint = config->GetContinuous_Adjoint();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -4796,6 +4917,56 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
             *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+bool CEulerSolver::GetFusedGradientLimiter(const CConfig *config) const {
+
+  /*--- Periodic boundaries need communications between the steps, and the
+   *    discrete adjoint the AD pre-accumulation of the separate functions. ---*/
+
+  return config->GetFusedGradientLimiter() && (config->GetnMarker_Periodic() == 0) &&
+         !config->GetDiscrete_Adjoint();
+}
+
+void CEulerSolver::SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config,
+                                                 bool reconstruction, bool limiter) {
+
+  const auto kindGradient = static_cast<ENUM_FLOW_GRADIENT>(reconstruction? config->GetKind_Gradient_Method_Recon() :
+                                                                            config->GetKind_Gradient_Method());
+  const auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const bool fuseLimiter = limiter && (kindLimiter != NO_LIMITER);
+
+  if (kindGradient == NO_GRADIENT) return;
+
+  /*--- The least-squares matrices only depend on the grid, they are computed once for static grids. ---*/
+
+  const su2activematrix* Smatrix = nullptr;
+
+  if ((kindGradient != GREEN_GAUSS) && !dynamic_grid && !config->GetDeform_Mesh()) {
+    auto& cache = geometry->LeastSquaresMatrix[kindGradient == WEIGHTED_LEAST_SQUARES];
+
+    /*--- All threads must agree before the cache is allocated. ---*/
+    const bool computeCache = (cache.rows() != geometry->GetnPointDomain());
+    SU2_OMP_BARRIER
+
+    if (computeCache)
+      computeLeastSquaresMatrices(*geometry, kindGradient == WEIGHTED_LEAST_SQUARES, cache);
+    Smatrix = &cache;
+  }
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& primLimiter = nodes->GetLimiter_Primitive();
+
+  computeGradientsAndLimiters(fuseLimiter? kindLimiter : NO_LIMITER, this, PRIMITIVE_GRADIENT, PRIMITIVE_LIMITER,
+                              *geometry, *config, kindGradient, Smatrix, primitives, 0, nPrimVarGrad,
+                              gradient, primMin, primMax, primLimiter);
+
+  /*--- Without a slope limiter the limiter is just set to 1 (e.g. if needed by the turbulence model). ---*/
+
+  if (limiter && !fuseLimiter) SetPrimitive_Limiter(geometry, config);
+}
+
 void CEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
                                      su2double delta, su2double** preconditioner) const {
 
@@ -4924,13 +5095,13 @@ void CEulerSolver::GetPower_Properties(CGeometry *geometry, CConfig *config, uns
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (geometry->nodes->GetDomain(iPoint)) {
 
             V_inlet = nodes->GetPrimitive(iPoint);
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
             Temperature = V_inlet[0];
             Pressure = V_inlet[nDim+1];
@@ -4994,13 +5165,13 @@ void CEulerSolver::GetPower_Properties(CGeometry *geometry, CConfig *config, uns
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (geometry->nodes->GetDomain(iPoint)) {
 
             V_outlet = nodes->GetPrimitive(iPoint);
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
             Temperature = V_outlet[0];
             Pressure = V_outlet[nDim+1];
@@ -5815,7 +5986,7 @@ void CEulerSolver::SetActDisk_BCThrust(CGeometry *geometry, CSolver **solver_con
         /*--- Set the Delta P, Delta T values at each discrete point (uniform distribution)  ---*/
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
           SetActDisk_DeltaP(iMarker, iVertex, DeltaP);
           SetActDisk_DeltaT(iMarker, iVertex, DeltaT);
         }
@@ -6067,11 +6238,11 @@ void CEulerSolver::SetActDisk_BCThrust(CGeometry *geometry, CSolver **solver_con
 
           for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
             if (geometry->nodes->GetDomain(iPoint)) {
 
-              geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+              geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
               if (config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) {
                 for (iDim = 0; iDim < nDim; iDim++) { Vector[iDim] = -Vector[iDim]; }
@@ -6479,13 +6650,13 @@ su2double CEulerSolver::GetInletAtVertex(su2double *val_inlet,
 
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++){
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (iPoint == val_inlet_point) {
 
             /*-- Compute boundary face area for this vertex. ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
             Area = sqrt(Area);
@@ -6756,7 +6927,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       preprocessed = true;
 
       /*--- Normal vector for a random vertex (zero) on this marker (negate for outward convention). ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++)
         Normal[iDim] = -Normal[iDim];
 
@@ -6803,7 +6974,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       }//if viscous
     }//if bound_is_straight
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
@@ -6824,7 +6995,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
                                   geometry->nodes->GetGridVel(iPoint));
 
       /*--- Normal vector for this vertex (negate for outward convention). ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++)
         Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
@@ -6982,8 +7153,86 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
 void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
                                 CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
+  /*--- Loop over all the vertices on this boundary marker ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
+
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
+
+    if (geometry->nodes->GetDomain(iPoint)) {
+      BC_Far_Field_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, val_marker, iVertex, iPoint,
+                          geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex),
+                          geometry->vertexData[val_marker].GetNormal(iVertex));
+    }
+  }
+
+}
+
+bool CEulerSolver::GetPacked_BC(unsigned short kindBC, const CConfig *config) const {
+
+  /*--- The discrete adjoint records the boundary conditions marker by marker. ---*/
+
+  if (config->GetDiscrete_Adjoint()) return false;
+
+  return (kindBC == FAR_FIELD) || (kindBC == INLET_FLOW) || (kindBC == OUTLET_FLOW);
+}
+
+void CEulerSolver::BC_Packed(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                             CNumerics *visc_numerics, CConfig *config, const CVertexPack& pack,
+                             unsigned short kindBC) {
+
+  switch (kindBC) {
+    case FAR_FIELD:
+      LoopVertexPack(pack, [&](unsigned long iPack) {
+        BC_Far_Field_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, pack.GetMarker(iPack),
+                            pack.GetVertex(iPack), pack.GetNode(iPack), pack.GetNormal_Neighbor(iPack),
+                            pack.GetNormal(iPack));
+      });
+      break;
+
+    case INLET_FLOW:
+      LoopVertexPack(pack, [&](unsigned long iPack) {
+        BC_Inlet_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, pack.GetMarker(iPack),
+                        pack.GetVertex(iPack), pack.GetNode(iPack), pack.GetNormal(iPack));
+      });
+      break;
+
+    case OUTLET_FLOW: {
+
+      /*--- The back pressure is retrieved when the marker changes (the
+       vertices of each thread are mostly contiguous in the pack). ---*/
+
+      auto lastMarker = config->GetnMarker_All();
+      su2double Outlet_Pressure = 0.0;
+
+      LoopVertexPack(pack, [&](unsigned long iPack) {
+        const auto iMarker = pack.GetMarker(iPack);
+        if (iMarker != lastMarker) {
+          Outlet_Pressure = config->GetOutlet_Pressure(config->GetMarker_All_TagBound(iMarker));
+          lastMarker = iMarker;
+        }
+        BC_Outlet_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, iMarker,
+                         pack.GetVertex(iPack), pack.GetNode(iPack), pack.GetNormal(iPack),
+                         pack.GetCoord(iPack), Outlet_Pressure);
+      });
+      break;
+    }
+
+    default:
+      SU2_MPI::Error("Kind of boundary condition not supported by BC_Packed.", CURRENT_FUNCTION);
+      break;
+  }
+
+}
+
+void CEulerSolver::BC_Far_Field_Vertex(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                       CNumerics *visc_numerics, CConfig *config, unsigned short val_marker,
+                                       unsigned long iVertex, unsigned long iPoint, unsigned long Point_Normal,
+                                       const su2double *VertexNormal) {
+
   unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
 
   su2double *GridVel;
   su2double Area, UnitNormal[3] = {0.0,0.0,0.0};
@@ -7002,241 +7251,220 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
-  su2double *Normal = new su2double[nDim];
-
-  /*--- Loop over all the vertices on this boundary marker ---*/
-
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Allocate the value at the infinity ---*/
-    V_infty = GetCharacPrimVar(val_marker, iVertex);
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
+  su2double Normal[MAXNDIM] = {0.0};
 
-      /*--- Index of the closest interior node ---*/
+  /*--- Allocate the value at the infinity ---*/
+  V_infty = GetCharacPrimVar(val_marker, iVertex);
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+  /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      /*--- Normal vector for this vertex (negate for outward convention) ---*/
+  for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -VertexNormal[iDim];
+  conv_numerics->SetNormal(Normal);
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
-      conv_numerics->SetNormal(Normal);
+  /*--- Retrieve solution at the farfield boundary node ---*/
+  V_domain = nodes->GetPrimitive(iPoint);
 
-      /*--- Retrieve solution at the farfield boundary node ---*/
-      V_domain = nodes->GetPrimitive(iPoint);
+  /*--- Construct solution state at infinity for compressible flow by
+     using Riemann invariants, and then impose a weak boundary condition
+     by computing the flux using this new state for U. See CFD texts by
+     Hirsch or Blazek for more detail. Adapted from an original
+     implementation in the Stanford University multi-block (SUmb) solver
+     in the routine bcFarfield.f90 written by Edwin van der Weide,
+     last modified 06-12-2005. First, compute the unit normal at the
+     boundary nodes. ---*/
 
-      /*--- Construct solution state at infinity for compressible flow by
-         using Riemann invariants, and then impose a weak boundary condition
-         by computing the flux using this new state for U. See CFD texts by
-         Hirsch or Blazek for more detail. Adapted from an original
-         implementation in the Stanford University multi-block (SUmb) solver
-         in the routine bcFarfield.f90 written by Edwin van der Weide,
-         last modified 06-12-2005. First, compute the unit normal at the
-         boundary nodes. ---*/
-
-      Area = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-      Area = sqrt(Area);
-
-      for (iDim = 0; iDim < nDim; iDim++)
-        UnitNormal[iDim] = Normal[iDim]/Area;
+  Area = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
+  Area = sqrt(Area);
 
-      /*--- Store primitive variables (density, velocities, velocity squared,
-         energy, pressure, and sound speed) at the boundary node, and set some
-         other quantities for clarity. Project the current flow velocity vector
-         at this boundary node into the local normal direction, i.e. compute
-         v_bound.n.  ---*/
+  for (iDim = 0; iDim < nDim; iDim++)
+    UnitNormal[iDim] = Normal[iDim]/Area;
 
-      Density_Bound = V_domain[nDim+2];
-      Vel2_Bound = 0.0; Vn_Bound = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vel_Bound[iDim] = V_domain[iDim+1];
-        Vel2_Bound     += Vel_Bound[iDim]*Vel_Bound[iDim];
-        Vn_Bound       += Vel_Bound[iDim]*UnitNormal[iDim];
-      }
-      Pressure_Bound   = nodes->GetPressure(iPoint);
-      SoundSpeed_Bound = sqrt(Gamma*Pressure_Bound/Density_Bound);
-      Entropy_Bound    = pow(Density_Bound, Gamma)/Pressure_Bound;
+  /*--- Store primitive variables (density, velocities, velocity squared,
+     energy, pressure, and sound speed) at the boundary node, and set some
+     other quantities for clarity. Project the current flow velocity vector
+     at this boundary node into the local normal direction, i.e. compute
+     v_bound.n.  ---*/
 
-      /*--- Store the primitive variable state for the freestream. Project
-         the freestream velocity vector into the local normal direction,
-         i.e. compute v_infty.n. ---*/
+  Density_Bound = V_domain[nDim+2];
+  Vel2_Bound = 0.0; Vn_Bound = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Vel_Bound[iDim] = V_domain[iDim+1];
+    Vel2_Bound     += Vel_Bound[iDim]*Vel_Bound[iDim];
+    Vn_Bound       += Vel_Bound[iDim]*UnitNormal[iDim];
+  }
+  Pressure_Bound   = nodes->GetPressure(iPoint);
+  SoundSpeed_Bound = sqrt(Gamma*Pressure_Bound/Density_Bound);
+  Entropy_Bound    = pow(Density_Bound, Gamma)/Pressure_Bound;
 
-      Density_Infty = GetDensity_Inf();
-      Vel2_Infty = 0.0; Vn_Infty = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vel_Infty[iDim] = GetVelocity_Inf(iDim);
-        Vel2_Infty     += Vel_Infty[iDim]*Vel_Infty[iDim];
-        Vn_Infty       += Vel_Infty[iDim]*UnitNormal[iDim];
-      }
-      Pressure_Infty   = GetPressure_Inf();
-      SoundSpeed_Infty = sqrt(Gamma*Pressure_Infty/Density_Infty);
-      Entropy_Infty    = pow(Density_Infty, Gamma)/Pressure_Infty;
+  /*--- Store the primitive variable state for the freestream. Project
+     the freestream velocity vector into the local normal direction,
+     i.e. compute v_infty.n. ---*/
 
-      /*--- Adjust the normal freestream velocity for grid movement ---*/
+  Density_Infty = GetDensity_Inf();
+  Vel2_Infty = 0.0; Vn_Infty = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Vel_Infty[iDim] = GetVelocity_Inf(iDim);
+    Vel2_Infty     += Vel_Infty[iDim]*Vel_Infty[iDim];
+    Vn_Infty       += Vel_Infty[iDim]*UnitNormal[iDim];
+  }
+  Pressure_Infty   = GetPressure_Inf();
+  SoundSpeed_Infty = sqrt(Gamma*Pressure_Infty/Density_Infty);
+  Entropy_Infty    = pow(Density_Infty, Gamma)/Pressure_Infty;
 
-      Qn_Infty = Vn_Infty;
-      if (dynamic_grid) {
-        GridVel = geometry->nodes->GetGridVel(iPoint);
-        for (iDim = 0; iDim < nDim; iDim++)
-          Qn_Infty -= GridVel[iDim]*UnitNormal[iDim];
-      }
+  /*--- Adjust the normal freestream velocity for grid movement ---*/
 
-      /*--- Compute acoustic Riemann invariants: R = u.n +/- 2c/(gamma-1).
-         These correspond with the eigenvalues (u+c) and (u-c), respectively,
-         which represent the acoustic waves. Positive characteristics are
-         incoming, and a physical boundary condition is imposed (freestream
-         state). This occurs when either (u.n+c) > 0 or (u.n-c) > 0. Negative
-         characteristics are leaving the domain, and numerical boundary
-         conditions are required by extrapolating from the interior state
-         using the Riemann invariants. This occurs when (u.n+c) < 0 or
-         (u.n-c) < 0. Note that grid movement is taken into account when
-         checking the sign of the eigenvalue. ---*/
+  Qn_Infty = Vn_Infty;
+  if (dynamic_grid) {
+    GridVel = geometry->nodes->GetGridVel(iPoint);
+    for (iDim = 0; iDim < nDim; iDim++)
+      Qn_Infty -= GridVel[iDim]*UnitNormal[iDim];
+  }
 
-      /*--- Check whether (u.n+c) is greater or less than zero ---*/
+  /*--- Compute acoustic Riemann invariants: R = u.n +/- 2c/(gamma-1).
+     These correspond with the eigenvalues (u+c) and (u-c), respectively,
+     which represent the acoustic waves. Positive characteristics are
+     incoming, and a physical boundary condition is imposed (freestream
+     state). This occurs when either (u.n+c) > 0 or (u.n-c) > 0. Negative
+     characteristics are leaving the domain, and numerical boundary
+     conditions are required by extrapolating from the interior state
+     using the Riemann invariants. This occurs when (u.n+c) < 0 or
+     (u.n-c) < 0. Note that grid movement is taken into account when
+     checking the sign of the eigenvalue. ---*/
 
-      if (Qn_Infty > -SoundSpeed_Infty) {
-        /*--- Subsonic inflow or outflow ---*/
-        RiemannPlus = Vn_Bound + 2.0*SoundSpeed_Bound/Gamma_Minus_One;
-      } else {
-        /*--- Supersonic inflow ---*/
-        RiemannPlus = Vn_Infty + 2.0*SoundSpeed_Infty/Gamma_Minus_One;
-      }
+  /*--- Check whether (u.n+c) is greater or less than zero ---*/
 
-      /*--- Check whether (u.n-c) is greater or less than zero ---*/
+  if (Qn_Infty > -SoundSpeed_Infty) {
+    /*--- Subsonic inflow or outflow ---*/
+    RiemannPlus = Vn_Bound + 2.0*SoundSpeed_Bound/Gamma_Minus_One;
+  } else {
+    /*--- Supersonic inflow ---*/
+    RiemannPlus = Vn_Infty + 2.0*SoundSpeed_Infty/Gamma_Minus_One;
+  }
 
-      if (Qn_Infty > SoundSpeed_Infty) {
-        /*--- Supersonic outflow ---*/
-        RiemannMinus = Vn_Bound - 2.0*SoundSpeed_Bound/Gamma_Minus_One;
-      } else {
-        /*--- Subsonic outflow ---*/
-        RiemannMinus = Vn_Infty - 2.0*SoundSpeed_Infty/Gamma_Minus_One;
-      }
+  /*--- Check whether (u.n-c) is greater or less than zero ---*/
 
-      /*--- Compute a new value for the local normal velocity and speed of
-         sound from the Riemann invariants. ---*/
+  if (Qn_Infty > SoundSpeed_Infty) {
+    /*--- Supersonic outflow ---*/
+    RiemannMinus = Vn_Bound - 2.0*SoundSpeed_Bound/Gamma_Minus_One;
+  } else {
+    /*--- Subsonic outflow ---*/
+    RiemannMinus = Vn_Infty - 2.0*SoundSpeed_Infty/Gamma_Minus_One;
+  }
 
-      Vn = 0.5 * (RiemannPlus + RiemannMinus);
-      SoundSpeed = 0.25 * (RiemannPlus - RiemannMinus)*Gamma_Minus_One;
+  /*--- Compute a new value for the local normal velocity and speed of
+     sound from the Riemann invariants. ---*/
 
-      /*--- Construct the primitive variable state at the boundary for
-         computing the flux for the weak boundary condition. The values
-         that we choose to construct the solution (boundary or freestream)
-         depend on whether we are at an inflow or outflow. At an outflow, we
-         choose boundary information (at most one characteristic is incoming),
-         while at an inflow, we choose infinity values (at most one
-         characteristic is outgoing). ---*/
+  Vn = 0.5 * (RiemannPlus + RiemannMinus);
+  SoundSpeed = 0.25 * (RiemannPlus - RiemannMinus)*Gamma_Minus_One;
 
-      if (Qn_Infty > 0.0)   {
-        /*--- Outflow conditions ---*/
-        for (iDim = 0; iDim < nDim; iDim++)
-          Velocity[iDim] = Vel_Bound[iDim] + (Vn-Vn_Bound)*UnitNormal[iDim];
-        Entropy = Entropy_Bound;
-      } else  {
-        /*--- Inflow conditions ---*/
-        for (iDim = 0; iDim < nDim; iDim++)
-          Velocity[iDim] = Vel_Infty[iDim] + (Vn-Vn_Infty)*UnitNormal[iDim];
-        Entropy = Entropy_Infty;
-      }
+  /*--- Construct the primitive variable state at the boundary for
+     computing the flux for the weak boundary condition. The values
+     that we choose to construct the solution (boundary or freestream)
+     depend on whether we are at an inflow or outflow. At an outflow, we
+     choose boundary information (at most one characteristic is incoming),
+     while at an inflow, we choose infinity values (at most one
+     characteristic is outgoing). ---*/
 
-      /*--- Recompute the primitive variables. ---*/
+  if (Qn_Infty > 0.0)   {
+    /*--- Outflow conditions ---*/
+    for (iDim = 0; iDim < nDim; iDim++)
+      Velocity[iDim] = Vel_Bound[iDim] + (Vn-Vn_Bound)*UnitNormal[iDim];
+    Entropy = Entropy_Bound;
+  } else  {
+    /*--- Inflow conditions ---*/
+    for (iDim = 0; iDim < nDim; iDim++)
+      Velocity[iDim] = Vel_Infty[iDim] + (Vn-Vn_Infty)*UnitNormal[iDim];
+    Entropy = Entropy_Infty;
+  }
 
-      Density = pow(Entropy*SoundSpeed*SoundSpeed/Gamma,1.0/Gamma_Minus_One);
-      Velocity2 = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Velocity2 += Velocity[iDim]*Velocity[iDim];
-      }
-      Pressure = Density*SoundSpeed*SoundSpeed/Gamma;
-      Energy   = Pressure/(Gamma_Minus_One*Density) + 0.5*Velocity2;
-      if (tkeNeeded) Energy += GetTke_Inf();
+  /*--- Recompute the primitive variables. ---*/
 
-      /*--- Store new primitive state for computing the flux. ---*/
+  Density = pow(Entropy*SoundSpeed*SoundSpeed/Gamma,1.0/Gamma_Minus_One);
+  Velocity2 = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Velocity2 += Velocity[iDim]*Velocity[iDim];
+  }
+  Pressure = Density*SoundSpeed*SoundSpeed/Gamma;
+  Energy   = Pressure/(Gamma_Minus_One*Density) + 0.5*Velocity2;
+  if (tkeNeeded) Energy += GetTke_Inf();
 
-      V_infty[0] = Pressure/(Gas_Constant*Density);
-      for (iDim = 0; iDim < nDim; iDim++)
-        V_infty[iDim+1] = Velocity[iDim];
-      V_infty[nDim+1] = Pressure;
-      V_infty[nDim+2] = Density;
-      V_infty[nDim+3] = Energy + Pressure/Density;
+  /*--- Store new primitive state for computing the flux. ---*/
 
+  V_infty[0] = Pressure/(Gas_Constant*Density);
+  for (iDim = 0; iDim < nDim; iDim++)
+    V_infty[iDim+1] = Velocity[iDim];
+  V_infty[nDim+1] = Pressure;
+  V_infty[nDim+2] = Density;
+  V_infty[nDim+3] = Energy + Pressure/Density;
 
 
-      /*--- Set various quantities in the numerics class ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_infty);
+  /*--- Set various quantities in the numerics class ---*/
 
-      if (dynamic_grid) {
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
-                                  geometry->nodes->GetGridVel(iPoint));
-      }
+  conv_numerics->SetPrimitive(V_domain, V_infty);
 
-      /*--- Compute the convective residual using an upwind scheme ---*/
+  if (dynamic_grid) {
+    conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
+                              geometry->nodes->GetGridVel(iPoint));
+  }
 
-      auto residual = conv_numerics->ComputeResidual(config);
+  /*--- Compute the convective residual using an upwind scheme ---*/
 
-      /*--- Update residual value ---*/
+  auto residual = conv_numerics->ComputeResidual(config);
 
-      LinSysRes.AddBlock(iPoint, residual);
+  /*--- Update residual value ---*/
 
-      /*--- Convective Jacobian contribution for implicit integration ---*/
+  LinSysRes.AddBlock(iPoint, residual);
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+  /*--- Convective Jacobian contribution for implicit integration ---*/
 
-      /*--- Viscous residual contribution ---*/
+  if (implicit)
+    Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
 
-      if (viscous) {
+  /*--- Viscous residual contribution ---*/
 
-        /*--- Set laminar and eddy viscosity at the infinity ---*/
+  if (viscous) {
 
-        V_infty[nDim+5] = nodes->GetLaminarViscosity(iPoint);
-        V_infty[nDim+6] = nodes->GetEddyViscosity(iPoint);
+    /*--- Set laminar and eddy viscosity at the infinity ---*/
 
-        /*--- Set the normal vector and the coordinates ---*/
+    V_infty[nDim+5] = nodes->GetLaminarViscosity(iPoint);
+    V_infty[nDim+6] = nodes->GetEddyViscosity(iPoint);
 
-        visc_numerics->SetNormal(Normal);
-        visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                                geometry->nodes->GetCoord(Point_Normal));
+    /*--- Set the normal vector and the coordinates ---*/
 
-        /*--- Primitive variables, and gradient ---*/
+    visc_numerics->SetNormal(Normal);
+    visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                            geometry->nodes->GetCoord(Point_Normal));
 
-        visc_numerics->SetPrimitive(V_domain, V_infty);
-        visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
-                                          nodes->GetGradient_Primitive(iPoint));
+    /*--- Primitive variables, and gradient ---*/
 
-        /*--- Turbulent kinetic energy ---*/
+    visc_numerics->SetPrimitive(V_domain, V_infty);
+    visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint),
+                                      nodes->GetGradient_Primitive(iPoint));
 
-        if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
-          visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
-                                              solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
+    /*--- Turbulent kinetic energy ---*/
 
-        /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
+    if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
+      visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
+                                          solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
 
-        visc_numerics->SetTauWall(-1.0, -1.0);
+    /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
 
-        /*--- Compute and update viscous residual ---*/
+    visc_numerics->SetTauWall(-1.0, -1.0);
 
-        auto residual = visc_numerics->ComputeResidual(config);
-        LinSysRes.SubtractBlock(iPoint, residual);
+    /*--- Compute and update viscous residual ---*/
 
-        /*--- Viscous Jacobian contribution for implicit integration ---*/
+    auto residual = visc_numerics->ComputeResidual(config);
+    LinSysRes.SubtractBlock(iPoint, residual);
 
-        if (implicit)
-          Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+    /*--- Viscous Jacobian contribution for implicit integration ---*/
 
-      }
+    if (implicit)
+      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
 
-    }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-
 }
 
 void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
@@ -7294,16 +7522,16 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
 
     V_boundary= GetCharacPrimVar(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Index of the closest interior node ---*/
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -7816,11 +8044,11 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
       V_boundary= GetCharacPrimVar(val_marker, oldVertex);
 
       /*--- Index of the closest interior node ---*/
-      Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention),
        *    this normal is scaled with the area of the face of the element  ---*/
-      geometry->vertex[val_marker][oldVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(oldVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -8743,11 +8971,11 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
       V_boundary= GetCharacPrimVar(val_marker, oldVertex);
 
       /*--- Index of the closest interior node ---*/
-      Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention),
        *    this normal is scaled with the area of the face of the element  ---*/
-      geometry->vertex[val_marker][oldVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(oldVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -9168,8 +9396,29 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
 void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
                             CNumerics *conv_numerics, CNumerics *visc_numerics,
                             CConfig *config, unsigned short val_marker) {
+
+  /*--- Loop over all the vertices on this boundary marker ---*/
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
+
+    /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
+
+    if (geometry->nodes->GetDomain(iPoint)) {
+      BC_Inlet_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, val_marker,
+                      iVertex, iPoint, geometry->vertexData[val_marker].GetNormal(iVertex));
+    }
+  }
+
+}
+
+void CEulerSolver::BC_Inlet_Vertex(CGeometry *geometry, CSolver **solver_container,
+                                   CNumerics *conv_numerics, CNumerics *visc_numerics,
+                                   CConfig *config, unsigned short val_marker,
+                                   unsigned long iVertex, unsigned long iPoint, const su2double *VertexNormal) {
   unsigned short iDim;
-  unsigned long iVertex, iPoint;
   su2double P_Total, T_Total, Velocity[3], Velocity2, H_Total, Temperature, Riemann,
   Pressure, Density, Energy, *Flow_Dir, Mach2, SoundSpeed2, SoundSpeed_Total2, Vel_Mag,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
@@ -9179,462 +9428,451 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   su2double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   su2double Gas_Constant       = config->GetGas_ConstantND();
   unsigned short Kind_Inlet = config->GetKind_Inlet();
-  string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
-  su2double *Normal = new su2double[nDim];
-
-  /*--- Loop over all the vertices on this boundary marker ---*/
-
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-
-    /*--- Allocate the value at the inlet ---*/
-
-    V_inlet = GetCharacPrimVar(val_marker, iVertex);
+  su2double Normal[MAXNDIM] = {0.0};
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  /*--- Allocate the value at the inlet ---*/
 
-    /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
+  V_inlet = GetCharacPrimVar(val_marker, iVertex);
 
-    if (geometry->nodes->GetDomain(iPoint)) {
+  /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      /*--- Normal vector for this vertex (negate for outward convention) ---*/
+  for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -VertexNormal[iDim];
+  conv_numerics->SetNormal(Normal);
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
-      conv_numerics->SetNormal(Normal);
+  Area = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
+  Area = sqrt (Area);
 
-      Area = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-      Area = sqrt (Area);
+  for (iDim = 0; iDim < nDim; iDim++)
+    UnitNormal[iDim] = Normal[iDim]/Area;
 
-      for (iDim = 0; iDim < nDim; iDim++)
-        UnitNormal[iDim] = Normal[iDim]/Area;
+  /*--- Retrieve solution at this boundary node ---*/
 
-      /*--- Retrieve solution at this boundary node ---*/
+  V_domain = nodes->GetPrimitive(iPoint);
 
-      V_domain = nodes->GetPrimitive(iPoint);
+  /*--- Build the fictitious intlet state based on characteristics ---*/
 
-      /*--- Build the fictitious intlet state based on characteristics ---*/
 
+  /*--- Subsonic inflow: there is one outgoing characteristic (u-c),
+     therefore we can specify all but one state variable at the inlet.
+     The outgoing Riemann invariant provides the final piece of info.
+     Adapted from an original implementation in the Stanford University
+     multi-block (SUmb) solver in the routine bcSubsonicInflow.f90
+     written by Edwin van der Weide, last modified 04-20-2009. ---*/
 
-      /*--- Subsonic inflow: there is one outgoing characteristic (u-c),
-         therefore we can specify all but one state variable at the inlet.
-         The outgoing Riemann invariant provides the final piece of info.
-         Adapted from an original implementation in the Stanford University
-         multi-block (SUmb) solver in the routine bcSubsonicInflow.f90
-         written by Edwin van der Weide, last modified 04-20-2009. ---*/
+  switch (Kind_Inlet) {
 
-      switch (Kind_Inlet) {
+    /*--- Total properties have been specified at the inlet. ---*/
 
-        /*--- Total properties have been specified at the inlet. ---*/
+    case TOTAL_CONDITIONS:
 
-        case TOTAL_CONDITIONS:
-
-          /*--- Retrieve the specified total conditions for this inlet. ---*/
+      /*--- Retrieve the specified total conditions for this inlet. ---*/
 
-          P_Total  = Inlet_Ptotal[val_marker][iVertex];
-          T_Total  = Inlet_Ttotal[val_marker][iVertex];
-          Flow_Dir = Inlet_FlowDir[val_marker][iVertex];
+      P_Total  = Inlet_Ptotal[val_marker][iVertex];
+      T_Total  = Inlet_Ttotal[val_marker][iVertex];
+      Flow_Dir = Inlet_FlowDir[val_marker][iVertex];
 
-          /*--- Non-dim. the inputs if necessary. ---*/
+      /*--- Non-dim. the inputs if necessary. ---*/
 
-          P_Total /= config->GetPressure_Ref();
-          T_Total /= config->GetTemperature_Ref();
+      P_Total /= config->GetPressure_Ref();
+      T_Total /= config->GetTemperature_Ref();
 
-          /*--- Store primitives and set some variables for clarity. ---*/
+      /*--- Store primitives and set some variables for clarity. ---*/
 
-          Density = V_domain[nDim+2];
-          Velocity2 = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Velocity[iDim] = V_domain[iDim+1];
-            Velocity2 += Velocity[iDim]*Velocity[iDim];
-          }
-          Energy      = V_domain[nDim+3] - V_domain[nDim+1]/V_domain[nDim+2];
-          Pressure    = V_domain[nDim+1];
-          H_Total     = (Gamma*Gas_Constant/Gamma_Minus_One)*T_Total;
-          SoundSpeed2 = Gamma*Pressure/Density;
+      Density = V_domain[nDim+2];
+      Velocity2 = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Velocity[iDim] = V_domain[iDim+1];
+        Velocity2 += Velocity[iDim]*Velocity[iDim];
+      }
+      Energy      = V_domain[nDim+3] - V_domain[nDim+1]/V_domain[nDim+2];
+      Pressure    = V_domain[nDim+1];
+      H_Total     = (Gamma*Gas_Constant/Gamma_Minus_One)*T_Total;
+      SoundSpeed2 = Gamma*Pressure/Density;
 
-          /*--- Compute the acoustic Riemann invariant that is extrapolated
-             from the domain interior. ---*/
+      /*--- Compute the acoustic Riemann invariant that is extrapolated
+         from the domain interior. ---*/
 
-          Riemann   = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Riemann += Velocity[iDim]*UnitNormal[iDim];
+      Riemann   = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Riemann += Velocity[iDim]*UnitNormal[iDim];
 
-          /*--- Total speed of sound ---*/
+      /*--- Total speed of sound ---*/
 
-          SoundSpeed_Total2 = Gamma_Minus_One*(H_Total - (Energy + Pressure/Density)+0.5*Velocity2) + SoundSpeed2;
+      SoundSpeed_Total2 = Gamma_Minus_One*(H_Total - (Energy + Pressure/Density)+0.5*Velocity2) + SoundSpeed2;
 
-          /*--- Dot product of normal and flow direction. This should
-             be negative due to outward facing boundary normal convention. ---*/
+      /*--- Dot product of normal and flow direction. This should
+         be negative due to outward facing boundary normal convention. ---*/
 
-          alpha = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            alpha += UnitNormal[iDim]*Flow_Dir[iDim];
+      alpha = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        alpha += UnitNormal[iDim]*Flow_Dir[iDim];
 
-          /*--- Coefficients in the quadratic equation for the velocity ---*/
+      /*--- Coefficients in the quadratic equation for the velocity ---*/
 
-          aa =  1.0 + 0.5*Gamma_Minus_One*alpha*alpha;
-          bb = -1.0*Gamma_Minus_One*alpha*Riemann;
-          cc =  0.5*Gamma_Minus_One*Riemann*Riemann
-              -2.0*SoundSpeed_Total2/Gamma_Minus_One;
+      aa =  1.0 + 0.5*Gamma_Minus_One*alpha*alpha;
+      bb = -1.0*Gamma_Minus_One*alpha*Riemann;
+      cc =  0.5*Gamma_Minus_One*Riemann*Riemann
+          -2.0*SoundSpeed_Total2/Gamma_Minus_One;
 
-          /*--- Solve quadratic equation for velocity magnitude. Value must
-             be positive, so the choice of root is clear. ---*/
+      /*--- Solve quadratic equation for velocity magnitude. Value must
+         be positive, so the choice of root is clear. ---*/
 
-          dd = bb*bb - 4.0*aa*cc;
-          dd = sqrt(max(0.0, dd));
-          Vel_Mag   = (-bb + dd)/(2.0*aa);
-          Vel_Mag   = max(0.0, Vel_Mag);
-          Velocity2 = Vel_Mag*Vel_Mag;
+      dd = bb*bb - 4.0*aa*cc;
+      dd = sqrt(max(0.0, dd));
+      Vel_Mag   = (-bb + dd)/(2.0*aa);
+      Vel_Mag   = max(0.0, Vel_Mag);
+      Velocity2 = Vel_Mag*Vel_Mag;
 
-          /*--- Compute speed of sound from total speed of sound eqn. ---*/
+      /*--- Compute speed of sound from total speed of sound eqn. ---*/
 
-          SoundSpeed2 = SoundSpeed_Total2 - 0.5*Gamma_Minus_One*Velocity2;
+      SoundSpeed2 = SoundSpeed_Total2 - 0.5*Gamma_Minus_One*Velocity2;
 
-          /*--- Mach squared (cut between 0-1), use to adapt velocity ---*/
+      /*--- Mach squared (cut between 0-1), use to adapt velocity ---*/
 
-          Mach2 = Velocity2/SoundSpeed2;
-          Mach2 = min(1.0, Mach2);
-          Velocity2   = Mach2*SoundSpeed2;
-          Vel_Mag     = sqrt(Velocity2);
-          SoundSpeed2 = SoundSpeed_Total2 - 0.5*Gamma_Minus_One*Velocity2;
+      Mach2 = Velocity2/SoundSpeed2;
+      Mach2 = min(1.0, Mach2);
+      Velocity2   = Mach2*SoundSpeed2;
+      Vel_Mag     = sqrt(Velocity2);
+      SoundSpeed2 = SoundSpeed_Total2 - 0.5*Gamma_Minus_One*Velocity2;
 
-          /*--- Compute new velocity vector at the inlet ---*/
+      /*--- Compute new velocity vector at the inlet ---*/
 
-          for (iDim = 0; iDim < nDim; iDim++)
-            Velocity[iDim] = Vel_Mag*Flow_Dir[iDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Velocity[iDim] = Vel_Mag*Flow_Dir[iDim];
 
-          /*--- Static temperature from the speed of sound relation ---*/
+      /*--- Static temperature from the speed of sound relation ---*/
 
-          Temperature = SoundSpeed2/(Gamma*Gas_Constant);
+      Temperature = SoundSpeed2/(Gamma*Gas_Constant);
 
-          /*--- Static pressure using isentropic relation at a point ---*/
+      /*--- Static pressure using isentropic relation at a point ---*/
 
-          Pressure = P_Total*pow((Temperature/T_Total), Gamma/Gamma_Minus_One);
+      Pressure = P_Total*pow((Temperature/T_Total), Gamma/Gamma_Minus_One);
 
-          /*--- Density at the inlet from the gas law ---*/
+      /*--- Density at the inlet from the gas law ---*/
 
-          Density = Pressure/(Gas_Constant*Temperature);
+      Density = Pressure/(Gas_Constant*Temperature);
 
-          /*--- Using pressure, density, & velocity, compute the energy ---*/
+      /*--- Using pressure, density, & velocity, compute the energy ---*/
 
-          Energy = Pressure/(Density*Gamma_Minus_One) + 0.5*Velocity2;
-          if (tkeNeeded) Energy += GetTke_Inf();
+      Energy = Pressure/(Density*Gamma_Minus_One) + 0.5*Velocity2;
+      if (tkeNeeded) Energy += GetTke_Inf();
 
-          /*--- Primitive variables, using the derived quantities ---*/
+      /*--- Primitive variables, using the derived quantities ---*/
 
-          V_inlet[0] = Temperature;
-          for (iDim = 0; iDim < nDim; iDim++)
-            V_inlet[iDim+1] = Velocity[iDim];
-          V_inlet[nDim+1] = Pressure;
-          V_inlet[nDim+2] = Density;
-          V_inlet[nDim+3] = Energy + Pressure/Density;
+      V_inlet[0] = Temperature;
+      for (iDim = 0; iDim < nDim; iDim++)
+        V_inlet[iDim+1] = Velocity[iDim];
+      V_inlet[nDim+1] = Pressure;
+      V_inlet[nDim+2] = Density;
+      V_inlet[nDim+3] = Energy + Pressure/Density;
 
-          break;
+      break;
 
-          /*--- Mass flow has been specified at the inlet. ---*/
+      /*--- Mass flow has been specified at the inlet. ---*/
 
-        case MASS_FLOW:
+    case MASS_FLOW:
 
-          /*--- Retrieve the specified mass flow for the inlet. ---*/
+      /*--- Retrieve the specified mass flow for the inlet. ---*/
 
-          Density  = Inlet_Ttotal[val_marker][iVertex];
-          Vel_Mag  = Inlet_Ptotal[val_marker][iVertex];
-          Flow_Dir = Inlet_FlowDir[val_marker][iVertex];
+      Density  = Inlet_Ttotal[val_marker][iVertex];
+      Vel_Mag  = Inlet_Ptotal[val_marker][iVertex];
+      Flow_Dir = Inlet_FlowDir[val_marker][iVertex];
 
-          /*--- Non-dim. the inputs if necessary. ---*/
+      /*--- Non-dim. the inputs if necessary. ---*/
 
-          Density /= config->GetDensity_Ref();
-          Vel_Mag /= config->GetVelocity_Ref();
+      Density /= config->GetDensity_Ref();
+      Vel_Mag /= config->GetVelocity_Ref();
 
-          /*--- Get primitives from current inlet state. ---*/
+      /*--- Get primitives from current inlet state. ---*/
 
-          for (iDim = 0; iDim < nDim; iDim++)
-            Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
-          Pressure    = nodes->GetPressure(iPoint);
-          SoundSpeed2 = Gamma*Pressure/V_domain[nDim+2];
+      for (iDim = 0; iDim < nDim; iDim++)
+        Velocity[iDim] = nodes->GetVelocity(iPoint,iDim);
+      Pressure    = nodes->GetPressure(iPoint);
+      SoundSpeed2 = Gamma*Pressure/V_domain[nDim+2];
 
-          /*--- Compute the acoustic Riemann invariant that is extrapolated
-             from the domain interior. ---*/
+      /*--- Compute the acoustic Riemann invariant that is extrapolated
+         from the domain interior. ---*/
 
-          Riemann = Two_Gamma_M1*sqrt(SoundSpeed2);
-          for (iDim = 0; iDim < nDim; iDim++)
-            Riemann += Velocity[iDim]*UnitNormal[iDim];
+      Riemann = Two_Gamma_M1*sqrt(SoundSpeed2);
+      for (iDim = 0; iDim < nDim; iDim++)
+        Riemann += Velocity[iDim]*UnitNormal[iDim];
 
-          /*--- Speed of sound squared for fictitious inlet state ---*/
+      /*--- Speed of sound squared for fictitious inlet state ---*/
 
-          SoundSpeed2 = Riemann;
-          for (iDim = 0; iDim < nDim; iDim++)
-            SoundSpeed2 -= Vel_Mag*Flow_Dir[iDim]*UnitNormal[iDim];
+      SoundSpeed2 = Riemann;
+      for (iDim = 0; iDim < nDim; iDim++)
+        SoundSpeed2 -= Vel_Mag*Flow_Dir[iDim]*UnitNormal[iDim];
 
-          SoundSpeed2 = max(0.0,0.5*Gamma_Minus_One*SoundSpeed2);
-          SoundSpeed2 = SoundSpeed2*SoundSpeed2;
+      SoundSpeed2 = max(0.0,0.5*Gamma_Minus_One*SoundSpeed2);
+      SoundSpeed2 = SoundSpeed2*SoundSpeed2;
 
-          /*--- Pressure for the fictitious inlet state ---*/
+      /*--- Pressure for the fictitious inlet state ---*/
 
-          Pressure = SoundSpeed2*Density/Gamma;
+      Pressure = SoundSpeed2*Density/Gamma;
 
-          /*--- Energy for the fictitious inlet state ---*/
+      /*--- Energy for the fictitious inlet state ---*/
 
-          Energy = Pressure/(Density*Gamma_Minus_One) + 0.5*Vel_Mag*Vel_Mag;
-          if (tkeNeeded) Energy += GetTke_Inf();
+      Energy = Pressure/(Density*Gamma_Minus_One) + 0.5*Vel_Mag*Vel_Mag;
+      if (tkeNeeded) Energy += GetTke_Inf();
 
-          /*--- Primitive variables, using the derived quantities ---*/
+      /*--- Primitive variables, using the derived quantities ---*/
 
-          V_inlet[0] = Pressure / ( Gas_Constant * Density);
-          for (iDim = 0; iDim < nDim; iDim++)
-            V_inlet[iDim+1] = Vel_Mag*Flow_Dir[iDim];
-          V_inlet[nDim+1] = Pressure;
-          V_inlet[nDim+2] = Density;
-          V_inlet[nDim+3] = Energy + Pressure/Density;
+      V_inlet[0] = Pressure / ( Gas_Constant * Density);
+      for (iDim = 0; iDim < nDim; iDim++)
+        V_inlet[iDim+1] = Vel_Mag*Flow_Dir[iDim];
+      V_inlet[nDim+1] = Pressure;
+      V_inlet[nDim+2] = Density;
+      V_inlet[nDim+3] = Energy + Pressure/Density;
 
-          break;
-      }
+      break;
+  }
 
-      /*--- Set various quantities in the solver class ---*/
+  /*--- Set various quantities in the solver class ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_inlet);
+  conv_numerics->SetPrimitive(V_domain, V_inlet);
 
-      if (dynamic_grid)
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+  if (dynamic_grid)
+    conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-      /*--- Compute the residual using an upwind scheme ---*/
+  /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+  auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
+  /*--- Update residual value ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+  LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Jacobian contribution for implicit integration ---*/
+  /*--- Jacobian contribution for implicit integration ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+  if (implicit)
+    Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
 
-//      /*--- Viscous contribution, commented out because serious convergence problems ---*/
+//  /*--- Viscous contribution, commented out because serious convergence problems ---*/
 //
-//      if (viscous) {
+//  if (viscous) {
 //
-//        /*--- Set laminar and eddy viscosity at the infinity ---*/
+//    /*--- Set laminar and eddy viscosity at the infinity ---*/
 //
-//        V_inlet[nDim+5] = nodes->GetLaminarViscosity(iPoint);
-//        V_inlet[nDim+6] = nodes->GetEddyViscosity(iPoint);
+//    V_inlet[nDim+5] = nodes->GetLaminarViscosity(iPoint);
+//    V_inlet[nDim+6] = nodes->GetEddyViscosity(iPoint);
 //
-//        /*--- Set the normal vector and the coordinates ---*/
+//    /*--- Set the normal vector and the coordinates ---*/
 //
-//        visc_numerics->SetNormal(Normal);
-//        visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(Point_Normal));
+//    visc_numerics->SetNormal(Normal);
+//    visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(Point_Normal));
 //
-//        /*--- Primitive variables, and gradient ---*/
+//    /*--- Primitive variables, and gradient ---*/
 //
-//        visc_numerics->SetPrimitive(V_domain, V_inlet);
-//        visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(iPoint));
+//    visc_numerics->SetPrimitive(V_domain, V_inlet);
+//    visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(iPoint));
 //
-//        /*--- Turbulent kinetic energy ---*/
+//    /*--- Turbulent kinetic energy ---*/
 //
-//        if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
-//          visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
-//                                              solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
+//    if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
+//      visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
+//                                          solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
 //
-//        /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
+//    /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
 //
-//        visc_numerics->SetTauWall(-1.0, -1.0);
+//    visc_numerics->SetTauWall(-1.0, -1.0);
 //
-//        /*--- Compute and update residual ---*/
+//    /*--- Compute and update residual ---*/
 //
-//        auto residual = visc_numerics->ComputeResidual(config);
-//        LinSysRes.SubtractBlock(iPoint, residual);
+//    auto residual = visc_numerics->ComputeResidual(config);
+//    LinSysRes.SubtractBlock(iPoint, residual);
 //
-//        /*--- Jacobian contribution for implicit integration ---*/
+//    /*--- Jacobian contribution for implicit integration ---*/
 //
-//        if (implicit)
-//          Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+//    if (implicit)
+//      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
 //
-//      }
-
-    }
-  }
-
-  /*--- Free locally allocated memory ---*/
-
-  delete [] Normal;
+//  }
 
 }
 
 void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
                              CNumerics *conv_numerics, CNumerics *visc_numerics,
                              CConfig *config, unsigned short val_marker) {
-  unsigned short iVar, iDim;
-  unsigned long iVertex, iPoint;
-  su2double Pressure, P_Exit, Velocity[3],
-  Velocity2, Entropy, Density, Energy, Riemann, Vn, SoundSpeed, Mach_Exit, Vn_Exit,
-  Area, UnitNormal[3];
-  su2double *V_outlet, *V_domain;
 
-  bool implicit           = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  su2double Gas_Constant     = config->GetGas_ConstantND();
-  string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
-  bool gravity = (config->GetGravityForce());
-  bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
-  su2double *Normal = new su2double[nDim];
+  /*--- Retrieve the specified back pressure for this outlet. ---*/
+
+  const su2double Outlet_Pressure = config->GetOutlet_Pressure(config->GetMarker_All_TagBound(val_marker));
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    /*--- Allocate the value at the outlet ---*/
-    V_outlet = GetCharacPrimVar(val_marker, iVertex);
-
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
+
     if (geometry->nodes->GetDomain(iPoint)) {
+      BC_Outlet_Vertex(geometry, solver_container, conv_numerics, visc_numerics, config, val_marker, iVertex, iPoint,
+                       geometry->vertexData[val_marker].GetNormal(iVertex), geometry->nodes->GetCoord(iPoint),
+                       Outlet_Pressure);
+    }
+  }
 
-      /*--- Normal vector for this vertex (negate for outward convention) ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
-      conv_numerics->SetNormal(Normal);
+}
 
-      Area = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
-      Area = sqrt (Area);
+void CEulerSolver::BC_Outlet_Vertex(CGeometry *geometry, CSolver **solver_container,
+                                    CNumerics *conv_numerics, CNumerics *visc_numerics,
+                                    CConfig *config, unsigned short val_marker,
+                                    unsigned long iVertex, unsigned long iPoint, const su2double *VertexNormal,
+                                    const su2double *Coord, su2double Outlet_Pressure) {
+  unsigned short iVar, iDim;
+  su2double Pressure, P_Exit, Velocity[3],
+  Velocity2, Entropy, Density, Energy, Riemann, Vn, SoundSpeed, Mach_Exit, Vn_Exit,
+  Area, UnitNormal[3];
+  su2double *V_outlet, *V_domain;
 
-      for (iDim = 0; iDim < nDim; iDim++)
-        UnitNormal[iDim] = Normal[iDim]/Area;
+  bool implicit           = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  su2double Gas_Constant     = config->GetGas_ConstantND();
+  bool gravity = (config->GetGravityForce());
+  bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
+  su2double Normal[MAXNDIM] = {0.0};
 
-      /*--- Current solution at this boundary node ---*/
-      V_domain = nodes->GetPrimitive(iPoint);
+  /*--- Allocate the value at the outlet ---*/
+  V_outlet = GetCharacPrimVar(val_marker, iVertex);
 
-      /*--- Build the fictitious intlet state based on characteristics ---*/
+  /*--- Normal vector for this vertex (negate for outward convention) ---*/
+  for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -VertexNormal[iDim];
+  conv_numerics->SetNormal(Normal);
 
-      /*--- Retrieve the specified back pressure for this outlet. ---*/
-      if (gravity) P_Exit = config->GetOutlet_Pressure(Marker_Tag) - geometry->nodes->GetCoord(iPoint, nDim-1)*STANDARD_GRAVITY;
-      else P_Exit = config->GetOutlet_Pressure(Marker_Tag);
+  Area = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
+  Area = sqrt (Area);
 
-      /*--- Non-dim. the inputs if necessary. ---*/
-      P_Exit = P_Exit/config->GetPressure_Ref();
+  for (iDim = 0; iDim < nDim; iDim++)
+    UnitNormal[iDim] = Normal[iDim]/Area;
 
-      /*--- Check whether the flow is supersonic at the exit. The type
-         of boundary update depends on this. ---*/
-      Density = V_domain[nDim+2];
-      Velocity2 = 0.0; Vn = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Velocity[iDim] = V_domain[iDim+1];
-        Velocity2 += Velocity[iDim]*Velocity[iDim];
-        Vn += Velocity[iDim]*UnitNormal[iDim];
-      }
-      Pressure   = V_domain[nDim+1];
-      SoundSpeed = sqrt(Gamma*Pressure/Density);
-      Mach_Exit  = sqrt(Velocity2)/SoundSpeed;
+  /*--- Current solution at this boundary node ---*/
+  V_domain = nodes->GetPrimitive(iPoint);
+
+  /*--- Build the fictitious intlet state based on characteristics ---*/
 
-      if (Mach_Exit >= 1.0) {
+  /*--- Retrieve the specified back pressure for this outlet. ---*/
+  if (gravity) P_Exit = Outlet_Pressure - Coord[nDim-1]*STANDARD_GRAVITY;
+  else P_Exit = Outlet_Pressure;
 
-        /*--- Supersonic exit flow: there are no incoming characteristics,
-           so no boundary condition is necessary. Set outlet state to current
-           state so that upwinding handles the direction of propagation. ---*/
-        for (iVar = 0; iVar < nPrimVar; iVar++) V_outlet[iVar] = V_domain[iVar];
+  /*--- Non-dim. the inputs if necessary. ---*/
+  P_Exit = P_Exit/config->GetPressure_Ref();
+
+  /*--- Check whether the flow is supersonic at the exit. The type
+     of boundary update depends on this. ---*/
+  Density = V_domain[nDim+2];
+  Velocity2 = 0.0; Vn = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Velocity[iDim] = V_domain[iDim+1];
+    Velocity2 += Velocity[iDim]*Velocity[iDim];
+    Vn += Velocity[iDim]*UnitNormal[iDim];
+  }
+  Pressure   = V_domain[nDim+1];
+  SoundSpeed = sqrt(Gamma*Pressure/Density);
+  Mach_Exit  = sqrt(Velocity2)/SoundSpeed;
 
-      } else {
+  if (Mach_Exit >= 1.0) {
 
-        /*--- Subsonic exit flow: there is one incoming characteristic,
-           therefore one variable can be specified (back pressure) and is used
-           to update the conservative variables. Compute the entropy and the
-           acoustic Riemann variable. These invariants, as well as the
-           tangential velocity components, are extrapolated. Adapted from an
-           original implementation in the Stanford University multi-block
-           (SUmb) solver in the routine bcSubsonicOutflow.f90 by Edwin van
-           der Weide, last modified 09-10-2007. ---*/
+    /*--- Supersonic exit flow: there are no incoming characteristics,
+       so no boundary condition is necessary. Set outlet state to current
+       state so that upwinding handles the direction of propagation. ---*/
+    for (iVar = 0; iVar < nPrimVar; iVar++) V_outlet[iVar] = V_domain[iVar];
 
-        Entropy = Pressure*pow(1.0/Density, Gamma);
-        Riemann = Vn + 2.0*SoundSpeed/Gamma_Minus_One;
+  } else {
 
-        /*--- Compute the new fictious state at the outlet ---*/
-        Density    = pow(P_Exit/Entropy,1.0/Gamma);
-        Pressure   = P_Exit;
-        SoundSpeed = sqrt(Gamma*P_Exit/Density);
-        Vn_Exit    = Riemann - 2.0*SoundSpeed/Gamma_Minus_One;
-        Velocity2  = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Velocity[iDim] = Velocity[iDim] + (Vn_Exit-Vn)*UnitNormal[iDim];
-          Velocity2 += Velocity[iDim]*Velocity[iDim];
-        }
-        Energy = P_Exit/(Density*Gamma_Minus_One) + 0.5*Velocity2;
-        if (tkeNeeded) Energy += GetTke_Inf();
+    /*--- Subsonic exit flow: there is one incoming characteristic,
+       therefore one variable can be specified (back pressure) and is used
+       to update the conservative variables. Compute the entropy and the
+       acoustic Riemann variable. These invariants, as well as the
+       tangential velocity components, are extrapolated. Adapted from an
+       original implementation in the Stanford University multi-block
+       (SUmb) solver in the routine bcSubsonicOutflow.f90 by Edwin van
+       der Weide, last modified 09-10-2007. ---*/
+
+    Entropy = Pressure*pow(1.0/Density, Gamma);
+    Riemann = Vn + 2.0*SoundSpeed/Gamma_Minus_One;
+
+    /*--- Compute the new fictious state at the outlet ---*/
+    Density    = pow(P_Exit/Entropy,1.0/Gamma);
+    Pressure   = P_Exit;
+    SoundSpeed = sqrt(Gamma*P_Exit/Density);
+    Vn_Exit    = Riemann - 2.0*SoundSpeed/Gamma_Minus_One;
+    Velocity2  = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Velocity[iDim] = Velocity[iDim] + (Vn_Exit-Vn)*UnitNormal[iDim];
+      Velocity2 += Velocity[iDim]*Velocity[iDim];
+    }
+    Energy = P_Exit/(Density*Gamma_Minus_One) + 0.5*Velocity2;
+    if (tkeNeeded) Energy += GetTke_Inf();
 
-        /*--- Conservative variables, using the derived quantities ---*/
-        V_outlet[0] = Pressure / ( Gas_Constant * Density);
-        for (iDim = 0; iDim < nDim; iDim++)
-          V_outlet[iDim+1] = Velocity[iDim];
-        V_outlet[nDim+1] = Pressure;
-        V_outlet[nDim+2] = Density;
-        V_outlet[nDim+3] = Energy + Pressure/Density;
+    /*--- Conservative variables, using the derived quantities ---*/
+    V_outlet[0] = Pressure / ( Gas_Constant * Density);
+    for (iDim = 0; iDim < nDim; iDim++)
+      V_outlet[iDim+1] = Velocity[iDim];
+    V_outlet[nDim+1] = Pressure;
+    V_outlet[nDim+2] = Density;
+    V_outlet[nDim+3] = Energy + Pressure/Density;
 
-      }
+  }
 
-      /*--- Set various quantities in the solver class ---*/
-      conv_numerics->SetPrimitive(V_domain, V_outlet);
+  /*--- Set various quantities in the solver class ---*/
+  conv_numerics->SetPrimitive(V_domain, V_outlet);
 
-      if (dynamic_grid)
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+  if (dynamic_grid)
+    conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-      /*--- Compute the residual using an upwind scheme ---*/
+  /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+  auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Add Residuals and Jacobians ---*/
+  /*--- Add Residuals and Jacobians ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+  LinSysRes.AddBlock(iPoint, residual);
+  if (implicit)
+    Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
 
-//      /*--- Viscous contribution, commented out because serious convergence problems  ---*/
+//  /*--- Viscous contribution, commented out because serious convergence problems  ---*/
 //
-//      if (viscous) {
+//  if (viscous) {
 //
-//        /*--- Set laminar and eddy viscosity at the infinity ---*/
+//    /*--- Set laminar and eddy viscosity at the infinity ---*/
 //
-//        V_outlet[nDim+5] = nodes->GetLaminarViscosity(iPoint);
-//        V_outlet[nDim+6] = nodes->GetEddyViscosity(iPoint);
+//    V_outlet[nDim+5] = nodes->GetLaminarViscosity(iPoint);
+//    V_outlet[nDim+6] = nodes->GetEddyViscosity(iPoint);
 //
-//        /*--- Set the normal vector and the coordinates ---*/
+//    /*--- Set the normal vector and the coordinates ---*/
 //
-//        visc_numerics->SetNormal(Normal);
-//        visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(Point_Normal));
+//    visc_numerics->SetNormal(Normal);
+//    visc_numerics->SetCoord(geometry->nodes->GetCoord(iPoint), geometry->nodes->GetCoord(Point_Normal));
 //
-//        /*--- Primitive variables, and gradient ---*/
+//    /*--- Primitive variables, and gradient ---*/
 //
-//        visc_numerics->SetPrimitive(V_domain, V_outlet);
-//        visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(iPoint));
+//    visc_numerics->SetPrimitive(V_domain, V_outlet);
+//    visc_numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nodes->GetGradient_Primitive(iPoint));
 //
-//        /*--- Turbulent kinetic energy ---*/
+//    /*--- Turbulent kinetic energy ---*/
 //
-//        if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
-//          visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
-//                                              solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
+//    if ((config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST))
+//      visc_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0),
+//                                          solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
 //
-//        /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
-//        visc_numerics->SetTauWall(-1.0, -1.0);
+//    /*--- Set the wall shear stress values (wall functions) to -1 (no evaluation using wall functions) ---*/
+//    visc_numerics->SetTauWall(-1.0, -1.0);
 //
-//        /*--- Compute and update residual ---*/
+//    /*--- Compute and update residual ---*/
 //
-//        auto residual = visc_numerics->ComputeResidual(config);
-//        LinSysRes.SubtractBlock(iPoint, residual);
+//    auto residual = visc_numerics->ComputeResidual(config);
+//    LinSysRes.SubtractBlock(iPoint, residual);
 //
-//        /*--- Jacobian contribution for implicit integration ---*/
+//    /*--- Jacobian contribution for implicit integration ---*/
 //
-//        if (implicit)
-//         Jacobian.SubtractBlock2Diag(iPoint, residual.acobian_i);
+//    if (implicit)
+//     Jacobian.SubtractBlock2Diag(iPoint, residual.acobian_i);
 //
-//      }
-
-    }
-  }
-
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+//  }
 
 }
 
@@ -9699,7 +9937,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
     V_inlet[nDim+2] = Density;
     V_inlet[nDim+3] = Energy + Pressure/Density;
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -9711,7 +9949,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       /*--- Set various quantities in the solver class ---*/
@@ -9804,7 +10042,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -9833,7 +10071,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       /*--- Set various quantities in the solver class ---*/
@@ -9991,7 +10229,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
 
     V_inflow = GetCharacPrimVar(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -9999,7 +10237,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       Area = 0.0;
@@ -10180,7 +10418,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
 
     V_exhaust = GetCharacPrimVar(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -10188,7 +10426,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       Area = 0.0;
@@ -10411,7 +10649,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
 
       SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -10429,7 +10667,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
 
           for (jVertex = 0; jVertex < nDonorVertex; jVertex++) {
 
-            Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+            Point_Normal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
             for (iVar = 0; iVar < nPrimVar; iVar++) {
               PrimVar_i[iVar] = nodes->GetPrimitive(iPoint,iVar);
@@ -10459,7 +10697,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
 
             /*--- Set the normal vector ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             for (iDim = 0; iDim < nDim; iDim++)
               Normal[iDim] = -Normal[iDim];
 
@@ -10578,7 +10816,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex_iPoint = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_jPoint = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -10597,7 +10835,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
 
       /*--- Set Normal ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       numerics->SetNormal(Normal);
 
@@ -10641,7 +10879,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex_iPoint = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_jPoint = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -10660,7 +10898,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
 
       /*--- Set Normal ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       numerics->SetNormal(Normal);
 
@@ -10733,7 +10971,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     GlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
     GlobalIndex_donor = GetDonorGlobalIndex(val_marker, iVertex);
 
@@ -10744,7 +10982,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
 
       /*--- Normal vector for this vertex (negative for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -11160,7 +11398,7 @@ void CEulerSolver::BC_Custom(CGeometry      *geometry,
 
       /*--- Get the point index for the current node. ---*/
 
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+      iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
       /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -11315,8 +11553,8 @@ void CEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_co
 
           /*--- Get the index for node i plus the boundary face normal ---*/
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           /*--- Grid velocities stored at boundary node i ---*/
 
@@ -577,7 +577,7 @@ void CFEASolver::Set_Prestretch(CGeometry *geometry, CConfig *config) {
 
       /*--- Copy the solution that should be sent ---*/
       for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        iPoint = geometry->vertexData[MarkerS].GetNode(iVertex);
         for (iVar = 0; iVar < nVar; iVar++)
           Buffer_Send_U[iVar*nVertexS+iVertex] = nodes->GetPrestretch(iPoint,iVar);
       }
@@ -593,7 +593,7 @@ void CFEASolver::Set_Prestretch(CGeometry *geometry, CConfig *config) {
       for (iVertex = 0; iVertex < nVertexR; iVertex++) {
 
         /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+        iPoint = geometry->vertexData[MarkerR].GetNode(iVertex);
 
         /*--- Store received values back into the variable. ---*/
         for (iVar = 0; iVar < nVar; iVar++)
@@ -721,7 +721,7 @@ void CFEASolver::Set_VertexEliminationSchedule(CGeometry *geometry, const vector
 
   for (auto iMarker : markers) {
     for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-      auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
       myPoints.push_back(geometry->nodes->GetGlobalIndex(iPoint));
     }
   }
@@ -1517,7 +1517,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
             for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
               /*--- Get node index ---*/
-              iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+              iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
               myfile << "Node " << iPoint << "." << " \t ";
 
@@ -1575,7 +1575,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
                 for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
                   /*--- Get node index ---*/
-                  iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+                  iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
                   myfile << "Node " << iPoint << "." << " \t ";
 
@@ -1748,7 +1748,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, CNumerics *numerics, const CCon
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Get node index ---*/
-    auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Set and enforce solution at current and previous time-step ---*/
     nodes->SetSolution(iPoint, zeros);
@@ -1781,7 +1781,7 @@ void CFEASolver::BC_Clamped_Post(CGeometry *geometry, CNumerics *numerics, const
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Get node index ---*/
-    auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     nodes->SetSolution(iPoint, zeros);
 
@@ -1833,7 +1833,7 @@ void CFEASolver::BC_Sym_Plane(CGeometry *geometry, CNumerics *numerics, const CC
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Get node index ---*/
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Set and enforce solution at current and previous time-step ---*/
     nodes->SetSolution(iPoint, axis, 0.0);
@@ -1880,7 +1880,7 @@ void CFEASolver::BC_DispDir(CGeometry *geometry, CNumerics *numerics, const CCon
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Get node index. ---*/
-    auto iNode = geometry->vertex[val_marker][iVertex]->GetNode();
+    auto iNode = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- The solution is incremental so we need to
      *    subtract the current displacement. ---*/
@@ -2081,7 +2081,7 @@ void CFEASolver::BC_Normal_Load(CGeometry *geometry, CNumerics *numerics, const
     /*--- Use a reference normal from one of the points to decide if computed normal needs to be flipped. ---*/
 
     auto reference_vertex = geometry->nodes->GetVertex(indexNode[0], val_marker);
-    const su2double* reference_normal = geometry->vertex[val_marker][reference_vertex]->GetNormal();
+    const su2double* reference_normal = geometry->vertexData[val_marker].GetNormal(reference_vertex);
 
     su2double dot = 0.0;
     for (iDim = 0; iDim < nDim; iDim++)
@@ -2227,7 +2227,7 @@ void CFEASolver::BC_Deforming(CGeometry *geometry, CNumerics *numerics, const CC
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Get node index ---*/
-    auto iNode = geometry->vertex[val_marker][iVertex]->GetNode();
+    auto iNode = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Retrieve the boundary displacement ---*/
     su2double Disp[MAXNVAR] = {0.0};
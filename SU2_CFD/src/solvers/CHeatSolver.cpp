@@ -736,11 +736,11 @@ void CHeatSolver::Set_Heatflux_Areas(CGeometry *geometry, CConfig *config) {
 
         for( iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++ ) {
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if(geometry->nodes->GetDomain(iPoint)) {
 
-            Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+            Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
             Area = sqrt(Area);
@@ -793,13 +793,13 @@ void CHeatSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_conta
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt (Area);
@@ -864,11 +864,11 @@ void CHeatSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contain
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++)
         Area += Normal[iDim]*Normal[iDim];
@@ -916,11 +916,11 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       if(flow) {
@@ -968,9 +968,9 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
       if (viscous) {
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
-        geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+        geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt (Area);
@@ -1022,15 +1022,15 @@ void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
 
       if(flow) {
@@ -1097,11 +1097,11 @@ void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solv
 
     for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+      iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
       if (geometry->nodes->GetDomain(iPoint)) {
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt (Area);
@@ -1125,11 +1125,11 @@ void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solv
 
     for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+      iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
       if (geometry->nodes->GetDomain(iPoint)) {
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
         Area = sqrt(Area);
@@ -1198,16 +1198,16 @@ void CHeatSolver::Heat_Fluxes(CGeometry *geometry, CSolver **solver_container, C
 
       for( iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++ ) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if(geometry->nodes->GetDomain(iPoint)) {
 
-          iPointNormal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+          iPointNormal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
           Coord = geometry->nodes->GetCoord(iPoint);
           Coord_Normal = geometry->nodes->GetCoord(iPointNormal);
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Area = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
           Area = sqrt(Area);
@@ -1236,18 +1236,18 @@ void CHeatSolver::Heat_Fluxes(CGeometry *geometry, CSolver **solver_container, C
 
       for( iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++ ) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if(geometry->nodes->GetDomain(iPoint)) {
 
-          iPointNormal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+          iPointNormal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
           Twall = nodes->GetSolution(iPoint,0);
 
           Coord = geometry->nodes->GetCoord(iPoint);
           Coord_Normal = geometry->nodes->GetCoord(iPointNormal);
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Area = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
           Area = sqrt(Area);
@@ -1387,8 +1387,8 @@ void CHeatSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
       /*--- Inviscid contribution ---*/
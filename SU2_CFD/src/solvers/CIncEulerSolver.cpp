@@ -296,8 +296,10 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    System.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Flow());
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+        ((iMesh != MESH_0) && config->GetMG_LineAgglomeration())) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
@@ -1659,8 +1661,8 @@ void CIncEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
@@ -2359,8 +2361,8 @@ void CIncEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
       Area = sqrt(Area);
@@ -2674,7 +2676,7 @@ void CIncEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         Pressure = nodes->GetPressure(iPoint);
 
@@ -2685,7 +2687,7 @@ void CIncEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
         if ( (geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES) ) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Coord = geometry->nodes->GetCoord(iPoint);
 
           for (iDim = 0; iDim < nDim; iDim++) {
@@ -3049,14 +3051,14 @@ void CIncEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Note that the pressure coefficient is computed at the
          halo cells (for visualization purposes), but not the forces ---*/
 
         if ( (geometry->nodes->GetDomain(iPoint)) && (Monitoring == YES) ) {
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Coord = geometry->nodes->GetCoord(iPoint);
           Density   = nodes->GetDensity(iPoint);
 
@@ -3692,13 +3694,13 @@ su2double CIncEulerSolver::GetInletAtVertex(su2double *val_inlet,
 
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++){
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (iPoint == val_inlet_point) {
 
             /*-- Compute boundary face area for this vertex. ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
             Area = sqrt(Area);
@@ -4032,7 +4034,7 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
   /*--- Loop over all the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Allocate the value at the infinity ---*/
 
@@ -4044,11 +4046,11 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
 
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4179,7 +4181,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
     V_inlet = GetCharacPrimVar(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -4187,11 +4189,11 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4429,7 +4431,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
     V_outlet = GetCharacPrimVar(val_marker, iVertex);
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -4437,11 +4439,11 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Index of the closest interior node ---*/
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
 
@@ -4676,7 +4678,7 @@ void CIncEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       /*----------------------------------------------------------------------------------------------*/
 
       /*--- Normal vector for a random vertex (zero) on this marker (negate for outward convention). ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++)
         Normal[iDim] = -Normal[iDim];
 
@@ -4723,7 +4725,7 @@ void CIncEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
       }//if viscous
     }//if bound_is_straight
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
@@ -4743,7 +4745,7 @@ void CIncEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
         conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
       /*--- Normal vector for this vertex (negate for outward convention). ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      geometry->vertexData[val_marker].GetNormal(iVertex, Normal);
       for (iDim = 0; iDim < nDim; iDim++)
         Normal[iDim] = -Normal[iDim];
       conv_numerics->SetNormal(Normal);
@@ -4917,7 +4919,7 @@ void CIncEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_c
     if (config->GetMarker_All_KindBC(iMarker) == FLUID_INTERFACE) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -4935,7 +4937,7 @@ void CIncEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_c
 
           for (jVertex = 0; jVertex < nDonorVertex; jVertex++) {
 
-            Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+            Point_Normal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
             for (iVar = 0; iVar < nPrimVar; iVar++) {
               PrimVar_i[iVar] = nodes->GetPrimitive(iPoint,iVar);
@@ -4952,7 +4954,7 @@ void CIncEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_c
 
             /*--- Set the normal vector ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             for (iDim = 0; iDim < nDim; iDim++)
               Normal[iDim] = -Normal[iDim];
 
@@ -5098,7 +5100,7 @@ void CIncEulerSolver::BC_Custom(CGeometry      *geometry,
 
       /*--- Get the point index for the current node. ---*/
 
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+      iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
       /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -5357,8 +5359,8 @@ void CIncEulerSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver
 
         /*--- Get the index for node i plus the boundary face normal ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         /*--- Grid velocities stored at boundary node i ---*/
 
@@ -5544,13 +5546,13 @@ void CIncEulerSolver::GetOutlet_Properties(CGeometry *geometry, CConfig *config,
 
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (geometry->nodes->GetDomain(iPoint)) {
 
             V_outlet = nodes->GetPrimitive(iPoint);
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Vector);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Vector);
 
             if (axisymmetric) {
               if (geometry->nodes->GetCoord(iPoint, 1) != 0.0)
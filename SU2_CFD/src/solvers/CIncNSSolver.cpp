@@ -239,8 +239,10 @@ CIncNSSolver::CIncNSSolver(CGeometry *geometry, CConfig *config, unsigned short
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    System.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Flow());
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
+        ((iMesh != MESH_0) && config->GetMG_LineAgglomeration())) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
@@ -924,8 +926,8 @@ void CIncNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
       /*--- Mean Values ---*/
@@ -1232,13 +1234,13 @@ void CIncNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        iPointNormal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        iPointNormal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
         Coord = geometry->nodes->GetCoord(iPoint);
         Coord_Normal = geometry->nodes->GetCoord(iPointNormal);
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         for (iDim = 0; iDim < nDim; iDim++) {
           for (jDim = 0 ; jDim < nDim; jDim++) {
@@ -1612,7 +1614,7 @@ void CIncNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -1620,7 +1622,7 @@ void CIncNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contai
 
       /*--- Compute dual-grid area and boundary normal ---*/
 
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++)
@@ -1718,7 +1720,7 @@ void CIncNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -1759,7 +1761,7 @@ void CIncNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
 
         /*--- Compute dual grid area and boundary normal ---*/
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
         Area = 0.0;
         for (iDim = 0; iDim < nDim; iDim++)
@@ -1768,7 +1770,7 @@ void CIncNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
 
         /*--- Compute closest normal neighbor ---*/
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+        Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
         /*--- Get coordinates of i & nearest normal and compute distance ---*/
 
@@ -1860,7 +1862,7 @@ void CIncNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **sol
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
@@ -1904,7 +1906,7 @@ void CIncNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **sol
 
           /*--- Compute closest normal neighbor ---*/
 
-          Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+          Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
           /*--- Get coordinates of i & nearest normal and compute distance ---*/
 
@@ -30,6 +30,7 @@
 #include "../../include/solvers/CMeshSolver.hpp"
 #include "../../include/variables/CMeshBoundVariable.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
 
 using namespace GeometryToolbox;
 
@@ -40,6 +41,7 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(true
 
   time_domain = config->GetTime_Domain();
   multizone = config->GetMultizone_Problem();
+  rbf_deformation = (config->GetDeform_Method() == RBF_DEFORMATION);
 
   /*--- Determine if the stiffness per-element is set ---*/
   switch (config->GetDeform_Stiffness_Type()) {
@@ -96,13 +98,16 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(true
 
   element.resize(nElement);
 
-  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
-
-  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Mesh Deformation)." << endl;
+  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver.
+   *    The RBF deformation only uses the solution vector to store the displacements. ---*/
 
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+  if (!rbf_deformation) {
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Mesh Deformation)." << endl;
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
   System.SetToleranceType(LinearToleranceType::ABSOLUTE);
 
   /*--- Initialize structures for hybrid-parallel mode. ---*/
@@ -160,7 +165,9 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(true
   /*--- Compute the wall distance using the reference coordinates ---*/
   SetWallDistance(geometry, config);
 
-  if (size != SINGLE_NODE) {
+  if (rbf_deformation) SetRBF_BoundaryPoints(geometry, config);
+
+  if (size != SINGLE_NODE && !rbf_deformation) {
     vector<unsigned short> essentialMarkers;
     /*--- Markers types covered in SetBoundaryDisplacements. ---*/
     for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -312,7 +319,7 @@ void CMeshSolver::SetWallDistance(CGeometry *geometry, CConfig *config) {
     if (!config->GetSolid_Wall(iMarker)) continue;
 
     for (auto iVertex=0u; iVertex<geometry->GetnVertex(iMarker); ++iVertex) {
-      auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
       PointIDs[jj++] = iPoint;
       for (auto iDim=0u; iDim<nDim; ++iDim){
         Coord_bound[ii++] = nodes->GetMesh_Coord(iPoint,iDim);
@@ -478,26 +485,36 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   InitiateComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
   CompleteComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
 
-  /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
-
   const bool ActiveTape = AD::TapeActive();
-  AD::StopRecording();
-
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
 
-  if (ActiveTape) AD::StartRecording();
+  if (rbf_deformation) {
 
-  /*--- Clear residual (loses AD info), we do not want an incremental solution. ---*/
-  SU2_OMP_PARALLEL
-  {
-    LinSysRes.SetValZero();
+    /*--- Interpolate the boundary displacements, no linear system is assembled. ---*/
+    SetSurfaceMotions(geometry[MESH_0], config);
+    InterpolateDisplacements_RBF(geometry[MESH_0], config);
   }
+  else {
 
-  /*--- Impose boundary conditions (all of them are ESSENTIAL BC's - displacements). ---*/
-  SetBoundaryDisplacements(geometry[MESH_0], numerics[FEA_TERM], config);
+    /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
 
-  /*--- Solve the linear system. ---*/
-  Solve_System(geometry[MESH_0], config);
+    AD::StopRecording();
+
+    Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+
+    if (ActiveTape) AD::StartRecording();
+
+    /*--- Clear residual (loses AD info), we do not want an incremental solution. ---*/
+    SU2_OMP_PARALLEL
+    {
+      LinSysRes.SetValZero();
+    }
+
+    /*--- Impose boundary conditions (all of them are ESSENTIAL BC's - displacements). ---*/
+    SetBoundaryDisplacements(geometry[MESH_0], numerics[FEA_TERM], config);
+
+    /*--- Solve the linear system. ---*/
+    Solve_System(geometry[MESH_0], config);
+  }
 
   /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
@@ -620,7 +637,7 @@ void CMeshSolver::UpdateMultiGrid(CGeometry **geometry, CConfig *config) const{
 
 }
 
-void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numerics, CConfig *config){
+void CMeshSolver::SetSurfaceMotions(CGeometry *geometry, CConfig *config){
 
   /* Surface motions are not applied during discrete adjoint runs as the corresponding
    * boundary displacements are computed when loading the primal solution, and it
@@ -638,6 +655,12 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numer
     Surface_Rotating(geometry, config, config->GetTimeIter());
   }
 
+}
+
+void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numerics, CConfig *config){
+
+  SetSurfaceMotions(geometry, config);
+
   unsigned short iMarker;
 
   /*--- Impose zero displacements of all non-moving surfaces (also at nodes in multiple moving/non-moving boundaries). ---*/
@@ -690,6 +713,301 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CNumerics *numer
 
 }
 
+void CMeshSolver::SetRBF_BoundaryPoints(CGeometry *geometry, const CConfig *config){
+
+  /*--- Same classification of the markers as in SetBoundaryDisplacements, nodes of moving
+   *    markers take the prescribed displacement unless they also belong to fixed markers. ---*/
+
+  vector<char> kind(nPoint, 0);
+
+  for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    const bool moving = (config->GetMarker_All_Deform_Mesh(iMarker) == YES) ||
+                        (config->GetMarker_All_Moving(iMarker) == YES);
+    const bool fixed = (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
+                       (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY);
+    if (!moving && !fixed) continue;
+
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      const auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      if (!moving) kind[iPoint] = 1;
+      else if (kind[iPoint] == 0) kind[iPoint] = 2;
+    }
+  }
+
+  su2double bbox[2*MAXNDIM];
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    bbox[iDim] = numeric_limits<passivedouble>::max();
+    bbox[nDim+iDim] = numeric_limits<passivedouble>::max();
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    if (kind[iPoint] == 0) continue;
+    RBF_BoundPoint.push_back(iPoint);
+    RBF_BoundMoving.push_back(kind[iPoint] == 2);
+
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const su2double coord = nodes->GetMesh_Coord(iPoint, iDim);
+      bbox[iDim] = min(bbox[iDim], coord);
+      bbox[nDim+iDim] = min(bbox[nDim+iDim], -coord);
+    }
+  }
+  RBF_BoundIsCenter.assign(RBF_BoundPoint.size(), false);
+
+  /*--- Default radius, the diagonal of the bounding box of all the boundaries. ---*/
+
+  RBF_Radius = config->GetDeform_RBF_Radius();
+
+  if (RBF_Radius <= 0.0) {
+    su2double globalBox[2*MAXNDIM];
+    SU2_MPI::Allreduce(bbox, globalBox, 2*nDim, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    RBF_Radius = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      RBF_Radius += pow(-globalBox[nDim+iDim] - globalBox[iDim], 2);
+    RBF_Radius = sqrt(RBF_Radius);
+  }
+
+  if (rank == MASTER_NODE)
+    cout << "RBF mesh deformation, radius of the basis functions: " << RBF_Radius << "." << endl;
+
+}
+
+void CMeshSolver::InterpolateDisplacements_RBF(CGeometry *geometry, CConfig *config){
+
+  const auto kindRBF = static_cast<ENUM_RADIALBASIS>(config->GetDeform_RBF_Kind());
+  const unsigned long maxCenters = config->GetDeform_RBF_MaxCenters();
+  const unsigned long nBound = RBF_BoundPoint.size();
+
+  /*--- Displacements imposed at the boundary nodes. ---*/
+
+  vector<su2double> boundDisp(nBound*nDim, 0.0);
+  su2double maxDisp = 0.0;
+
+  for (auto iBound = 0ul; iBound < nBound; ++iBound) {
+    if (!RBF_BoundMoving[iBound]) continue;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      boundDisp[iBound*nDim+iDim] = nodes->GetBound_Disp(RBF_BoundPoint[iBound], iDim);
+    maxDisp = max(maxDisp, Norm(nDim, &boundDisp[iBound*nDim]));
+  }
+
+  su2double globalMaxDisp = 0.0;
+  SU2_MPI::Allreduce(&maxDisp, &globalMaxDisp, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  const passivedouble tolerance = SU2_TYPE::GetValue(config->GetDeform_RBF_Tol()*globalMaxDisp);
+
+  /*--- Interpolated displacement at coordinate "coord", given the coefficients of the centers. For compact basis
+   *    functions the centers are sorted into bins of the size of the radius, only the 3^nDim bins around the
+   *    coordinate can contribute (coordinates outside the bins are clamped to the last bin, which remains
+   *    correct). Global basis functions use a single bin. ---*/
+
+  const bool compact = (kindRBF == WENDLAND_C2);
+  su2double binOrigin[MAXNDIM] = {0.0};
+  unsigned long nBin[MAXNDIM] = {1, 1, 1};
+  vector<unsigned long> binStart, binCenters;
+
+  auto BinIndex = [&](const su2double* coord, unsigned short iDim) {
+    const long idx = floor(SU2_TYPE::GetValue((coord[iDim]-binOrigin[iDim])/RBF_Radius));
+    return static_cast<unsigned long>(max(0l, min(long(nBin[iDim])-1, idx)));
+  };
+
+  auto SetBins = [&]() {
+    const unsigned long nCenters = RBF_CenterRank.size();
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      su2double lo = numeric_limits<passivedouble>::max(), hi = -lo;
+      for (auto iCenter = 0ul; iCenter < nCenters; ++iCenter) {
+        lo = min(lo, RBF_CenterCoord[iCenter*nDim+iDim]);
+        hi = max(hi, RBF_CenterCoord[iCenter*nDim+iDim]);
+      }
+      binOrigin[iDim] = (nCenters > 0)? lo : su2double(0.0);
+      nBin[iDim] = (compact && nCenters > 0)? min(64ul, 1ul+static_cast<unsigned long>(SU2_TYPE::GetValue((hi-lo)/RBF_Radius))) : 1;
+    }
+    const unsigned long nBinTotal = nBin[0]*nBin[1]*nBin[2];
+
+    vector<unsigned long> binOfCenter(nCenters);
+    binStart.assign(nBinTotal+1, 0);
+    for (auto iCenter = 0ul; iCenter < nCenters; ++iCenter) {
+      const su2double* coord = &RBF_CenterCoord[iCenter*nDim];
+      unsigned long iBin = 0;
+      for (int iDim = nDim-1; iDim >= 0; --iDim) iBin = iBin*nBin[iDim] + BinIndex(coord, iDim);
+      binOfCenter[iCenter] = iBin;
+      ++binStart[iBin+1];
+    }
+    for (auto iBin = 0ul; iBin < nBinTotal; ++iBin) binStart[iBin+1] += binStart[iBin];
+
+    binCenters.resize(nCenters);
+    vector<unsigned long> pos(binStart.begin(), binStart.end()-1);
+    for (auto iCenter = 0ul; iCenter < nCenters; ++iCenter)
+      binCenters[pos[binOfCenter[iCenter]]++] = iCenter;
+  };
+
+  auto Interpolate = [&](const su2double* coord, const su2activematrix& coeff, su2double* disp) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) disp[iDim] = 0.0;
+
+    unsigned long lo[MAXNDIM] = {0, 0, 0}, hi[MAXNDIM] = {0, 0, 0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const auto idx = BinIndex(coord, iDim);
+      lo[iDim] = (idx > 0)? idx-1 : 0;
+      hi[iDim] = min(nBin[iDim]-1, idx+1);
+    }
+    for (auto k = lo[2]; k <= hi[2]; ++k) {
+      for (auto j = lo[1]; j <= hi[1]; ++j) {
+        for (auto i = lo[0]; i <= hi[0]; ++i) {
+          const auto iBin = (k*nBin[1] + j)*nBin[0] + i;
+          for (auto iPos = binStart[iBin]; iPos < binStart[iBin+1]; ++iPos) {
+            const auto iCenter = binCenters[iPos];
+            const su2double dist = Distance(nDim, coord, &RBF_CenterCoord[iCenter*nDim]);
+            if (compact && dist >= RBF_Radius) continue;
+            const su2double phi = CRadialBasisFunction::Get_RadialBasisValue(kindRBF, RBF_Radius, dist);
+            for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+              disp[iDim] += phi * coeff(iCenter, iDim);
+          }
+        }
+      }
+    }
+  };
+
+  /*--- Greedy selection of the centers, the ones of previous deformations are kept. ---*/
+
+  su2activematrix coeff;
+  vector<passivedouble> boundError(nBound);
+  const int nCandVar = 1+nDim;
+
+  while (true) {
+
+    const unsigned long nCenters = RBF_CenterRank.size();
+
+    /*--- Displacements of the centers, from their owners, and coefficients of the basis functions. ---*/
+
+    su2activematrix centerDisp(nCenters, nDim), globalCenterDisp(nCenters, nDim);
+    centerDisp = su2double(0.0);
+    for (auto iCenter = 0ul; iCenter < nCenters; ++iCenter) {
+      if (RBF_CenterRank[iCenter] != rank) continue;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        centerDisp(iCenter, iDim) = boundDisp[RBF_CenterBound[iCenter]*nDim+iDim];
+    }
+    if (nCenters > 0)
+      SU2_MPI::Allreduce(centerDisp.data(), globalCenterDisp.data(), nCenters*nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    coeff.resize(nCenters, nDim);
+    for (auto iCenter = 0ul; iCenter < nCenters; ++iCenter) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        su2double sum = 0.0;
+        for (auto jCenter = 0ul; jCenter < nCenters; ++jCenter)
+          sum += RBF_Generator(iCenter, jCenter) * globalCenterDisp(jCenter, iDim);
+        coeff(iCenter, iDim) = sum;
+      }
+    }
+
+    SetBins();
+
+    /*--- Interpolation error at the boundary nodes of this rank. ---*/
+
+    passivedouble maxError = 0.0;
+
+    SU2_OMP_PARALLEL
+    {
+      passivedouble threadMax = 0.0;
+
+      SU2_OMP_FOR_DYN(roundUpDiv(nBound, 4*omp_get_num_threads())+1)
+      for (auto iBound = 0ul; iBound < nBound; ++iBound) {
+        su2double disp[MAXNDIM] = {0.0}, diff[MAXNDIM] = {0.0};
+        Interpolate(nodes->GetMesh_Coord(RBF_BoundPoint[iBound]), coeff, disp);
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          diff[iDim] = disp[iDim] - boundDisp[iBound*nDim+iDim];
+        boundError[iBound] = RBF_BoundIsCenter[iBound]? 0.0 : SU2_TYPE::GetValue(Norm(nDim, diff));
+        threadMax = max(threadMax, boundError[iBound]);
+      }
+      SU2_OMP_CRITICAL
+      maxError = max(maxError, threadMax);
+    }
+
+    passivedouble globalMaxError = 0.0;
+#ifdef HAVE_MPI
+    MPI_Allreduce(&maxError, &globalMaxError, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    globalMaxError = maxError;
+#endif
+
+    if (globalMaxError <= tolerance || nCenters >= maxCenters) {
+      if (rank == MASTER_NODE)
+        cout << "RBF mesh deformation with " << nCenters << " centers, max boundary error: " << globalMaxError << "." << endl;
+      break;
+    }
+
+    /*--- Candidates of each rank, the nodes with the largest errors, padded with negative errors. ---*/
+
+    const unsigned long nAdd = min(maxCenters-nCenters, max(8ul, nCenters/4));
+
+    vector<unsigned long> order(nBound);
+    iota(order.begin(), order.end(), 0ul);
+    const auto nLocal = min(nAdd, nBound);
+    partial_sort(order.begin(), order.begin()+nLocal, order.end(),
+                 [&](unsigned long a, unsigned long b) { return boundError[a] > boundError[b]; });
+
+    vector<su2double> candidates(nAdd*nCandVar, -1.0), allCandidates(size*nAdd*nCandVar);
+    vector<unsigned long> candBound(nAdd, 0), allCandBound(size*nAdd);
+
+    for (auto iCand = 0ul; iCand < nLocal; ++iCand) {
+      const auto iBound = order[iCand];
+      candidates[iCand*nCandVar] = boundError[iBound];
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        candidates[iCand*nCandVar+1+iDim] = nodes->GetMesh_Coord(RBF_BoundPoint[iBound], iDim);
+      candBound[iCand] = iBound;
+    }
+
+    SU2_MPI::Allgather(candidates.data(), nAdd*nCandVar, MPI_DOUBLE,
+                       allCandidates.data(), nAdd*nCandVar, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(candBound.data(), nAdd, MPI_UNSIGNED_LONG,
+                       allCandBound.data(), nAdd, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    /*--- All ranks select the same global candidates, ties are broken by position. ---*/
+
+    vector<unsigned long> allOrder(size*nAdd);
+    iota(allOrder.begin(), allOrder.end(), 0ul);
+    stable_sort(allOrder.begin(), allOrder.end(), [&](unsigned long a, unsigned long b) {
+      return allCandidates[a*nCandVar] > allCandidates[b*nCandVar];
+    });
+
+    for (auto iCand = 0ul; iCand < nAdd; ++iCand) {
+      const auto iGlobal = allOrder[iCand];
+      if (SU2_TYPE::GetValue(allCandidates[iGlobal*nCandVar]) <= tolerance) break;
+
+      const int owner = iGlobal / nAdd;
+      RBF_CenterRank.push_back(owner);
+      RBF_CenterBound.push_back(allCandBound[iGlobal]);
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        RBF_CenterCoord.push_back(allCandidates[iGlobal*nCandVar+1+iDim]);
+      if (owner == rank) RBF_BoundIsCenter[allCandBound[iGlobal]] = true;
+    }
+
+    /*--- Update the inverse of the interpolation matrix. ---*/
+
+    const unsigned long nNewCenters = RBF_CenterRank.size();
+    if (nNewCenters == nCenters) break;
+
+    su2activematrix centerCoord(nNewCenters, nDim);
+    for (auto iCenter = 0ul; iCenter < nNewCenters; ++iCenter)
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        centerCoord(iCenter, iDim) = RBF_CenterCoord[iCenter*nDim+iDim];
+
+    int nPolynomial = 0;
+    vector<int> keepPolynomialRow;
+    CRadialBasisFunction::ComputeGeneratorMatrix(kindRBF, false, RBF_Radius, centerCoord,
+                                                 nPolynomial, keepPolynomialRow, RBF_Generator);
+  }
+
+  /*--- Matrix-free evaluation at the owned nodes, the boundary nodes take the exact displacement. ---*/
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,omp_chunk_size))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    su2double disp[MAXNDIM] = {0.0};
+    Interpolate(nodes->GetMesh_Coord(iPoint), coeff, disp);
+    LinSysSol.SetBlock(iPoint, disp);
+  }
+
+  for (auto iBound = 0ul; iBound < nBound; ++iBound)
+    LinSysSol.SetBlock(RBF_BoundPoint[iBound], &boundDisp[iBound*nDim]);
+
+}
+
 void CMeshSolver::SetDualTime_Mesh(void){
 
   nodes->Set_Solution_time_n1();
@@ -795,7 +1113,7 @@ void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
       for (unsigned long iVertex = 0; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
 
         /*--- Get node index. ---*/
-        auto iNode = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+        auto iNode = geometry[MESH_0]->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Set boundary solution. ---*/
         nodes->SetBound_Disp(iNode, nodes->GetSolution(iNode));
@@ -997,7 +1315,7 @@ void CMeshSolver::Surface_Pitching(CGeometry *geometry, CConfig *config, unsigne
 
         /*--- Index and coordinates of the current point ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Coord  = geometry->nodes->GetCoord(iPoint);
 
         /*--- Calculate non-dim. position from rotation center ---*/
@@ -1103,7 +1421,7 @@ void CMeshSolver::Surface_Rotating(CGeometry *geometry, CConfig *config, unsigne
 
         /*--- Index and coordinates of the current point ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         Coord  = geometry->nodes->GetCoord(iPoint);
 
         /*--- Calculate non-dim. position from rotation center ---*/
@@ -1263,7 +1581,7 @@ void CMeshSolver::Surface_Plunging(CGeometry *geometry, CConfig *config, unsigne
 
         /*--- Set node displacement for volume deformation ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         for (iDim = 0; iDim < nDim; iDim++)
           VarCoordAbs[iDim] = nodes->GetBound_Disp(iPoint, iDim) + VarCoord[iDim];
@@ -1373,7 +1691,7 @@ void CMeshSolver::Surface_Translating(CGeometry *geometry, CConfig *config, unsi
 
         /*--- Set node displacement for volume deformation ---*/
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         for (iDim = 0; iDim < nDim; iDim++)
           VarCoordAbs[iDim] = nodes->GetBound_Disp(iPoint, iDim) + VarCoord[iDim];
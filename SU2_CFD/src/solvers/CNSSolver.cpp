@@ -27,6 +27,7 @@
 
 #include "../../include/solvers/CNSSolver.hpp"
 #include "../../include/variables/CNSVariable.hpp"
+#include "../../include/numerics/flow/flow_diffusion.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -182,33 +183,57 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   CommonPreprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
 
-  /*--- Compute gradient for MUSCL reconstruction. ---*/
+  /*--- The limiter is needed by the turbulence model or to limit the viscous
+   *    terms (check this logic with JST and 2nd order turbulence model) ---*/
 
-  if (config->GetReconstructionGradientRequired() && (iMesh == MESH_0)) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
-    }
-  }
+  const bool limiter = (iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada;
+  const bool reconGradient = config->GetReconstructionGradientRequired() && (iMesh == MESH_0);
+  const bool primGradient = (config->GetKind_Gradient_Method() == GREEN_GAUSS) ||
+                            (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES);
 
-  /*--- Compute gradient of the primitive variables ---*/
+  if (GetFusedGradientLimiter(config)) {
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
-  }
-  else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+    /*--- Gradients and limiter computation in one pass, the limiter goes with
+     *    the gradient for MUSCL reconstruction (which may be the primitive one). ---*/
+
+    if (reconGradient)
+      SetPrimitive_Gradient_Limiter(geometry, config, true, limiter);
+
+    if (primGradient)
+      SetPrimitive_Gradient_Limiter(geometry, config, false, limiter && !reconGradient);
+
+    if (limiter && !reconGradient && !primGradient)
+      SetPrimitive_Limiter(geometry, config);
   }
+  else {
+
+    /*--- Compute gradient for MUSCL reconstruction. ---*/
 
-  /*--- Compute the limiter in case we need it in the turbulence model or to limit the
-   *    viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
+    if (reconGradient) {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
+    }
 
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada) {
-    SetPrimitive_Limiter(geometry, config);
+    /*--- Compute gradient of the primitive variables ---*/
+
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
+
+    /*--- Compute the limiter. ---*/
+
+    if (limiter) {
+      SetPrimitive_Limiter(geometry, config);
+    }
   }
 
   /*--- Evaluate the vorticity and strain rate magnitude ---*/
@@ -271,32 +296,39 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
   const unsigned short turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The points are updated in batches, to evaluate the fluid and transport models on arrays. ---*/
+
+  constexpr unsigned long MAXBATCH = CEulerVariable::MAXBATCH;
+  const unsigned long nBatch = roundUpDiv(nPoint, MAXBATCH);
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, MAXBATCH))
+  for (unsigned long iBatch = 0; iBatch < nBatch; iBatch++) {
+
+    const unsigned long iPointBegin = iBatch*MAXBATCH;
+    const unsigned long iPointEnd = min(nPoint, iPointBegin+MAXBATCH);
 
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
-    su2double eddy_visc = 0.0, turb_ke = 0.0;
+    su2double eddy_visc[MAXBATCH] = {0.0}, turb_ke[MAXBATCH] = {0.0};
 
     if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+      for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+        eddy_visc[iPoint-iPointBegin] = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+        if (tkeNeeded) turb_ke[iPoint-iPointBegin] = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
 
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
-        su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
-        nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
+        if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+          su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
+          nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
+        }
       }
     }
 
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
-    bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(iPoint, eddy_visc, turb_ke, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
-
-    /*--- Check for non-realizable states for reporting. ---*/
-
-    nonPhysicalPoints += !physical;
+    /*--- Count the non-realizable states for reporting. ---*/
 
+    nonPhysicalPoints += static_cast<CNSVariable*>(nodes)->SetPrimVar(iPointBegin, iPointEnd, eddy_visc, turb_ke,
+                                                                      GetFluidModel());
   }
 
   return nonPhysicalPoints;
@@ -365,6 +397,110 @@ void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolv
 
 }
 
+bool CNSSolver::ViscousEdgePacks(const CNumerics *numerics, const CConfig *config) const {
+
+  auto avgGrad = dynamic_cast<const CAvgGrad_Flow*>(numerics);
+  return (avgGrad != nullptr) && avgGrad->SupportsEdgePack(config);
+}
+
+void CNSSolver::Viscous_Residual(unsigned long nEdge, const unsigned long *edges, CGeometry *geometry,
+                                 CSolver **solver_container, CNumerics *numerics, CConfig *config) {
+
+  static_assert(size_t(EDGE_PACK_SIZE) == size_t(CAvgGrad_Flow::EdgePack::SIZE), "Pack sizes of solver and numerics differ.");
+
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  CAvgGrad_Flow::EdgePack pack;
+
+  /*--- Gather the data of the edges, the unused lanes repeat the first edge. ---*/
+
+  for (auto iLane = 0ul; iLane < EDGE_PACK_SIZE; ++iLane) {
+
+    const auto iEdge = edges[(iLane < nEdge)? iLane : 0];
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
+
+    const auto Normal = geometry->edges->GetNormal(iEdge);
+    const auto EdgeVector = geometry->edges->GetEdgeVector(iEdge);
+
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      pack.Normal[iDim][iLane] = Normal[iDim];
+      pack.EdgeVector[iDim][iLane] = EdgeVector[iDim];
+    }
+    pack.Area[iLane] = geometry->edges->GetArea(iEdge);
+    pack.Dist2[iLane] = geometry->edges->GetDist2(iEdge);
+
+    const auto V_i = nodes->GetPrimitive(iPoint);
+    const auto V_j = nodes->GetPrimitive(jPoint);
+
+    for (unsigned short iVar = 0; iVar < nDim+3; ++iVar) {
+      pack.PrimVar_i[iVar][iLane] = V_i[iVar];
+      pack.PrimVar_j[iVar][iLane] = V_j[iVar];
+    }
+    pack.LamVisc_i[iLane] = V_i[nDim+5];  pack.LamVisc_j[iLane] = V_j[nDim+5];
+    pack.EddyVisc_i[iLane] = V_i[nDim+6]; pack.EddyVisc_j[iLane] = V_j[nDim+6];
+
+    const auto Grad_i = nodes->GetGradient_Primitive(iPoint);
+    const auto Grad_j = nodes->GetGradient_Primitive(jPoint);
+
+    for (unsigned short iVar = 0; iVar < nDim+1; ++iVar) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        pack.Grad_i[iVar][iDim][iLane] = Grad_i[iVar][iDim];
+        pack.Grad_j[iVar][iDim][iLane] = Grad_j[iVar][iDim];
+      }
+    }
+  }
+
+  /*--- Compute the residuals of the pack. ---*/
+
+  static_cast<CAvgGrad_Flow*>(numerics)->ComputeResidual(pack, config);
+
+  /*--- Scatter the residuals of the edges. ---*/
+
+  su2double flux[MAXNVAR];
+  su2double jacData_i[MAXNVAR][MAXNVAR], jacData_j[MAXNVAR][MAXNVAR];
+  su2double *Jacobian_i[MAXNVAR], *Jacobian_j[MAXNVAR];
+
+  for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+    Jacobian_i[iVar] = jacData_i[iVar];
+    Jacobian_j[iVar] = jacData_j[iVar];
+  }
+
+  for (auto iLane = 0ul; iLane < nEdge; ++iLane) {
+
+    const auto iEdge = edges[iLane];
+
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+      flux[iVar] = pack.Flux[iVar][iLane];
+
+    if (implicit) {
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+        for (auto jVar = 0u; jVar < nVar; ++jVar) {
+          Jacobian_i[iVar][jVar] = pack.Jacobian_i[iVar][jVar][iLane];
+          Jacobian_j[iVar][jVar] = pack.Jacobian_j[iVar][jVar][iLane];
+        }
+      }
+    }
+
+    if (ReducerStrategy) {
+      EdgeFluxes.SubtractBlock(iEdge, flux);
+      if (implicit)
+        Jacobian.UpdateBlocksSub(iEdge, Jacobian_i, Jacobian_j);
+    }
+    else {
+      const auto iPoint = geometry->edges->GetNode(iEdge,0);
+      const auto jPoint = geometry->edges->GetNode(iEdge,1);
+
+      LinSysRes.SubtractBlock(iPoint, flux);
+      LinSysRes.AddBlock(jPoint, flux);
+
+      if (implicit)
+        Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    }
+  }
+
+}
+
 void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
   unsigned long iVertex, iPoint, iPointNormal;
@@ -457,13 +593,13 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        iPointNormal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+        iPointNormal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
         Coord = geometry->nodes->GetCoord(iPoint);
         Coord_Normal = geometry->nodes->GetCoord(iPointNormal);
 
-        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         for (iDim = 0; iDim < nDim; iDim++) {
           for (jDim = 0 ; jDim < nDim; jDim++) {
@@ -861,7 +997,7 @@ void CNSSolver::Buffet_Monitoring(CGeometry *geometry, CConfig *config) {
 
         if(Monitoring == YES){
 
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
           Area = 0.0;
           for(iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
           Area = sqrt(Area);
@@ -1076,112 +1212,147 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
   /*--- Identify the boundary by string name and get the specified wall
    heat flux from config as well as the wall function treatment. ---*/
 
-  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const auto Marker_Tag = config->GetMarker_All_TagBound(val_marker);
-  su2double Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag)/config->GetHeat_Flux_Ref();
+  const su2double Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag)/config->GetHeat_Flux_Ref();
 
 //  Wall_Function = config->GetWallFunction_Treatment(Marker_Tag);
 //  if (Wall_Function != NO_WALL_FUNCTION) {
 //    SU2_MPI::Error("Wall function treament not implemented yet", CURRENT_FUNCTION);
 //  }
 
-  /*--- Jacobian, initialized to zero if needed. ---*/
-  su2double **Jacobian_i = nullptr;
-  if (dynamic_grid && implicit) {
-    Jacobian_i = new su2double* [nVar];
-    for (auto iVar = 0u; iVar < nVar; iVar++)
-      Jacobian_i[iVar] = new su2double [nVar] ();
-  }
-
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-    /*--- If it is a customizable patch, retrieve the specified wall heat flux. ---*/
+    BC_HeatFlux_Wall_Vertex(geometry, config, val_marker, iVertex, iPoint,
+                            geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex),
+                            geometry->vertexData[val_marker].GetNormal(iVertex), Wall_HeatFlux);
+  }
 
-    if (config->GetMarker_All_PyCustom(val_marker))
-      Wall_HeatFlux = geometry->GetCustomBoundaryHeatFlux(val_marker, iVertex);
+}
 
-    /*--- Compute dual-grid area and boundary normal ---*/
+void CNSSolver::BC_HeatFlux_Wall_Vertex(CGeometry *geometry, const CConfig *config, unsigned short val_marker,
+                                        unsigned long iVertex, unsigned long iPoint, unsigned long Point_Normal,
+                                        const su2double *Normal, su2double Wall_HeatFlux) {
 
-    const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
-    su2double Area = GeometryToolbox::Norm(nDim, Normal);
+  /*--- Jacobian of the grid motion contribution, set if needed. ---*/
 
-    su2double UnitNormal[MAXNDIM] = {0.0};
-    for (auto iDim = 0u; iDim < nDim; iDim++)
-      UnitNormal[iDim] = -Normal[iDim]/Area;
+  su2double JacobianBuffer[MAXNVAR*MAXNVAR], *Jacobian_i[MAXNVAR] = {nullptr};
 
-    /*--- Apply a weak boundary condition for the energy equation.
-     Compute the residual due to the prescribed heat flux.
-     The convective part will be zero if the grid is not moving. ---*/
+  /*--- If it is a customizable patch, retrieve the specified wall heat flux. ---*/
 
-    su2double Res_Conv = 0.0;
-    su2double Res_Visc = Wall_HeatFlux * Area;
+  if (config->GetMarker_All_PyCustom(val_marker))
+    Wall_HeatFlux = geometry->GetCustomBoundaryHeatFlux(val_marker, iVertex);
 
-    /*--- Impose the value of the velocity as a strong boundary
-     condition (Dirichlet). Fix the velocity and remove any
-     contribution to the residual at this node. ---*/
+  /*--- Compute dual-grid area and boundary normal ---*/
 
-    if (dynamic_grid) {
-      nodes->SetVelocity_Old(iPoint, geometry->nodes->GetGridVel(iPoint));
-    }
-    else {
-      su2double zero[MAXNDIM] = {0.0};
-      nodes->SetVelocity_Old(iPoint, zero);
-    }
+  su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-    for (auto iDim = 0u; iDim < nDim; iDim++)
-      LinSysRes.SetBlock_Zero(iPoint, iDim+1);
-    nodes->SetVel_ResTruncError_Zero(iPoint);
-
-    /*--- If the wall is moving, there are additional residual contributions
-     due to pressure (p v_wall.n) and shear stress (tau.v_wall.n). ---*/
+  su2double UnitNormal[MAXNDIM] = {0.0};
+  for (auto iDim = 0u; iDim < nDim; iDim++)
+    UnitNormal[iDim] = -Normal[iDim]/Area;
 
-    if (dynamic_grid) {
-      if (implicit) {
-        for (auto iVar = 0u; iVar < nVar; ++iVar)
-          Jacobian_i[nDim+1][iVar] = 0.0;
-      }
+  /*--- Apply a weak boundary condition for the energy equation.
+   Compute the residual due to the prescribed heat flux.
+   The convective part will be zero if the grid is not moving. ---*/
 
-      const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+  su2double Res_Conv = 0.0;
+  su2double Res_Visc = Wall_HeatFlux * Area;
 
-      AddDynamicGridResidualContribution(iPoint, Point_Normal, geometry, UnitNormal,
-                                         Area, geometry->nodes->GetGridVel(iPoint),
-                                         Jacobian_i, Res_Conv, Res_Visc);
-    }
+  /*--- Impose the value of the velocity as a strong boundary
+   condition (Dirichlet). Fix the velocity and remove any
+   contribution to the residual at this node. ---*/
 
-    /*--- Convective and viscous contributions to the residual at the wall ---*/
+  if (dynamic_grid) {
+    nodes->SetVelocity_Old(iPoint, geometry->nodes->GetGridVel(iPoint));
+  }
+  else {
+    su2double zero[MAXNDIM] = {0.0};
+    nodes->SetVelocity_Old(iPoint, zero);
+  }
 
-    LinSysRes(iPoint, nDim+1) += Res_Conv - Res_Visc;
+  for (auto iDim = 0u; iDim < nDim; iDim++)
+    LinSysRes.SetBlock_Zero(iPoint, iDim+1);
+  nodes->SetVel_ResTruncError_Zero(iPoint);
 
-    /*--- Enforce the no-slip boundary condition in a strong way by
-     modifying the velocity-rows of the Jacobian (1 on the diagonal).
-     And add the contributions to the Jacobian due to energy. ---*/
+  /*--- If the wall is moving, there are additional residual contributions
+   due to pressure (p v_wall.n) and shear stress (tau.v_wall.n). ---*/
 
+  if (dynamic_grid) {
     if (implicit) {
-      if (dynamic_grid) {
-        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        Jacobian_i[iVar] = &JacobianBuffer[iVar*nVar];
+        for (auto jVar = 0u; jVar < nVar; ++jVar)
+          Jacobian_i[iVar][jVar] = 0.0;
       }
+    }
 
-      for (auto iVar = 1u; iVar <= nDim; iVar++) {
-        auto total_index = iPoint*nVar+iVar;
-        Jacobian.DeleteValsRowi(total_index);
-      }
+    AddDynamicGridResidualContribution(iPoint, Point_Normal, geometry, UnitNormal,
+                                       Area, geometry->nodes->GetGridVel(iPoint),
+                                       implicit? Jacobian_i : nullptr, Res_Conv, Res_Visc);
+  }
+
+  /*--- Convective and viscous contributions to the residual at the wall ---*/
+
+  LinSysRes(iPoint, nDim+1) += Res_Conv - Res_Visc;
+
+  /*--- Enforce the no-slip boundary condition in a strong way by
+   modifying the velocity-rows of the Jacobian (1 on the diagonal).
+   And add the contributions to the Jacobian due to energy. ---*/
+
+  if (implicit) {
+    if (dynamic_grid) {
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+    }
+
+    for (auto iVar = 1u; iVar <= nDim; iVar++) {
+      auto total_index = iPoint*nVar+iVar;
+      Jacobian.DeleteValsRowi(total_index);
     }
   }
 
-  if (Jacobian_i)
-    for (auto iVar = 0u; iVar < nVar; iVar++)
-      delete [] Jacobian_i[iVar];
-  delete [] Jacobian_i;
+}
+
+bool CNSSolver::GetPacked_BC(unsigned short kindBC, const CConfig *config) const {
+
+  if ((kindBC == HEAT_FLUX) && !config->GetDiscrete_Adjoint()) return true;
+
+  return CEulerSolver::GetPacked_BC(kindBC, config);
+}
+
+void CNSSolver::BC_Packed(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                          CNumerics *visc_numerics, CConfig *config, const CVertexPack& pack,
+                          unsigned short kindBC) {
+
+  if (kindBC != HEAT_FLUX) {
+    CEulerSolver::BC_Packed(geometry, solver_container, conv_numerics, visc_numerics, config, pack, kindBC);
+    return;
+  }
+
+  /*--- The wall heat flux is retrieved when the marker changes (the
+   vertices of each thread are mostly contiguous in the pack). ---*/
+
+  auto lastMarker = config->GetnMarker_All();
+  su2double Wall_HeatFlux = 0.0;
+
+  LoopVertexPack(pack, [&](unsigned long iPack) {
+    const auto iMarker = pack.GetMarker(iPack);
+    if (iMarker != lastMarker) {
+      Wall_HeatFlux = config->GetWall_HeatFlux(config->GetMarker_All_TagBound(iMarker))/config->GetHeat_Flux_Ref();
+      lastMarker = iMarker;
+    }
+    BC_HeatFlux_Wall_Vertex(geometry, config, iMarker, pack.GetVertex(iPack), pack.GetNode(iPack),
+                            pack.GetNormal_Neighbor(iPack), pack.GetNormal(iPack), Wall_HeatFlux);
+  });
 
 }
 
@@ -1257,13 +1428,13 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
   SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (!geometry->nodes->GetDomain(iPoint)) continue;
 
     /*--- Compute dual-grid area and boundary normal ---*/
 
-    const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    const auto Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
     su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
@@ -1273,7 +1444,7 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
 
     /*--- Compute closest normal neighbor ---*/
 
-    const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
     /*--- Get coordinates of i & nearest normal and compute distance ---*/
 
@@ -1429,8 +1600,8 @@ void CNSSolver::SetTauWall_WF(CGeometry *geometry, CSolver **solver_container, C
     SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
     for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+      const auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      const auto Point_Normal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
 
       /*--- Check if the node belongs to the domain (i.e, not a halo node)
        and the neighbor is not part of the physical boundary ---*/
@@ -1444,7 +1615,7 @@ void CNSSolver::SetTauWall_WF(CGeometry *geometry, CSolver **solver_container, C
 
       /*--- Compute dual-grid area and boundary normal ---*/
 
-      const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      const auto Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
       su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
@@ -294,14 +294,14 @@ void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_cont
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++)
@@ -371,14 +371,14 @@ void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++)
@@ -445,14 +445,14 @@ void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, C
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++)
@@ -626,8 +626,8 @@ void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+      Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
 
       /*--- Viscous contribution ---*/
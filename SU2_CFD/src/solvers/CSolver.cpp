@@ -30,6 +30,7 @@
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
+#include "../../include/output/filewriter/CSU2SeriesFileWriter.hpp"
 #include "../../../Common/include/toolboxes/MMS/CIncTGVSolution.hpp"
 #include "../../../Common/include/toolboxes/MMS/CInviscidVortexSolution.hpp"
 #include "../../../Common/include/toolboxes/MMS/CMMSIncEulerSolution.hpp"
@@ -45,6 +46,7 @@
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -2742,7 +2744,7 @@ void CSolver::SetRotatingFrame_GCL(CGeometry *geometry, CConfig *config) {
       SU2_OMP_FOR_STAT(32)
       for (auto iVertex = 0u; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
-        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        const auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Grid Velocity at each edge point ---*/
 
@@ -2750,7 +2752,7 @@ void CSolver::SetRotatingFrame_GCL(CGeometry *geometry, CConfig *config) {
 
         /*--- Summed normal components ---*/
 
-        const su2double* Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        const su2double* Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         su2double Flux = GeometryToolbox::DotProduct(nDim, Normal, GridVel);
 
@@ -2881,7 +2883,7 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
 
       /*--- Loop over points on the surface (Least-Squares approximation) ---*/
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         if (geometry->nodes->GetDomain(iPoint)) {
           Coord_i = geometry->nodes->GetCoord(iPoint);
           AuxVar_i = base_nodes->GetAuxVar(iPoint);
@@ -3619,12 +3621,23 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   char str_buf[CGNS_STRING_SIZE], fname[100];
   unsigned short iVar;
-  val_filename += ".dat";
-  strcpy(fname, val_filename.c_str());
   int nRestart_Vars = 5, nFields;
   Restart_Vars = new int[5];
   fields.clear();
 
+  /*--- Unsteady solutions may have been written to a time series (TIME_SERIES output)
+   instead of one restart file per time step, in that case the series is read. ---*/
+
+  string series_filename;
+  unsigned long series_iter;
+  if (FindRestartSeries(config, val_filename, series_filename, series_iter)) {
+    Read_SU2_Restart_Series(geometry, series_filename, series_iter);
+    return;
+  }
+
+  val_filename += ".dat";
+  strcpy(fname, val_filename.c_str());
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -3674,6 +3687,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
     fields.push_back(str_buf);
   }
 
+  /*--- Compressed files have their own data layout. ---*/
+
+  if (Restart_Vars[3] == CompressionToolbox::COMPRESSED_FORMAT_TAG) {
+    fclose(fhw);
+    Read_SU2_Restart_Binary_Compressed(geometry, val_filename, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE);
+    return;
+  }
+
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
   Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
@@ -3773,6 +3794,14 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   delete [] mpi_str_buf;
 
+  /*--- Compressed files have their own data layout. ---*/
+
+  if (Restart_Vars[3] == CompressionToolbox::COMPRESSED_FORMAT_TAG) {
+    MPI_File_close(&fhw);
+    Read_SU2_Restart_Binary_Compressed(geometry, val_filename, nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE);
+    return;
+  }
+
   /*--- We're writing only su2doubles in the data portion of the file. ---*/
 
   etype = MPI_DOUBLE;
@@ -3827,6 +3856,269 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
 }
 
+bool CSolver::FindRestartSeries(const CConfig *config, const string& val_filename,
+                                string& series_filename, unsigned long& val_iter) const {
+
+  if (!config->GetTime_Domain() || !config->SplitUnsteady_FileName(val_filename, series_filename, val_iter))
+    return false;
+
+  int useSeries = 0;
+  if (rank == MASTER_NODE) {
+    ifstream restart_file((val_filename + ".dat").c_str());
+    useSeries = !restart_file.is_open();
+  }
+  SU2_MPI::Bcast(&useSeries, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  series_filename += CSU2SeriesFileWriter::fileExt;
+
+  return useSeries;
+}
+
+void CSolver::Read_SU2_Restart_Series(CGeometry *geometry, const string& val_filename, unsigned long val_iter) {
+
+  unsigned long nFields, nPoints, disp;
+  vector<string> seriesFields;
+
+  if (!CSU2SeriesFileWriter::FindTimeStep(val_filename, val_iter, nFields, nPoints, seriesFields, disp)) {
+    SU2_MPI::Error(string("Unable to find time iteration ") + to_string(val_iter) +
+                   string(" in the SU2 time series file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  /*--- Mimic the header of a binary restart file. ---*/
+
+  Restart_Vars[0] = 535532;
+  Restart_Vars[1] = nFields;
+  Restart_Vars[2] = nPoints;
+  Restart_Vars[3] = 0;
+  Restart_Vars[4] = 0;
+
+  fields.push_back("Point_ID");
+  for (const auto& name : seriesFields) {
+#ifdef HAVE_MPI
+    fields.push_back("\"" + name + "\"");
+#else
+    fields.push_back(name);
+#endif
+  }
+
+  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+
+#ifndef HAVE_MPI
+
+  /*--- Serial binary input, all points of the time step are read. ---*/
+
+  FILE *fhw = fopen(val_filename.c_str(), "rb");
+
+  if (!fhw || fseek(fhw, disp, SEEK_SET) != 0) {
+    SU2_MPI::Error(string("Unable to open SU2 time series file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  size_t ret = fread(Restart_Data, sizeof(passivedouble), nFields*geometry->GetnPointDomain(), fhw);
+  if (ret != (unsigned long)nFields*geometry->GetnPointDomain()) {
+    SU2_MPI::Error("Error reading time series file.", CURRENT_FUNCTION);
+  }
+
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel binary input, the data of a time step has the same layout as in binary restart files. ---*/
+
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype filetype;
+
+  int ierr = MPI_File_open(MPI_COMM_WORLD, val_filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 time series file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  int *blocklen = new int[geometry->GetnPointDomain()];
+  MPI_Aint *displace = new MPI_Aint[geometry->GetnPointDomain()];
+  int counter = 0;
+  for (unsigned long iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+      blocklen[counter] = nFields;
+      displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+      counter++;
+    }
+  }
+  MPI_Type_create_hindexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File_set_view(fhw, disp, MPI_DOUBLE, filetype, (char*)"native", MPI_INFO_NULL);
+
+  MPI_File_read_all(fhw, Restart_Data, nFields*geometry->GetnPointDomain(), MPI_DOUBLE, &status);
+
+  MPI_File_close(&fhw);
+
+  MPI_Type_free(&filetype);
+
+  delete [] blocklen;
+  delete [] displace;
+
+#endif
+
+}
+
+void CSolver::Read_SU2_Restart_Binary_Compressed(CGeometry *geometry, const string& val_filename, unsigned long disp) {
+
+  const unsigned long nFields = Restart_Vars[1];
+  const unsigned long nBlocks = Restart_Vars[4];
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  /*--- The codec of each field is not needed to decode, skip it. ---*/
+
+  disp += nFields*sizeof(int);
+
+  vector<unsigned long> pointOffset(nBlocks+1), byteOffset(nBlocks+1);
+  const unsigned long dataDisp = disp + 2*(nBlocks+1)*sizeof(unsigned long);
+
+  Restart_Data = new passivedouble[nFields*nPointDomain];
+
+  /*--- Decode one block read from the file at its offset. ---*/
+
+  auto decodeBlock = [&](unsigned long iBlock, const vector<uint8_t>& buffer, passivedouble* data) {
+    if (!CompressionToolbox::DecompressBlock(buffer.data(), buffer.size(),
+                                             pointOffset[iBlock+1]-pointOffset[iBlock], nFields, data)) {
+      SU2_MPI::Error(string("Corrupted data block in compressed restart file ") + val_filename, CURRENT_FUNCTION);
+    }
+  };
+
+#ifndef HAVE_MPI
+
+  /*--- Serial input, all blocks are decoded in order. ---*/
+
+  FILE *fhw = fopen(val_filename.c_str(), "rb");
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  bool readOK = (fseek(fhw, disp, SEEK_SET) == 0);
+  readOK &= (fread(pointOffset.data(), sizeof(unsigned long), nBlocks+1, fhw) == nBlocks+1);
+  readOK &= (fread(byteOffset.data(), sizeof(unsigned long), nBlocks+1, fhw) == nBlocks+1);
+
+  if (!readOK || pointOffset[nBlocks] != nPointDomain) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  vector<uint8_t> buffer;
+  for (unsigned long iBlock = 0; iBlock < nBlocks; iBlock++) {
+    buffer.resize(byteOffset[iBlock+1]-byteOffset[iBlock]);
+    if (fread(buffer.data(), sizeof(uint8_t), buffer.size(), fhw) != buffer.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    decodeBlock(iBlock, buffer, &Restart_Data[pointOffset[iBlock]*nFields]);
+  }
+
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel input, rank (iBlock % size) reads and decodes block iBlock. ---*/
+
+  MPI_File fhw;
+  int ierr = MPI_File_open(MPI_COMM_WORLD, val_filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + val_filename, CURRENT_FUNCTION);
+  }
+
+  if (rank == MASTER_NODE) {
+    MPI_File_read_at(fhw, disp, pointOffset.data(), nBlocks+1, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    MPI_File_read_at(fhw, disp + (nBlocks+1)*sizeof(unsigned long), byteOffset.data(),
+                     nBlocks+1, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+  }
+  SU2_MPI::Bcast(pointOffset.data(), nBlocks+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(byteOffset.data(), nBlocks+1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (pointOffset[nBlocks] != geometry->GetGlobal_nPointDomain()) {
+    SU2_MPI::Error(string("The restart file ") + val_filename + string(" does not match the mesh."), CURRENT_FUNCTION);
+  }
+
+  const auto blockOfPoint = [&](unsigned long iPoint_Global) {
+    return static_cast<unsigned long>(upper_bound(pointOffset.begin(), pointOffset.end(), iPoint_Global) -
+                                      pointOffset.begin()) - 1;
+  };
+
+  /*--- Global indices of the local points, in the order in which Restart_Data is expected. ---*/
+
+  vector<unsigned long> localGlobalIdx;
+  localGlobalIdx.reserve(nPointDomain);
+  for (unsigned long iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) localGlobalIdx.push_back(iPoint_Global);
+  }
+
+  /*--- Request the points from the ranks that decode the blocks containing them. ---*/
+
+  vector<int> nSend(size,0), nRecv(size,0), sendDisp(size+1,0), recvDisp(size+1,0);
+
+  for (auto iPoint_Global : localGlobalIdx) nSend[blockOfPoint(iPoint_Global) % size]++;
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendDisp[iRank+1] = sendDisp[iRank] + nSend[iRank];
+    recvDisp[iRank+1] = recvDisp[iRank] + nRecv[iRank];
+  }
+
+  vector<unsigned long> sendIdx(sendDisp[size]), recvIdx(recvDisp[size]);
+  vector<int> pos(sendDisp.begin(), sendDisp.end()-1);
+
+  for (auto iPoint_Global : localGlobalIdx) sendIdx[pos[blockOfPoint(iPoint_Global) % size]++] = iPoint_Global;
+
+  SU2_MPI::Alltoallv(sendIdx.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG,
+                     recvIdx.data(), nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  /*--- Read and decode the blocks of this rank. ---*/
+
+  vector<vector<passivedouble> > blockData(nBlocks);
+  vector<uint8_t> buffer;
+
+  for (unsigned long iBlock = rank; iBlock < nBlocks; iBlock += size) {
+    buffer.resize(byteOffset[iBlock+1]-byteOffset[iBlock]);
+    MPI_File_read_at(fhw, dataDisp + byteOffset[iBlock], buffer.data(), buffer.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+    blockData[iBlock].resize((pointOffset[iBlock+1]-pointOffset[iBlock])*nFields);
+    decodeBlock(iBlock, buffer, blockData[iBlock].data());
+  }
+
+  MPI_File_close(&fhw);
+
+  /*--- Answer the requests. Note that the passive data bypasses the AD wrapper. ---*/
+
+  vector<passivedouble> sendData(recvIdx.size()*nFields), recvData(sendIdx.size()*nFields);
+
+  for (unsigned long iReq = 0; iReq < recvIdx.size(); iReq++) {
+    const auto iBlock = blockOfPoint(recvIdx[iReq]);
+    const auto offset = (recvIdx[iReq]-pointOffset[iBlock])*nFields;
+    for (unsigned long iVar = 0; iVar < nFields; iVar++)
+      sendData[iReq*nFields + iVar] = blockData[iBlock][offset + iVar];
+  }
+
+  for (int iRank = 0; iRank <= size; iRank++) {
+    if (iRank < size) { nSend[iRank] *= nFields; nRecv[iRank] *= nFields; }
+    sendDisp[iRank] *= nFields; recvDisp[iRank] *= nFields;
+  }
+
+  MPI_Alltoallv(sendData.data(), nRecv.data(), recvDisp.data(), MPI_DOUBLE,
+                recvData.data(), nSend.data(), sendDisp.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  /*--- The answers of each rank come in the order of the requests. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) pos[iRank] = sendDisp[iRank];
+
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const int iRank = blockOfPoint(localGlobalIdx[iPoint]) % size;
+    for (unsigned long iVar = 0; iVar < nFields; iVar++)
+      Restart_Data[iPoint*nFields + iVar] = recvData[pos[iRank]++];
+  }
+
+#endif
+
+}
+
 void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bool adjoint, string val_filename) const {
 
   su2double AoA_ = config->GetAoA();
@@ -4197,7 +4489,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
       for (iVertex = 0; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
 
-        iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry[MESH_0]->vertexData[iMarker].GetNode(iVertex);
         Coord = geometry[MESH_0]->nodes->GetCoord(iPoint);
 
         if(Interpolate == false) {
@@ -4349,8 +4641,8 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
           /*--- Get the coarse mesh point and compute the boundary area. ---*/
 
-          iPoint = geometry[iMesh]->vertex[iMarker][iVertex]->GetNode();
-          geometry[iMesh]->vertex[iMarker][iVertex]->GetNormal(Normal);
+          iPoint = geometry[iMesh]->vertexData[iMarker].GetNode(iVertex);
+          geometry[iMesh]->vertexData[iMarker].GetNormal(iVertex, Normal);
           Area_Parent = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) Area_Parent += Normal[iDim]*Normal[iDim];
           Area_Parent = sqrt(Area_Parent);
@@ -4446,9 +4738,9 @@ void CSolver::ComputeVertexTractions(CGeometry *geometry, CConfig *config){
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
         // Recover the point index
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
         // Get the normal at the vertex: this normal goes inside the fluid domain.
-        iNormal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        iNormal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
         /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
         if (geometry->nodes->GetDomain(iPoint)) {
@@ -4518,7 +4810,7 @@ void CSolver::RegisterVertexTractions(CGeometry *geometry, CConfig *config){
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
         /*--- Recover the point index ---*/
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
         if (geometry->nodes->GetDomain(iPoint)) {
@@ -4550,7 +4842,7 @@ void CSolver::SetVertexTractionsAdjoint(CGeometry *geometry, CConfig *config){
       for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
         /*--- Recover the point index ---*/
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
         /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
         if (geometry->nodes->GetDomain(iPoint)) {
@@ -27,6 +27,7 @@
 
 #include "../../include/solvers/CTurbSASolver.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
+#include "../../include/numerics/turbulent/turb_sources.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -81,6 +82,7 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SA model)." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    System.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Turb());
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -90,6 +92,9 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+    if (config->GetCoupled_Turb_Solve())
+      InitializeCoupledSystem(geometry, config);
+
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
 
@@ -341,71 +346,98 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Loop over all points. ---*/
-
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  /*--- Evaluate the source terms by packs of points if the numerics support it. ---*/
 
-    /*--- Conservative variables w/o reconstruction ---*/
+  auto saNumerics = dynamic_cast<CSourceBase_TurbSA*>(numerics);
 
-    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+  if ((saNumerics != nullptr) && saNumerics->SupportsPointPack(config)) {
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+    constexpr auto PACK_SIZE = TurbSourcePack::SIZE;
+    const bool desLength = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
 
-    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+    TurbSourcePack pack;
 
-    /*--- Set vorticity and strain rate magnitude ---*/
+    SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size,PACK_SIZE))
+    for (unsigned long iPointBegin = 0; iPointBegin < nPointDomain; iPointBegin += PACK_SIZE) {
 
-    numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+      const auto nPointPack = min<unsigned long>(PACK_SIZE, nPointDomain-iPointBegin);
 
-    numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+      GatherSourcePack(geometry, flowNodes, config, iPointBegin, nPointPack, desLength, pack);
 
-    /*--- Set intermittency ---*/
+      saNumerics->ComputeResidual(pack, config);
 
-    if (transition) {
-      numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
+      ScatterSourcePack(iPointBegin, nPointPack, pack);
     }
+  }
+  else {
+
+    /*--- Loop over all points. ---*/
+
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      /*--- Conservative variables w/o reconstruction ---*/
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+      numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
-    numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
-    numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
+      /*--- Gradient of the primitive and conservative variables ---*/
 
-    /*--- Set volume ---*/
+      numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
-    numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+      /*--- Set vorticity and strain rate magnitude ---*/
 
-    /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
+      numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
 
-    if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
+      numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
 
-      /*--- Set distance to the surface ---*/
+      /*--- Set intermittency ---*/
 
-      numerics->SetDistance(geometry->nodes->GetWall_Distance(iPoint), 0.0);
+      if (transition) {
+        numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
+      }
 
-    } else {
+      /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
 
-      /*--- Set DES length scale ---*/
+      numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
+      numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
 
-      numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
+      /*--- Set volume ---*/
 
-    }
+      numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
 
-    /*--- Compute the source term ---*/
+      /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+      if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
 
-    /*--- Store the intermittency ---*/
+        /*--- Set distance to the surface ---*/
 
-    if (transition_BC) {
-      nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
-    }
+        numerics->SetDistance(geometry->nodes->GetWall_Distance(iPoint), 0.0);
 
-    /*--- Subtract residual and the Jacobian ---*/
+      } else {
 
-    LinSysRes.SubtractBlock(iPoint, residual);
+        /*--- Set DES length scale ---*/
 
-    Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+        numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
+
+      }
+
+      /*--- Compute the source term ---*/
+
+      auto residual = numerics->ComputeResidual(config);
+
+      /*--- Store the intermittency ---*/
+
+      if (transition_BC) {
+        nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
+      }
+
+      /*--- Subtract residual and the Jacobian ---*/
+
+      LinSysRes.SubtractBlock(iPoint, residual);
+
+      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+
+    }
 
   }
 
@@ -450,7 +482,7 @@ void CTurbSASolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_conta
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -482,7 +514,7 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -511,7 +543,7 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Compute residuals and Jacobians ---*/
@@ -536,7 +568,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -546,7 +578,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
 
       /*--- Allocate the value at the inlet ---*/
 
@@ -618,7 +650,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -646,7 +678,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       if (dynamic_grid)
@@ -698,7 +730,7 @@ void CTurbSASolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_conta
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -726,7 +758,7 @@ void CTurbSASolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_conta
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Set grid movement ---*/
@@ -781,7 +813,7 @@ void CTurbSASolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_cont
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -791,7 +823,7 @@ void CTurbSASolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_cont
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
 
       /*--- Allocate the value at the infinity ---*/
 
@@ -877,7 +909,7 @@ void CTurbSASolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container,
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
     const auto GlobalIndex_donor = solver_container[FLOW_SOL]->GetDonorGlobalIndex(val_marker, iVertex);
     const auto GlobalIndex = geometry->nodes->GetGlobalIndex(iPoint);
 
@@ -891,7 +923,7 @@ void CTurbSASolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container,
 
     su2double Normal[MAXNDIM] = {0.0};
     for (auto iDim = 0u; iDim < nDim; iDim++)
-      Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+      Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
     conv_numerics->SetNormal(Normal);
 
     su2double Area = GeometryToolbox::Norm(nDim, Normal);
@@ -1022,13 +1054,13 @@ void CTurbSASolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_c
       const auto oldVertex = geometry->turbovertex[val_marker][iSpan][iVertex]->GetOldVertex();
 
       /*--- Index of the closest interior node ---*/
-      const auto Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][oldVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(oldVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Allocate the value at the inlet ---*/
@@ -1124,13 +1156,13 @@ void CTurbSASolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contain
       const auto oldVertex = geometry->turbovertex[val_marker][iSpan][iVertex]->GetOldVertex();
 
       /*--- Index of the closest interior node ---*/
-      const auto Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][oldVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(oldVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Allocate the value at the inlet ---*/
@@ -1204,7 +1236,7 @@ void CTurbSASolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_
   //#ifndef HAVE_MPI
   //
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
@@ -1232,7 +1264,7 @@ void CTurbSASolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_
   //        numerics->SetConservative(FlowPrimVar_i, FlowPrimVar_j);
   //
   //        /*--- Set the normal vector ---*/
-  //        geometry->vertex[val_marker][iVertex]->GetNormal(Vector);
+  //        geometry->vertexData[val_marker].GetNormal(iVertex, Vector);
   //        for (iDim = 0; iDim < nDim; iDim++)
   //          Vector[iDim] = -Vector[iDim];
   //        numerics->SetNormal(Vector);
@@ -1259,7 +1291,7 @@ void CTurbSASolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_
   //  /*--- Do the send process, by the moment we are sending each
   //   node individually, this must be changed ---*/
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
   //      /*--- Find the associate pair to the original node ---*/
@@ -1289,7 +1321,7 @@ void CTurbSASolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_
   //
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
   //
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
@@ -1334,7 +1366,7 @@ void CTurbSASolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_
   //        /*--- Set Flow Variables ---*/
   //        numerics->SetConservative(FlowPrimVar_i, FlowPrimVar_j);
   //
-  //        geometry->vertex[val_marker][iVertex]->GetNormal(Vector);
+  //        geometry->vertexData[val_marker].GetNormal(iVertex, Vector);
   //        for (iDim = 0; iDim < nDim; iDim++)
   //          Vector[iDim] = -Vector[iDim];
   //        numerics->SetNormal(Vector);
@@ -1367,7 +1399,7 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //#ifndef HAVE_MPI
   //
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
@@ -1395,7 +1427,7 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //        numerics->SetConservative(FlowPrimVar_i, FlowPrimVar_j);
   //
   //        /*--- Set the normal vector ---*/
-  //        geometry->vertex[val_marker][iVertex]->GetNormal(Vector);
+  //        geometry->vertexData[val_marker].GetNormal(iVertex, Vector);
   //        for (iDim = 0; iDim < nDim; iDim++)
   //          Vector[iDim] = -Vector[iDim];
   //        numerics->SetNormal(Vector);
@@ -1422,7 +1454,7 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //  /*--- Do the send process, by the moment we are sending each
   //   node individually, this must be changed ---*/
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
   //      /*--- Find the associate pair to the original node ---*/
@@ -1452,7 +1484,7 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //
   //  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
   //
-  //    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  //    iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
   //
   //    if (geometry->nodes->GetDomain(iPoint)) {
   //
@@ -1497,7 +1529,7 @@ void CTurbSASolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_
   //        /*--- Set Flow Variables ---*/
   //        numerics->SetConservative(FlowPrimVar_i, FlowPrimVar_j);
   //
-  //        geometry->vertex[val_marker][iVertex]->GetNormal(Vector);
+  //        geometry->vertexData[val_marker].GetNormal(iVertex, Vector);
   //        for (iDim = 0; iDim < nDim; iDim++)
   //          Vector[iDim] = -Vector[iDim];
   //        numerics->SetNormal(Vector);
@@ -1544,15 +1576,15 @@ void CTurbSASolver::SetNuTilde_WF(CGeometry *geometry, CSolver **solver_containe
 
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-    const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
     /*--- Compute dual-grid area and boundary normal ---*/
 
-    const auto Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+    const auto Normal = geometry->vertexData[val_marker].GetNormal(iVertex);
 
     su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
@@ -1884,13 +1916,13 @@ su2double CTurbSASolver::GetInletAtVertex(su2double *val_inlet,
 
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++){
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (iPoint == val_inlet_point) {
 
             /*-- Compute boundary face area for this vertex. ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++)
               Area += Normal[iDim]*Normal[iDim];
@@ -27,6 +27,7 @@
 
 #include "../../include/solvers/CTurbSSTSolver.hpp"
 #include "../../include/variables/CTurbSSTVariable.hpp"
+#include "../../include/numerics/turbulent/turb_sources.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -83,6 +84,7 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (SST model)." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    System.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Turb());
 
     if (config->GetKind_Linear_Solver_Prec() == LINELET) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -92,6 +94,9 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+    if (config->GetCoupled_Turb_Solve())
+      InitializeCoupledSystem(geometry, config);
+
     if (ReducerStrategy)
       EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
 
@@ -327,58 +332,84 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Loop over all points. ---*/
+  /*--- Evaluate the source terms by packs of points if the numerics support it. ---*/
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  auto sstNumerics = dynamic_cast<CSourcePieceWise_TurbSST*>(numerics);
 
-    /*--- Conservative variables w/o reconstruction ---*/
+  if ((sstNumerics != nullptr) && sstNumerics->SupportsPointPack(config)) {
 
-    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+    constexpr auto PACK_SIZE = TurbSourcePack::SIZE;
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+    TurbSourcePack pack;
 
-    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+    SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size,PACK_SIZE))
+    for (unsigned long iPointBegin = 0; iPointBegin < nPointDomain; iPointBegin += PACK_SIZE) {
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+      const auto nPointPack = min<unsigned long>(PACK_SIZE, nPointDomain-iPointBegin);
 
-    numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
-    numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
+      GatherSourcePack(geometry, flowNodes, config, iPointBegin, nPointPack, false, pack);
 
-    /*--- Set volume ---*/
+      sstNumerics->ComputeResidual(pack, config);
 
-    numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+      ScatterSourcePack(iPointBegin, nPointPack, pack);
+    }
+  }
+  else {
 
-    /*--- Set distance to the surface ---*/
+    /*--- Loop over all points. ---*/
 
-    numerics->SetDistance(geometry->nodes->GetWall_Distance(iPoint), 0.0);
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      /*--- Conservative variables w/o reconstruction ---*/
 
-    /*--- Menter's first blending function ---*/
+      numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
-    numerics->SetF1blending(nodes->GetF1blending(iPoint),0.0);
+      /*--- Gradient of the primitive and conservative variables ---*/
 
-    /*--- Menter's second blending function ---*/
+      numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
-    numerics->SetF2blending(nodes->GetF2blending(iPoint),0.0);
+      /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
 
-    /*--- Set vorticity and strain rate magnitude ---*/
+      numerics->SetTurbVar(nodes->GetSolution(iPoint), nullptr);
+      numerics->SetTurbVarGradient(nodes->GetGradient(iPoint), nullptr);
 
-    numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+      /*--- Set volume ---*/
 
-    numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+      numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+
+      /*--- Set distance to the surface ---*/
+
+      numerics->SetDistance(geometry->nodes->GetWall_Distance(iPoint), 0.0);
+
+      /*--- Menter's first blending function ---*/
 
-    /*--- Cross diffusion ---*/
+      numerics->SetF1blending(nodes->GetF1blending(iPoint),0.0);
 
-    numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint),0.0);
+      /*--- Menter's second blending function ---*/
 
-    /*--- Compute the source term ---*/
+      numerics->SetF2blending(nodes->GetF2blending(iPoint),0.0);
 
-    auto residual = numerics->ComputeResidual(config);
+      /*--- Set vorticity and strain rate magnitude ---*/
 
-    /*--- Subtract residual and the Jacobian ---*/
+      numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
 
-    LinSysRes.SubtractBlock(iPoint, residual);
-    Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+      numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+
+      /*--- Cross diffusion ---*/
+
+      numerics->SetCrossDiff(nodes->GetCrossDiff(iPoint),0.0);
+
+      /*--- Compute the source term ---*/
+
+      auto residual = numerics->ComputeResidual(config);
+
+      /*--- Subtract residual and the Jacobian ---*/
+
+      LinSysRes.SubtractBlock(iPoint, residual);
+      Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+
+    }
 
   }
 
@@ -394,13 +425,13 @@ void CTurbSSTSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_cont
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
     if (geometry->nodes->GetDomain(iPoint)) {
 
       /*--- distance to closest neighbor ---*/
-      const auto jPoint = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      const auto jPoint = geometry->vertexData[val_marker].GetNormal_Neighbor(iVertex);
 
       su2double distance2 = GeometryToolbox::SquaredDistance(nDim,
                                                              geometry->nodes->GetCoord(iPoint),
@@ -442,7 +473,7 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
@@ -468,7 +499,7 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Grid Movement ---*/
@@ -498,7 +529,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -508,7 +539,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Allocate the value at the inlet ---*/
@@ -586,7 +617,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertexData[val_marker].GetNode(iVertex);
 
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
 
@@ -615,7 +646,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(iVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       if (dynamic_grid)
@@ -689,13 +720,13 @@ void CTurbSSTSolver::BC_Inlet_MixingPlane(CGeometry *geometry, CSolver **solver_
       const auto oldVertex = geometry->turbovertex[val_marker][iSpan][iVertex]->GetOldVertex();
 
       /*--- Index of the closest interior node ---*/
-      const auto Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][oldVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(oldVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Allocate the value at the inlet ---*/
@@ -792,13 +823,13 @@ void CTurbSSTSolver::BC_Inlet_Turbo(CGeometry *geometry, CSolver **solver_contai
       const auto oldVertex = geometry->turbovertex[val_marker][iSpan][iVertex]->GetOldVertex();
 
       /*--- Index of the closest interior node ---*/
-      const auto Point_Normal = geometry->vertex[val_marker][oldVertex]->GetNormal_Neighbor();
+      const auto Point_Normal = geometry->vertexData[val_marker].GetNormal_Neighbor(oldVertex);
 
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[val_marker][oldVertex]->GetNormal(iDim);
+        Normal[iDim] = -geometry->vertexData[val_marker].GetNormal(oldVertex)[iDim];
       conv_numerics->SetNormal(Normal);
 
       /*--- Allocate the value at the inlet ---*/
@@ -892,13 +923,13 @@ su2double CTurbSSTSolver::GetInletAtVertex(su2double *val_inlet,
 
         for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++){
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
           if (iPoint == val_inlet_point) {
 
             /*-- Compute boundary face area for this vertex. ---*/
 
-            geometry->vertex[iMarker][iVertex]->GetNormal(Normal);
+            geometry->vertexData[iMarker].GetNormal(iVertex, Normal);
             Area = 0.0;
             for (iDim = 0; iDim < nDim; iDim++)
               Area += Normal[iDim]*Normal[iDim];
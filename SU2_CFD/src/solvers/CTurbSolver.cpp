@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSolver.hpp"
+#include "../../include/numerics/turbulent/turb_sources.hpp"
 #include "../../../Common/include/omp_structure.hpp"
 
 
@@ -310,6 +311,73 @@ void CTurbSolver::SumEdgeFluxes(CGeometry* geometry) {
 
 }
 
+void CTurbSolver::GatherSourcePack(const CGeometry *geometry, CVariable *flowNodes, const CConfig *config,
+                                   unsigned long iPointBegin, unsigned long nPointPack, bool desLength,
+                                   TurbSourcePack& pack) const {
+
+  const bool incompressible = (config->GetKind_Regime() == INCOMPRESSIBLE);
+
+  for (auto iLane = 0ul; iLane < TurbSourcePack::SIZE; ++iLane) {
+
+    const auto iPoint = iPointBegin + ((iLane < nPointPack)? iLane : 0);
+
+    const auto V = flowNodes->GetPrimitive(iPoint);
+
+    pack.Density[iLane] = V[nDim+2];
+    pack.Pressure[iLane] = V[nDim+1];
+    pack.LamVisc[iLane] = incompressible? V[nDim+4] : V[nDim+5];
+    pack.EddyVisc[iLane] = incompressible? V[nDim+5] : V[nDim+6];
+
+    const auto Vorticity = flowNodes->GetVorticity(iPoint);
+    for (auto iDim = 0u; iDim < 3; ++iDim)
+      pack.Vorticity[iDim][iLane] = Vorticity[iDim];
+    pack.StrainMag[iLane] = flowNodes->GetStrainMag(iPoint);
+
+    const auto Grad = flowNodes->GetGradient_Primitive(iPoint);
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      for (auto jDim = 0u; jDim < nDim; ++jDim)
+        pack.VelocityGrad[iDim][jDim][iLane] = Grad[iDim+1][jDim];
+
+    const auto TurbVar = nodes->GetSolution(iPoint);
+    const auto TurbVarGrad = nodes->GetGradient(iPoint);
+    for (auto iVar = 0u; iVar < nVar; ++iVar)
+      pack.TurbVar[iVar][iLane] = TurbVar[iVar];
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      pack.TurbVarGrad[iDim][iLane] = TurbVarGrad[0][iDim];
+
+    pack.F1[iLane] = nodes->GetF1blending(iPoint);
+    pack.F2[iLane] = nodes->GetF2blending(iPoint);
+    pack.CrossDiff[iLane] = nodes->GetCrossDiff(iPoint);
+
+    pack.Distance[iLane] = desLength? nodes->GetDES_LengthScale(iPoint) : geometry->nodes->GetWall_Distance(iPoint);
+    pack.Volume[iLane] = geometry->nodes->GetVolume(iPoint);
+  }
+}
+
+void CTurbSolver::ScatterSourcePack(unsigned long iPointBegin, unsigned long nPointPack, const TurbSourcePack& pack) {
+
+  su2double residual[MAXNVAR];
+  su2double jacData[MAXNVAR][MAXNVAR];
+  su2double *jacobian[MAXNVAR];
+
+  for (auto iVar = 0u; iVar < nVar; ++iVar)
+    jacobian[iVar] = jacData[iVar];
+
+  for (auto iLane = 0ul; iLane < nPointPack; ++iLane) {
+
+    const auto iPoint = iPointBegin + iLane;
+
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      residual[iVar] = pack.Residual[iVar][iLane];
+      for (auto jVar = 0u; jVar < nVar; ++jVar)
+        jacData[iVar][jVar] = pack.Jacobian[iVar][jVar][iLane];
+    }
+
+    LinSysRes.SubtractBlock(iPoint, residual);
+    Jacobian.SubtractBlock2Diag(iPoint, jacobian);
+  }
+}
+
 void CTurbSolver::BC_Sym_Plane(CGeometry      *geometry,
                                CSolver        **solver_container,
                                CNumerics      *conv_numerics,
@@ -420,16 +488,16 @@ void CTurbSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_conta
     SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for (auto iVertex = 0u; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
 
       if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      const auto Point_Normal = geometry->vertex[iMarker][iVertex]->GetNormal_Neighbor();
+      const auto Point_Normal = geometry->vertexData[iMarker].GetNormal_Neighbor(iVertex);
       const auto nDonorVertex = GetnSlidingStates(iMarker,iVertex);
 
       su2double Normal[MAXNDIM] = {0.0};
       for (auto iDim = 0u; iDim < nDim; iDim++)
-        Normal[iDim] = -geometry->vertex[iMarker][iVertex]->GetNormal()[iDim];
+        Normal[iDim] = -geometry->vertexData[iMarker].GetNormal(iVertex)[iDim];
 
       su2double* PrimVar_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
@@ -512,8 +580,31 @@ void CTurbSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_conta
 
 void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint() || (config->GetDiscrete_Adjoint() && config->GetFrozen_Visc_Disc());
-  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  if (config->GetCoupled_Turb_Solve()) {
+
+    /*--- Solve for the flow and turbulence increments together, this also updates the flow solution. ---*/
+
+    SolveCoupledSystem(geometry, solver_container, config);
+  }
+  else {
+
+    /*--- Solve or smooth the linear system ---*/
+
+    auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+    SU2_OMP_MASTER
+    {
+      SetIterLinSolver(iter);
+      SetResLinSolver(System.GetResidual());
+    }
+    SU2_OMP_BARRIER
+  }
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
@@ -579,17 +670,14 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
     for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
       LinSysSol.SetBlock_Zero(iPoint);
   }
+}
 
-  /*--- Solve or smooth the linear system ---*/
+void CTurbSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
-  SU2_OMP_BARRIER
+  const bool adjoint = config->GetContinuous_Adjoint() || (config->GetDiscrete_Adjoint() && config->GetFrozen_Visc_Disc());
+  const bool compressible = (config->GetKind_Regime() == COMPRESSIBLE);
 
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -651,6 +739,174 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
 }
 
+void CTurbSolver::InitializeCoupledSystem(CGeometry *geometry, CConfig *config) {
+
+  /*--- The flow variables go first in the blocks. ---*/
+
+  const unsigned short nVarCoupled = nDim+2 + nVar;
+
+  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (coupled flow and turbulence)." << endl;
+  CoupledJacobian.Initialize(nPoint, nPointDomain, nVarCoupled, nVarCoupled, true, geometry, config);
+  CoupledSystem.SetPreconditionerReuse(config->GetLinear_Solver_Prec_Reuse_Flow());
+
+  if (config->GetKind_Linear_Solver_Prec() == LINELET)
+    CoupledJacobian.BuildLineletPreconditioner(geometry, config);
+
+  CoupledLinSysSol.Initialize(nPoint, nPointDomain, nVarCoupled, 0.0);
+  CoupledLinSysRes.Initialize(nPoint, nPointDomain, nVarCoupled, 0.0);
+}
+
+void CTurbSolver::SolveCoupledSystem(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  CSolver* flowSolver = solver_container[FLOW_SOL];
+  CVariable* flowNodes = flowSolver->GetNodes();
+
+  const unsigned short nVarFlow = flowSolver->GetnVar();
+  const bool conservative = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
+
+  /*--- The diagonal sub-blocks are the Jacobians of each solver. ---*/
+
+  CoupledJacobian.SetSubMatrix(flowSolver->Jacobian, 0, 0);
+  CoupledJacobian.SetSubMatrix(Jacobian, nVarFlow, nVarFlow);
+
+  /*--- The turbulence rows of the flow columns are the derivatives of the upwind convective
+   *    flux (a0*T_i + a1*T_j, T = nu_tilde or rho*k, rho*omega) w.r.t. the conservative flow
+   *    variables, through the face velocity q_ij = 0.5*(u_i+u_j).n. The other couplings (eddy
+   *    viscosity in the flow equations, flow variables in the turbulence diffusion and sources,
+   *    and boundary fluxes) are neglected. Each thread sets entire rows, hence the point loop. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    /*--- Rows replaced by a strong boundary condition (e.g. walls) have no off-diagonal
+     *    entries, they must remain decoupled for the condition to hold. ---*/
+
+    bool coupledVar[MAXNVAR] = {false};
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+      const unsigned long jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          coupledVar[iVar] |= (Jacobian.GetBlock(iPoint, jPoint, iVar, jVar) != 0.0);
+    }
+
+    su2double Jacobian_ii[MAXNVAR*MAXNVARFLOW] = {0.0};
+
+    const su2double* V_i = flowNodes->GetPrimitive(iPoint);
+
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+
+      const unsigned long jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+      const unsigned long iEdge = geometry->nodes->GetEdge(iPoint, iNeigh);
+      const su2double* V_j = flowNodes->GetPrimitive(jPoint);
+
+      /*--- Orient the normal out of iPoint, the flux then has the sign of the residual of iPoint. ---*/
+
+      const su2double sign = (geometry->edges->GetNode(iEdge,0) == iPoint)? 1.0 : -1.0;
+      su2double Normal[MAXNDIM] = {0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Normal[iDim] = sign * geometry->edges->GetNormal(iEdge)[iDim];
+
+      su2double ProjVel_i = 0.0, ProjVel_j = 0.0, ProjGridVel = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        ProjVel_i += V_i[iDim+1]*Normal[iDim];
+        ProjVel_j += V_j[iDim+1]*Normal[iDim];
+      }
+      if (dynamic_grid) {
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          ProjGridVel += 0.5*(geometry->nodes->GetGridVel(iPoint)[iDim] +
+                              geometry->nodes->GetGridVel(jPoint)[iDim])*Normal[iDim];
+      }
+      const su2double q_ij = 0.5*(ProjVel_i+ProjVel_j) - ProjGridVel;
+
+      /*--- The flux depends on the face velocity through the upwind turbulence variables. ---*/
+
+      const unsigned long upwPoint = (q_ij > 0.0)? iPoint : jPoint;
+      const su2double density = conservative? flowNodes->GetDensity(upwPoint) : 1.0;
+
+      su2double TurbVar[MAXNVAR] = {0.0};
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        if (coupledVar[iVar]) TurbVar[iVar] = density * nodes->GetSolution(upwPoint, iVar);
+
+      /*--- dq_ij/drho_k = -0.5*(u_k.n)/rho_k, dq_ij/d(rho*u_k) = 0.5*n/rho_k, and 0 for the energy.
+       *    For SST the flux is q_ij*rho*k (rho*omega) with k (omega) as unknowns, its derivative
+       *    w.r.t. the density of the upwind point through rho*k, q_ij*k, is also neglected. ---*/
+
+      auto addFluxDerivative = [&](const su2double* V, su2double ProjVel, su2double* block) {
+        const su2double halfInvRho = 0.5/V[nDim+2];
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          su2double* row = &block[iVar*nVarFlow];
+          row[0] -= TurbVar[iVar]*ProjVel*halfInvRho;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            row[iDim+1] += TurbVar[iVar]*Normal[iDim]*halfInvRho;
+        }
+      };
+
+      su2double Jacobian_ij[MAXNVAR*MAXNVARFLOW] = {0.0};
+      addFluxDerivative(V_i, ProjVel_i, Jacobian_ii);
+      addFluxDerivative(V_j, ProjVel_j, Jacobian_ij);
+
+      CoupledJacobian.SetSubBlock(iPoint, jPoint, nVarFlow, 0, nVar, nVarFlow, Jacobian_ij);
+    }
+
+    CoupledJacobian.SetSubBlock(iPoint, iPoint, nVarFlow, 0, nVar, nVarFlow, Jacobian_ii);
+  }
+
+  /*--- Right hand side and initial guess, the flow and turbulence systems were prepared. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+      CoupledLinSysRes(iPoint,iVar) = flowSolver->LinSysRes(iPoint,iVar);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      CoupledLinSysRes(iPoint,nVarFlow+iVar) = LinSysRes(iPoint,iVar);
+    CoupledLinSysSol.SetBlock_Zero(iPoint);
+  }
+
+  SU2_OMP(sections)
+  {
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      CoupledLinSysRes.SetBlock_Zero(iPoint);
+
+    SU2_OMP(section)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      CoupledLinSysSol.SetBlock_Zero(iPoint);
+  }
+
+  /*--- Solve or smooth the linear system, with the settings of the flow system. ---*/
+
+  auto iter = CoupledSystem.Solve(CoupledJacobian, CoupledLinSysRes, CoupledLinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(CoupledSystem.GetResidual());
+    flowSolver->SetIterLinSolver(iter);
+    flowSolver->SetResLinSolver(CoupledSystem.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Split the increments. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+      flowSolver->LinSysSol(iPoint,iVar) = CoupledLinSysSol(iPoint,iVar);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      LinSysSol(iPoint,iVar) = CoupledLinSysSol(iPoint,nVarFlow+iVar);
+  }
+
+  /*--- Update the flow solution, this communicates it to the halos. Only the primitive variables
+   *    are recomputed (the halos included), the turbulence update (SST) and the eddy viscosity need
+   *    the new density and viscosity, the rest of the flow preprocessing (gradients, fixed CL, etc.)
+   *    is done at the start of the next iteration, as in the segregated iteration. ---*/
+
+  flowSolver->CompleteImplicitIteration(geometry, solver_container, config);
+
+  flowSolver->SetPrimitive_Variables(solver_container, config, false);
+
+}
+
 void CTurbSolver::ComputeUnderRelaxationFactor(CSolver **solver_container, CConfig *config) {
 
   /* Only apply the turbulent under-relaxation to the SA variants. The
@@ -864,8 +1120,8 @@ void CTurbSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_con
 
           /*--- Get the index for node i plus the boundary face normal ---*/
 
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+          iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
+          Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           /*--- Grid velocities stored at boundary node i ---*/
 
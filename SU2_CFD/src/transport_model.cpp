@@ -27,6 +27,7 @@
 
 
 #include "../include/transport_model.hpp"
+#include "../../Common/include/omp_structure.hpp"
 
 CViscosityModel::CViscosityModel(void) {
 
@@ -40,6 +41,17 @@ CViscosityModel::CViscosityModel(void) {
 
 CViscosityModel::~CViscosityModel(void) { }
 
+void CViscosityModel::ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                       su2double *mu, su2double *dmudrho, su2double *dmudT) {
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    SetViscosity(T[iPoint], rho[iPoint]);
+    SetDerViscosity(T[iPoint], rho[iPoint]);
+    mu[iPoint] = Mu;
+    dmudrho[iPoint] = dmudrho_T;
+    dmudT[iPoint] = dmudT_rho;
+  }
+}
+
 
 CConstantViscosity::CConstantViscosity(void) : CViscosityModel() { }
 
@@ -55,6 +67,16 @@ CConstantViscosity::CConstantViscosity(su2double mu_const) : CViscosityModel() {
 
 CConstantViscosity::~CConstantViscosity(void) { }
 
+void CConstantViscosity::ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                          su2double *mu, su2double *dmudrho, su2double *dmudT) {
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    mu[iPoint] = Mu;
+    dmudrho[iPoint] = 0.0;
+    dmudT[iPoint] = 0.0;
+  }
+}
+
 
 
 
@@ -95,6 +117,25 @@ void CSutherland::SetDerViscosity(su2double T, su2double rho) {
 
 }
 
+void CSutherland::ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                   su2double *mu, su2double *dmudrho, su2double *dmudT) {
+
+  /*--- Same expressions as SetViscosity and SetDerViscosity. ---*/
+
+  const su2double T_refInv = 1.0/T_ref;
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const su2double TnonDim = T[iPoint]/T_ref;
+    mu[iPoint] = Mu_ref*TnonDim*sqrt(TnonDim)*((T_ref + S)/(T[iPoint] + S));
+
+    const su2double TnonDimDer = T_refInv*T[iPoint];
+    const su2double TSInv = 1.0/(T[iPoint] + S);
+    dmudrho[iPoint] = 0.0;
+    dmudT[iPoint] = Mu_ref*(T_ref + S)*TSInv*sqrt(TnonDimDer) * (1.5*T_refInv - TnonDimDer*TSInv);
+  }
+}
+
 CPolynomialViscosity::CPolynomialViscosity(void) : CViscosityModel() {
   nPolyCoeffs = 0;
   b           = nullptr;
@@ -126,6 +167,22 @@ void CPolynomialViscosity::SetViscosity(su2double T, su2double rho) {
   
 }
 
+void CPolynomialViscosity::ComputeViscosity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                            su2double *mu, su2double *dmudrho, su2double *dmudT) {
+
+  /*--- Horner's scheme, the derivatives are not computed (as in the scalar version). ---*/
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    su2double val = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; iVar--)
+      val = val*T[iPoint] + b[iVar];
+    mu[iPoint] = val;
+    dmudrho[iPoint] = dmudrho_T;
+    dmudT[iPoint] = dmudT_rho;
+  }
+}
+
 /*-------------------------------------------------*/
 /*---------- Thermal Conductivity Models ----------*/
 /*-------------------------------------------------*/
@@ -142,6 +199,19 @@ CConductivityModel::CConductivityModel(void) {
 
 CConductivityModel::~CConductivityModel(void) { }
 
+void CConductivityModel::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                             const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                             const su2double *dmudrho, const su2double *dmudT,
+                                             su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    SetConductivity(T[iPoint], rho[iPoint], mu_lam[iPoint], mu_turb, cp);
+    SetDerConductivity(T[iPoint], rho[iPoint], dmudrho[iPoint], dmudT[iPoint], cp);
+    kt[iPoint] = Kt;
+    dktdrho[iPoint] = dktdrho_T;
+    dktdT[iPoint] = dktdT_rho;
+  }
+}
+
 
 CConstantConductivity::CConstantConductivity(void) : CConductivityModel() { }
 
@@ -157,6 +227,18 @@ CConstantConductivity::CConstantConductivity(su2double kt_const) : CConductivity
 
 CConstantConductivity::~CConstantConductivity(void) { }
 
+void CConstantConductivity::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                                const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                                const su2double *dmudrho, const su2double *dmudT,
+                                                su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    kt[iPoint] = Kt;
+    dktdrho[iPoint] = 0.0;
+    dktdT[iPoint] = 0.0;
+  }
+}
+
 CConstantConductivityRANS::CConstantConductivityRANS(void) : CConductivityModel() { }
 
 CConstantConductivityRANS::CConstantConductivityRANS(su2double kt_const, su2double pr_turb) : CConductivityModel() {
@@ -179,6 +261,20 @@ void CConstantConductivityRANS::SetConductivity(su2double T, su2double rho, su2d
 
 CConstantConductivityRANS::~CConstantConductivityRANS(void) { }
 
+void CConstantConductivityRANS::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                                    const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                                    const su2double *dmudrho, const su2double *dmudT,
+                                                    su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  const su2double val = Kt_Lam + cp*mu_turb/Prandtl_Turb;
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    kt[iPoint] = val;
+    dktdrho[iPoint] = dktdrho_T;
+    dktdT[iPoint] = dktdT_rho;
+  }
+}
+
 CConstantPrandtl::CConstantPrandtl(void) : CConductivityModel() { }
 
 CConstantPrandtl::CConstantPrandtl(su2double pr_const) : CConductivityModel() {
@@ -204,6 +300,18 @@ void CConstantPrandtl::SetDerConductivity(su2double T, su2double rho, su2double
 
 CConstantPrandtl::~CConstantPrandtl(void) { }
 
+void CConstantPrandtl::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                           const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                           const su2double *dmudrho, const su2double *dmudT,
+                                           su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    kt[iPoint] = mu_lam[iPoint]*cp/Pr_const;
+    dktdrho[iPoint] = dmudrho[iPoint]*cp/Pr_const;
+    dktdT[iPoint] = dmudT[iPoint]*cp/Pr_const;
+  }
+}
+
 CConstantPrandtlRANS::CConstantPrandtlRANS(void) : CConductivityModel() { }
 
 CConstantPrandtlRANS::CConstantPrandtlRANS(su2double pr_lam, su2double pr_turb) : CConductivityModel() {
@@ -222,6 +330,18 @@ void CConstantPrandtlRANS::SetConductivity(su2double T, su2double rho, su2double
 
 CConstantPrandtlRANS::~CConstantPrandtlRANS(void) { }
 
+void CConstantPrandtlRANS::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                               const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                               const su2double *dmudrho, const su2double *dmudT,
+                                               su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    kt[iPoint] = cp * ((mu_lam[iPoint]/Prandtl_Lam) + (mu_turb/Prandtl_Turb));
+    dktdrho[iPoint] = dktdrho_T;
+    dktdT[iPoint] = dktdT_rho;
+  }
+}
+
 CPolynomialConductivity::CPolynomialConductivity(void) : CConductivityModel() {
   nPolyCoeffs = 0;
   b           = nullptr;
@@ -253,6 +373,21 @@ void CPolynomialConductivity::SetConductivity(su2double T, su2double rho, su2dou
   
 }
 
+void CPolynomialConductivity::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                                  const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                                  const su2double *dmudrho, const su2double *dmudT,
+                                                  su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    su2double val = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; iVar--)
+      val = val*T[iPoint] + b[iVar];
+    kt[iPoint] = val;
+    dktdrho[iPoint] = dktdrho_T;
+    dktdT[iPoint] = dktdT_rho;
+  }
+}
+
 CPolynomialConductivityRANS::CPolynomialConductivityRANS(unsigned short val_nCoeffs, const su2double* val_b, su2double pr_turb) : CConductivityModel() {
   
   /*--- Attributes initialization ---*/
@@ -285,3 +420,20 @@ void CPolynomialConductivityRANS::SetConductivity(su2double T, su2double rho, su
   
 }
 
+void CPolynomialConductivityRANS::ComputeConductivity(unsigned long nPoint, const su2double *T, const su2double *rho,
+                                                      const su2double *mu_lam, su2double mu_turb, su2double cp,
+                                                      const su2double *dmudrho, const su2double *dmudT,
+                                                      su2double *kt, su2double *dktdrho, su2double *dktdT) {
+  const su2double turb = cp*mu_turb/Prandtl_Turb;
+
+  SU2_OMP_SIMD
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    su2double val = b[nPolyCoeffs-1];
+    for (int iVar = nPolyCoeffs-2; iVar >= 0; iVar--)
+      val = val*T[iPoint] + b[iVar];
+    kt[iPoint] = val + turb;
+    dktdrho[iPoint] = dktdrho_T;
+    dktdT[iPoint] = dktdT_rho;
+  }
+}
+
@@ -193,6 +193,63 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+unsigned long CEulerVariable::SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd, CFluidModel *FluidModel) {
+
+  const unsigned long nBatch = iPointEnd - iPointBegin;
+  assert(nBatch <= MAXBATCH);
+
+  su2double density[MAXBATCH], staticEnergy[MAXBATCH], pressure[MAXBATCH], temperature[MAXBATCH],
+            soundSpeed2[MAXBATCH], dPdrho_e[MAXBATCH], dPde_rho[MAXBATCH], dTdrho_e[MAXBATCH], dTde_rho[MAXBATCH];
+
+  for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+    SetVelocity(iPoint);   // Computes velocity and velocity^2
+    density[iPoint-iPointBegin] = GetDensity(iPoint);
+    staticEnergy[iPoint-iPointBegin] = GetEnergy(iPoint)-0.5*Velocity2(iPoint);
+  }
+
+  CFluidBatch state;
+  state.Pressure = pressure;
+  state.Temperature = temperature;
+  state.SoundSpeed2 = soundSpeed2;
+  state.dPdrho_e = dPdrho_e;
+  state.dPde_rho = dPde_rho;
+  state.dTdrho_e = dTdrho_e;
+  state.dTde_rho = dTde_rho;
+
+  FluidModel->ComputeState_rhoe(nBatch, density, staticEnergy, state);
+
+  unsigned long nonPhysicalPoints = 0;
+
+  for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+    const auto k = iPoint-iPointBegin;
+
+    bool check_dens  = SetDensity(iPoint);
+    bool check_press = SetPressure(iPoint, pressure[k]);
+    bool check_sos   = SetSoundSpeed(iPoint, soundSpeed2[k]);
+    bool check_temp  = SetTemperature(iPoint, temperature[k]);
+
+    /*--- Non-physical states fall back to the point-wise update from the old solution. ---*/
+
+    if (check_dens || check_press || check_sos || check_temp) {
+
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        Solution(iPoint, iVar) = Solution_Old(iPoint, iVar);
+
+      SetPrimVar(iPoint, FluidModel);
+      SetSecondaryVar(iPoint, FluidModel);
+      nonPhysicalPoints++;
+      continue;
+    }
+
+    SetEnthalpy(iPoint); // Requires pressure computation.
+
+    SetdPdrho_e(iPoint, dPdrho_e[k]);
+    SetdPde_rho(iPoint, dPde_rho[k]);
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
@@ -253,6 +253,92 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
   return RightVol;
 }
 
+unsigned long CNSVariable::SetPrimVar(unsigned long iPointBegin, unsigned long iPointEnd, const su2double *eddy_visc,
+                                      const su2double *turb_ke, CFluidModel *FluidModel) {
+
+  const unsigned long nBatch = iPointEnd - iPointBegin;
+  assert(nBatch <= MAXBATCH);
+
+  su2double density[MAXBATCH], staticEnergy[MAXBATCH], pressure[MAXBATCH], temperature[MAXBATCH],
+            soundSpeed2[MAXBATCH], dPdrho_e[MAXBATCH], dPde_rho[MAXBATCH], dTdrho_e[MAXBATCH], dTde_rho[MAXBATCH];
+  bool nonPhysical[MAXBATCH];
+
+  for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+    SetVelocity(iPoint); // Computes velocity and velocity^2
+    density[iPoint-iPointBegin] = GetDensity(iPoint);
+    staticEnergy[iPoint-iPointBegin] = GetEnergy(iPoint)-0.5*Velocity2(iPoint) - turb_ke[iPoint-iPointBegin];
+  }
+
+  CFluidBatch state;
+  state.Pressure = pressure;
+  state.Temperature = temperature;
+  state.SoundSpeed2 = soundSpeed2;
+  state.dPdrho_e = dPdrho_e;
+  state.dPde_rho = dPde_rho;
+  state.dTdrho_e = dTdrho_e;
+  state.dTde_rho = dTde_rho;
+
+  FluidModel->ComputeState_rhoe(nBatch, density, staticEnergy, state);
+
+  unsigned long nonPhysicalPoints = 0;
+
+  for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+    const auto k = iPoint-iPointBegin;
+
+    bool check_dens  = SetDensity(iPoint);
+    bool check_press = SetPressure(iPoint, pressure[k]);
+    bool check_sos   = SetSoundSpeed(iPoint, soundSpeed2[k]);
+    bool check_temp  = SetTemperature(iPoint, temperature[k]);
+
+    /*--- Non-physical states fall back to the point-wise update from the old solution. ---*/
+
+    nonPhysical[k] = check_dens || check_press || check_sos || check_temp;
+
+    if (nonPhysical[k]) {
+
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        Solution(iPoint,iVar) = Solution_Old(iPoint,iVar);
+
+      SetPrimVar(iPoint, eddy_visc[k], turb_ke[k], FluidModel);
+      SetSecondaryVar(iPoint, FluidModel);
+      density[k] = GetDensity(iPoint);
+      temperature[k] = GetTemperature(iPoint);
+      nonPhysicalPoints++;
+      continue;
+    }
+
+    SetEnthalpy(iPoint); // Requires pressure computation.
+    SetEddyViscosity(iPoint, eddy_visc[k]);
+    SetSpecificHeatCp(iPoint, FluidModel->GetCp());
+
+    SetdPdrho_e(iPoint, dPdrho_e[k]);
+    SetdPde_rho(iPoint, dPde_rho[k]);
+    SetdTdrho_e(iPoint, dTdrho_e[k]);
+    SetdTde_rho(iPoint, dTde_rho[k]);
+  }
+
+  /*--- Transport properties, those of the fallback points were already set. ---*/
+
+  su2double mu[MAXBATCH], dmudrho[MAXBATCH], dmudT[MAXBATCH], kt[MAXBATCH], dktdrho[MAXBATCH], dktdT[MAXBATCH];
+
+  FluidModel->ComputeTransport(nBatch, temperature, density, mu, dmudrho, dmudT, kt, dktdrho, dktdT);
+
+  for (unsigned long iPoint = iPointBegin; iPoint < iPointEnd; iPoint++) {
+    const auto k = iPoint-iPointBegin;
+    if (nonPhysical[k]) continue;
+
+    SetLaminarViscosity(iPoint, mu[k]);
+    SetThermalConductivity(iPoint, kt[k]);
+
+    Setdmudrho_T(iPoint, dmudrho[k]);
+    SetdmudT_rho(iPoint, dmudT[k]);
+    Setdktdrho_T(iPoint, dktdrho[k]);
+    SetdktdT_rho(iPoint, dktdT[k]);
+  }
+
+  return nonPhysicalPoints;
+}
+
 void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
     /*--- Compute secondary thermodynamic properties (partial derivatives...) ---*/
@@ -348,7 +348,8 @@ int main(int argc, char *argv[]) {
     if (config_container[iZone]->GetVisualize_Volume_Def()){
       for (unsigned short iFile = 0; iFile < config_container[iZone]->GetnVolumeOutputFiles(); iFile++){
         unsigned short* FileFormat = config_container[iZone]->GetVolumeOutputFiles();
-        if (FileFormat[iFile] != RESTART_ASCII && FileFormat[iFile] != RESTART_BINARY)
+        if (FileFormat[iFile] != RESTART_ASCII && FileFormat[iFile] != RESTART_BINARY &&
+            FileFormat[iFile] != TIME_SERIES)
           output[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone], FileFormat[iFile]);
       }
     } 
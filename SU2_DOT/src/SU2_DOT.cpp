@@ -628,10 +628,10 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
           if (config->GetMarker_All_DV(iMarker) == YES) {
             for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
 
-              iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+              iPoint = geometry->vertexData[iMarker].GetNode(iVertex);
               if ((iPoint < geometry->GetnPointDomain()) && UpdatePoint[iPoint]) {
 
-                Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+                Normal = geometry->vertexData[iMarker].GetNormal(iVertex);
                 VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
                 Sensitivity = geometry->vertex[iMarker][iVertex]->GetAuxVar();
 
@@ -745,10 +745,10 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
     if (config->GetMarker_All_DV(iMarker) == YES) {
       nVertex = geometry->nVertex[iMarker];
       for (iVertex = 0; iVertex <nVertex; iVertex++) {
-        iPoint      = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint      = geometry->vertexData[iMarker].GetNode(iVertex);
         if (!visited[iPoint]){
           VarCoord    = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-          Normal      = geometry->vertex[iMarker][iVertex]->GetNormal();
+          Normal      = geometry->vertexData[iMarker].GetNormal(iVertex);
 
           Area = 0.0;
           for (iDim = 0; iDim < nDim; iDim++){
@@ -907,8 +907,8 @@ void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned shor
         nVertex = geometry[iZone][INST_0]->GetnVertex(iMarker);
 
         for (iVertex = 0; iVertex < nVertex; iVertex++) {
-          iPoint = geometry[iZone][INST_0]->vertex[iMarker][iVertex]->GetNode();
-          Normal = geometry[iZone][INST_0]->vertex[iMarker][iVertex]->GetNormal();
+          iPoint = geometry[iZone][INST_0]->vertexData[iMarker].GetNode(iVertex);
+          Normal = geometry[iZone][INST_0]->vertexData[iMarker].GetNormal(iVertex);
           Prod = 0.0;
           Area = 0.0;
           for (iDim = 0; iDim < nDim; iDim++) {
@@ -958,6 +958,7 @@ void SetSensitivity_Files(CGeometry ***geometry, CConfig **config, unsigned shor
       unsigned short* FileFormat = config[iZone]->GetVolumeOutputFiles();
       if (FileFormat[iFile] != RESTART_ASCII &&
           FileFormat[iFile] != RESTART_BINARY &&
+          FileFormat[iFile] != TIME_SERIES &&
           FileFormat[iFile] != CSV)
         output->WriteToFile(config[iZone], geometry[iZone][INST_0], FileFormat[iFile]);
     }
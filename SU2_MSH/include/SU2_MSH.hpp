@@ -39,5 +39,6 @@
 #include "../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../Common/include/CConfig.hpp"
 #include "../../Common/include/grid_adaptation_structure.hpp"
+#include "../../Common/include/CDistributedGridAdaptation.hpp"
 
 using namespace std;
@@ -164,7 +164,18 @@ int main(int argc, char *argv[]) {
 		/*-- Definition of the Class for grid adaptation ---*/
     
 		CGridAdaptation *grid_adaptation;
-		grid_adaptation = new CGridAdaptation(geometry_container[ZONE_0], config_container[ZONE_0]);
+    CDistributedGridAdaptation *dist_adaptation = nullptr;
+    const bool distributed = config_container[ZONE_0]->GetAdapt_Distributed();
+
+    if (distributed) {
+      if (config_container[ZONE_0]->GetKind_Adaptation() == SMOOTHING)
+        SU2_MPI::Error("The distributed grid adaptation does not support SMOOTHING.", CURRENT_FUNCTION);
+      dist_adaptation = new CDistributedGridAdaptation(geometry_container[ZONE_0], config_container[ZONE_0]);
+      grid_adaptation = dist_adaptation;
+    }
+    else {
+      grid_adaptation = new CGridAdaptation(geometry_container[ZONE_0], config_container[ZONE_0]);
+    }
 		
 		/*--- Read the flow solution and/or the adjoint solution
 		 and choose the elements to adapt ---*/
@@ -219,6 +230,21 @@ int main(int argc, char *argv[]) {
 				cout << "The adaptation is not defined" << endl;
 		}
 		
+    if (distributed) {
+
+      /*--- Divide the selected elements of each partition ---*/
+
+      dist_adaptation->SetDistributed_Adaptation(geometry_container[ZONE_0], config_container[ZONE_0]);
+
+      /*--- Write the new adapted grid and the interpolated solution ---*/
+
+      dist_adaptation->WriteAdaptedGrid(config_container[ZONE_0], config_container[ZONE_0]->GetMesh_Out_FileName());
+      dist_adaptation->WriteAdaptedSolution(config_container[ZONE_0], config_container[ZONE_0]->GetRestart_FileName(), false);
+      dist_adaptation->WriteAdaptedSolution(config_container[ZONE_0], config_container[ZONE_0]->GetRestart_AdjFileName(), true);
+
+    }
+    else {
+
 		/*--- Perform an homothetic adaptation of the grid ---*/
     
 		CPhysicalGeometry *geo_adapt; geo_adapt = new CPhysicalGeometry;
@@ -270,6 +296,8 @@ int main(int argc, char *argv[]) {
 				|| (config_container[ZONE_0]->GetKind_Adaptation() == FULL_ADJOINT) || (config_container[ZONE_0]->GetKind_Adaptation() == COMPUTABLE) ||
 				(config_container[ZONE_0]->GetKind_Adaptation() == REMAINING))
 			grid_adaptation->SetRestart_AdjSolution(config_container[ZONE_0], geo_adapt, config_container[ZONE_0]->GetRestart_AdjFileName());
+
+    }
 		
 	}
   
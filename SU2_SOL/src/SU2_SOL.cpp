@@ -815,6 +815,7 @@ void WriteFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container
     unsigned short* FileFormat = config->GetVolumeOutputFiles();
     if (FileFormat[iFile] != RESTART_ASCII &&
         FileFormat[iFile] != RESTART_BINARY &&
+        FileFormat[iFile] != TIME_SERIES &&
         FileFormat[iFile] != CSV)
       output->WriteToFile(config, geometry, FileFormat[iFile]);
   }
@@ -29,7 +29,7 @@
 #include <sstream>
 #include <iomanip>
 #include "../../../Common/include/geometry/dual_grid/CEdge.hpp"
-#include "../../../Common/include/geometry/dual_grid/CVertex.hpp"
+#include "../../../Common/include/geometry/dual_grid/CVertexData.hpp"
 
 TEST_CASE("Volume Computation", "[Dual Grid]") {
   
@@ -54,19 +54,19 @@ TEST_CASE("Volume Computation", "[Dual Grid]") {
     REQUIRE(volume == Approx(0.000546832));
   }
   
-  CVertex vertex2d(0, 2);
+  CVertexData vertex2d(1, 2);
   SECTION("2D Vertex"){
-    vertex2d.SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG);
-    REQUIRE(vertex2d.GetNormal()[0] == Approx(-1.696));
-    REQUIRE(vertex2d.GetNormal()[1] == Approx(1.1097));
+    vertex2d.SetNodes_Coord(0, Coord_Edge_CG, Coord_Elem_CG);
+    REQUIRE(vertex2d.GetNormal(0)[0] == Approx(-1.696));
+    REQUIRE(vertex2d.GetNormal(0)[1] == Approx(1.1097));
   }
 
-  CVertex vertex3d(0, 3);
+  CVertexData vertex3d(1, 3);
   SECTION("3D Vertex"){
-    vertex3d.SetNodes_Coord(Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-    REQUIRE(vertex3d.GetNormal()[0] == Approx(-0.0864312));
-    REQUIRE(vertex3d.GetNormal()[1] == Approx(0.0499696));
-    REQUIRE(vertex3d.GetNormal()[2] == Approx(0.111938));
+    vertex3d.SetNodes_Coord(0, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+    REQUIRE(vertex3d.GetNormal(0)[0] == Approx(-0.0864312));
+    REQUIRE(vertex3d.GetNormal(0)[1] == Approx(0.0499696));
+    REQUIRE(vertex3d.GetNormal(0)[2] == Approx(0.111938));
   }
   
 }
@@ -0,0 +1,259 @@
+/*!
+ * \file CSysMatrix_tests.cpp
+ * \brief Unit tests for the block operations and kernels of the sparse matrix.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include <functional>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+namespace {
+
+/*!
+ * \brief Small grid, with edges and point-to-point communications, providing the sparse pattern of the matrices.
+ */
+CPhysicalGeometry* CreateGeometry(CConfig* config) {
+
+  const unsigned short iZone = 0, nZone = 1;
+  CGeometry* geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  geometry_aux->SetColorGrid_Parallel(config);
+
+  auto geometry = new CPhysicalGeometry(geometry_aux, config);
+  delete geometry_aux;
+
+  geometry->SetSendReceive(config);
+  geometry->SetBoundaries(config);
+
+  geometry->SetPoint_Connectivity();
+  geometry->SetEdges();
+
+  geometry->PreprocessP2PComms(geometry, config);
+
+  return geometry;
+}
+
+}
+
+TEST_CASE("Sub-blocks of a block matrix", "[Linear algebra]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "MESH_FORMAT= RECTANGLE" << std::endl;
+  config_options << "MESH_BOX_SIZE= ( 3, 3, 0 )" << std::endl;
+  config_options << "MESH_BOX_LENGTH= ( 1.0, 1.0, 0.0 )" << std::endl;
+  config_options << "MARKER_FAR= ( x_minus, x_plus, y_minus, y_plus )" << std::endl;
+  config_options << "LINEAR_SOLVER_PREC= JACOBI" << std::endl;
+
+  /*--- Setup ---*/
+
+  CConfig* config = new CConfig(config_options, SU2_CFD, false);
+  CPhysicalGeometry* geometry = CreateGeometry(config);
+
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned short nVar = 5, nVarSub = 3;
+
+  CSysMatrix<su2double> A, B;
+  A.Initialize(nPoint, nPoint, nVar, nVar, true, geometry, config);
+  B.Initialize(nPoint, nPoint, nVarSub, nVarSub, true, geometry, config);
+
+  /*--- Distinct values for all entries of both matrices. ---*/
+
+  auto valueA = [](unsigned long iPoint, unsigned long jPoint, unsigned short iVar, unsigned short jVar) {
+    return -(1000.0*iPoint + 100.0*jPoint + 10.0*iVar + jVar);
+  };
+  auto valueB = [](unsigned long iPoint, unsigned long jPoint, unsigned short iVar, unsigned short jVar) {
+    return 1000.0*iPoint + 100.0*jPoint + 10.0*iVar + jVar + 0.5;
+  };
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iNeigh = 0; iNeigh <= geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+      const unsigned long jPoint = (iNeigh < geometry->nodes->GetnPoint(iPoint))?
+                                   geometry->nodes->GetPoint(iPoint, iNeigh) : iPoint;
+      su2double blockA[nVar*nVar], blockB[nVarSub*nVarSub];
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        for (unsigned short jVar = 0; jVar < nVar; jVar++)
+          blockA[iVar*nVar+jVar] = valueA(iPoint, jPoint, iVar, jVar);
+      for (unsigned short iVar = 0; iVar < nVarSub; iVar++)
+        for (unsigned short jVar = 0; jVar < nVarSub; jVar++)
+          blockB[iVar*nVarSub+jVar] = valueB(iPoint, jPoint, iVar, jVar);
+      A.SetBlock(iPoint, jPoint, blockA);
+      B.SetBlock(iPoint, jPoint, blockB);
+    }
+  }
+
+  /*--- Check all the blocks of A against the expected values. ---*/
+
+  auto checkA = [&](const std::function<su2double(unsigned long, unsigned long, unsigned short, unsigned short)>& expected) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iNeigh = 0; iNeigh <= geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+        const unsigned long jPoint = (iNeigh < geometry->nodes->GetnPoint(iPoint))?
+                                     geometry->nodes->GetPoint(iPoint, iNeigh) : iPoint;
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          for (unsigned short jVar = 0; jVar < nVar; jVar++)
+            REQUIRE(A.GetBlock(iPoint, jPoint, iVar, jVar) == expected(iPoint, jPoint, iVar, jVar));
+      }
+    }
+  };
+
+  SECTION("SetSubMatrix") {
+    const unsigned short iOffset = 1, jOffset = 2;
+    A.SetSubMatrix(B, iOffset, jOffset);
+
+    checkA([&](unsigned long iPoint, unsigned long jPoint, unsigned short iVar, unsigned short jVar) {
+      const bool inSub = (iVar >= iOffset) && (iVar < iOffset+nVarSub) && (jVar >= jOffset) && (jVar < jOffset+nVarSub);
+      return inSub? valueB(iPoint, jPoint, iVar-iOffset, jVar-jOffset) : valueA(iPoint, jPoint, iVar, jVar);
+    });
+  }
+
+  SECTION("SetSubBlock") {
+    /*--- A 2x3 sub-block of one off-diagonal block and of one diagonal block. ---*/
+    const unsigned short iOffset = 3, jOffset = 0, nRow = 2, nCol = 3;
+    const su2double subBlock[nRow*nCol] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    const unsigned long iPoint = 4, jPoint = geometry->nodes->GetPoint(iPoint, 0);
+    A.SetSubBlock(iPoint, jPoint, iOffset, jOffset, nRow, nCol, subBlock);
+    A.SetSubBlock(iPoint, iPoint, iOffset, jOffset, nRow, nCol, subBlock);
+
+    checkA([&](unsigned long kPoint, unsigned long lPoint, unsigned short iVar, unsigned short jVar) {
+      const bool inSub = (kPoint == iPoint) && ((lPoint == jPoint) || (lPoint == iPoint)) &&
+                         (iVar >= iOffset) && (iVar < iOffset+nRow) && (jVar >= jOffset) && (jVar < jOffset+nCol);
+      return inSub? subBlock[(iVar-iOffset)*nCol + jVar-jOffset] : valueA(kPoint, lPoint, iVar, jVar);
+    });
+  }
+
+  /*--- Teardown ---*/
+
+  delete geometry;
+  delete config;
+}
+
+TEST_CASE("Block kernels specialized for the block size", "[Linear algebra]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "MESH_FORMAT= RECTANGLE" << std::endl;
+  config_options << "MESH_BOX_SIZE= ( 4, 4, 0 )" << std::endl;
+  config_options << "MESH_BOX_LENGTH= ( 1.0, 1.0, 0.0 )" << std::endl;
+  config_options << "MARKER_FAR= ( x_minus, x_plus, y_minus, y_plus )" << std::endl;
+  config_options << "LINEAR_SOLVER_PREC= ILU" << std::endl;
+
+  /*--- Setup ---*/
+
+  CConfig* config = new CConfig(config_options, SU2_CFD, false);
+  CPhysicalGeometry* geometry = CreateGeometry(config);
+
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+  /*--- Sizes 1 to 5 have specialized kernels, 6 uses the generic ones in both matrices. ---*/
+
+  for (unsigned short nVar = 1; nVar <= 6; nVar++) {
+
+    DYNAMIC_SECTION("Block size " << nVar) {
+
+      /*--- A uses the kernels selected at Initialize, B the generic ones, both have the same
+       *    diagonally dominant entries. ---*/
+
+      CSysMatrix<su2double> A, B;
+      A.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+      B.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+      B.SetGenericBlockKernels();
+
+      su2double block[6*6];
+
+      for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+        for (unsigned short iNeigh = 0; iNeigh <= geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+          const unsigned long jPoint = (iNeigh < geometry->nodes->GetnPoint(iPoint))?
+                                       geometry->nodes->GetPoint(iPoint, iNeigh) : iPoint;
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+              block[iVar*nVar+jVar] = 0.1*cos(1.0*iPoint + 2.0*jPoint + 3.0*iVar + 5.0*jVar);
+              if ((iPoint == jPoint) && (iVar == jVar)) block[iVar*nVar+jVar] += 2.0*nVar + 10.0;
+            }
+          }
+          A.SetBlock(iPoint, jPoint, block);
+          B.SetBlock(iPoint, jPoint, block);
+        }
+      }
+
+      CSysVector<su2double> x(nPoint, nPointDomain, nVar, 0.0), f(nPoint, nPointDomain, nVar, 0.0);
+      CSysVector<su2double> yA(nPoint, nPointDomain, nVar, 0.0), yB(nPoint, nPointDomain, nVar, 0.0);
+
+      for (unsigned long i = 0; i < nPoint*nVar; i++) {
+        x[i] = sin(0.7*i);
+        f[i] = cos(0.3*i);
+      }
+
+      /*--- The operation order is the same, the results must be identical. ---*/
+
+      auto checkEqual = [&]() {
+        for (unsigned long i = 0; i < nPointDomain*nVar; i++) REQUIRE(yA[i] == yB[i]);
+      };
+
+      SECTION("Matrix-vector product") {
+        A.MatrixVectorProduct(x, yA, geometry, config);
+        B.MatrixVectorProduct(x, yB, geometry, config);
+        checkEqual();
+      }
+
+      SECTION("Residual") {
+        A.ComputeResidual(x, f, yA);
+        B.ComputeResidual(x, f, yB);
+        checkEqual();
+      }
+
+      SECTION("Jacobi preconditioner") {
+        A.BuildJacobiPreconditioner();
+        B.BuildJacobiPreconditioner();
+        A.ComputeJacobiPreconditioner(x, yA, geometry, config);
+        B.ComputeJacobiPreconditioner(x, yB, geometry, config);
+        checkEqual();
+      }
+
+      SECTION("ILU preconditioner") {
+        A.BuildILUPreconditioner();
+        B.BuildILUPreconditioner();
+        A.ComputeILUPreconditioner(x, yA, geometry, config);
+        B.ComputeILUPreconditioner(x, yB, geometry, config);
+        checkEqual();
+      }
+
+      SECTION("LU-SGS preconditioner") {
+        A.ComputeLU_SGSPreconditioner(x, yA, geometry, config);
+        B.ComputeLU_SGSPreconditioner(x, yB, geometry, config);
+        checkEqual();
+      }
+    }
+  }
+
+  /*--- Teardown ---*/
+
+  delete geometry;
+  delete config;
+}
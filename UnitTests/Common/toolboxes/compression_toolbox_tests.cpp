@@ -0,0 +1,72 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests for the compression toolbox.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+using namespace CompressionToolbox;
+
+TEST_CASE("LZ4 round trip", "[Compression]") {
+
+  for (size_t n : {0ul, 5ul, 13ul, 1000ul, 100000ul}) {
+    std::vector<uint8_t> raw(n), comp(LZ4CompressBound(n)), decoded(n);
+    for (size_t i = 0; i < n; ++i) raw[i] = uint8_t((i/7)%5 + (i%97 == 0? i%13 : 0));
+
+    const size_t compSize = LZ4Compress(raw.data(), n, comp.data());
+    REQUIRE(compSize <= comp.size());
+    REQUIRE(LZ4Decompress(comp.data(), compSize, decoded.data(), n));
+    REQUIRE(decoded == raw);
+    if (n == 100000) REQUIRE(compSize < n/4);
+  }
+}
+
+TEST_CASE("Compressed block", "[Compression]") {
+
+  const size_t nPoint = 5000, nField = 2;
+  const double tol = 1e-6;
+
+  std::vector<double> fields(nPoint*nField), decoded(nPoint*nField);
+  for (size_t i = 0; i < nPoint; ++i) {
+    fields[i] = std::sin(0.01*i);
+    fields[nPoint + i] = std::cos(0.01*i) + 1e-3*i;
+  }
+  const auto original = fields;
+
+  std::vector<uint8_t> block;
+  CompressBlock(fields.data(), nPoint, {CODEC_SHUFFLE_LZ4, CODEC_QUANTIZED_LZ4}, {0.0, tol}, block);
+  REQUIRE(block.size() < nPoint*nField*sizeof(double));
+
+  REQUIRE(DecompressBlock(block.data(), block.size(), nPoint, nField, decoded.data()));
+
+  for (size_t i = 0; i < nPoint; ++i) {
+    REQUIRE(decoded[i*nField] == original[i]);
+    REQUIRE(std::abs(decoded[i*nField+1] - original[nPoint+i]) <= tol);
+  }
+
+  /*--- Truncated blocks are detected. ---*/
+  REQUIRE_FALSE(DecompressBlock(block.data(), block.size()/2, nPoint, nField, decoded.data()));
+}
@@ -0,0 +1,67 @@
+/*!
+ * \file CLookUpTableGas_tests.cpp
+ * \brief Unit tests for the tabulated fluid model.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/fluid_model.hpp"
+
+namespace {
+/*--- Peng-Robinson model of a siloxane (MDM) in SI units. ---*/
+CFluidModel* NewModel() { return new CPengRobinson(1.0125, 35.152, 1415200.0, 564.1, 0.529); }
+}
+
+TEST_CASE("Tabulated Peng-Robinson gas", "[FluidModel]") {
+
+  CFluidModel* model = NewModel();
+  auto table = make_shared<const CFluidTable>(model, 20.0, 200.0, 450.0, 700.0, 150, 150);
+  CLookUpTableGas lut(NewModel(), table);
+
+  /*--- Interior states, within the interpolation error of the exact model. ---*/
+  for (auto rho : {25.3, 77.7, 140.1, 190.0}) {
+    for (auto T : {480.0, 566.0, 650.0}) {
+      model->SetTDState_rhoT(rho, T);
+      lut.SetTDState_rhoe(rho, model->GetStaticEnergy());
+
+      CHECK(lut.GetPressure() == Approx(model->GetPressure()).epsilon(1e-3));
+      CHECK(lut.GetTemperature() == Approx(model->GetTemperature()).epsilon(1e-4));
+      CHECK(lut.GetSoundSpeed2() == Approx(model->GetSoundSpeed2()).epsilon(1e-3));
+      CHECK(lut.GetdPde_rho() == Approx(model->GetdPde_rho()).epsilon(1e-3));
+
+      /*--- The inversions in (P, rho) and (rho, T) are consistent with the table. ---*/
+      const su2double P = lut.GetPressure(), e = lut.GetStaticEnergy();
+      lut.SetTDState_Prho(P, rho);
+      CHECK(lut.GetStaticEnergy() == Approx(e).epsilon(1e-10));
+      lut.SetTDState_rhoT(rho, T);
+      CHECK(lut.GetTemperature() == Approx(T).epsilon(1e-10));
+    }
+  }
+
+  /*--- Outside of the table the exact model is used. ---*/
+  model->SetTDState_rhoT(300.0, 600.0);
+  lut.SetTDState_rhoe(300.0, model->GetStaticEnergy());
+  CHECK(lut.GetPressure() == model->GetPressure());
+
+  delete model;
+}
@@ -28,6 +28,8 @@
 #include "catch.hpp"
 #include <sstream>
 #include "../../../SU2_CFD/include/numerics/CNumerics.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
 
 TEST_CASE("NTS blending has a minimum of 0.05", "[Upwind/central blending]") {
 
@@ -64,3 +66,178 @@ TEST_CASE("NTS blending has a minimum of 0.05", "[Upwind/central blending]") {
   delete config;
 }
 
+
+TEST_CASE("Viscous residual of a pack of edges matches the edge-wise residual", "[Viscous flux]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= RANS" << std::endl;
+  config_options << "KIND_TURB_MODEL= SA" << std::endl;
+  config_options << "REYNOLDS_NUMBER= 1e6" << std::endl;
+  config_options << "TIME_DISCRE_FLOW= EULER_IMPLICIT" << std::endl;
+
+  /*--- Setup ---*/
+
+  const unsigned short nDim = 3, nVar = nDim+2;
+  using Pack = CAvgGrad_Flow::EdgePack;
+
+  CConfig* config = new CConfig(config_options, SU2_CFD, false);
+
+  CAvgGrad_Flow numerics(nDim, nVar, true, config);
+
+  /*--- Edges of the pack with arbitrary data, the last one has zero length. ---*/
+
+  su2double coord[Pack::SIZE][2][nDim], normal[Pack::SIZE][nDim];
+  su2double prim[Pack::SIZE][2][nDim+7], gradData[Pack::SIZE][2][nDim+1][nDim];
+
+  Pack pack;
+
+  for (unsigned long iLane = 0; iLane < Pack::SIZE; ++iLane) {
+    const su2double f = 1.0 + 0.1*iLane;
+
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      coord[iLane][0][iDim] = 0.1*f*iDim;
+      coord[iLane][1][iDim] = (iLane+1 < Pack::SIZE)? coord[iLane][0][iDim] + 0.2 + 0.05*f*iDim : coord[iLane][0][iDim];
+      normal[iLane][iDim] = 0.3*f - 0.2*iDim;
+    }
+    for (unsigned short iPt = 0; iPt < 2; ++iPt) {
+      const su2double g = f + 0.3*iPt;
+      prim[iLane][iPt][0] = 288.0*g;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) prim[iLane][iPt][iDim+1] = 10.0*g - 5.0*iDim;
+      prim[iLane][iPt][nDim+1] = 1.0e5*g;
+      prim[iLane][iPt][nDim+2] = 1.2*g;
+      prim[iLane][iPt][nDim+3] = 0.0;
+      prim[iLane][iPt][nDim+4] = 0.0;
+      prim[iLane][iPt][nDim+5] = 1.8e-5*g;
+      prim[iLane][iPt][nDim+6] = 3.0e-4*g;
+      for (unsigned short iVar = 0; iVar < nDim+1; ++iVar)
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          gradData[iLane][iPt][iVar][iDim] = g*(iVar+1) - 0.7*iDim;
+    }
+
+    su2double dist2 = 0.0, area = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      pack.Normal[iDim][iLane] = normal[iLane][iDim];
+      pack.EdgeVector[iDim][iLane] = coord[iLane][1][iDim] - coord[iLane][0][iDim];
+      dist2 += pow(pack.EdgeVector[iDim][iLane], 2);
+      area += pow(normal[iLane][iDim], 2);
+    }
+    pack.Dist2[iLane] = dist2;
+    pack.Area[iLane] = sqrt(area);
+
+    for (unsigned short iVar = 0; iVar < nDim+3; ++iVar) {
+      pack.PrimVar_i[iVar][iLane] = prim[iLane][0][iVar];
+      pack.PrimVar_j[iVar][iLane] = prim[iLane][1][iVar];
+    }
+    pack.LamVisc_i[iLane] = prim[iLane][0][nDim+5];  pack.LamVisc_j[iLane] = prim[iLane][1][nDim+5];
+    pack.EddyVisc_i[iLane] = prim[iLane][0][nDim+6]; pack.EddyVisc_j[iLane] = prim[iLane][1][nDim+6];
+
+    for (unsigned short iVar = 0; iVar < nDim+1; ++iVar) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        pack.Grad_i[iVar][iDim][iLane] = gradData[iLane][0][iVar][iDim];
+        pack.Grad_j[iVar][iDim][iLane] = gradData[iLane][1][iVar][iDim];
+      }
+    }
+  }
+
+  /*--- Test ---*/
+
+  REQUIRE(numerics.SupportsEdgePack(config));
+
+  numerics.ComputeResidual(pack, config);
+
+  for (unsigned long iLane = 0; iLane < Pack::SIZE; ++iLane) {
+    su2double* grad_i[nDim+1];
+    su2double* grad_j[nDim+1];
+    for (unsigned short iVar = 0; iVar < nDim+1; ++iVar) {
+      grad_i[iVar] = gradData[iLane][0][iVar];
+      grad_j[iVar] = gradData[iLane][1][iVar];
+    }
+    numerics.SetCoord(coord[iLane][0], coord[iLane][1]);
+    numerics.SetNormal(normal[iLane]);
+    numerics.SetPrimitive(prim[iLane][0], prim[iLane][1]);
+    numerics.SetPrimVarGradient(grad_i, grad_j);
+    numerics.SetTurbKineticEnergy(0.0, 0.0);
+    numerics.SetTauWall(-1.0, -1.0);
+
+    auto residual = numerics.ComputeResidual(config);
+
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      CHECK(pack.Flux[iVar][iLane] == Approx(residual[iVar]).margin(1e-12));
+      for (unsigned short jVar = 0; jVar < nVar; ++jVar) {
+        CHECK(pack.Jacobian_i[iVar][jVar][iLane] == Approx(residual.jacobian_i[iVar][jVar]).margin(1e-12));
+        CHECK(pack.Jacobian_j[iVar][jVar][iLane] == Approx(residual.jacobian_j[iVar][jVar]).margin(1e-12));
+      }
+    }
+  }
+
+  /*--- Teardown ---*/
+
+  delete config;
+}
+
+
+TEST_CASE("Compressibility correction of SA_E_COMP uses c5 = 3.5", "[Turbulence source]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= RANS" << std::endl;
+  config_options << "KIND_TURB_MODEL= SA_E_COMP" << std::endl;
+  config_options << "REYNOLDS_NUMBER= 1e6" << std::endl;
+
+  /*--- Setup ---*/
+
+  const unsigned short nDim = 2;
+
+  CConfig* config = new CConfig(config_options, SU2_CFD, false);
+
+  /*--- Low speed of sound and large SA variable, for a correction comparable to the other terms. ---*/
+
+  su2double prim[] = {288.0, 10.0, 5.0, 1.0, 1.2, 0.0, 0.0, 1.8e-5, 3.0e-4};
+  su2double vorticity[] = {0.0, 0.0, 50.0};
+  su2double gradData[3][2] = {{0.0, 0.0}, {30.0, -17.0}, {45.0, 12.0}};
+  su2double* grad[] = {gradData[0], gradData[1], gradData[2]};
+  su2double turbVar[] = {1.0e-2};
+  su2double turbGradData[2] = {0.01, -0.003};
+  su2double* turbGrad[] = {turbGradData};
+  const su2double distance = 1.0e-3, volume = 1.0e-6;
+
+  auto computeResidual = [&](CNumerics& numerics) {
+    numerics.SetPrimitive(prim, nullptr);
+    numerics.SetPrimVarGradient(grad, nullptr);
+    numerics.SetVorticity(vorticity, nullptr);
+    numerics.SetStrainMag(40.0, 0.0);
+    numerics.SetTurbVar(turbVar, nullptr);
+    numerics.SetTurbVarGradient(turbGrad, nullptr);
+    numerics.SetDistance(distance, 0.0);
+    numerics.SetVolume(volume);
+    auto residual = numerics.ComputeResidual(config);
+    return std::make_pair(residual[0], residual.jacobian_i[0][0]);
+  };
+
+  /*--- Test ---*/
+
+  CSourcePieceWise_TurbSA_E numericsE(nDim, 1, config);
+  CSourcePieceWise_TurbSA_E_COMP numericsEComp(nDim, 1, config);
+
+  const auto resE = computeResidual(numericsE);
+  const auto resEComp = computeResidual(numericsEComp);
+
+  /*--- The correction is -c5 * (nu_tilde/a)^2 * |grad(u)|^2 * volume. ---*/
+
+  const su2double c5 = 3.5;
+  const su2double soundSpeed2 = config->GetGamma()*prim[nDim+1]/prim[nDim+2];
+  su2double norm2GradVel = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    for (unsigned short jDim = 0; jDim < nDim; jDim++)
+      norm2GradVel += pow(gradData[iDim+1][jDim], 2);
+
+  const su2double correction = c5*pow(turbVar[0],2)/soundSpeed2*norm2GradVel*volume;
+
+  CHECK(resEComp.first - resE.first == Approx(-correction).epsilon(1e-8));
+  CHECK(resEComp.second - resE.second == Approx(-2.0*correction/turbVar[0]).epsilon(1e-8));
+
+  /*--- Teardown ---*/
+
+  delete config;
+}
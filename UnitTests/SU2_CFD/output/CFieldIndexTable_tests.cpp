@@ -0,0 +1,61 @@
+/*!
+ * \file CFieldIndexTable_tests.cpp
+ * \brief Unit tests for the hash table of the output field handles.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/output/tools/CFieldIndexTable.hpp"
+
+TEST_CASE("Field keys", "[Output]") {
+
+  /*--- The key of a literal is a constant expression and matches the runtime key. ---*/
+  constexpr CFieldIndexTable::Key key = CFieldIndexTable::GetKey("DENSITY");
+  static_assert(key != CFieldIndexTable::GetKey("DENSITZ"), "Keys of different names should differ.");
+
+  REQUIRE(key == CFieldIndexTable::GetKey(std::string("DENSITY")));
+  REQUIRE(CFieldIndexTable::GetKey("") == CFieldIndexTable::GetKey(std::string()));
+}
+
+TEST_CASE("Field index table", "[Output]") {
+
+  CFieldIndexTable table;
+  REQUIRE(table.Find(CFieldIndexTable::GetKey("DENSITY")) == CFieldIndexTable::NOT_FOUND);
+
+  /*--- Insert enough fields to trigger a few rehashes. ---*/
+  const unsigned short nFields = 1000;
+  for (unsigned short i = 0; i < nFields; ++i) {
+    const auto key = CFieldIndexTable::GetKey("FIELD_" + std::to_string(i));
+    REQUIRE(table.Insert(key, i) == i);
+  }
+  REQUIRE(table.size() == nFields);
+
+  for (unsigned short i = 0; i < nFields; ++i) {
+    const auto key = CFieldIndexTable::GetKey("FIELD_" + std::to_string(i));
+    REQUIRE(table.Find(key) == i);
+    /*--- Inserting an existing key keeps its handle. ---*/
+    REQUIRE(table.Insert(key, nFields) == i);
+  }
+  REQUIRE(table.size() == nFields);
+  REQUIRE(table.Find(CFieldIndexTable::GetKey("FIELD_1000")) == CFieldIndexTable::NOT_FOUND);
+}
@@ -0,0 +1,404 @@
+/*!
+ * \file CTurbSolver_tests.cpp
+ * \brief Unit tests for the turbulence solvers.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../SU2_CFD/include/solvers/CNSSolver.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSASolver.hpp"
+#include "../../../SU2_CFD/include/solvers/CTurbSSTSolver.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+
+namespace {
+
+/*!
+ * \brief Small grid with its dual grid and point-to-point communications.
+ */
+CPhysicalGeometry* CreateGeometry(CConfig* config) {
+
+  const unsigned short iZone = 0, nZone = 1;
+  CGeometry* geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  geometry_aux->SetColorGrid_Parallel(config);
+
+  auto geometry = new CPhysicalGeometry(geometry_aux, config);
+  delete geometry_aux;
+
+  geometry->SetSendReceive(config);
+  geometry->SetBoundaries(config);
+
+  geometry->SetPoint_Connectivity();
+  geometry->SetElement_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->SetEdges();
+  geometry->SetVertex(config);
+  geometry->SetCoord_CG();
+  geometry->SetControlVolume(config, ALLOCATE);
+  geometry->SetBoundControlVolume(config, ALLOCATE);
+
+  geometry->PreprocessP2PComms(geometry, config);
+
+  return geometry;
+}
+
+/*!
+ * \brief Config of a small RANS problem with a wall at the bottom, the number of points (45) is not
+ *        a multiple of the size of the packs of points of the turbulence source terms.
+ */
+CConfig* CreateConfig(const string& turbModel, bool coupled) {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= RANS" << std::endl;
+  config_options << "KIND_TURB_MODEL= " << turbModel << std::endl;
+  config_options << "MACH_NUMBER= 0.3" << std::endl;
+  config_options << "REYNOLDS_NUMBER= 1e5" << std::endl;
+  config_options << "MESH_FORMAT= RECTANGLE" << std::endl;
+  config_options << "MESH_BOX_SIZE= ( 9, 5, 0 )" << std::endl;
+  config_options << "MESH_BOX_LENGTH= ( 1.0, 0.1, 0.0 )" << std::endl;
+  config_options << "MARKER_HEATFLUX= ( y_minus, 0.0 )" << std::endl;
+  config_options << "MARKER_FAR= ( x_minus, x_plus, y_plus )" << std::endl;
+  config_options << "TIME_DISCRE_FLOW= EULER_IMPLICIT" << std::endl;
+  config_options << "TIME_DISCRE_TURB= EULER_IMPLICIT" << std::endl;
+  config_options << "CFL_NUMBER= 10" << std::endl;
+  config_options << "COUPLED_TURB_SOLVE= " << (coupled? "YES" : "NO") << std::endl;
+  config_options << "LINEAR_SOLVER= FGMRES" << std::endl;
+  config_options << "LINEAR_SOLVER_PREC= ILU" << std::endl;
+  config_options << "LINEAR_SOLVER_ERROR= 1e-14" << std::endl;
+  config_options << "LINEAR_SOLVER_ITER= 300" << std::endl;
+
+  return new CConfig(config_options, SU2_CFD, false);
+}
+
+/*!
+ * \brief Sets arbitrary, non-uniform, flow and turbulence variables and gradients, and wall distances
+ *        (the distance to the bottom plus an offset, SST is singular at zero distance).
+ */
+void SetSourceData(CGeometry* geometry, CSolver** solvers, CConfig* config, su2double wallOffset) {
+
+  CSolver* flowSolver = solvers[FLOW_SOL];
+  CSolver* turbSolver = solvers[TURB_SOL];
+  CVariable* flowNodes = flowSolver->GetNodes();
+  CVariable* turbNodes = turbSolver->GetNodes();
+
+  const unsigned short nDim = geometry->GetnDim();
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+
+    const su2double f = 1.0 + 0.05*sin(1.0+iPoint);
+    for (unsigned short iVar = 0; iVar < flowSolver->GetnVar(); iVar++)
+      flowNodes->SetSolution(iPoint, iVar, flowNodes->GetSolution(iPoint,iVar) * f);
+
+    for (unsigned short iVar = 0; iVar < flowSolver->GetnPrimVarGrad(); iVar++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        flowNodes->SetGradient_Primitive(iPoint, iVar, iDim, 100.0*sin(2.0*iPoint + 3.0*iVar - iDim));
+
+    for (unsigned short iVar = 0; iVar < turbSolver->GetnVar(); iVar++) {
+      turbNodes->SetSolution(iPoint, iVar, turbNodes->GetSolution(iPoint,iVar) * (2.0-f));
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        turbNodes->SetGradient(iPoint, iVar, iDim, turbNodes->GetSolution(iPoint,iVar) * 10.0*cos(iPoint + iVar + iDim));
+    }
+
+    geometry->nodes->SetWall_Distance(iPoint, geometry->nodes->GetCoord(iPoint, 1) + wallOffset);
+  }
+
+  flowSolver->SetPrimitive_Variables(solvers, config, false);
+  flowNodes->SetVorticity_StrainMag();
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    turbNodes->SetBlendingFunc(iPoint, flowNodes->GetLaminarViscosity(iPoint),
+                               geometry->nodes->GetWall_Distance(iPoint), flowNodes->GetDensity(iPoint));
+}
+
+/*!
+ * \brief Evaluates the source residual of the turbulence solver, by packs of points, and checks it
+ *        against the point-wise residual of the same numerics.
+ */
+template<class SourceNumerics>
+void CheckSourceResidual(CGeometry* geometry, CSolver** solvers, CConfig* config, SourceNumerics& numerics) {
+
+  CSolver* turbSolver = solvers[TURB_SOL];
+  CVariable* flowNodes = solvers[FLOW_SOL]->GetNodes();
+  CVariable* turbNodes = turbSolver->GetNodes();
+
+  REQUIRE(numerics.SupportsPointPack(config));
+
+  CNumerics* numerics_container[MAX_TERMS] = {nullptr};
+  numerics_container[SOURCE_FIRST_TERM] = &numerics;
+
+  turbSolver->LinSysRes.SetValZero();
+  turbSolver->Jacobian.SetValZero();
+
+  turbSolver->Source_Residual(geometry, solvers, numerics_container, config, MESH_0);
+
+  const unsigned short nVar = turbSolver->GetnVar();
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+
+    numerics.SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+    numerics.SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+    numerics.SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+    numerics.SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+    numerics.SetTurbVar(turbNodes->GetSolution(iPoint), nullptr);
+    numerics.SetTurbVarGradient(turbNodes->GetGradient(iPoint), nullptr);
+    numerics.SetF1blending(turbNodes->GetF1blending(iPoint), 0.0);
+    numerics.SetF2blending(turbNodes->GetF2blending(iPoint), 0.0);
+    numerics.SetCrossDiff(turbNodes->GetCrossDiff(iPoint), 0.0);
+    numerics.SetDistance(geometry->nodes->GetWall_Distance(iPoint), 0.0);
+    numerics.SetVolume(geometry->nodes->GetVolume(iPoint));
+
+    auto residual = numerics.ComputeResidual(config);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      CHECK(turbSolver->LinSysRes(iPoint,iVar) == Approx(-residual[iVar]).epsilon(1e-12));
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        CHECK(turbSolver->Jacobian.GetBlock(iPoint, iPoint, iVar, jVar) ==
+              Approx(-residual.jacobian_i[iVar][jVar]).epsilon(1e-12));
+    }
+  }
+}
+
+}
+
+TEST_CASE("Coupled system of the flow and turbulence equations", "[Coupled turbulence]") {
+
+  /*--- Setup ---*/
+
+  CConfig* config = CreateConfig("SA", true);
+  CPhysicalGeometry* geometry = CreateGeometry(config);
+
+  CSolver* solvers[MAX_SOLS] = {nullptr};
+  solvers[FLOW_SOL] = new CNSSolver(geometry, config, MESH_0);
+  solvers[TURB_SOL] = new CTurbSASolver(geometry, config, MESH_0, solvers[FLOW_SOL]->GetFluidModel());
+
+  CSolver* flowSolver = solvers[FLOW_SOL];
+  CSolver* turbSolver = solvers[TURB_SOL];
+  CVariable* flowNodes = flowSolver->GetNodes();
+  CVariable* turbNodes = turbSolver->GetNodes();
+
+  const unsigned long nPoint = geometry->GetnPoint();
+  const unsigned short nDim = geometry->GetnDim();
+  const unsigned short nVarFlow = flowSolver->GetnVar(), nVarTurb = turbSolver->GetnVar();
+
+  /*--- Non-uniform flow, the vertical velocity does not change sign to keep the upwind directions. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    const su2double f = 1.0 + 0.05*sin(1.0+iPoint);
+    const su2double density = flowNodes->GetSolution(iPoint,0) * f;
+    const su2double momentum = flowNodes->GetSolution(iPoint,1) * f*f;
+    flowNodes->SetSolution(iPoint, 0, density);
+    flowNodes->SetSolution(iPoint, 1, momentum);
+    flowNodes->SetSolution(iPoint, 2, 0.1*momentum*(1.0+0.5*cos(2.0*iPoint)));
+    turbNodes->SetSolution(iPoint, 0, turbNodes->GetSolution(iPoint,0) * (2.0-f));
+  }
+  flowSolver->Set_OldSolution();
+  turbSolver->Set_OldSolution();
+
+  flowSolver->SetPrimitive_Variables(solvers, config, false);
+  flowSolver->SetTime_Step(geometry, solvers, config, MESH_0, 0);
+
+  /*--- Jacobians with diagonal dominance and non-zero off-diagonal blocks, and residuals. ---*/
+
+  auto FillSystem = [&](CSolver* solver, su2double scale) {
+    const unsigned short nVar = solver->GetnVar();
+    solver->Jacobian.SetValZero();
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+        const unsigned long jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+        std::vector<su2double> block(nVar*nVar);
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
+          for (unsigned short jVar = 0; jVar < nVar; jVar++)
+            block[iVar*nVar+jVar] = scale*(0.1 + 0.05*sin(iPoint + 3.0*jPoint + iVar - jVar));
+        solver->Jacobian.SetBlock(iPoint, jPoint, block.data());
+        solver->Jacobian.AddVal2Diag(iPoint, scale);
+      }
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        solver->LinSysRes(iPoint,iVar) = scale*cos(0.3*iPoint + iVar);
+    }
+  };
+  FillSystem(flowSolver, 1.0);
+  FillSystem(turbSolver, 1.0e-3);
+
+  /*--- Test ---*/
+
+  /*--- The flow iteration only prepares its system, the turbulence one solves both. ---*/
+
+  flowSolver->ImplicitEuler_Iteration(geometry, solvers, config);
+  turbSolver->ImplicitEuler_Iteration(geometry, solvers, config);
+
+  /*--- Upwind convective flux of the turbulence variables, q_ij * T_upwind, at the flow state
+   *    before the update displaced by eps times the increments of the flow variables. ---*/
+
+  auto TurbulenceFlux = [&](su2double eps) {
+    std::vector<su2double> flux(nPoint, 0.0);
+    for (unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      const unsigned long iPoint = geometry->edges->GetNode(iEdge,0);
+      const unsigned long jPoint = geometry->edges->GetNode(iEdge,1);
+      const su2double* Normal = geometry->edges->GetNormal(iEdge);
+      su2double q_ij = 0.0;
+      for (auto kPoint : {iPoint, jPoint}) {
+        const su2double density = flowNodes->GetSolution_Old(kPoint,0) + eps*flowSolver->LinSysSol(kPoint,0);
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          const su2double momentum = flowNodes->GetSolution_Old(kPoint,iDim+1) + eps*flowSolver->LinSysSol(kPoint,iDim+1);
+          q_ij += 0.5*momentum/density*Normal[iDim];
+        }
+      }
+      const unsigned long upwPoint = (q_ij > 0.0)? iPoint : jPoint;
+      const su2double edgeFlux = q_ij * turbNodes->GetSolution_Old(upwPoint,0);
+      flux[iPoint] += edgeFlux;
+      flux[jPoint] -= edgeFlux;
+    }
+    return flux;
+  };
+
+  su2double maxRelIncrement = 0.0;
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++)
+    for (unsigned short iVar = 0; iVar <= nDim; iVar++)
+      maxRelIncrement = max(maxRelIncrement, fabs(flowSolver->LinSysSol(iPoint,iVar)) /
+                                             fabs(flowNodes->GetSolution_Old(iPoint,0)));
+  const su2double eps = 1e-6 / maxRelIncrement;
+
+  const auto fluxPlus = TurbulenceFlux(eps);
+  const auto fluxMinus = TurbulenceFlux(-eps);
+
+  /*--- The increments must satisfy the flow equations, and the turbulence equations with the
+   *    coupling term, i.e. the derivative of the flux along the increments of the flow variables. ---*/
+
+  auto MatrixVectorProduct = [&](const CSolver* solver, unsigned long iPoint, unsigned short iVar) {
+    const unsigned short nVar = solver->GetnVar();
+    su2double product = 0.0;
+    for (unsigned short jVar = 0; jVar < nVar; jVar++)
+      product += solver->Jacobian.GetBlock(iPoint, iPoint, iVar, jVar) * solver->LinSysSol(iPoint,jVar);
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); iNeigh++) {
+      const unsigned long jPoint = geometry->nodes->GetPoint(iPoint, iNeigh);
+      for (unsigned short jVar = 0; jVar < nVar; jVar++)
+        product += solver->Jacobian.GetBlock(iPoint, jPoint, iVar, jVar) * solver->LinSysSol(jPoint,jVar);
+    }
+    return product;
+  };
+
+  su2double maxCoupling = 0.0;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVarFlow; iVar++)
+      CHECK(MatrixVectorProduct(flowSolver, iPoint, iVar) ==
+            Approx(flowSolver->LinSysRes(iPoint,iVar)).margin(1e-10));
+
+    const su2double coupling = (fluxPlus[iPoint] - fluxMinus[iPoint]) / (2*eps);
+    maxCoupling = max(maxCoupling, fabs(coupling));
+
+    for (unsigned short iVar = 0; iVar < nVarTurb; iVar++)
+      CHECK(MatrixVectorProduct(turbSolver, iPoint, iVar) + coupling ==
+            Approx(turbSolver->LinSysRes(iPoint,iVar)).margin(1e-10));
+  }
+
+  /*--- Otherwise the above does not test the coupling. ---*/
+
+  REQUIRE(maxCoupling > 1e-4);
+
+  /*--- Teardown ---*/
+
+  delete solvers[TURB_SOL];
+  delete solvers[FLOW_SOL];
+  delete geometry;
+  delete config;
+}
+
+TEST_CASE("Source residual by packs of points matches the point-wise residual", "[Turbulence source]") {
+
+  SECTION("SA") {
+
+    /*--- Setup ---*/
+
+    CConfig* config = CreateConfig("SA", false);
+    CPhysicalGeometry* geometry = CreateGeometry(config);
+
+    CSolver* solvers[MAX_SOLS] = {nullptr};
+    solvers[FLOW_SOL] = new CNSSolver(geometry, config, MESH_0);
+    solvers[TURB_SOL] = new CTurbSASolver(geometry, config, MESH_0, solvers[FLOW_SOL]->GetFluidModel());
+
+    SetSourceData(geometry, solvers, config, 0.0);
+
+    const unsigned short nDim = geometry->GetnDim();
+
+    /*--- Test, the variants share the solver. ---*/
+
+    CSourcePieceWise_TurbSA numericsSA(nDim, 1, config);
+    CheckSourceResidual(geometry, solvers, config, numericsSA);
+
+    CSourcePieceWise_TurbSA_COMP numericsComp(nDim, 1, config);
+    CheckSourceResidual(geometry, solvers, config, numericsComp);
+
+    CSourcePieceWise_TurbSA_E numericsE(nDim, 1, config);
+    CheckSourceResidual(geometry, solvers, config, numericsE);
+
+    CSourcePieceWise_TurbSA_E_COMP numericsEComp(nDim, 1, config);
+    CheckSourceResidual(geometry, solvers, config, numericsEComp);
+
+    /*--- Negative values of the variable for the negative SA model. ---*/
+
+    for (unsigned long iPoint = 10; iPoint < 20; iPoint++)
+      solvers[TURB_SOL]->GetNodes()->SetSolution(iPoint, 0, -solvers[TURB_SOL]->GetNodes()->GetSolution(iPoint,0));
+
+    CSourcePieceWise_TurbSA_Neg numericsNeg(nDim, 1, config);
+    CheckSourceResidual(geometry, solvers, config, numericsNeg);
+
+    /*--- Teardown ---*/
+
+    delete solvers[TURB_SOL];
+    delete solvers[FLOW_SOL];
+    delete geometry;
+    delete config;
+  }
+
+  SECTION("SST") {
+
+    /*--- Setup ---*/
+
+    CConfig* config = CreateConfig("SST", false);
+    CPhysicalGeometry* geometry = CreateGeometry(config);
+
+    CSolver* solvers[MAX_SOLS] = {nullptr};
+    solvers[FLOW_SOL] = new CNSSolver(geometry, config, MESH_0);
+    solvers[TURB_SOL] = new CTurbSSTSolver(geometry, config, MESH_0);
+
+    SetSourceData(geometry, solvers, config, 1.0e-4);
+
+    /*--- Test ---*/
+
+    CSourcePieceWise_TurbSST numerics(geometry->GetnDim(), 2, solvers[TURB_SOL]->GetConstants(),
+                                      solvers[TURB_SOL]->GetTke_Inf(), solvers[TURB_SOL]->GetOmega_Inf(), config);
+    CheckSourceResidual(geometry, solvers, config, numerics);
+
+    /*--- Teardown ---*/
+
+    delete solvers[TURB_SOL];
+    delete solvers[FLOW_SOL];
+    delete geometry;
+    delete config;
+  }
+}
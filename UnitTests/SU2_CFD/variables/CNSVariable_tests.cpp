@@ -0,0 +1,180 @@
+/*!
+ * \file CNSVariable_tests.cpp
+ * \brief Unit tests for the primitive variables of the compressible flow solvers.
+ * \version 7.0.5 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../SU2_CFD/include/fluid_model.hpp"
+#include "../../../SU2_CFD/include/variables/CNSVariable.hpp"
+
+namespace {
+
+/*!
+ * \brief Sets the same conservative variables in both containers, from states in a range of density
+ *        and temperature, plus one point with negative density (its old solution is physical).
+ */
+void SetStates(CFluidModel* model, su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax,
+               unsigned long nPoint, const su2double* turb_ke, CVariable* nodes1, CVariable* nodes2) {
+
+  for (auto nodes : {nodes1, nodes2}) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+
+      const su2double rho = rhoMin + (rhoMax-rhoMin)*(0.5+0.5*sin(1.0+iPoint));
+      const su2double T = TMin + (TMax-TMin)*(0.5+0.5*cos(2.0*iPoint));
+      model->SetTDState_rhoT(rho, T);
+
+      const su2double u = 50.0*sin(0.5*iPoint), v = 20.0*cos(0.3*iPoint);
+      const su2double energy = model->GetStaticEnergy() + 0.5*(u*u+v*v) + turb_ke[iPoint];
+
+      nodes->SetSolution(iPoint, 0, rho);
+      nodes->SetSolution(iPoint, 1, rho*u);
+      nodes->SetSolution(iPoint, 2, rho*v);
+      nodes->SetSolution(iPoint, 3, rho*energy);
+    }
+    nodes->Set_OldSolution();
+
+    nodes->SetSolution(5, 0, -nodes->GetSolution(5, 0));
+  }
+}
+
+/*!
+ * \brief Compares all the primitive and secondary variables of two containers.
+ */
+void CheckVariables(unsigned short nDim, unsigned long nPoint, CVariable* batched, CVariable* scalar) {
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nDim+9; iVar++)
+      CHECK(batched->GetPrimitive(iPoint)[iVar] == Approx(scalar->GetPrimitive(iPoint)[iVar]).epsilon(1e-12));
+    for (unsigned short iVar = 0; iVar < 8; iVar++)
+      CHECK(batched->GetSecondary(iPoint)[iVar] == Approx(scalar->GetSecondary(iPoint)[iVar]).epsilon(1e-12));
+    for (unsigned short iVar = 0; iVar < nDim+2; iVar++)
+      CHECK(batched->GetSolution(iPoint, iVar) == scalar->GetSolution(iPoint, iVar));
+  }
+}
+
+/*!
+ * \brief Updates the variables of the points by batches and point by point, for CEulerVariable and
+ *        CNSVariable, and compares the results. The points are split into a full and a partial batch.
+ */
+void CheckBatchedPrimVar(CFluidModel* model, CConfig* config,
+                         su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax) {
+
+  const unsigned short nDim = 2, nVar = 4;
+  constexpr unsigned long MAXBATCH = CEulerVariable::MAXBATCH;
+  constexpr unsigned long nPoint = MAXBATCH + 10;
+  const su2double velocity[] = {0.0, 0.0};
+
+  model->SetLaminarViscosityModel(config);
+  model->SetThermalConductivityModel(config);
+
+  su2double eddy_visc[nPoint], turb_ke[nPoint], zero[nPoint] = {0.0};
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    eddy_visc[iPoint] = 1.0e-4*(1.0+sin(3.0*iPoint));
+    turb_ke[iPoint] = 10.0*(1.0+cos(iPoint));
+  }
+
+  SECTION("Euler") {
+    CEulerVariable batched(1.0, velocity, 1.0, nPoint, nDim, nVar, config);
+    CEulerVariable scalar(1.0, velocity, 1.0, nPoint, nDim, nVar, config);
+    SetStates(model, rhoMin, rhoMax, TMin, TMax, nPoint, zero, &batched, &scalar);
+
+    unsigned long nonPhysical = 0;
+    for (unsigned long iPointBegin = 0; iPointBegin < nPoint; iPointBegin += MAXBATCH)
+      nonPhysical += batched.SetPrimVar(iPointBegin, min(nPoint, iPointBegin+MAXBATCH), model);
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      CHECK(scalar.SetPrimVar(iPoint, model) == (iPoint != 5));
+      scalar.SetSecondaryVar(iPoint, model);
+    }
+
+    CHECK(nonPhysical == 1);
+    CheckVariables(nDim, nPoint, &batched, &scalar);
+  }
+
+  SECTION("Navier-Stokes") {
+    CNSVariable batched(1.0, velocity, 1.0, nPoint, nDim, nVar, config);
+    CNSVariable scalar(1.0, velocity, 1.0, nPoint, nDim, nVar, config);
+    SetStates(model, rhoMin, rhoMax, TMin, TMax, nPoint, turb_ke, &batched, &scalar);
+
+    unsigned long nonPhysical = 0;
+    for (unsigned long iPointBegin = 0; iPointBegin < nPoint; iPointBegin += MAXBATCH)
+      nonPhysical += batched.SetPrimVar(iPointBegin, min(nPoint, iPointBegin+MAXBATCH),
+                                        &eddy_visc[iPointBegin], &turb_ke[iPointBegin], model);
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      CHECK(scalar.SetPrimVar(iPoint, eddy_visc[iPoint], turb_ke[iPoint], model) == (iPoint != 5));
+      scalar.SetSecondaryVar(iPoint, model);
+    }
+
+    CHECK(nonPhysical == 1);
+    CheckVariables(nDim, nPoint, &batched, &scalar);
+  }
+}
+
+}
+
+TEST_CASE("Batched update of the primitive variables matches the point-wise update", "[Primitive variables]") {
+
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NAVIER_STOKES" << std::endl;
+  config_options << "REYNOLDS_NUMBER= 1e6" << std::endl;
+  config_options << "VISCOSITY_MODEL= SUTHERLAND" << std::endl;
+  config_options << "CONDUCTIVITY_MODEL= CONSTANT_PRANDTL" << std::endl;
+
+  /*--- Setup, dimensional values. ---*/
+
+  CConfig* config = new CConfig(config_options, SU2_CFD, false);
+  config->SetMu_RefND(1.716e-5);
+  config->SetMu_Temperature_RefND(273.15);
+  config->SetMu_SND(110.4);
+
+  /*--- Test, air as an ideal gas and a siloxane (MDM) with the real gas models. ---*/
+
+  SECTION("Ideal gas") {
+    CIdealGas model(1.4, 287.058, false);
+    CheckBatchedPrimVar(&model, config, 0.5, 2.0, 250.0, 400.0);
+  }
+  SECTION("Van der Waals gas") {
+    CVanDerWaalsGas model(1.0125, 35.152, 1415200.0, 564.1);
+    CheckBatchedPrimVar(&model, config, 25.0, 190.0, 580.0, 690.0);
+  }
+  SECTION("Peng-Robinson gas") {
+    CPengRobinson model(1.0125, 35.152, 1415200.0, 564.1, 0.529);
+    CheckBatchedPrimVar(&model, config, 25.0, 190.0, 580.0, 690.0);
+  }
+  SECTION("Tabulated gas") {
+    CFluidModel* tableModel = new CPengRobinson(1.0125, 35.152, 1415200.0, 564.1, 0.529);
+    auto table = make_shared<const CFluidTable>(tableModel, 20.0, 200.0, 450.0, 700.0, 50, 50);
+    delete tableModel;
+    CLookUpTableGas model(new CPengRobinson(1.0125, 35.152, 1415200.0, 564.1, 0.529), table);
+    CheckBatchedPrimVar(&model, config, 25.0, 190.0, 580.0, 690.0);
+  }
+
+  /*--- Teardown ---*/
+
+  delete config;
+}